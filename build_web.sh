@@ -13,10 +13,11 @@ ensure_command() {
 
 ensure_command npm
 ensure_command pnpm
+ensure_command python3
 
 cd "${PROJECT_ROOT}/web"
 
 pnpm install
 pnpm run build
 
-npx svelteesp32 -e espidf -s ../web/dist -o ../main/include/svelteesp32.h --etag=true
+python3 ../tools/web_assets.py header --dist ./dist --out ../main/include/web_assets.h
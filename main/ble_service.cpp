@@ -2,15 +2,19 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstdio>
 #include <inttypes.h>
+#include <limits>
 #include <string>
 #include <utility>
 
 #include "esp_log.h"
-#include "host/ble_hs.h"
+#include "esp_timer.h"
 #include "host/ble_hs_adv.h"
 
+#include "services/metrics/metrics.hh"
+
 namespace {
 std::string toString(const NimBLEAddress& address) {
     return address.toString();
@@ -28,6 +32,65 @@ constexpr uint16_t    kHidProtocolModeUuid = 0x2A4E;
 constexpr uint16_t    kBootKeyboardInputUuid  = 0x2A22;
 constexpr uint16_t    kBootKeyboardOutputUuid = 0x2A32;
 constexpr uint16_t    kReportReferenceDescriptorUuid = 0x2908;
+constexpr uint16_t    kAttNotifyOverhead  = 3; // Opcode and handle
+constexpr uint32_t    kPollTaskStack      = 4096; // connect() and discovery run on it
+constexpr UBaseType_t kPollTaskPriority   = 5;
+
+// Riding: scan continuously so the controller is found at once. Parked: a
+// 30 ms window every 1.28 s (about 2 % duty) still catches a controller
+// that powers up, at a fraction of the radio time.
+constexpr uint16_t    kRidingScanIntervalMs = 100;
+constexpr uint16_t    kRidingScanWindowMs   = 100;
+constexpr uint16_t    kParkedScanIntervalMs = 1280;
+constexpr uint16_t    kParkedScanWindowMs   = 30;
+
+class MutexGuard {
+  public:
+    explicit MutexGuard(SemaphoreHandle_t mutex) : mutex_(mutex) { xSemaphoreTake(mutex_, portMAX_DELAY); }
+    ~MutexGuard() { xSemaphoreGive(mutex_); }
+
+    MutexGuard(const MutexGuard&)            = delete;
+    MutexGuard& operator=(const MutexGuard&) = delete;
+
+  private:
+    SemaphoreHandle_t mutex_;
+};
+
+uint32_t nowMs() {
+    return static_cast<uint32_t>(esp_timer_get_time() / 1000);
+}
+
+template <typename T>
+T saturate(float value) {
+    const float lo = static_cast<float>(std::numeric_limits<T>::min());
+    const float hi = static_cast<float>(std::numeric_limits<T>::max());
+    return static_cast<T>(std::llround(std::clamp(value, lo, hi)));
+}
+
+void putUint16LE(uint8_t* out, uint16_t value) {
+    out[0] = static_cast<uint8_t>(value);
+    out[1] = static_cast<uint8_t>(value >> 8);
+}
+
+void putUint32LE(uint8_t* out, uint32_t value) {
+    putUint16LE(out, static_cast<uint16_t>(value));
+    putUint16LE(out + 2, static_cast<uint16_t>(value >> 16));
+}
+
+// Layout documented at BleService::kTelemetryRecordSize.
+void encodeTelemetryRecord(const TelemetryState& state, uint32_t timeMs, uint8_t* out) {
+    const ControllerData& data = state.data;
+    putUint32LE(&out[0], timeMs);
+    putUint16LE(&out[4], data.rpm);
+    putUint16LE(&out[6], saturate<uint16_t>(data.speedKph * 100.0f));
+    putUint16LE(&out[8], static_cast<uint16_t>(saturate<int16_t>(data.powerKw * 1000.0f)));
+    putUint16LE(&out[10], saturate<uint16_t>(data.voltage * 100.0f));
+    putUint32LE(&out[12], saturate<uint32_t>(state.distanceKm * 1000.0f));
+    out[16] = static_cast<uint8_t>(std::min<uint16_t>(data.throttle >> 4, 0xFF));
+    out[17] = data.gear;
+    out[18] = static_cast<uint8_t>(saturate<int8_t>(data.controllerC));
+    out[19] = static_cast<uint8_t>(saturate<int8_t>(data.motorC));
+}
 } // namespace
 
 class BleService::ClientCallbacks : public NimBLEClientCallbacks {
@@ -80,6 +143,10 @@ class BleService::ServerCallbacks : public NimBLEServerCallbacks {
         service_.handleServerDisconnect(connInfo.getConnHandle());
     }
 
+    void onMTUChange(uint16_t mtu, NimBLEConnInfo& connInfo) override {
+        service_.handleMtuChange(connInfo.getConnHandle(), mtu);
+    }
+
     uint32_t onPassKeyDisplay() override {
         ESP_LOGI(kLogTag, "Server displaying passkey %06" PRIu32, BleService::kPairingPasskey);
         return BleService::kPairingPasskey;
@@ -115,6 +182,27 @@ class BleService::CharacteristicCallbacks : public NimBLECharacteristicCallbacks
     BleService& service_;
 };
 
+class BleService::TelemetryCallbacks : public NimBLECharacteristicCallbacks {
+  public:
+    explicit TelemetryCallbacks(BleService& service) : service_(service) {}
+
+    void onRead(NimBLECharacteristic* characteristic, NimBLEConnInfo& /*connInfo*/) override {
+        service_.handleTelemetryRead(characteristic);
+    }
+
+    void onWrite(NimBLECharacteristic* characteristic, NimBLEConnInfo& connInfo) override {
+        const NimBLEAttValue& value = characteristic->getValue();
+        service_.handleTelemetryWrite(connInfo.getConnHandle(), value.data(), value.size());
+    }
+
+    void onSubscribe(NimBLECharacteristic* /*characteristic*/, NimBLEConnInfo& connInfo, uint16_t subValue) override {
+        service_.handleTelemetrySubscribe(connInfo.getConnHandle(), subValue);
+    }
+
+  private:
+    BleService& service_;
+};
+
 BleService* BleService::instance_ = nullptr;
 
 BleService::BleService(uint32_t scanTimeMs) : scanTimeMs_(scanTimeMs) {
@@ -163,6 +251,9 @@ BleService::~BleService() {
     if (instance_ == this) {
         instance_ = nullptr;
     }
+    if (telemetryMutex_ != nullptr) {
+        vSemaphoreDelete(telemetryMutex_);
+    }
 }
 
 void BleService::addClientTarget(ClientTarget target) {
@@ -178,14 +269,33 @@ void BleService::enableHidServer(bool enable) {
     hidServerEnabled_ = enable;
 }
 
+void BleService::enableTelemetryServer(TelemetryConfig config) {
+    telemetryConfig_ = std::move(config);
+    telemetryConfig_.sampleIntervalMs = std::max<uint16_t>(telemetryConfig_.sampleIntervalMs, 1);
+    telemetryConfig_.maxNotifyIntervalMs =
+        std::max(telemetryConfig_.maxNotifyIntervalMs, telemetryConfig_.minNotifyIntervalMs);
+    telemetryConfig_.defaultNotifyIntervalMs = std::clamp(telemetryConfig_.defaultNotifyIntervalMs,
+                                                          telemetryConfig_.minNotifyIntervalMs,
+                                                          telemetryConfig_.maxNotifyIntervalMs);
+    telemetryEnabled_ = true;
+}
+
 void BleService::init() {
     clientCallbacks_ = std::make_unique<ClientCallbacks>(*this);
     scanCallbacks_   = std::make_unique<ScanCallbacks>(*this);
 
+    if (serverConfigured_ || hidServerEnabled_ || telemetryEnabled_) {
+        serverCallbacks_ = std::make_unique<ServerCallbacks>(*this);
+    }
     if (serverConfigured_) {
-        serverCallbacks_         = std::make_unique<ServerCallbacks>(*this);
         characteristicCallbacks_ = std::make_unique<CharacteristicCallbacks>(*this);
     }
+    if (telemetryEnabled_) {
+        telemetryCallbacks_ = std::make_unique<TelemetryCallbacks>(*this);
+        if (telemetryMutex_ == nullptr) {
+            telemetryMutex_ = xSemaphoreCreateMutex();
+        }
+    }
 
     NimBLEDevice::init(kDefaultDeviceName);
     NimBLEDevice::setPower(3);
@@ -197,8 +307,8 @@ void BleService::init() {
 
     NimBLEScan* scan = NimBLEDevice::getScan();
     scan->setScanCallbacks(scanCallbacks_.get(), false);
-    scan->setInterval(100);
-    scan->setWindow(100);
+    scan->setInterval(lowPowerScan_ ? kParkedScanIntervalMs : kRidingScanIntervalMs);
+    scan->setWindow(lowPowerScan_ ? kParkedScanWindowMs : kRidingScanWindowMs);
     scan->setActiveScan(true);
     scan->start(scanTimeMs_);
     ESP_LOGI(kLogTag, "Scanning for peripherals");
@@ -221,8 +331,31 @@ void BleService::poll() {
     }
 }
 
+bool BleService::start(uint32_t pollIntervalMs) {
+    if (pollTask_ != nullptr) {
+        return true;
+    }
+    pollIntervalMs_ = std::max<uint32_t>(pollIntervalMs, 10);
+    init();
+
+    if (xTaskCreate(&BleService::pollTask, "ble_poll", kPollTaskStack, this, kPollTaskPriority, &pollTask_) != pdPASS) {
+        pollTask_ = nullptr;
+        ESP_LOGE(kLogTag, "Failed to create poll task");
+        return false;
+    }
+    return true;
+}
+
+void BleService::pollTask(void* arg) {
+    auto* self = static_cast<BleService*>(arg);
+    for (;;) {
+        self->poll();
+        vTaskDelay(pdMS_TO_TICKS(self->pollIntervalMs_));
+    }
+}
+
 void BleService::setupServerIfNeeded() {
-    if (!serverConfigured_ && !hidServerEnabled_) {
+    if (!serverConfigured_ && !hidServerEnabled_ && !telemetryEnabled_) {
         return;
     }
 
@@ -325,6 +458,27 @@ void BleService::setupServerIfNeeded() {
         }
     }
 
+    NimBLEService* telemetryService = nullptr;
+    telemetryCharacteristic_        = nullptr;
+    if (telemetryEnabled_ && telemetryMutex_ != nullptr) {
+        telemetryService = server_->createService(telemetryConfig_.serviceUuid);
+        if (telemetryService != nullptr) {
+            telemetryCharacteristic_ = telemetryService->createCharacteristic(
+                telemetryConfig_.characteristicUuid,
+                NIMBLE_PROPERTY::READ | NIMBLE_PROPERTY::WRITE | NIMBLE_PROPERTY::NOTIFY | NIMBLE_PROPERTY::READ_ENC |
+                    NIMBLE_PROPERTY::WRITE_ENC);
+        }
+        if (telemetryCharacteristic_ == nullptr) {
+            ESP_LOGE(kLogTag,
+                     "Failed to create telemetry service %s",
+                     telemetryConfig_.serviceUuid.toString().c_str());
+            telemetryService = nullptr;
+        } else {
+            telemetryCharacteristic_->setCallbacks(telemetryCallbacks_.get());
+            telemetryService->start();
+        }
+    }
+
     NimBLEAdvertising* advertising = NimBLEDevice::getAdvertising();
 
     NimBLEAdvertisementData advData;
@@ -340,6 +494,10 @@ void BleService::setupServerIfNeeded() {
 
     NimBLEAdvertisementData scanData;
     scanData.setName(kDefaultDeviceName);
+    if (telemetryService != nullptr) {
+        // The advertisement has no room left for a second 128-bit UUID.
+        scanData.addServiceUUID(telemetryService->getUUID());
+    }
     advertising->setScanResponseData(scanData);
     advertising->start();
 
@@ -470,15 +628,192 @@ void BleService::handleScanEnd(const NimBLEScanResults& results, int reason) {
 
 void BleService::handleServerConnect(uint16_t connHandle) {
     ESP_LOGI(kLogTag, "Server accepted connection (handle=%u)", static_cast<unsigned>(connHandle));
+    if (server_ != nullptr && hidInputReportCharacteristic_ != nullptr) {
+        // Hosts often pick 30-50 ms for a keyboard; ask for a short interval
+        // so key reports go out within a few milliseconds.
+        server_->updateConnParams(connHandle, kHidMinConnInterval, kHidMaxConnInterval, 0, kHidSupervisionTimeout);
+    }
 }
 
 void BleService::handleServerDisconnect(uint16_t connHandle) {
     ESP_LOGI(kLogTag, "Server client disconnected (handle=%u)", static_cast<unsigned>(connHandle));
+    if (telemetryMutex_ != nullptr) {
+        MutexGuard        lock(telemetryMutex_);
+        TelemetryCentral* central = findTelemetryCentral(connHandle, false);
+        if (central != nullptr) {
+            *central = TelemetryCentral{};
+        }
+    }
     if (server_) {
         NimBLEDevice::startAdvertising();
     }
 }
 
+void BleService::handleMtuChange(uint16_t connHandle, uint16_t mtu) {
+    if (telemetryMutex_ == nullptr) {
+        return;
+    }
+    // Centrals that subscribe later read the MTU when they are added.
+    MutexGuard        lock(telemetryMutex_);
+    TelemetryCentral* central = findTelemetryCentral(connHandle, false);
+    if (central != nullptr) {
+        central->mtu = mtu;
+    }
+}
+
+void BleService::handleTelemetrySubscribe(uint16_t connHandle, uint16_t subValue) {
+    MutexGuard        lock(telemetryMutex_);
+    TelemetryCentral* central = findTelemetryCentral(connHandle, subValue != 0);
+    if (central == nullptr) {
+        if (subValue != 0) {
+            ESP_LOGW(kLogTag, "Telemetry central limit reached, handle=%u not served", static_cast<unsigned>(connHandle));
+        }
+        return;
+    }
+
+    central->subscribed = (subValue & 0x0001) != 0; // Notifications; indications are not offered
+    if (central->subscribed) {
+        // Start with the newest snapshot rather than replaying the history.
+        central->nextRecord   = telemetryRecords_ > 0 ? telemetryRecords_ - 1 : 0;
+        central->lastNotifyMs = 0;
+    }
+    ESP_LOGI(kLogTag,
+             "Telemetry %s for handle=%u every %u ms (MTU %u)",
+             central->subscribed ? "subscribed" : "unsubscribed",
+             static_cast<unsigned>(connHandle),
+             static_cast<unsigned>(central->intervalMs),
+             static_cast<unsigned>(central->mtu));
+}
+
+void BleService::handleTelemetryWrite(uint16_t connHandle, const uint8_t* data, size_t length) {
+    if (length < 2) {
+        return;
+    }
+    const uint16_t requested = static_cast<uint16_t>(data[0] | (data[1] << 8));
+
+    MutexGuard        lock(telemetryMutex_);
+    TelemetryCentral* central = findTelemetryCentral(connHandle, true);
+    if (central != nullptr) {
+        central->intervalMs =
+            std::clamp(requested, telemetryConfig_.minNotifyIntervalMs, telemetryConfig_.maxNotifyIntervalMs);
+    }
+}
+
+void BleService::handleTelemetryRead(NimBLECharacteristic* characteristic) {
+    std::array<uint8_t, kTelemetryRecordSize> latest{};
+    {
+        MutexGuard lock(telemetryMutex_);
+        if (telemetryRecords_ > 0) {
+            latest = telemetryHistory_[(telemetryRecords_ - 1) % kTelemetryHistory];
+        }
+    }
+    characteristic->setValue(latest.data(), latest.size());
+}
+
+BleService::TelemetryCentral* BleService::findTelemetryCentral(uint16_t connHandle, bool create) {
+    TelemetryCentral* freeSlot = nullptr;
+    for (TelemetryCentral& central : telemetryCentrals_) {
+        if (central.connHandle == connHandle) {
+            return &central;
+        }
+        if (freeSlot == nullptr && central.connHandle == BLE_HS_CONN_HANDLE_NONE) {
+            freeSlot = &central;
+        }
+    }
+    if (!create || freeSlot == nullptr) {
+        return nullptr;
+    }
+
+    *freeSlot            = TelemetryCentral{};
+    freeSlot->connHandle = connHandle;
+    freeSlot->intervalMs = telemetryConfig_.defaultNotifyIntervalMs;
+    if (server_ != nullptr) {
+        freeSlot->mtu = server_->getPeerMTU(connHandle);
+    }
+    return freeSlot;
+}
+
+void BleService::publishTelemetry(const TelemetryState& state) {
+    if (telemetryCharacteristic_ == nullptr) {
+        return;
+    }
+
+    const uint32_t now = nowMs();
+    if (telemetryRecords_ > 0 && now - lastSampleMs_ < telemetryConfig_.sampleIntervalMs) {
+        return;
+    }
+
+    MutexGuard lock(telemetryMutex_);
+    lastSampleMs_ = now;
+    encodeTelemetryRecord(state, now, telemetryHistory_[telemetryRecords_ % kTelemetryHistory].data());
+    ++telemetryRecords_;
+
+    for (TelemetryCentral& central : telemetryCentrals_) {
+        if (central.subscribed && now - central.lastNotifyMs >= central.intervalMs) {
+            notifyTelemetry(central, now);
+        }
+    }
+}
+
+void BleService::notifyTelemetry(TelemetryCentral& central, uint32_t timeMs) {
+    const size_t payload = std::min<size_t>(central.mtu > kAttNotifyOverhead ? central.mtu - kAttNotifyOverhead : 0,
+                                            kTelemetryMaxPayload);
+    const size_t fit     = payload / kTelemetryRecordSize;
+
+    // Records that fell out of the history, or do not fit, are skipped in
+    // favour of the newest; the timestamps show the gap.
+    const uint32_t oldest = telemetryRecords_ > kTelemetryHistory ? telemetryRecords_ - kTelemetryHistory : 0;
+    const uint32_t unsent = telemetryRecords_ - std::max(central.nextRecord, oldest);
+    const size_t   count  = std::min<size_t>(unsent, fit);
+    if (count == 0) {
+        return;
+    }
+    const uint32_t first = telemetryRecords_ - static_cast<uint32_t>(count);
+
+    std::array<uint8_t, kTelemetryMaxPayload> buffer;
+    for (size_t i = 0; i < count; ++i) {
+        const auto& record = telemetryHistory_[(first + i) % kTelemetryHistory];
+        std::copy(record.begin(), record.end(), buffer.begin() + i * kTelemetryRecordSize);
+    }
+
+    // The payload is copied into a host mbuf; nothing is allocated on the heap.
+    if (telemetryCharacteristic_->notify(buffer.data(), count * kTelemetryRecordSize, central.connHandle)) {
+        central.nextRecord   = telemetryRecords_;
+        central.lastNotifyMs = timeMs;
+    }
+}
+
+bool BleService::sendHidReport(const uint8_t* report, size_t length) {
+    if (report == nullptr || hidInputReportCharacteristic_ == nullptr || server_ == nullptr ||
+        server_->getConnectedCount() == 0) {
+        return false;
+    }
+    hidInputReportCharacteristic_->setValue(report, length);
+    return hidInputReportCharacteristic_->notify();
+}
+
+bool BleService::hidReportSink(void* context, const uint8_t* report, size_t length) {
+    return static_cast<BleService*>(context)->sendHidReport(report, length);
+}
+
+void BleService::setLowPowerScan(bool lowPower) {
+    if (lowPower == lowPowerScan_) {
+        return;
+    }
+    lowPowerScan_ = lowPower;
+
+    // Scans restart every scanTimeMs_, so the new parameters apply from the
+    // next one without interrupting a connection attempt.
+    NimBLEScan* scan = NimBLEDevice::getScan();
+    scan->setInterval(lowPower ? kParkedScanIntervalMs : kRidingScanIntervalMs);
+    scan->setWindow(lowPower ? kParkedScanWindowMs : kRidingScanWindowMs);
+    ESP_LOGI(kLogTag, "Scan duty %s", lowPower ? "reduced" : "full");
+}
+
+void BleService::onPowerState(void* context, PowerState state) {
+    static_cast<BleService*>(context)->setLowPowerScan(state == PowerState::Parked);
+}
+
 std::string BleService::handleCharacteristicRead() {
     if (!serverConfigured_ || !serverConfig_.onRead) {
         return {};
@@ -631,6 +966,8 @@ void BleService::handleNotificationEvent(NimBLERemoteCharacteristic* characteris
 }
 
 void BleService::notifyCallback(NimBLERemoteCharacteristic* characteristic, uint8_t* data, size_t length, bool isNotify) {
+    JARVIS_COUNT(BleNotifications);
+    JARVIS_PROBE(BleNotify);
     if (instance_ == nullptr) {
         return;
     }
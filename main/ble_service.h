@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -9,6 +10,14 @@
 #include <vector>
 
 #include "NimBLEDevice.h"
+#include "host/ble_hs.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "services/power/power.hh"
+#include "telemetry/motor/motor_controller.h"
 
 /**
  * BLE manager capable of acting as both server and client concurrently.
@@ -41,6 +50,41 @@ class BleService {
         std::function<void(const std::string&)> onWrite{};
     };
 
+    /**
+     * Telemetry characteristic streaming packed snapshots by notification.
+     *
+     * publishTelemetry() samples the state every sampleIntervalMs into a
+     * short history. Each subscribed central gets the snapshots it has not
+     * seen yet, as many per notification as its MTU allows, at most once
+     * per its own notify interval. A central picks the interval by writing
+     * it in milliseconds (uint16 LE); it is clamped to [min, max].
+     */
+    struct TelemetryConfig {
+        NimBLEUUID serviceUuid{};
+        NimBLEUUID characteristicUuid{};
+        uint16_t   sampleIntervalMs        = 50;
+        uint16_t   defaultNotifyIntervalMs = 200;
+        uint16_t   minNotifyIntervalMs     = 50;
+        uint16_t   maxNotifyIntervalMs     = 5000;
+    };
+
+    /**
+     * Wire format of one snapshot, little-endian, kTelemetryRecordSize bytes.
+     * A notification carries one or more records back to back, oldest first.
+     *
+     *   0  uint32  time since boot (ms)
+     *   4  uint16  motor rpm
+     *   6  uint16  speed (0.01 km/h)
+     *   8  int16   power (W, saturated)
+     *  10  uint16  battery voltage (0.01 V)
+     *  12  uint32  distance (m)
+     *  16  uint8   throttle (raw >> 4)
+     *  17  uint8   gear
+     *  18  int8    controller temperature (°C)
+     *  19  int8    motor temperature (°C)
+     */
+    static constexpr size_t kTelemetryRecordSize = 20;
+
     explicit BleService(uint32_t scanTimeMs = 5000);
     ~BleService();
 
@@ -48,14 +92,57 @@ class BleService {
     void setServerConfig(ServerConfig config);
     void enableHidServer(bool enable = true);
 
+    /**
+     * Sends one keyboard input report (modifiers, reserved, six key slots)
+     * to subscribed HID hosts.
+     * @return false when the HID service is not running or no host is connected.
+     */
+    bool sendHidReport(const uint8_t* report, size_t length);
+
+    /**
+     * HidInputService::ReportSink adapter; pass the BleService as context.
+     */
+    static bool hidReportSink(void* context, const uint8_t* report, size_t length);
+
+    /**
+     * Adds the telemetry service. Must be called before init().
+     */
+    void enableTelemetryServer(TelemetryConfig config);
+
+    /**
+     * Records a telemetry snapshot and notifies centrals that are due. Cheap
+     * between samples; call it on every telemetry update (for example from
+     * MotorController's telemetry callback), always from the same task.
+     */
+    void publishTelemetry(const TelemetryState& state);
+
+    /**
+     * Switches between continuous scanning and a low duty cycle for when the
+     * bike is parked. Takes effect from the next scan.
+     */
+    void setLowPowerScan(bool lowPower);
+
+    /**
+     * PowerManager::Listener adapter; pass the BleService as context.
+     */
+    static void onPowerState(void* context, PowerState state);
+
     void init();
     void poll();
 
+    /**
+     * Runs init() and a task that calls poll() every pollIntervalMs, so
+     * discovered targets are connected without a caller loop.
+     * @return false when the task could not be created.
+     */
+    bool start(uint32_t pollIntervalMs = 100);
+
   private:
     class ClientCallbacks;
     class ScanCallbacks;
     class ServerCallbacks;
     class CharacteristicCallbacks;
+    class TelemetryCallbacks;
 
     struct ClientContext {
         std::string                   address;
@@ -76,6 +163,10 @@ class BleService {
     void handleScanEnd(const NimBLEScanResults& results, int reason);
     void handleServerConnect(uint16_t connHandle);
     void handleServerDisconnect(uint16_t connHandle);
+    void handleMtuChange(uint16_t connHandle, uint16_t mtu);
+    void handleTelemetrySubscribe(uint16_t connHandle, uint16_t subValue);
+    void handleTelemetryWrite(uint16_t connHandle, const uint8_t* data, size_t length);
+    void handleTelemetryRead(NimBLECharacteristic* characteristic);
     std::string handleCharacteristicRead();
     void handleCharacteristicWrite(const std::string& value);
     void handleNotificationEvent(NimBLERemoteCharacteristic* characteristic, const uint8_t* data, size_t length, bool isNotify);
@@ -84,15 +175,20 @@ class BleService {
     bool subscribeToTarget(ClientContext& context, NimBLERemoteCharacteristic* characteristic);
 
     static void notifyCallback(NimBLERemoteCharacteristic* characteristic, uint8_t* data, size_t length, bool isNotify);
+    static void pollTask(void* arg);
 
     void setupServerIfNeeded();
 
-    uint32_t scanTimeMs_ = 5000;
+    uint32_t     scanTimeMs_     = 5000;
+    bool         lowPowerScan_   = false;
+    uint32_t     pollIntervalMs_ = 100;
+    TaskHandle_t pollTask_       = nullptr;
 
     std::unique_ptr<ClientCallbacks>         clientCallbacks_;
     std::unique_ptr<ScanCallbacks>           scanCallbacks_;
     std::unique_ptr<ServerCallbacks>         serverCallbacks_;
     std::unique_ptr<CharacteristicCallbacks> characteristicCallbacks_;
+    std::unique_ptr<TelemetryCallbacks>      telemetryCallbacks_;
 
     NimBLEServer*         server_              = nullptr;
     NimBLECharacteristic* serverCharacteristic_ = nullptr;
@@ -102,10 +198,42 @@ class BleService {
     std::vector<uint8_t>  hidReportMap_{};
     NimBLECharacteristic* hidInputReportCharacteristic_ = nullptr;
 
+    struct TelemetryCentral {
+        uint16_t connHandle   = BLE_HS_CONN_HANDLE_NONE;
+        uint16_t mtu          = BLE_ATT_MTU_DFLT;
+        uint16_t intervalMs   = 0;
+        bool     subscribed   = false;
+        uint32_t lastNotifyMs = 0;
+        uint32_t nextRecord   = 0; ///< Sequence of the oldest record not yet sent
+    };
+
+    static constexpr size_t kTelemetryHistory    = 16;  ///< Records kept for batching
+    static constexpr size_t kTelemetryCentrals   = 3;
+    static constexpr size_t kTelemetryMaxPayload = 240; ///< Up to 12 records with a 243+ byte MTU
+
+    TelemetryCentral* findTelemetryCentral(uint16_t connHandle, bool create);
+    void              notifyTelemetry(TelemetryCentral& central, uint32_t timeMs);
+
+    bool                  telemetryEnabled_        = false;
+    TelemetryConfig       telemetryConfig_{};
+    NimBLECharacteristic* telemetryCharacteristic_ = nullptr;
+    SemaphoreHandle_t     telemetryMutex_          = nullptr; ///< Guards the history and centrals
+    uint32_t              telemetryRecords_        = 0;       ///< Records ever sampled; next sequence number
+    uint32_t              lastSampleMs_            = 0;
+
+    std::array<std::array<uint8_t, kTelemetryRecordSize>, kTelemetryHistory> telemetryHistory_{};
+    std::array<TelemetryCentral, kTelemetryCentrals>                          telemetryCentrals_{};
+
     std::vector<ClientTarget> clientTargets_;
     std::map<std::string, ClientContext> clientContexts_;
     std::map<NimBLERemoteCharacteristic*, std::string> characteristicToAddress_;
 
     static BleService* instance_;
     static constexpr uint32_t kPairingPasskey = 1234;
+
+    // Preferred HID connection interval in 1.25 ms units (7.5-15 ms); a
+    // button press waits at most one interval for its notification.
+    static constexpr uint16_t kHidMinConnInterval = 6;
+    static constexpr uint16_t kHidMaxConnInterval = 12;
+    static constexpr uint16_t kHidSupervisionTimeout = 400; // 10 ms units
 };
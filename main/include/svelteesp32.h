@@ -1,103 +0,0 @@
-//engine:   espidf
-//cmdline:  -e espidf -s ../web/dist -o ../main/include/svelteesp32.h --etag=true
-
-#ifdef SVELTEESP32_ENABLE_ETAG
-#warning SVELTEESP32_ENABLE_ETAG has no effect because it is permanently switched ON
-#endif
-#ifdef SVELTEESP32_ENABLE_GZIP
-#warning SVELTEESP32_ENABLE_GZIP has no effect because it is permanently switched ON
-#endif
-
-#define SVELTEESP32_COUNT 4
-#define SVELTEESP32_SIZE 307853
-#define SVELTEESP32_SIZE_GZIP 46136
-
-#define SVELTEESP32_FILE_INDEX_HTML
-#define SVELTEESP32_FILE_FAVICON_SVG
-#define SVELTEESP32_FILE_ASSETS_INDEX_CVKLZ8QS_JS
-#define SVELTEESP32_FILE_ASSETS_INDEX_BIYBMFDF_CSS
-
-#define SVELTEESP32_CSS_FILES 1
-#define SVELTEESP32_HTML_FILES 1
-#define SVELTEESP32_JS_FILES 1
-#define SVELTEESP32_SVG_FILES 1
-#include <stdint.h>
-#include <esp_err.h>
-#include <esp_http_server.h>
-
-const char datagzip_index_html[470] = { 60,33,100,111,99,116,121,112,101,32,104,116,109,108,62,10,60,104,116,109,108,32,108,97,110,103,61,34,101,110,34,62,10,9,60,104,101,97,100,62,10,9,9,60,109,101,116,97,32,99,104,97,114,115,101,116,61,34,85,84,70,45,56,34,32,47,62,10,9,9,60,108,105,110,107,32,114,101,108,61,34,105,99,111,110,34,32,104,114,101,102,61,34,102,97,118,105,99,111,110,46,115,118,103,34,32,47,62,10,9,9,60,116,105,116,108,101,62,228,184,173,231,169,186,229,144,142,229,143,176,60,47,116,105,116,108,101,62,10,9,9,60,109,101,116,97,32,110,97,109,101,61,34,118,105,101,119,112,111,114,116,34,32,99,111,110,116,101,110,116,61,34,119,105,100,116,104,61,100,101,118,105,99,101,45,119,105,100,116,104,44,32,105,110,105,116,105,97,108,45,115,99,97,108,101,61,49,34,32,47,62,10,9,9,60,109,101,116,97,32,110,97,109,101,61,34,116,104,101,109,101,45,99,111,108,111,114,34,32,99,111,110,116,101,110,116,61,34,35,102,51,102,52,102,54,34,32,47,62,10,9,9,60,115,99,114,105,112,116,32,116,121,112,101,61,34,109,111,100,117,108,101,34,32,99,114,111,115,115,111,114,105,103,105,110,32,115,114,99,61,34,46,47,97,115,115,101,116,115,47,105,110,100,101,120,45,67,86,75,108,122,56,113,115,46,106,115,34,62,60,47,115,99,114,105,112,116,62,10,9,9,60,108,105,110,107,32,114,101,108,61,34,115,116,121,108,101,115,104,101,101,116,34,32,99,114,111,115,115,111,114,105,103,105,110,32,104,114,101,102,61,34,46,47,97,115,115,101,116,115,47,105,110,100,101,120,45,66,105,89,66,77,102,100,70,46,99,115,115,34,62,10,9,60,47,104,101,97,100,62,10,10,9,60,98,111,100,121,62,10,9,9,60,100,105,118,32,105,100,61,34,97,112,112,34,62,60,47,100,105,118,62,10,9,60,47,98,111,100,121,62,10,60,47,104,116,109,108,62,10 };
-const char datagzip_favicon_svg[676] = { 31,139,8,0,0,0,0,0,2,3,109,84,77,175,218,48,16,188,247,87,108,211,107,61,120,215,31,107,87,64,245,122,233,233,93,250,117,143,30,121,128,20,8,2,10,252,252,202,137,243,218,67,145,60,147,120,86,147,245,122,196,242,243,227,208,211,173,59,95,246,195,113,213,48,108,67,221,241,101,216,236,143,219,85,243,251,250,106,82,243,121,189,124,111,12,253,60,245,67,187,233,54,116,29,62,209,247,95,95,233,91,119,26,62,210,253,126,199,229,182,61,119,167,1,47,195,225,35,125,237,142,221,185,189,14,231,191,85,244,188,127,116,103,250,49,12,253,133,140,89,191,91,94,110,91,122,221,247,253,170,249,96,199,95,67,247,253,230,186,91,53,201,218,211,163,161,93,183,223,238,174,111,175,183,125,119,255,50,60,86,141,37,75,226,73,124,67,231,161,239,86,205,254,176,109,232,113,232,143,151,85,179,187,94,79,159,22,139,210,210,221,97,56,111,23,98,173,93,92,110,219,102,189,60,181,215,29,109,86,205,51,11,178,68,226,12,39,190,85,68,42,171,24,91,35,200,201,153,8,13,158,20,190,194,164,57,36,73,134,17,130,71,204,90,214,168,176,65,180,209,64,29,35,170,47,107,218,39,168,119,6,145,149,18,114,133,73,73,148,145,108,32,45,158,21,171,151,228,68,140,224,165,103,228,148,17,98,203,12,235,50,85,178,83,37,148,189,65,12,76,44,224,144,103,154,100,8,171,17,56,239,158,88,16,148,38,156,68,133,176,80,4,43,183,1,193,209,8,117,2,100,201,195,5,95,113,158,11,71,98,56,167,228,33,234,43,206,173,100,155,41,34,133,88,142,149,103,156,85,171,30,156,3,121,88,230,138,211,24,220,232,232,144,131,47,24,67,197,121,172,158,202,135,123,134,83,70,74,45,91,112,18,170,52,249,11,108,80,56,47,164,8,21,234,12,52,120,35,136,146,14,165,125,15,117,79,236,96,213,81,165,122,77,214,114,241,204,201,149,49,229,242,133,137,230,46,139,0,117,218,151,27,45,23,223,178,192,198,113,170,133,236,124,86,5,123,166,255,137,85,178,253,156,157,98,145,199,162,183,28,101,56,23,201,65,37,62,139,31,91,202,238,105,162,250,54,187,9,178,207,100,95,12,92,202,100,13,52,70,178,134,193,222,149,129,244,6,18,4,234,164,229,132,204,66,149,166,35,49,35,164,52,146,198,190,68,215,64,162,123,177,6,46,70,216,152,75,158,101,124,24,61,15,134,33,49,83,0,199,240,196,90,2,51,225,28,169,196,37,183,162,37,173,204,99,90,11,205,249,241,37,131,80,189,49,162,11,229,30,114,41,154,168,54,149,33,49,149,70,131,238,74,153,47,94,202,142,42,189,37,95,185,56,250,248,172,200,82,250,72,201,183,140,152,153,38,28,237,76,121,54,255,110,207,226,40,35,230,105,163,89,172,151,229,79,98,253,7,221,136,230,206,14,5,0,0 };
-const char datagzip_assets_index_CVKlz8qs_js[12112] = { 31,139,8,0,0,0,0,0,2,3,237,125,233,114,219,200,150,230,255,121,10,144,237,198,5,66,73,152,146,151,114,145,74,113,188,151,203,107,89,118,45,86,184,213,73,224,128,132,5,2,112,102,130,162,138,100,196,125,135,153,159,61,15,48,175,49,143,210,79,50,113,114,1,18,148,188,84,93,207,141,152,190,247,143,77,0,137,92,78,158,245,59,39,161,37,227,94,198,233,203,233,7,136,101,148,64,154,21,240,138,151,21,112,121,49,94,50,238,77,129,74,122,180,150,115,94,158,123,111,46,42,120,200,121,201,3,25,110,213,227,156,211,64,18,32,60,164,71,224,101,133,39,39,25,87,119,214,80,212,11,224,108,154,195,168,55,36,113,89,164,217,172,110,174,207,121,38,237,239,37,203,107,24,241,109,56,146,39,240,158,114,213,243,66,182,61,231,216,165,188,168,160,76,61,232,209,190,184,88,76,203,188,63,129,189,126,127,132,77,8,3,103,30,209,156,137,64,134,155,205,20,130,254,125,86,20,165,244,250,123,60,212,51,110,27,6,12,212,239,62,7,150,120,41,47,23,94,197,179,37,147,224,165,25,228,73,63,36,124,194,163,152,229,121,32,195,17,68,51,144,129,12,67,178,184,60,216,196,25,139,37,137,39,231,224,9,182,128,166,199,5,44,166,192,189,69,201,193,147,115,86,120,101,17,67,63,28,33,213,132,100,69,140,139,251,5,216,217,49,200,9,68,44,73,244,152,2,199,196,37,38,102,80,34,220,169,35,29,193,147,229,165,153,139,137,48,51,39,188,211,15,15,201,233,21,52,96,113,12,66,56,211,149,243,82,81,32,28,7,105,93,196,50,43,139,32,92,199,101,33,164,7,52,41,227,122,1,133,140,98,14,76,194,195,28,240,42,232,231,89,113,214,15,35,14,249,179,76,200,113,150,6,224,251,16,137,186,170,74,46,133,251,59,232,47,202,164,206,161,226,144,151,44,233,135,33,7,89,243,98,156,150,60,208,227,48,175,76,189,102,168,143,53,240,139,99,200,33,150,37,191,155,231,193,95,112,180,19,14,57,221,233,234,253,95,194,80,4,44,28,23,112,238,61,175,37,195,217,191,156,10,224,75,224,1,163,71,235,118,140,12,199,96,97,150,6,89,132,60,70,41,237,199,243,44,79,112,1,253,176,109,88,96,195,12,119,6,146,23,101,2,34,44,34,201,102,47,216,66,189,243,236,201,139,167,125,223,47,112,237,120,221,157,145,239,139,160,8,183,97,84,234,89,4,118,85,100,221,12,134,178,32,234,169,228,128,98,177,13,199,150,238,30,15,152,37,125,70,215,219,177,38,148,199,162,172,144,48,227,153,188,240,253,32,107,175,168,243,36,36,44,226,144,2,231,192,95,149,121,22,235,182,221,91,116,183,13,190,21,243,82,136,151,60,155,101,5,46,168,22,48,136,57,36,80,200,140,229,162,63,201,34,231,146,246,179,34,206,235,4,250,163,75,111,178,162,44,46,22,101,125,249,157,114,145,201,254,104,231,38,202,205,160,84,111,247,73,182,109,168,128,59,186,206,210,128,69,80,89,94,193,223,180,55,28,91,226,32,165,198,41,200,120,30,176,104,206,33,37,89,184,221,134,65,104,90,188,6,218,219,87,138,224,3,208,187,156,179,139,40,19,234,127,82,112,115,163,226,165,44,145,21,162,172,72,96,245,50,37,165,125,132,74,130,228,112,181,194,36,47,164,125,48,3,249,242,188,176,15,30,128,136,121,86,201,146,147,186,81,182,205,40,36,189,52,48,73,184,211,211,43,123,251,101,74,78,155,177,51,241,112,37,161,16,217,52,135,150,83,98,212,205,138,187,113,141,64,135,99,56,148,81,14,197,76,206,199,176,183,23,162,138,13,194,150,168,115,30,132,107,108,171,52,2,69,129,121,197,203,69,38,32,8,4,97,33,42,127,42,8,80,182,13,13,223,173,43,221,96,196,9,7,81,230,75,24,73,194,1,103,53,130,237,86,19,250,5,61,32,175,128,222,36,21,167,119,200,92,210,253,219,164,146,244,198,1,89,74,122,251,38,169,128,238,31,220,33,79,233,193,173,219,228,55,73,111,237,31,144,151,116,127,120,112,147,60,167,7,195,155,119,136,144,244,230,240,251,219,228,88,210,59,251,223,31,144,7,216,199,141,59,55,201,125,160,55,14,190,187,125,135,60,2,122,251,214,173,27,183,201,57,208,253,195,195,253,239,200,146,171,31,119,8,232,59,223,147,149,186,115,48,36,133,186,115,176,79,30,232,31,7,228,169,84,63,110,144,12,232,177,50,41,65,255,154,144,76,66,63,36,207,64,209,34,206,153,16,30,32,165,19,225,41,227,167,5,145,215,168,133,130,112,45,234,10,120,16,69,17,227,51,37,209,34,28,47,100,32,231,153,32,253,130,45,160,79,250,199,146,229,240,26,152,34,185,234,164,239,52,90,128,16,108,134,237,222,204,193,227,166,25,90,9,233,161,10,135,196,251,247,25,200,187,211,146,203,227,108,86,176,60,8,255,221,59,103,194,227,48,224,117,225,149,220,75,64,72,94,94,64,210,15,183,219,150,29,22,56,67,109,188,113,53,218,120,247,231,82,86,98,116,253,186,88,66,46,33,74,96,121,29,174,67,154,66,44,79,235,42,97,18,78,19,168,228,252,20,86,49,64,162,58,109,186,156,125,125,151,138,150,167,73,195,253,226,52,205,86,221,222,166,127,180,183,70,70,46,247,117,250,71,251,170,11,193,82,56,93,24,3,225,246,117,254,7,250,82,23,167,211,178,46,18,198,47,78,57,8,144,167,101,1,122,159,141,60,92,112,122,64,206,44,159,57,186,253,140,27,179,90,230,16,157,51,94,252,161,97,138,178,172,220,121,63,84,242,111,236,131,164,148,34,139,69,203,109,14,210,91,162,238,35,111,56,106,192,230,133,99,37,255,64,123,67,213,230,30,45,234,60,111,31,95,67,143,103,125,143,202,118,136,151,202,193,195,174,56,62,89,87,163,123,36,30,225,107,4,244,127,98,36,201,74,255,204,71,75,240,253,30,76,214,66,223,168,245,127,215,70,39,239,183,234,231,182,237,249,174,154,188,86,92,247,8,167,16,1,122,16,188,71,213,172,194,53,68,96,230,103,20,156,64,155,204,195,223,120,32,194,173,89,245,61,10,81,69,214,78,191,28,2,75,147,222,18,54,155,123,166,67,223,191,23,161,173,86,211,192,213,79,37,61,121,223,46,254,69,163,27,233,84,142,213,67,162,20,108,219,245,99,69,159,44,13,166,86,203,82,74,135,118,17,83,57,254,88,67,13,207,179,152,151,146,137,179,32,64,133,138,254,194,84,250,62,246,191,13,183,83,25,85,181,152,99,191,198,72,105,61,140,222,224,115,86,181,243,249,8,45,125,166,202,183,50,147,55,214,208,91,69,233,134,62,149,68,57,94,1,68,169,127,31,66,61,33,123,163,50,55,20,111,247,32,170,24,135,66,250,190,116,253,80,197,238,190,255,4,199,35,114,12,209,52,2,235,247,67,46,192,251,29,157,73,112,232,96,110,40,203,51,6,67,223,113,103,216,158,26,150,95,172,221,238,140,73,217,198,12,77,54,15,215,146,242,45,80,59,175,173,22,193,207,76,174,157,130,186,209,56,168,175,185,113,215,199,224,251,65,142,94,110,171,104,215,58,228,128,200,220,217,134,68,183,16,146,197,103,206,115,117,189,13,237,198,60,151,106,99,142,65,142,145,93,222,168,85,146,143,250,191,18,236,67,242,3,114,202,74,243,42,169,27,151,227,66,146,51,73,10,73,94,73,242,80,146,82,146,55,146,220,151,228,145,36,15,72,10,228,71,73,18,48,142,202,79,146,106,219,243,147,220,49,56,11,109,54,30,56,22,36,174,57,82,171,79,148,191,203,170,112,108,26,93,200,75,183,206,244,173,99,144,205,173,66,146,97,115,241,74,18,197,82,246,250,161,36,39,239,155,171,178,115,245,166,115,117,191,115,245,200,92,217,57,138,179,172,170,32,57,213,118,70,244,155,89,108,43,94,98,236,17,64,184,86,132,83,42,139,85,85,126,129,122,178,235,168,67,120,106,150,79,82,8,77,132,131,215,89,136,60,159,219,5,133,173,24,114,250,113,220,188,148,184,47,233,136,80,208,220,174,52,36,204,94,148,50,28,39,46,5,72,226,82,192,94,105,10,144,134,19,56,185,128,64,132,248,47,11,73,110,73,26,78,34,227,42,5,70,130,154,25,253,40,221,101,180,83,9,201,231,155,148,95,110,242,70,134,225,88,115,231,54,102,149,172,57,4,24,246,173,115,203,29,161,10,95,33,220,108,156,91,24,42,170,168,90,109,132,225,45,115,23,162,101,72,62,78,156,171,45,186,43,24,51,6,225,250,141,50,55,219,4,58,247,28,33,217,166,57,106,58,165,23,126,48,10,243,72,107,39,189,235,205,123,228,3,15,66,242,166,209,212,248,75,237,153,81,24,138,136,221,237,246,253,79,109,179,234,219,157,149,195,86,128,108,85,2,6,128,37,218,218,28,36,4,16,18,112,134,15,167,28,216,217,54,43,98,174,227,220,112,157,52,162,211,78,98,111,63,220,38,240,249,54,131,253,75,131,231,86,124,194,240,110,0,228,121,72,94,202,0,62,213,236,145,105,38,164,109,167,86,103,8,187,101,73,114,138,43,159,178,248,12,37,42,183,82,31,42,76,1,194,173,0,41,115,72,26,147,24,56,92,58,73,26,37,128,129,65,24,70,198,215,223,162,199,148,197,30,20,162,86,230,52,75,131,55,214,250,52,74,247,141,210,128,63,201,241,115,169,70,123,19,146,159,100,4,133,50,130,218,246,225,75,10,18,176,19,110,236,246,155,118,12,221,30,194,245,99,92,224,214,232,130,245,118,59,190,144,174,105,36,103,221,203,162,123,249,170,123,249,176,123,89,118,47,223,116,47,239,119,47,31,117,47,31,52,87,168,238,83,160,13,68,2,232,165,164,255,70,95,54,62,10,250,49,105,198,133,28,243,214,46,106,197,195,163,148,48,26,8,63,168,228,102,41,67,101,35,73,70,153,239,7,194,127,169,47,11,154,109,54,129,240,143,165,186,222,108,212,126,239,168,83,37,199,92,233,192,94,225,251,60,74,139,198,107,98,19,174,102,52,10,132,255,74,219,225,73,171,68,180,239,193,195,145,128,128,135,190,31,4,60,74,253,185,30,204,247,91,85,98,27,146,119,50,224,161,214,157,53,46,65,173,45,75,131,186,25,145,211,26,205,152,204,138,26,182,91,108,88,82,110,76,186,162,11,167,60,42,96,37,199,156,90,1,47,27,226,112,90,170,135,164,164,165,245,3,182,228,71,217,33,114,43,28,92,219,5,61,239,231,157,229,221,151,225,200,17,155,102,5,119,3,78,94,134,99,176,46,219,112,75,18,103,15,141,143,53,222,25,163,21,165,144,7,174,185,65,225,138,115,96,168,177,158,203,72,100,191,195,209,126,71,203,154,167,202,107,224,136,87,180,93,43,23,246,185,118,34,133,113,216,145,130,189,253,150,132,6,13,83,206,169,125,241,164,32,245,251,50,245,92,37,173,59,105,84,54,242,68,17,162,102,227,190,143,187,211,62,66,223,168,8,195,174,122,47,72,29,142,149,98,181,35,143,153,166,89,17,110,21,240,226,184,184,77,19,11,189,156,68,81,212,246,119,6,23,34,8,223,71,105,150,75,224,65,65,143,122,29,115,98,230,54,86,184,91,107,8,118,224,54,22,62,135,160,48,198,221,53,24,111,168,32,87,57,9,234,173,31,194,211,0,104,199,71,0,82,132,99,229,93,116,13,193,118,187,213,6,106,251,92,90,229,175,118,96,171,246,234,55,250,147,108,253,239,15,109,60,112,46,199,232,215,13,199,232,208,90,168,5,167,241,16,130,222,48,28,183,115,29,91,47,228,183,200,42,79,229,186,239,237,29,237,195,13,163,9,8,27,191,194,96,128,71,214,25,250,33,36,32,45,223,108,183,105,86,176,60,191,88,43,103,146,60,84,190,175,113,48,157,64,231,149,138,90,249,197,26,227,126,227,83,203,112,173,156,243,21,132,91,21,228,228,114,39,198,187,112,194,138,6,43,194,41,42,143,125,221,234,177,225,152,31,66,163,188,228,9,223,219,123,175,34,13,17,165,126,240,64,110,142,101,104,44,177,64,47,8,29,111,21,52,189,147,232,19,33,229,43,209,8,188,208,154,195,185,46,16,85,61,21,146,241,246,110,32,34,9,140,39,229,121,225,180,100,177,185,152,252,132,3,141,68,148,22,90,247,144,92,78,90,62,9,215,45,17,119,113,229,92,134,239,36,194,133,106,142,219,173,161,139,67,206,231,160,131,26,244,78,34,139,203,8,171,229,118,180,131,211,194,26,68,165,224,199,129,240,95,104,173,244,28,2,78,32,68,61,28,60,128,205,220,40,124,223,191,167,31,248,126,128,154,73,59,0,60,12,157,169,220,115,167,130,100,108,116,237,165,105,224,83,148,121,132,47,21,34,139,134,97,179,81,234,241,69,119,64,227,76,245,134,198,6,247,246,157,48,95,118,145,196,21,80,140,4,181,62,110,13,89,27,171,141,27,99,167,140,1,26,121,140,115,125,63,224,214,156,88,212,22,121,134,251,193,82,110,42,67,3,29,41,114,255,165,118,220,77,59,109,73,183,219,31,180,22,114,3,206,251,10,43,64,126,6,58,36,156,206,32,24,134,68,152,120,82,185,26,191,240,0,73,122,138,180,36,215,184,242,63,84,200,60,68,182,162,92,168,59,82,253,251,90,17,60,12,9,236,209,125,162,94,127,44,77,180,62,160,251,164,121,109,18,5,33,17,116,89,102,137,55,36,250,181,109,184,13,113,183,144,0,143,56,125,4,27,128,77,229,160,178,15,184,73,184,172,209,109,120,102,175,212,11,207,200,43,50,7,242,35,169,37,121,75,238,147,135,228,103,242,142,164,146,252,68,18,73,126,37,191,74,34,129,92,144,143,156,60,225,228,173,36,63,75,18,195,88,7,135,207,186,104,164,78,15,217,8,241,194,137,190,244,22,245,155,232,236,25,233,237,183,33,95,243,107,14,221,224,239,199,230,87,221,134,139,111,219,136,111,39,84,236,94,254,220,189,124,215,189,76,221,160,243,39,231,119,34,221,185,253,218,125,235,87,169,55,199,216,214,95,67,223,255,25,130,230,202,58,218,169,196,93,177,47,73,32,247,205,246,39,182,215,89,243,22,182,13,117,175,73,103,76,220,84,27,3,190,34,208,196,124,63,170,116,156,37,11,17,38,80,210,36,166,211,104,106,31,62,35,189,94,110,9,25,85,80,36,89,49,107,94,125,75,30,235,73,173,167,209,84,153,253,177,210,221,137,165,45,211,12,40,26,7,29,25,212,104,117,134,232,100,38,12,142,194,194,173,105,243,83,120,52,156,152,48,232,130,252,236,70,133,225,40,113,246,126,187,37,143,144,117,51,113,106,38,214,4,4,214,209,121,22,110,54,189,158,179,54,223,119,46,34,247,205,237,156,53,87,167,162,64,215,84,182,152,219,101,34,108,13,204,108,95,137,203,186,64,87,127,221,76,61,238,68,247,45,241,83,233,236,241,30,132,164,212,201,82,203,2,184,241,51,144,198,47,254,228,218,100,39,64,36,167,178,229,161,112,171,137,10,214,112,183,179,55,160,174,114,13,132,115,63,101,89,14,137,227,17,38,152,126,238,113,223,239,9,141,180,121,48,182,62,41,234,164,95,130,230,170,89,153,17,166,134,135,31,118,26,62,108,27,62,220,105,248,115,167,225,207,109,67,35,128,218,85,103,232,56,100,198,173,68,79,137,42,222,67,183,46,92,35,8,109,161,56,70,123,67,146,249,62,66,224,164,117,90,156,13,24,58,67,55,1,250,47,178,157,65,71,154,126,182,210,212,138,133,98,163,43,89,198,161,70,195,10,111,59,216,134,43,198,90,85,88,65,201,27,77,117,25,10,81,178,211,146,236,235,197,196,132,57,43,229,232,61,10,180,143,145,33,137,248,36,82,110,165,34,170,17,203,82,57,91,165,29,230,109,216,4,80,111,67,35,55,97,227,203,61,10,234,112,43,124,223,26,154,134,94,159,89,249,218,89,249,48,84,147,178,201,96,211,139,163,46,212,27,160,254,197,220,115,59,71,243,74,119,170,118,126,68,3,53,102,146,29,74,111,183,202,216,109,159,117,195,236,206,213,28,58,151,63,118,174,234,110,24,253,182,27,114,119,163,245,206,213,207,157,171,119,157,171,180,219,233,79,157,171,164,251,240,215,238,85,247,161,236,78,253,162,19,228,127,228,110,128,120,149,162,254,34,255,153,13,128,142,238,134,112,219,97,56,242,164,51,144,133,86,46,169,80,133,107,55,26,193,76,1,58,182,66,73,175,131,189,124,149,104,57,18,255,141,229,42,104,85,196,195,174,138,120,120,89,69,244,246,145,213,194,45,121,219,141,251,181,74,158,18,65,87,132,209,123,99,222,244,249,54,12,201,35,247,226,154,243,40,138,229,170,35,46,208,4,72,89,35,15,31,33,200,118,216,159,43,231,241,17,134,47,215,48,88,216,110,201,207,242,235,246,167,209,240,141,138,180,219,245,142,236,148,207,60,48,151,143,56,155,105,236,48,36,63,241,214,70,88,242,190,11,93,243,208,196,67,159,231,130,45,137,225,50,9,21,82,244,25,61,188,238,216,253,211,128,83,231,134,107,159,49,142,176,166,35,177,222,92,195,14,104,161,155,11,227,67,187,123,236,26,187,175,96,143,134,14,24,90,218,53,70,83,72,75,222,44,250,93,107,68,222,89,75,105,85,108,203,220,45,254,24,58,249,242,31,59,161,176,193,214,108,44,172,227,173,230,118,55,19,105,162,99,27,62,243,61,186,31,254,18,192,9,127,239,134,113,207,119,202,51,164,141,157,174,72,153,189,112,67,33,15,198,78,86,204,220,211,156,218,228,250,219,185,19,78,167,40,25,106,56,205,246,106,101,4,168,208,249,75,151,189,109,119,208,246,245,214,161,131,234,119,172,2,79,248,88,179,92,231,11,2,25,45,41,16,25,157,47,41,32,84,76,122,31,37,134,157,31,45,165,62,154,154,51,25,45,53,170,100,100,55,144,82,189,158,250,79,117,232,231,251,157,144,118,34,228,232,229,248,174,170,86,179,213,36,160,21,117,39,27,58,51,33,177,238,117,157,142,134,100,169,10,81,76,20,110,82,210,106,202,163,135,156,240,229,104,72,206,151,163,97,83,63,197,157,252,165,238,203,4,210,24,77,54,185,73,239,87,142,58,192,105,156,73,29,192,209,222,126,184,94,181,226,221,123,178,217,4,171,40,245,207,193,174,12,89,205,247,213,205,224,197,102,46,55,15,96,115,14,54,238,239,93,155,180,65,186,12,125,255,212,130,132,130,242,201,93,244,136,71,96,167,241,51,174,87,56,33,240,207,45,38,208,115,246,198,82,68,70,203,241,71,57,1,105,246,1,251,146,109,29,160,218,63,147,0,115,160,41,172,26,212,153,34,213,74,237,147,69,13,2,117,245,220,92,41,190,32,184,79,102,51,145,93,39,47,71,2,19,83,13,95,144,95,176,167,231,33,209,148,152,182,212,154,70,169,129,184,205,133,5,193,141,154,248,96,33,30,41,130,19,249,62,28,125,176,105,242,171,56,246,181,78,196,27,134,195,76,76,243,232,151,14,163,56,56,77,167,184,160,41,41,160,218,246,81,110,100,153,100,116,56,206,14,217,56,219,219,211,157,20,148,159,100,239,73,77,11,141,117,244,130,158,240,125,196,167,166,134,250,37,13,106,255,185,90,201,184,244,253,187,65,129,33,76,80,91,36,232,23,68,53,133,12,71,37,82,181,118,224,118,217,16,40,151,22,123,69,56,168,64,128,193,41,149,176,117,7,166,44,86,246,104,191,84,133,97,253,205,198,162,103,155,77,166,139,114,173,18,145,227,166,126,147,27,161,70,197,83,115,223,199,255,83,222,54,212,196,50,66,71,4,253,160,118,155,209,223,17,102,201,104,44,73,65,107,29,63,196,56,94,102,95,173,3,29,111,148,116,69,82,26,203,177,117,154,143,209,186,170,71,115,90,55,225,134,247,40,40,213,179,52,36,243,70,50,5,166,48,144,85,251,122,15,250,228,247,192,66,147,97,72,76,149,218,234,34,144,100,221,45,194,11,106,82,146,52,92,7,189,160,175,178,248,253,172,240,210,112,179,73,35,183,6,153,82,218,219,199,155,109,153,114,115,203,214,38,171,27,161,239,99,197,147,153,183,46,42,40,155,201,35,20,174,161,160,201,156,22,218,198,96,203,37,253,61,72,35,53,126,211,86,47,168,36,203,144,44,183,225,40,147,193,156,152,54,232,203,147,158,202,66,32,2,237,174,69,243,83,218,142,156,165,65,218,140,170,88,160,196,61,174,173,242,178,243,248,61,56,11,195,177,29,116,30,34,86,133,254,139,194,247,51,25,164,228,204,220,27,55,40,32,193,49,12,1,177,99,220,87,232,242,68,75,3,178,164,122,100,156,82,75,8,212,131,203,205,230,133,234,40,156,52,212,68,53,216,161,81,76,239,202,96,57,169,79,202,247,163,179,144,204,232,239,65,220,16,107,182,13,73,59,247,144,204,123,237,146,241,229,138,158,202,96,222,52,175,40,165,103,19,221,96,84,89,245,240,26,210,220,212,80,154,85,169,21,94,89,153,233,210,218,121,239,211,109,213,70,248,190,203,100,235,29,38,153,251,190,229,2,61,93,147,251,223,217,66,205,48,13,89,43,186,156,68,75,236,126,217,107,137,90,245,40,61,51,91,241,133,218,122,93,188,82,185,53,246,91,75,146,116,75,48,243,162,22,187,187,195,189,225,184,203,107,100,78,83,103,10,105,132,19,58,219,108,44,125,108,79,138,20,77,195,205,198,81,242,189,249,85,172,16,174,83,151,95,82,151,45,42,58,71,203,135,108,17,142,206,72,76,127,15,170,102,159,99,135,45,82,3,108,44,145,182,169,154,196,146,182,68,234,237,219,53,207,183,68,88,14,32,243,43,232,221,178,177,240,125,36,137,213,58,141,81,136,105,58,142,15,151,209,114,28,163,99,167,186,152,153,46,226,189,126,63,28,207,154,245,79,50,25,204,200,89,56,138,85,183,190,31,204,92,145,52,243,199,183,200,44,84,121,181,101,203,12,65,175,250,132,236,44,155,78,76,211,144,100,50,88,146,187,184,248,150,42,203,208,56,91,21,93,234,253,82,68,122,109,222,214,173,199,234,205,215,26,128,94,201,175,103,248,149,84,165,31,190,191,82,158,132,142,0,230,36,13,73,175,210,201,71,223,55,22,169,164,180,47,36,207,138,89,95,211,235,137,52,4,107,168,75,30,211,23,53,30,139,64,97,209,191,162,76,60,193,202,117,224,193,227,208,247,31,31,209,39,50,90,250,126,38,131,39,146,60,70,187,174,245,88,171,179,202,243,226,41,38,27,235,112,125,170,212,153,182,62,118,77,237,99,155,139,92,54,156,166,231,179,236,168,17,203,196,149,166,222,54,180,46,254,73,74,230,239,85,185,225,92,63,242,253,94,144,106,221,235,251,165,54,214,105,211,87,169,184,206,169,221,14,194,245,84,229,242,52,217,207,128,252,6,228,41,144,107,78,162,224,30,215,165,21,103,224,232,135,51,160,231,89,145,148,231,228,55,160,215,31,101,28,210,114,117,61,146,32,100,80,176,101,54,99,178,228,81,45,128,223,157,33,128,51,214,41,74,115,38,195,169,42,7,138,231,22,156,27,156,190,129,149,211,98,252,20,232,11,44,236,233,171,212,220,125,60,153,208,15,145,72,228,154,125,130,153,249,227,108,154,171,141,85,143,78,65,249,174,129,140,78,79,227,60,139,207,108,118,68,223,96,66,168,51,18,206,77,38,37,207,166,181,4,29,68,169,123,66,94,228,157,70,246,34,196,1,84,101,2,143,78,79,165,189,235,56,67,63,242,64,210,126,191,137,227,119,162,107,92,35,46,188,83,184,249,214,45,148,125,10,246,148,143,83,217,9,78,131,107,87,52,248,221,137,145,86,42,226,178,158,14,151,250,135,139,55,200,192,5,254,64,53,226,238,34,126,230,174,151,10,81,206,68,91,30,49,209,215,182,146,132,202,81,160,11,40,40,186,187,21,135,37,229,196,180,113,231,248,76,218,67,67,180,103,44,13,163,211,49,107,21,52,139,82,91,89,130,91,184,161,199,134,129,50,186,142,229,106,116,143,96,104,166,99,41,39,63,235,222,128,34,209,151,233,72,110,158,19,53,67,115,163,24,1,193,73,153,230,176,50,191,116,28,59,98,100,58,98,190,207,162,41,193,53,232,103,54,221,107,174,56,43,68,230,4,116,24,193,17,166,11,142,183,202,131,87,69,165,239,36,98,55,25,22,192,222,135,22,233,212,224,251,47,248,172,212,198,23,154,181,191,196,87,148,214,183,110,125,54,214,181,18,69,55,83,93,92,78,65,23,87,38,171,139,54,165,173,246,194,247,131,34,74,125,0,27,211,20,212,52,9,73,209,238,65,97,115,71,140,180,59,243,51,15,10,194,66,226,196,151,43,55,22,147,254,210,84,57,234,217,35,70,29,212,22,156,152,76,218,223,244,228,189,173,125,41,194,198,19,112,14,214,96,162,212,242,105,59,92,239,73,219,226,55,87,90,158,201,224,21,108,86,156,104,76,184,105,244,84,53,114,98,73,27,108,60,147,152,234,5,32,26,180,54,41,90,78,215,91,68,166,157,19,39,130,30,173,121,84,214,146,151,147,95,80,219,232,60,46,138,139,176,102,111,139,64,98,231,14,66,210,109,193,186,174,78,31,186,179,173,248,198,140,237,136,119,211,78,11,220,51,25,204,229,166,59,69,23,32,96,82,87,189,119,59,110,86,213,41,134,254,161,131,34,89,222,233,194,72,22,105,248,40,17,202,28,191,81,101,35,228,145,163,56,140,202,209,208,151,85,29,111,192,226,145,110,52,248,14,76,73,126,27,228,234,170,44,52,93,210,234,12,173,30,20,202,228,84,162,217,218,34,30,177,216,81,12,191,27,204,152,69,12,207,157,4,207,0,19,170,182,108,77,213,110,169,138,130,165,214,29,19,91,222,165,94,31,253,162,96,65,194,169,112,102,249,251,37,240,75,79,18,186,101,113,168,252,116,255,170,112,220,214,118,170,61,7,202,157,14,127,105,182,68,191,215,219,31,7,96,176,165,37,111,193,37,71,84,155,245,217,187,80,36,173,128,253,128,212,114,90,19,167,21,174,6,183,72,211,218,247,123,60,36,63,32,83,12,53,8,242,64,90,242,200,200,81,90,74,191,92,46,25,81,197,204,34,204,34,33,203,42,8,199,138,101,76,158,174,1,5,219,221,96,154,84,205,245,79,186,248,221,152,0,109,0,90,78,163,18,225,110,170,81,53,36,51,222,113,245,149,179,44,42,177,152,166,139,36,254,192,157,98,126,185,187,59,168,222,96,162,182,89,217,200,49,34,42,139,18,75,155,137,236,236,207,79,29,57,48,208,49,55,243,37,56,51,93,3,216,110,128,49,106,88,44,212,115,42,128,180,129,11,73,171,187,3,104,84,173,116,174,68,104,173,160,189,175,46,48,209,221,114,77,131,222,13,109,41,211,201,251,241,175,10,93,83,129,248,59,30,152,100,27,71,182,67,216,212,247,33,232,168,153,119,188,139,41,181,85,83,252,168,233,22,251,24,12,248,102,99,43,142,213,254,170,42,157,144,161,154,67,49,214,70,201,61,146,247,43,216,106,17,132,130,165,54,208,205,41,14,137,53,49,199,200,154,14,151,93,102,176,66,23,3,57,109,194,160,192,156,253,44,47,167,44,223,108,208,163,2,107,21,218,3,53,141,84,138,238,190,51,42,116,81,102,70,85,185,215,35,48,213,168,234,170,210,90,0,169,40,8,144,108,194,71,8,238,11,202,92,53,245,147,195,87,150,112,174,180,9,151,49,119,171,101,25,69,103,72,52,140,199,177,126,147,85,152,185,80,240,44,14,133,200,233,185,236,156,111,82,165,114,235,115,73,165,122,250,177,251,244,141,122,250,209,62,93,105,119,244,73,167,205,35,108,178,50,45,166,59,181,115,92,225,112,83,243,244,218,206,211,95,149,198,115,44,248,53,235,207,93,163,39,242,253,232,90,139,104,170,169,235,225,143,233,144,124,216,233,73,34,62,188,254,96,198,145,156,238,147,15,146,14,73,44,233,7,167,66,241,88,159,129,177,235,145,221,213,66,107,231,247,246,164,99,220,68,71,80,83,125,122,200,0,189,45,56,160,239,10,83,202,213,176,62,42,25,34,104,0,6,207,239,30,217,82,91,71,50,82,96,131,223,244,187,164,166,194,133,130,123,18,107,125,185,35,68,65,177,217,96,84,21,76,27,40,83,65,196,15,58,46,79,74,37,66,20,110,97,49,163,195,49,59,44,199,108,111,47,204,40,63,97,239,9,246,213,203,38,45,236,235,96,238,105,24,154,211,208,246,217,196,189,114,60,167,52,28,23,10,206,73,255,141,254,38,67,82,251,254,188,221,215,121,3,128,219,54,79,195,237,165,249,164,129,153,146,64,40,212,247,223,130,246,89,207,151,71,136,151,183,213,120,65,79,184,40,74,79,98,124,133,70,230,101,120,69,165,30,231,151,20,218,14,200,221,42,211,157,140,67,3,112,232,121,10,187,5,204,66,221,25,21,39,236,253,56,200,26,215,115,194,121,144,17,64,215,111,132,81,106,134,106,123,114,55,200,200,243,112,164,218,89,80,31,239,153,83,10,89,167,152,81,52,231,252,94,143,53,211,157,19,78,143,17,101,38,140,174,72,70,37,194,203,215,72,77,239,145,146,62,81,56,50,153,43,214,188,36,35,68,74,26,204,13,239,249,126,240,100,179,233,157,203,205,102,101,79,39,144,21,62,119,147,11,19,19,133,104,113,197,196,174,50,152,161,18,124,20,169,189,189,15,168,96,89,220,238,176,245,135,240,174,235,18,145,198,126,106,175,77,98,4,82,128,65,166,208,246,34,160,23,132,36,54,162,130,251,113,222,17,143,153,42,110,70,171,116,28,146,118,200,227,163,161,214,231,182,234,250,120,239,220,166,36,102,116,56,158,29,218,203,241,108,111,47,140,79,142,247,102,239,233,249,201,236,189,174,225,54,230,63,166,231,58,215,139,89,183,121,19,63,124,162,160,117,70,143,199,179,195,216,237,56,8,94,211,248,100,246,62,236,72,201,235,43,165,196,158,15,116,86,209,116,134,254,149,93,100,179,36,21,127,233,212,208,7,39,242,240,125,135,244,82,39,207,132,220,60,215,251,103,102,138,36,248,224,206,148,243,224,195,201,236,61,105,83,119,142,7,213,211,30,193,7,185,183,71,62,56,206,133,213,200,130,126,24,9,189,138,40,138,62,168,154,64,149,215,106,131,99,37,215,50,36,149,137,47,87,210,45,29,88,57,121,85,213,180,0,114,78,129,28,83,78,62,80,65,86,148,33,175,102,200,118,200,115,53,242,91,137,236,150,58,178,129,98,137,54,82,159,20,128,79,36,171,140,152,23,220,230,224,117,50,7,183,114,176,223,216,75,67,155,193,254,152,41,182,239,244,167,29,245,128,159,136,247,90,41,241,168,66,87,20,35,68,234,186,89,109,200,121,222,40,227,222,121,171,69,32,212,133,203,250,72,146,122,35,120,186,249,173,77,228,129,213,153,63,170,131,85,63,96,96,55,116,61,178,31,100,215,153,178,98,114,69,110,14,198,226,176,49,20,98,111,47,84,244,194,69,184,206,153,188,202,156,89,219,177,214,138,116,220,86,146,156,203,241,148,74,130,158,131,46,232,15,192,102,228,38,42,104,25,189,83,254,182,235,164,43,29,54,118,125,110,13,123,50,74,251,118,34,253,9,51,32,6,102,67,165,254,176,77,54,126,13,190,255,134,27,198,126,222,200,35,174,186,97,160,115,252,232,194,20,189,105,231,124,123,119,89,132,163,73,125,209,216,92,55,114,183,12,178,147,110,125,32,155,214,152,177,220,53,6,134,111,86,205,6,40,196,161,176,71,119,35,190,60,252,32,213,188,249,146,126,144,228,156,186,210,101,126,157,28,191,71,231,123,114,188,183,55,178,13,38,231,202,221,209,74,200,229,29,137,188,115,222,120,65,26,185,14,244,4,38,19,243,163,163,95,12,54,213,49,112,77,162,216,213,73,171,247,163,172,29,104,21,110,54,153,238,99,133,161,179,205,195,112,75,121,218,6,134,22,54,113,101,173,160,82,229,123,141,171,81,183,116,173,93,211,95,24,211,143,117,16,58,63,11,210,124,33,168,41,228,144,246,96,178,194,174,214,5,149,6,177,46,162,165,197,70,20,108,244,210,244,90,92,82,213,155,13,227,152,17,246,253,160,196,250,140,34,84,167,69,244,25,158,18,161,174,118,129,106,22,56,253,143,19,123,232,198,234,44,115,10,104,44,176,7,229,142,232,115,62,166,165,220,105,169,167,236,42,69,83,219,42,155,137,227,79,7,51,225,54,73,29,117,50,51,195,113,115,140,161,123,128,29,157,213,238,161,71,231,56,131,108,206,170,118,180,18,195,18,186,182,231,43,220,35,209,138,205,19,23,146,125,130,85,156,46,46,251,132,54,159,47,17,130,14,190,219,191,253,125,235,60,223,213,58,74,70,41,10,159,47,196,166,57,151,37,232,73,95,150,117,60,87,97,76,159,232,11,12,137,251,206,215,4,50,225,96,104,76,184,66,96,58,202,69,115,130,252,37,116,78,154,223,133,157,120,224,158,171,11,176,212,9,117,123,121,94,0,183,181,100,42,154,82,40,63,34,10,113,185,168,74,1,201,43,38,231,120,132,97,179,57,121,143,7,13,79,134,239,55,27,25,73,198,103,32,199,119,193,48,99,161,156,244,187,160,195,104,68,227,121,89,234,67,126,182,192,129,217,175,227,4,181,226,139,82,217,30,84,247,148,54,159,135,218,108,240,74,103,47,176,166,204,116,68,109,81,203,86,187,241,109,95,208,36,184,7,251,246,20,72,121,72,83,133,157,150,138,59,113,214,133,51,107,146,245,40,85,22,19,79,240,155,243,101,111,212,163,62,89,239,38,71,103,78,97,186,151,109,54,124,187,181,201,253,21,89,126,10,196,183,6,168,34,49,130,5,89,55,52,157,209,44,98,66,100,179,2,146,227,188,148,74,213,40,69,129,105,7,188,154,151,66,110,54,234,21,123,96,236,53,205,78,250,167,167,253,61,161,206,80,189,238,53,41,211,44,74,50,129,243,77,218,69,170,10,11,20,131,15,16,188,214,154,250,100,37,73,20,69,79,228,123,250,122,188,146,230,48,92,70,78,236,109,227,139,189,214,62,66,70,164,173,120,124,28,174,171,73,172,181,225,227,112,84,209,199,91,37,144,49,126,97,33,191,87,79,167,57,108,54,51,196,121,244,127,237,25,232,113,70,103,216,184,210,81,60,242,230,99,148,211,56,188,234,67,23,90,61,60,222,226,25,101,252,85,109,29,15,201,178,130,41,122,240,100,212,217,59,242,40,152,171,93,88,118,160,206,194,145,230,79,125,132,76,194,162,202,213,103,124,172,90,194,179,80,5,240,31,222,60,127,166,76,71,149,179,24,240,19,98,253,195,222,81,159,244,15,123,131,193,96,112,212,71,248,8,15,54,98,145,93,51,100,41,92,247,100,58,230,87,31,84,235,222,150,132,59,32,155,139,14,215,157,238,2,240,47,52,84,73,4,97,180,39,35,245,190,248,37,147,115,61,187,208,61,211,36,220,188,185,160,133,8,216,68,142,84,187,61,25,90,235,200,55,155,223,96,210,144,39,91,224,7,215,84,10,76,33,92,35,17,197,121,89,128,186,131,112,183,49,113,111,57,198,163,53,205,20,106,166,178,127,227,82,168,99,161,109,214,160,93,72,106,22,226,130,170,166,20,211,93,111,98,154,217,20,190,190,52,42,111,118,69,97,159,106,177,214,124,63,2,194,138,120,94,242,17,39,21,47,43,49,18,116,189,37,176,196,15,45,141,24,81,155,181,146,163,140,100,133,228,229,168,192,15,217,132,235,123,182,100,167,110,52,106,73,151,230,187,111,58,247,59,28,87,135,75,235,73,86,54,222,141,233,242,164,82,2,217,171,149,189,137,195,112,93,171,19,38,177,238,113,70,51,188,59,86,199,78,30,226,60,240,219,109,80,0,15,98,114,79,146,117,133,170,96,9,163,153,81,44,175,233,76,155,252,56,28,191,110,235,133,154,47,192,125,69,63,100,166,141,123,76,246,195,112,212,92,188,198,116,248,118,59,46,3,20,69,17,134,228,165,62,12,83,134,166,146,195,164,83,231,244,41,119,139,147,248,100,98,177,51,181,203,193,143,88,193,105,133,229,1,15,150,100,109,74,130,71,234,181,237,150,84,186,216,43,11,215,47,121,176,54,107,139,233,189,113,28,197,52,219,170,35,235,209,181,107,122,103,40,11,73,74,101,80,17,17,110,54,235,45,158,39,185,171,190,118,163,129,213,102,27,80,119,212,120,100,94,67,200,93,58,84,228,158,180,227,24,26,86,225,120,48,136,85,52,211,18,240,147,239,34,221,204,161,222,170,37,92,69,226,112,251,178,249,214,3,86,50,245,40,229,190,191,116,180,246,196,244,170,233,131,58,168,45,250,18,170,27,172,37,33,169,194,217,230,162,243,193,30,205,218,149,160,253,91,125,53,253,23,48,54,225,129,54,133,135,253,186,143,133,127,47,108,102,31,243,223,234,251,78,147,73,176,115,7,179,100,97,180,156,76,130,23,16,45,45,59,135,250,115,14,149,8,199,199,150,215,151,130,214,34,248,203,225,28,88,2,92,127,186,140,246,167,37,79,128,15,166,158,249,33,80,51,14,14,134,67,111,58,27,156,207,51,9,215,191,31,122,248,185,136,132,151,213,96,154,215,220,75,24,63,27,117,218,223,25,14,205,221,153,185,243,253,173,225,245,239,135,253,163,195,130,45,237,88,139,213,128,213,178,244,210,28,86,222,130,173,6,231,131,219,171,220,203,36,44,196,32,134,66,2,247,62,212,66,102,233,197,96,10,242,28,160,240,102,172,26,220,246,170,21,254,115,49,184,233,161,56,15,196,194,252,175,134,186,109,7,119,238,221,24,226,216,204,195,111,252,209,254,191,200,178,234,219,89,168,209,59,99,226,24,7,186,199,41,19,224,165,101,33,7,2,22,217,180,204,19,119,164,239,135,67,175,133,204,189,121,185,4,174,71,173,120,182,96,252,98,103,46,138,126,250,250,138,182,122,142,217,98,230,9,30,211,126,202,150,89,92,22,145,88,206,250,30,203,37,237,255,200,248,50,19,94,94,206,202,102,246,243,193,109,239,124,112,187,127,253,200,211,143,15,175,179,35,239,48,201,26,42,207,179,36,129,226,242,10,111,123,139,100,132,139,119,9,147,2,195,106,94,209,244,255,149,203,251,212,114,30,153,254,244,172,154,97,62,148,53,47,224,226,91,141,242,75,201,207,210,188,60,223,25,5,75,94,178,69,89,168,239,79,126,163,161,142,101,201,179,75,235,153,129,28,40,67,12,201,183,26,232,49,150,117,235,46,113,176,195,235,73,182,252,210,144,102,171,57,126,244,13,146,65,62,67,161,117,71,172,86,131,155,40,55,7,154,167,23,144,100,181,145,29,205,155,151,38,237,116,240,221,112,136,44,147,21,121,86,192,64,115,206,107,248,88,3,6,53,234,123,176,122,162,5,91,30,29,94,215,106,229,200,59,92,176,172,240,178,132,246,93,161,179,202,100,87,154,46,41,141,75,146,188,175,164,68,128,49,254,186,59,14,57,147,217,18,60,156,51,114,194,192,144,98,58,27,204,56,75,50,40,228,64,150,131,169,250,110,111,179,162,91,67,79,150,174,84,170,167,187,99,151,237,252,250,71,174,100,177,169,40,243,90,170,111,242,130,28,172,6,216,93,53,24,122,131,223,7,251,67,111,62,248,238,224,11,19,184,49,28,94,191,161,38,161,8,175,237,137,135,74,117,112,99,149,59,115,178,47,124,63,28,94,63,184,213,111,216,193,153,205,39,180,41,94,14,226,50,87,50,191,111,85,231,116,112,48,244,42,57,56,184,233,137,197,8,127,220,241,242,153,82,7,3,116,189,243,217,168,163,48,242,217,72,105,197,29,10,232,97,14,86,185,39,42,22,195,224,98,112,7,55,167,98,205,206,56,220,114,181,98,55,151,150,103,211,58,207,93,174,221,119,184,118,191,209,246,151,184,215,229,81,203,67,46,205,110,186,140,100,31,28,40,221,1,121,92,46,212,71,145,173,2,197,249,31,121,135,243,253,70,148,241,173,155,72,204,174,37,224,44,62,203,138,217,64,102,179,185,220,101,101,177,208,163,221,178,27,217,138,89,255,232,174,87,149,121,38,230,144,120,57,171,139,120,94,225,55,165,75,142,159,82,41,32,150,144,120,48,205,206,192,131,85,5,60,131,34,6,17,29,94,159,239,31,121,135,85,103,90,249,204,203,129,161,239,53,184,227,78,225,187,79,89,193,227,10,107,16,43,47,97,98,62,45,25,79,4,241,94,190,185,235,165,25,95,156,51,14,196,147,128,161,145,228,23,30,43,18,143,103,232,30,64,49,99,51,21,48,97,9,35,243,68,86,204,114,240,206,75,126,166,182,94,127,127,52,5,200,133,55,103,69,18,115,150,226,42,112,77,139,50,1,94,120,139,114,154,229,153,188,240,36,176,5,174,166,234,50,176,226,145,14,187,222,64,34,90,158,116,205,212,85,202,207,229,180,115,205,71,95,195,112,87,42,73,229,92,220,248,188,11,160,213,134,152,179,164,60,199,94,204,47,167,39,228,186,47,41,212,180,140,107,49,88,102,234,195,188,163,178,150,184,136,171,239,42,173,125,213,253,50,77,81,255,124,234,177,59,156,88,140,206,149,154,64,75,198,184,84,95,30,151,101,205,119,12,218,37,63,224,111,160,174,114,12,173,63,233,200,222,215,18,218,157,255,101,114,118,187,189,57,28,94,101,109,239,252,125,41,125,208,165,244,43,14,203,12,206,189,212,113,134,172,2,175,243,70,151,202,193,157,70,141,186,36,249,26,161,62,204,179,43,252,89,37,34,90,146,118,212,242,66,14,246,61,119,79,231,131,239,189,243,193,247,127,90,71,255,141,90,248,63,255,227,127,88,189,251,12,237,120,171,130,80,129,136,10,32,33,158,44,249,199,26,136,87,149,231,192,181,110,98,197,12,254,243,175,255,211,108,132,199,240,99,61,179,28,129,169,232,240,122,158,29,121,255,133,8,243,184,206,18,72,60,1,178,174,60,116,114,132,249,232,179,193,44,245,119,184,120,153,231,192,133,34,143,128,66,148,92,160,198,94,100,5,22,80,255,215,163,202,49,196,184,116,180,96,250,43,33,194,59,207,228,220,67,209,91,168,15,4,206,129,229,114,238,197,115,136,207,12,93,88,10,30,18,10,227,88,67,147,195,235,117,126,149,91,213,184,150,153,40,81,222,172,246,211,174,207,42,255,132,75,56,224,232,19,12,110,123,3,116,9,247,15,188,249,224,230,208,59,199,127,118,233,34,32,46,213,71,154,81,123,161,59,216,245,255,58,45,190,83,100,233,123,140,103,204,248,184,24,105,212,208,255,236,220,119,221,98,59,5,28,228,106,253,188,63,28,94,255,174,13,250,189,10,149,147,182,112,232,238,225,65,141,193,190,254,207,217,153,235,183,63,135,13,92,181,183,29,128,224,59,115,179,211,173,110,221,63,218,1,42,62,237,81,186,80,129,1,8,86,194,171,171,10,120,172,244,169,117,219,78,134,209,193,45,88,188,247,62,19,178,119,131,115,197,114,74,65,161,87,212,120,138,174,168,124,138,235,111,41,123,119,67,251,177,223,208,127,125,195,89,150,43,23,203,76,199,9,189,92,79,29,121,209,90,151,219,253,163,29,47,242,198,101,231,246,138,192,204,245,96,31,50,252,244,116,150,204,192,123,86,150,213,37,111,110,198,179,196,195,127,208,155,19,131,3,131,57,252,33,188,6,25,186,157,232,37,162,233,166,183,174,120,253,166,118,116,1,99,231,202,117,153,149,34,83,13,15,254,240,138,111,28,120,103,139,235,115,236,209,145,181,191,97,130,247,152,148,192,47,190,225,20,191,187,243,175,223,110,122,111,148,185,253,134,179,187,125,211,123,177,248,118,243,123,136,232,14,195,32,67,185,1,223,112,162,55,111,123,103,206,68,175,210,172,70,202,177,239,142,144,163,6,172,118,113,201,47,73,247,141,171,164,91,3,29,93,234,216,21,160,79,89,122,50,171,174,88,52,130,50,51,4,181,181,234,159,114,134,202,206,227,16,163,21,128,164,171,174,118,186,253,238,95,173,82,195,47,61,150,53,247,48,183,131,127,47,2,149,108,228,61,44,152,242,179,106,196,50,202,82,72,140,155,205,39,0,60,4,243,245,159,44,194,225,103,23,209,46,9,47,255,123,37,130,161,84,71,139,96,184,144,175,194,45,196,98,212,42,150,27,93,3,220,217,152,142,101,107,144,236,235,119,28,48,251,14,110,151,81,75,198,142,24,51,39,22,127,6,230,214,54,112,145,232,189,204,33,149,151,116,237,14,126,113,133,97,58,207,18,248,42,17,184,223,160,5,104,143,132,135,121,123,204,82,92,161,246,12,160,253,199,21,253,254,193,217,222,142,208,254,99,18,251,238,18,56,155,129,113,192,101,182,128,111,72,229,131,232,6,250,232,255,36,52,38,13,12,18,229,97,201,1,8,245,205,98,111,81,22,114,254,13,9,126,243,206,101,237,100,80,101,244,232,12,190,140,184,245,37,44,196,80,75,94,222,131,142,199,140,14,218,215,230,198,118,96,85,163,8,91,29,136,218,239,42,232,245,134,3,189,222,68,31,249,224,75,110,221,103,49,203,221,84,149,197,48,111,98,156,243,112,9,252,66,206,209,152,92,148,181,87,0,36,74,251,35,210,231,213,69,90,98,6,94,29,64,215,218,8,241,202,131,171,240,202,175,241,253,76,174,107,138,161,128,240,146,140,205,138,82,200,44,22,196,99,5,203,47,244,79,141,77,234,63,203,129,243,194,224,206,226,152,94,201,227,57,254,157,35,166,119,178,144,165,87,22,24,36,207,1,51,229,45,118,25,125,66,234,208,154,30,104,107,164,109,80,199,240,28,40,80,188,99,135,24,151,89,156,195,159,149,218,239,181,212,182,146,234,160,93,73,173,215,161,176,37,141,112,233,156,129,234,9,99,10,125,179,197,35,191,86,176,191,83,177,213,141,206,38,253,97,105,234,130,54,135,215,231,55,118,228,244,70,227,17,89,180,250,246,87,241,193,177,228,192,22,22,1,138,89,130,80,184,133,130,212,126,67,154,102,49,34,228,23,136,115,112,96,185,210,205,26,5,152,65,57,227,172,154,103,88,212,116,49,96,138,49,90,228,219,236,188,217,55,4,64,255,97,119,208,160,75,77,1,28,78,245,27,238,227,203,66,81,220,133,168,72,131,79,225,54,234,12,162,74,174,122,53,102,23,188,24,103,129,58,198,212,103,137,54,199,128,155,94,114,153,131,248,231,22,182,91,232,102,113,190,225,214,189,170,197,220,107,254,152,9,203,187,56,219,180,206,114,57,200,138,46,204,70,48,119,61,67,191,180,204,243,178,150,122,143,45,228,166,0,56,121,225,21,32,255,185,127,237,254,25,60,0,77,21,228,121,54,67,85,247,45,247,145,67,146,197,24,204,97,70,90,17,130,120,153,250,67,154,41,166,250,202,5,203,81,250,148,82,85,127,194,208,171,112,179,242,44,53,218,84,125,26,31,179,221,232,59,252,115,231,218,157,59,214,252,204,114,224,82,124,195,45,123,13,49,40,236,89,253,61,51,233,21,165,204,210,44,86,164,16,42,53,34,231,192,23,12,157,192,236,12,4,81,72,175,41,140,245,116,113,157,118,138,88,158,123,9,72,237,214,254,115,231,90,157,89,129,242,13,81,38,20,85,191,225,238,61,224,101,101,138,10,180,251,169,0,149,198,125,245,212,159,139,195,63,199,89,49,46,11,76,105,85,149,205,94,120,231,144,231,3,91,179,136,190,79,90,99,20,50,168,120,89,166,222,221,87,79,118,54,241,107,34,153,221,178,171,134,156,183,212,126,186,17,75,55,244,251,255,33,60,185,235,85,90,193,169,8,164,98,114,110,255,72,183,249,92,145,254,187,215,101,82,91,25,248,243,209,201,67,22,207,61,33,161,242,48,70,65,11,136,157,11,134,78,48,250,158,194,236,53,86,58,120,49,43,116,190,216,83,127,166,85,71,71,4,101,217,100,223,75,252,58,82,39,8,41,243,79,198,32,139,100,39,232,104,83,121,127,179,216,254,33,201,235,160,136,58,39,184,143,25,174,253,225,159,202,10,222,182,89,193,207,214,91,244,143,246,219,250,156,27,157,228,134,221,191,63,38,255,6,65,243,230,140,39,223,218,111,98,25,255,180,191,59,85,198,62,3,17,89,21,161,64,85,173,163,5,98,170,76,149,203,88,139,140,248,237,98,161,254,174,112,165,254,152,171,181,191,59,249,220,127,8,38,56,248,182,76,240,166,46,64,201,98,91,109,245,13,249,224,126,45,100,185,200,126,7,27,181,198,53,95,162,173,230,136,211,163,74,74,179,220,238,50,98,100,152,204,51,118,192,26,254,202,148,144,36,76,178,127,224,125,191,241,109,247,253,1,84,121,121,225,249,8,46,102,178,228,223,58,104,114,74,234,208,174,97,113,27,150,255,235,64,73,187,217,120,212,166,241,168,209,136,88,147,32,28,11,194,114,14,44,185,240,36,175,133,43,247,135,215,203,252,11,38,255,202,26,232,191,51,128,121,235,51,30,194,193,223,209,67,120,131,228,131,196,155,154,18,68,239,124,94,122,229,84,128,16,202,111,110,140,243,223,228,27,220,171,179,60,81,234,94,111,55,126,29,19,63,185,104,75,114,248,50,195,114,73,53,1,14,249,5,122,5,198,2,32,197,202,37,120,41,19,40,45,168,1,202,90,170,172,142,250,228,25,162,34,58,116,254,74,200,242,78,23,163,60,232,31,29,218,82,161,142,236,42,121,108,74,47,119,11,41,254,148,106,105,202,69,22,201,31,83,45,211,188,140,207,62,214,165,132,93,234,187,249,5,43,141,223,125,169,60,78,215,11,253,245,63,12,137,231,144,87,144,120,181,48,117,183,30,115,74,110,165,170,165,80,117,183,89,225,157,3,156,9,165,129,129,37,120,242,72,165,32,68,228,189,153,131,139,72,123,12,79,199,121,21,203,18,27,146,169,109,140,254,243,175,255,235,240,122,187,156,35,15,137,143,201,82,167,114,29,171,254,46,229,82,190,124,234,228,114,65,241,2,242,140,121,247,231,80,236,36,73,190,178,226,66,103,94,212,78,115,226,189,40,185,156,171,63,30,239,221,195,192,82,179,91,59,125,125,81,115,179,168,127,72,142,122,89,243,70,156,99,142,245,157,250,176,170,55,103,66,101,26,26,156,89,3,151,103,0,149,192,160,156,95,56,110,161,65,211,18,109,15,212,67,157,213,80,72,44,162,51,127,87,62,122,86,103,194,123,201,37,204,216,223,192,71,207,80,98,30,22,179,172,0,228,166,183,124,202,138,231,165,134,148,63,197,72,95,19,192,94,85,247,253,185,179,31,110,225,133,54,103,238,90,63,115,150,227,98,48,244,116,5,223,208,50,243,249,96,255,250,13,175,133,46,86,234,250,211,197,124,183,116,217,150,45,230,251,218,154,189,175,57,198,97,170,33,190,112,96,99,71,232,254,95,196,231,29,243,250,90,251,40,165,7,57,224,159,75,213,14,12,126,5,14,237,28,48,1,147,207,218,213,78,225,203,211,12,161,145,52,181,112,200,204,20,191,178,34,153,150,43,79,178,44,47,185,78,64,170,97,90,129,34,136,168,76,203,242,12,85,59,194,94,186,135,2,143,48,40,126,84,56,64,206,76,125,139,1,168,63,101,80,191,254,80,194,130,101,185,44,71,115,200,243,242,191,127,80,214,38,103,83,252,43,166,203,254,159,61,13,163,15,39,24,119,236,143,87,203,127,242,112,194,247,95,62,156,112,235,239,82,49,111,241,211,120,14,73,141,133,69,184,145,75,224,194,228,159,190,254,80,194,159,58,141,160,173,203,119,127,240,204,199,85,100,211,61,237,255,61,137,246,112,85,161,12,40,127,3,19,100,105,201,23,237,209,130,93,69,122,120,29,15,226,161,237,40,75,121,233,188,175,252,244,121,95,85,177,122,240,183,197,1,95,161,204,28,161,194,223,157,237,20,139,171,149,217,209,101,77,242,199,172,157,61,241,245,137,202,193,175,180,118,232,15,182,78,100,115,204,73,195,187,202,244,99,114,51,199,48,0,132,61,13,117,213,241,174,47,104,160,115,206,42,183,170,249,43,167,119,200,190,205,145,212,75,98,120,233,116,239,55,29,198,130,213,151,78,247,126,211,81,58,241,241,238,233,222,111,58,146,235,187,32,236,40,89,44,119,197,181,203,133,221,2,46,91,200,254,133,10,170,91,184,229,255,231,127,123,7,195,131,155,54,174,124,134,118,200,187,155,231,218,167,193,184,19,29,87,72,12,207,105,149,112,244,23,178,31,182,223,213,88,57,159,78,89,10,252,36,173,249,20,71,34,130,149,104,190,184,209,124,86,225,99,13,252,226,24,240,175,40,148,60,232,255,11,171,170,62,126,4,250,191,253,95,212,22,197,134,54,148,0,0 };
-const char datagzip_assets_index_BiYBMfdF_css[32878] = { 31,139,8,0,0,0,0,0,2,3,236,189,109,143,227,56,182,38,248,87,212,213,72,84,186,218,82,234,133,122,177,3,117,209,187,23,187,192,0,115,231,195,206,238,151,205,200,1,100,91,142,80,91,182,12,73,145,225,40,79,204,111,95,240,77,58,20,95,68,57,34,239,86,100,55,26,157,21,38,159,243,28,158,67,138,34,169,67,242,203,111,127,113,186,188,172,158,203,211,110,219,182,206,119,228,5,94,16,59,255,211,249,143,255,242,127,59,255,181,220,22,167,182,112,254,167,243,216,117,231,118,253,229,11,192,122,219,250,232,252,246,229,239,85,254,82,52,206,185,169,207,69,211,149,69,123,253,123,251,116,62,215,77,215,58,159,63,127,118,159,139,205,161,236,220,199,151,243,99,113,106,215,167,250,84,44,22,78,126,218,57,159,79,117,231,124,62,230,205,67,121,114,187,166,60,174,203,83,85,226,236,133,83,55,206,231,207,238,177,254,195,173,155,178,56,117,60,11,8,110,235,170,110,214,205,195,230,243,190,169,143,78,83,236,156,198,121,112,54,139,197,98,113,253,109,185,222,20,251,186,41,150,235,124,223,21,205,114,189,222,228,219,195,174,169,207,87,215,237,158,221,174,201,79,109,149,119,133,123,89,251,119,163,164,23,57,233,15,158,212,110,243,10,11,5,240,231,139,248,243,15,254,179,169,59,170,162,60,149,93,153,87,66,234,139,50,245,15,49,181,61,20,207,99,121,146,54,146,62,231,167,49,12,39,141,81,229,105,251,232,254,81,215,199,17,227,57,223,22,238,139,219,20,223,139,166,45,122,91,73,242,101,156,188,43,191,151,59,69,250,166,110,118,69,227,182,221,75,85,172,219,186,42,119,2,94,162,127,104,242,29,174,92,247,92,183,101,87,214,39,177,80,125,54,174,223,245,95,125,223,31,203,125,47,115,101,122,87,43,147,219,174,62,183,26,29,223,203,220,152,143,203,48,148,211,255,164,16,239,115,99,41,187,171,135,220,192,231,217,85,145,239,202,211,131,168,113,95,159,58,247,185,40,31,30,59,49,163,107,242,237,65,130,183,143,249,174,126,94,251,142,239,0,147,105,170,75,31,17,5,222,205,171,243,99,14,138,82,158,218,162,211,144,193,60,21,165,144,63,38,110,202,211,131,74,136,164,155,244,233,4,65,174,90,156,100,17,148,66,99,189,223,99,241,231,114,215,61,174,253,243,69,206,162,42,255,186,223,239,229,60,181,194,250,169,195,125,147,220,238,55,213,211,168,240,155,6,215,235,169,104,71,205,108,91,159,186,38,111,59,169,241,189,144,14,69,76,126,124,42,88,103,49,246,204,247,162,25,81,212,231,124,91,118,163,94,160,205,187,167,70,18,111,139,115,153,139,73,184,187,228,70,235,50,84,117,4,179,199,13,2,230,181,229,31,163,66,240,78,90,229,187,62,75,227,196,30,160,246,102,159,173,113,107,159,175,243,111,15,80,57,186,207,84,122,188,207,85,187,126,200,86,212,1,198,75,125,99,145,183,133,220,132,240,139,242,151,95,94,95,95,217,75,185,123,44,142,197,117,221,212,117,183,92,63,214,109,119,117,105,255,210,230,167,118,253,84,146,255,186,109,209,148,251,101,251,210,118,197,209,125,42,151,32,241,151,255,237,124,174,10,231,223,113,21,59,255,199,177,254,71,249,203,242,151,255,94,60,212,133,243,255,252,23,57,225,191,191,28,55,117,245,203,242,151,255,86,119,181,32,117,199,20,31,235,83,141,21,227,255,146,183,203,242,191,255,159,255,81,159,106,247,255,42,30,158,170,188,89,254,71,113,170,234,229,127,212,167,124,91,47,255,189,62,181,117,149,183,203,95,254,107,185,41,168,31,28,12,255,101,249,203,191,215,79,77,89,52,206,127,43,158,127,89,246,116,119,46,109,143,110,83,236,220,216,95,215,135,106,251,248,121,149,122,193,39,199,243,131,200,9,82,47,202,22,2,44,240,123,92,228,37,24,23,133,24,151,6,169,8,12,123,96,150,121,49,6,38,161,19,100,94,20,33,17,24,13,64,223,203,62,57,94,16,32,39,88,121,113,26,136,64,212,3,83,223,67,24,184,10,156,48,244,194,32,89,140,76,225,192,36,242,210,79,142,23,70,169,19,198,94,20,141,24,147,30,24,167,20,136,98,39,76,189,40,140,69,96,58,0,125,98,76,24,68,24,24,7,35,247,100,61,16,33,90,198,52,117,194,196,203,86,43,17,184,234,129,209,138,248,49,64,1,46,99,26,70,3,176,110,242,211,67,1,170,38,35,21,147,56,105,228,37,25,146,128,160,114,98,162,221,143,50,39,141,189,32,145,177,67,253,172,124,90,225,105,226,164,190,151,172,82,9,11,170,136,58,52,8,51,39,73,188,112,37,65,65,37,97,63,5,89,228,196,177,183,138,144,194,42,80,157,220,167,40,245,18,95,198,14,21,149,32,226,173,48,12,29,20,120,1,172,122,134,5,117,21,123,17,105,38,177,19,101,30,242,67,9,11,170,139,152,21,167,78,148,122,145,162,4,67,125,33,214,74,195,8,179,6,41,96,205,143,155,162,129,213,69,156,229,135,161,179,138,189,48,77,199,72,80,95,137,23,98,104,188,194,208,36,144,160,160,186,66,218,176,8,105,138,146,49,18,84,86,234,173,48,50,89,57,171,192,75,252,120,12,29,42,43,11,169,81,217,202,201,144,135,96,197,114,163,250,218,74,40,107,150,225,230,226,103,99,36,168,171,132,182,236,116,229,196,153,23,5,18,84,168,42,210,92,146,200,65,153,183,90,73,80,88,83,180,86,163,212,65,137,23,250,193,24,10,170,42,160,174,10,66,7,197,222,10,86,235,75,81,85,245,179,162,174,18,39,240,113,159,18,74,88,80,91,180,8,126,26,56,129,31,121,193,42,146,192,160,190,16,53,45,92,57,129,31,120,177,92,136,8,62,138,244,169,9,157,85,230,5,65,32,97,65,149,197,164,201,4,43,82,187,171,40,81,24,215,215,217,138,241,34,39,75,60,31,165,18,22,212,90,70,186,131,32,9,113,215,145,69,114,121,133,106,35,14,142,98,220,29,32,36,59,77,168,183,132,245,238,73,224,173,124,185,12,160,226,66,218,37,173,98,7,247,204,176,145,85,229,81,232,17,217,75,40,112,130,208,247,210,56,29,33,133,71,140,212,112,146,58,65,24,122,81,56,38,13,225,171,141,62,226,24,138,188,40,12,70,80,240,140,173,104,135,184,74,156,32,76,188,36,137,71,80,80,97,136,24,21,70,153,19,132,153,151,197,146,81,224,17,203,8,50,114,130,200,151,145,66,119,72,144,78,16,5,226,43,129,0,65,77,69,180,181,196,41,129,198,217,106,4,5,21,197,186,205,16,17,237,171,40,26,65,133,190,144,180,43,63,32,172,126,2,160,15,77,81,156,132,154,34,61,92,144,57,65,28,123,89,152,140,161,114,111,136,144,19,196,137,151,34,137,86,232,14,201,232,34,67,132,119,181,138,199,88,161,67,36,77,59,118,130,24,121,8,173,198,80,4,159,24,92,132,208,95,57,65,28,120,41,124,20,185,101,61,54,36,14,11,131,149,19,32,60,112,145,120,65,133,133,172,189,32,130,13,3,52,198,130,58,99,216,24,155,230,123,126,34,241,10,195,13,58,118,162,229,21,90,55,197,10,35,142,136,61,93,65,28,122,113,4,92,86,28,139,38,175,196,225,224,138,116,140,129,19,36,137,23,4,145,12,134,227,14,242,22,11,157,32,137,60,63,14,100,108,56,238,236,252,85,228,4,9,242,2,69,41,34,248,240,144,150,134,40,120,149,102,50,26,193,7,40,102,131,47,92,144,48,140,84,22,246,117,194,70,96,24,28,122,72,193,12,6,138,124,180,22,51,102,69,169,133,209,34,173,149,204,9,18,252,94,15,101,52,168,67,250,140,146,122,73,18,111,165,114,53,168,197,148,112,251,196,198,204,91,129,134,212,21,121,37,60,121,100,44,136,135,213,153,239,193,1,11,1,10,163,70,210,48,226,128,32,51,248,110,37,80,80,121,180,127,78,8,16,193,135,153,0,35,248,154,34,85,129,123,189,44,192,239,204,17,20,212,90,202,218,123,72,160,171,32,148,76,26,207,0,176,73,161,23,251,209,8,9,30,56,159,87,64,134,188,212,31,123,9,212,85,224,13,54,37,94,180,26,23,84,168,40,242,42,73,49,107,38,78,64,8,20,212,18,123,65,37,17,129,34,8,221,190,228,39,69,53,173,156,208,247,189,44,141,70,72,161,158,8,41,158,173,248,145,23,101,217,8,10,235,137,22,53,115,66,63,246,124,20,140,144,160,162,216,51,19,166,78,232,167,216,184,17,20,84,84,70,135,128,49,114,194,32,240,226,72,178,169,71,6,253,99,27,6,177,23,134,99,253,176,162,40,105,152,56,97,24,136,19,33,2,133,29,35,121,233,196,78,24,70,120,46,50,2,194,87,25,177,29,3,145,23,102,99,70,161,75,164,15,147,19,226,249,223,10,180,188,246,240,34,244,134,41,155,28,135,81,226,37,35,156,80,69,1,27,79,98,96,22,34,17,41,79,191,226,204,9,241,235,214,31,113,70,210,32,61,8,8,82,24,80,99,36,168,32,58,75,10,176,242,208,75,146,96,108,14,24,236,197,108,138,16,226,153,15,116,58,70,130,142,47,163,202,113,49,81,224,173,146,68,68,194,78,143,60,239,200,9,81,232,165,240,37,139,113,194,43,139,140,51,2,39,68,190,151,142,112,66,221,208,7,147,224,178,20,40,222,84,79,112,48,152,178,110,46,140,145,56,141,36,56,97,233,34,100,75,23,33,158,121,192,1,22,129,10,139,23,124,98,134,89,133,198,70,160,194,242,197,138,183,203,56,240,50,216,125,19,168,176,128,65,122,186,36,166,101,13,145,100,19,24,48,208,193,5,54,107,229,101,193,184,172,160,138,216,220,24,119,11,73,232,101,89,48,130,14,117,132,104,109,134,248,185,76,144,23,73,78,205,224,88,28,177,121,70,136,223,97,209,216,3,194,43,137,120,0,37,4,26,135,160,41,151,167,93,249,80,131,202,74,250,241,96,136,7,80,112,32,196,176,176,194,72,117,33,2,77,97,119,199,160,160,194,232,32,31,175,227,32,207,143,86,18,52,130,221,24,105,252,1,5,167,176,194,24,120,168,178,132,77,59,179,208,9,241,20,24,14,154,122,219,192,195,18,179,1,124,152,166,94,0,231,243,12,156,140,95,60,97,194,152,225,147,197,192,41,28,156,211,133,42,66,236,135,114,145,179,113,167,134,215,63,48,56,82,16,131,186,139,89,221,97,230,76,92,6,250,94,214,85,209,9,117,183,98,43,81,225,42,242,210,56,145,176,1,156,255,146,218,11,87,78,136,231,194,176,246,24,56,132,211,41,242,18,140,83,194,44,116,217,12,12,30,56,234,56,210,31,174,34,113,193,144,129,133,71,46,100,11,82,4,140,2,133,125,224,93,68,158,164,216,9,87,161,184,182,201,176,194,83,71,170,47,163,165,240,253,149,4,6,213,71,251,50,252,142,197,19,151,76,46,132,52,28,12,113,47,133,75,17,203,196,112,156,193,150,111,72,133,32,208,56,207,79,205,185,42,20,175,48,228,68,126,230,133,112,101,146,97,133,202,163,243,235,200,137,252,212,11,82,36,129,133,55,89,200,198,58,145,159,120,41,28,149,49,176,240,50,75,217,132,5,131,163,76,6,35,56,140,64,100,54,134,153,99,47,246,145,194,190,209,20,43,76,98,39,242,35,79,54,47,129,235,23,164,27,204,50,39,242,67,113,162,207,192,66,221,37,61,111,224,173,66,185,16,66,229,17,230,32,35,133,72,21,96,97,144,72,26,114,154,56,145,143,188,85,6,218,219,254,105,251,216,150,185,162,254,82,39,10,125,60,110,144,193,194,56,132,190,234,82,39,10,240,162,67,40,163,133,26,140,216,82,112,20,172,132,225,13,7,11,107,193,17,155,10,69,97,224,33,184,82,196,209,112,72,194,214,62,162,48,244,224,40,120,48,16,172,27,146,10,196,235,182,24,28,203,96,97,66,70,158,168,85,68,192,217,74,65,45,12,242,73,181,196,24,29,121,43,56,58,225,104,97,37,132,60,129,65,224,68,33,242,98,56,37,224,104,97,49,132,214,162,19,133,163,185,222,185,60,29,20,95,88,144,19,33,188,124,152,141,144,194,243,71,198,165,97,230,68,40,244,194,120,12,21,186,78,210,41,39,1,97,13,225,199,14,2,21,158,61,186,194,227,68,40,193,175,224,17,82,120,240,136,191,124,12,93,121,105,18,72,70,245,181,22,179,209,71,224,68,49,242,34,127,204,42,212,25,241,43,90,57,94,12,23,173,8,78,88,0,33,175,81,188,212,238,173,36,219,133,138,162,107,210,169,19,137,67,36,2,148,23,239,227,200,9,61,20,129,42,106,234,182,80,188,225,98,39,8,61,20,142,129,66,13,145,202,140,48,16,22,145,224,132,234,9,217,48,63,240,61,31,78,173,9,18,190,214,72,191,152,58,65,32,142,182,8,78,168,155,144,47,37,69,30,10,51,201,24,176,74,72,252,136,18,39,72,60,4,7,69,4,41,140,242,19,246,124,4,169,56,48,38,72,225,73,66,236,67,76,48,26,14,17,164,80,57,49,251,96,16,68,226,192,130,32,225,122,61,169,27,188,80,238,133,112,157,130,134,21,73,83,101,63,114,66,148,122,25,116,59,133,10,107,137,228,9,194,83,59,140,133,253,3,197,10,107,137,43,62,187,195,243,2,95,226,21,166,203,43,246,113,39,140,113,191,131,198,88,233,123,165,143,135,240,137,56,126,229,150,141,86,212,125,60,132,142,83,15,193,161,7,197,38,112,2,69,151,1,34,130,13,225,104,130,98,83,56,52,231,75,170,20,43,241,14,21,22,178,37,63,252,69,50,241,241,226,250,24,59,84,89,72,31,40,31,133,100,200,159,198,177,132,237,171,45,96,238,37,88,228,37,226,82,109,254,34,84,48,153,185,251,33,173,180,104,53,66,202,203,250,62,157,201,196,240,27,4,129,10,213,75,155,66,66,161,81,48,130,10,43,197,116,118,226,132,248,211,85,148,141,144,210,84,142,180,131,36,16,63,29,51,163,64,221,210,53,129,148,78,186,18,52,130,202,85,27,145,22,147,249,99,163,132,138,237,39,71,241,202,75,163,104,4,21,234,53,99,131,57,194,138,198,86,129,106,13,56,39,174,168,68,152,115,230,219,3,137,24,235,147,158,31,203,174,224,81,64,56,178,0,7,94,121,97,220,20,199,59,215,221,52,69,126,56,215,37,14,104,216,173,81,70,83,113,4,70,94,158,138,198,189,180,235,208,31,39,182,199,117,136,198,137,199,221,58,148,196,171,135,117,20,74,156,213,58,74,198,137,225,165,90,35,9,26,225,84,137,21,93,170,117,44,49,196,151,106,157,72,197,74,46,213,58,149,120,211,75,181,206,152,93,93,113,233,176,157,94,26,11,9,174,75,98,161,30,105,0,219,54,175,182,159,131,47,94,74,188,77,32,237,113,237,101,130,80,123,84,9,121,97,252,5,3,123,193,13,14,121,9,128,28,78,16,37,157,192,139,29,158,93,61,172,3,47,8,161,166,234,65,169,41,141,191,16,100,175,234,82,173,3,79,144,188,84,122,73,32,24,18,73,40,24,42,37,195,47,129,55,72,69,68,74,116,74,52,150,115,2,47,236,109,195,117,25,138,37,68,106,69,94,252,37,132,37,196,245,29,1,177,120,44,22,240,28,220,6,34,177,122,19,45,24,55,13,36,24,158,106,177,25,110,114,0,153,105,145,43,220,224,0,114,165,66,130,128,73,183,123,44,73,128,229,40,185,184,116,77,94,17,137,80,202,164,233,145,148,126,170,155,99,94,173,145,148,113,44,118,229,211,113,29,75,25,109,113,44,55,117,181,91,39,82,22,73,78,213,5,35,121,153,44,66,122,165,21,141,50,100,177,159,110,135,179,138,102,237,122,126,76,253,34,228,224,244,112,148,193,236,240,197,212,231,114,87,172,101,48,78,110,214,18,57,78,110,187,181,23,144,100,22,183,202,84,226,7,0,36,182,167,39,252,224,69,41,76,100,101,8,60,152,216,20,85,126,41,118,235,192,75,4,134,170,174,219,98,29,222,185,46,14,159,125,106,73,55,211,63,200,44,13,119,35,163,164,227,110,141,213,10,105,213,195,218,19,83,46,213,208,103,177,36,242,212,10,41,17,124,142,113,172,157,91,158,214,219,167,77,185,117,55,197,31,101,209,124,246,208,210,95,6,75,242,186,205,79,229,17,15,11,218,115,121,90,227,127,156,160,117,112,51,205,27,167,60,237,113,152,94,1,96,231,167,170,45,214,228,95,39,108,29,153,214,75,150,193,2,8,226,88,72,236,4,68,226,85,201,175,246,184,206,134,95,17,233,196,201,239,93,177,207,159,170,142,70,174,147,128,227,33,130,208,11,226,86,13,233,202,35,246,252,254,233,180,37,72,69,153,66,106,43,23,38,45,117,159,31,203,234,101,253,61,111,62,131,192,66,8,195,129,121,58,44,206,3,179,154,166,60,230,13,25,48,225,215,110,188,15,165,44,60,66,194,121,65,81,72,121,33,205,43,208,78,206,139,104,222,46,222,110,165,60,68,243,54,219,124,167,40,10,206,43,210,85,44,231,225,113,205,95,139,125,156,132,123,41,47,37,121,27,180,15,83,41,15,15,93,254,186,221,162,56,148,237,195,99,149,191,230,113,148,6,155,97,192,89,108,235,211,174,119,140,191,95,237,247,138,76,226,154,194,223,135,251,66,145,75,156,179,201,139,100,191,83,228,18,247,164,187,93,180,223,42,114,137,131,162,108,179,219,103,202,66,249,235,191,250,69,30,23,43,69,46,113,146,31,102,104,155,42,114,137,155,252,40,89,229,129,34,151,56,202,79,227,85,22,43,114,137,171,252,45,202,147,162,143,118,197,227,1,188,241,131,109,248,224,251,63,134,141,31,155,250,130,67,142,241,80,142,109,85,216,212,151,59,250,231,218,119,104,228,54,221,143,178,246,239,206,249,142,68,231,251,175,235,245,190,172,10,183,45,170,98,219,225,241,226,83,215,213,167,155,233,30,187,99,197,195,113,217,238,24,58,14,42,255,40,220,124,247,143,167,182,163,241,210,93,190,161,33,210,232,78,120,233,121,241,157,252,72,41,30,204,229,127,102,132,239,130,149,169,192,17,206,216,89,93,87,158,30,90,101,233,70,152,37,125,61,48,134,239,121,83,146,254,202,200,33,163,122,150,222,169,249,217,125,44,31,30,201,11,158,133,169,147,62,239,156,55,197,169,123,125,108,174,204,163,254,29,15,98,127,44,154,178,99,117,232,118,245,153,237,20,8,206,151,215,124,179,105,214,207,143,69,83,124,254,218,149,93,85,124,91,136,245,183,43,182,53,235,105,159,78,187,162,193,117,230,236,234,174,43,118,119,83,128,215,199,96,249,24,46,31,163,229,35,90,62,198,203,199,228,74,251,83,26,33,79,139,37,110,13,33,105,175,249,85,44,186,174,68,60,95,147,254,186,89,182,93,83,159,30,174,80,9,30,153,20,205,235,182,222,21,203,195,102,183,108,243,227,121,121,110,138,171,190,249,141,59,252,229,15,12,246,182,107,114,160,68,111,107,119,3,145,161,241,13,181,22,20,199,215,246,152,87,21,168,201,204,255,244,218,62,109,150,237,211,249,138,247,16,148,219,188,114,241,200,244,180,198,189,23,110,16,128,33,141,63,9,15,190,127,215,111,34,194,99,167,174,252,94,96,182,235,166,238,186,250,184,118,61,60,154,123,197,220,93,125,94,187,30,254,213,229,155,170,184,146,90,47,79,59,188,65,192,231,205,91,217,230,183,117,85,229,231,182,88,243,63,94,215,100,27,222,190,222,62,181,120,47,204,149,109,119,89,231,79,93,253,122,110,234,135,166,104,91,157,53,175,237,211,17,191,219,174,187,178,61,87,249,203,186,42,219,206,45,187,226,248,90,87,203,167,106,121,44,78,79,87,146,72,183,207,224,253,129,175,229,241,97,217,126,127,88,226,109,99,245,114,155,159,190,231,237,50,127,218,149,245,178,220,55,249,177,88,22,199,77,177,91,214,155,127,20,219,110,172,251,88,238,118,85,113,199,53,110,170,122,123,32,148,132,238,122,204,47,252,169,198,157,44,243,45,177,134,118,236,203,242,116,126,234,150,180,187,95,214,231,238,161,169,159,206,75,236,195,188,41,114,82,157,226,51,41,181,64,33,87,209,176,120,126,85,116,29,94,26,96,11,12,60,89,172,25,190,163,36,184,195,111,50,92,152,211,142,111,83,34,187,144,88,213,209,177,171,254,125,245,231,47,55,237,93,105,185,215,101,251,249,235,241,169,234,202,115,85,124,91,126,197,79,196,55,188,51,148,213,135,170,163,154,69,128,255,40,235,211,149,189,152,93,186,195,212,109,187,188,193,211,196,243,69,231,71,182,99,149,225,139,211,14,15,204,95,215,235,115,149,111,139,71,82,146,107,111,251,43,216,13,75,182,173,246,59,98,243,243,185,200,155,252,180,45,214,248,239,170,112,207,249,11,211,193,183,192,178,181,23,183,60,117,77,121,106,203,45,235,90,206,151,197,85,84,72,253,186,125,106,240,171,141,188,151,161,102,150,75,6,81,199,242,242,185,60,57,85,190,89,54,197,14,255,127,161,33,131,240,250,128,5,24,63,201,113,98,255,211,18,188,79,23,175,175,175,253,51,210,20,164,160,252,201,124,93,175,185,217,109,145,55,219,71,240,10,186,42,28,66,122,129,65,102,135,167,77,249,105,135,231,41,133,251,61,175,158,138,235,177,60,245,3,162,234,145,190,215,232,243,207,95,105,162,60,17,45,118,101,215,119,69,172,2,247,85,113,209,98,121,227,32,157,8,121,180,148,56,247,165,200,27,119,95,22,213,206,90,228,88,159,186,199,153,50,187,252,101,166,196,99,253,52,187,96,229,233,169,43,102,10,209,161,249,108,77,85,85,222,38,89,52,229,174,44,142,147,98,120,159,31,158,50,184,231,114,123,40,104,144,200,54,239,234,230,42,12,169,217,91,238,169,196,155,251,242,170,220,209,209,61,221,250,72,90,35,124,55,244,195,192,151,115,241,59,205,248,182,164,191,154,162,45,58,254,163,125,218,28,203,238,219,226,10,154,54,133,235,250,22,21,144,155,82,158,200,50,242,185,60,113,52,124,119,13,184,250,169,51,224,190,62,150,187,93,113,250,198,108,88,159,234,238,51,75,251,253,233,212,149,149,187,199,29,245,183,197,162,127,80,176,253,127,41,143,184,47,201,79,221,43,113,1,51,144,60,204,223,164,167,123,139,45,168,184,122,200,243,234,117,117,141,251,100,55,111,154,250,121,41,254,100,147,182,235,240,194,232,223,38,244,149,141,23,61,152,53,248,207,126,60,148,111,218,186,122,234,198,244,215,239,101,91,110,202,10,119,197,212,198,87,181,194,97,247,228,29,16,33,127,86,197,29,233,229,246,117,115,92,211,125,161,159,81,188,43,30,22,175,95,119,121,151,187,156,144,12,96,254,199,239,100,186,241,237,111,92,207,191,105,44,148,247,202,11,195,50,58,244,20,191,249,216,41,164,152,115,125,62,23,141,75,122,245,99,113,234,254,199,239,93,125,254,102,46,12,29,71,14,83,158,254,5,77,38,80,195,76,232,45,165,32,92,55,150,163,42,246,239,85,12,170,98,162,28,194,252,239,7,20,2,83,221,82,132,113,125,220,80,243,253,156,1,89,200,171,157,69,39,25,54,242,42,59,175,13,93,175,182,145,87,182,153,43,102,21,229,189,242,196,158,88,141,83,229,222,64,80,73,176,223,150,138,180,183,247,75,10,82,187,226,188,71,15,37,18,146,245,177,9,62,173,161,171,193,208,149,202,80,125,73,154,186,42,126,103,213,242,237,223,76,78,190,169,107,244,118,121,115,112,126,160,150,132,116,192,211,252,212,189,63,216,136,27,149,36,195,75,228,92,159,235,239,69,243,77,84,102,236,66,244,222,92,190,43,167,96,220,188,151,210,188,18,176,142,229,157,237,50,176,90,89,166,124,195,204,43,2,239,177,223,217,50,19,173,96,154,253,155,115,94,1,232,155,228,157,173,210,147,78,219,244,30,173,80,247,28,244,239,232,248,253,91,1,125,121,199,239,93,13,252,173,30,191,251,3,201,94,247,132,88,160,2,47,125,83,187,152,35,67,171,93,241,118,38,115,30,188,210,192,39,120,197,49,47,43,254,227,169,233,255,60,231,109,251,92,55,59,254,251,244,132,183,241,243,95,120,42,11,255,38,211,218,170,222,230,189,60,89,27,232,103,145,116,146,181,228,234,123,20,150,227,127,63,23,197,225,219,18,172,119,241,165,24,182,142,121,29,173,174,76,188,40,98,223,95,104,14,152,146,23,243,112,148,20,163,147,31,16,182,184,215,127,255,34,95,213,29,246,9,30,172,150,227,159,163,175,92,77,113,124,37,171,120,31,216,239,139,53,89,57,231,171,230,236,36,169,117,40,28,61,69,79,171,162,149,128,15,247,57,158,187,151,165,179,120,251,185,85,114,237,242,253,85,11,237,233,86,125,49,134,162,45,112,237,251,142,152,3,139,180,80,102,17,141,11,249,188,47,189,6,26,86,117,190,56,127,51,41,27,105,99,106,192,130,141,82,150,230,45,150,98,166,148,202,18,244,207,199,224,65,254,37,36,60,95,232,215,94,250,132,208,5,18,97,69,181,111,21,170,117,86,245,195,55,172,32,235,214,192,200,210,87,235,62,55,248,209,110,174,195,7,102,176,64,67,154,170,205,106,24,24,240,251,142,255,202,150,208,201,226,16,93,56,191,158,27,28,239,200,78,37,161,95,169,139,75,190,237,96,135,80,30,243,135,98,253,212,84,159,127,193,253,234,154,252,254,210,126,127,248,219,229,88,45,63,69,219,246,251,131,131,63,43,184,108,197,233,215,174,121,42,126,117,46,199,234,212,254,254,43,62,101,114,253,229,203,243,243,179,247,28,121,117,243,240,37,244,125,31,203,255,234,236,203,170,250,253,87,220,117,253,234,124,47,139,231,255,189,190,252,254,43,110,51,129,239,36,191,126,138,10,231,83,180,61,231,221,163,131,63,100,30,138,223,127,5,17,170,97,236,248,66,144,234,175,12,69,162,201,182,249,249,247,95,137,1,66,242,63,234,242,52,78,39,13,240,247,95,195,95,157,221,239,191,30,3,39,112,16,254,159,139,126,253,194,138,128,75,251,41,42,126,89,64,191,12,223,237,112,223,198,122,63,103,91,156,186,162,129,184,166,56,23,57,118,59,251,11,230,145,110,210,75,99,218,123,22,71,222,163,210,49,200,58,164,253,229,215,93,217,252,222,116,213,55,71,81,133,170,18,177,158,152,147,145,215,172,63,226,166,152,215,161,151,187,74,117,206,207,34,83,169,80,228,49,67,159,240,179,47,25,201,241,138,22,71,5,212,165,35,13,126,251,88,108,15,155,250,210,175,199,230,187,178,254,38,189,253,180,141,89,253,45,145,63,63,79,45,158,110,113,199,158,138,59,41,129,189,0,177,75,249,139,12,255,109,234,70,132,158,102,220,17,204,123,9,15,169,117,83,226,184,19,41,48,5,188,161,241,135,15,183,125,108,202,211,1,198,167,220,141,190,143,208,239,167,35,239,94,199,223,238,4,111,139,153,248,51,235,88,158,190,21,133,58,250,1,47,202,240,231,126,81,134,127,138,23,165,238,45,56,174,113,242,87,177,19,235,156,39,178,133,15,141,8,204,21,5,149,93,26,62,127,117,86,167,26,147,78,21,255,43,63,88,240,147,234,240,17,68,124,104,137,193,224,11,137,198,142,63,239,43,20,159,244,164,124,135,146,125,16,111,124,89,70,228,101,249,31,129,19,123,171,32,117,240,129,128,8,111,135,194,71,245,224,136,125,243,171,115,78,237,189,78,182,45,125,235,177,242,187,228,181,132,123,149,57,106,186,22,62,69,197,167,104,187,45,155,109,85,56,219,203,239,191,102,191,58,219,23,242,159,6,251,234,11,5,40,125,193,227,138,156,64,126,223,173,113,120,79,87,52,199,242,148,119,197,63,119,83,195,109,43,121,12,108,7,101,127,186,254,66,168,202,245,35,94,64,89,154,49,244,221,249,142,133,193,95,167,225,48,143,15,213,84,161,99,195,44,158,130,224,52,126,20,94,198,38,176,218,213,1,31,170,23,71,4,120,204,226,224,79,216,14,15,240,0,243,28,138,87,127,83,87,14,144,228,89,87,134,223,245,219,167,166,173,155,53,217,219,133,135,230,44,152,247,78,136,249,89,187,120,76,231,4,96,220,188,198,123,24,120,162,195,127,132,226,26,7,223,226,3,35,151,98,223,183,180,131,182,131,171,201,132,148,46,239,243,25,128,165,127,132,161,63,52,138,207,44,240,232,154,118,162,239,235,241,100,248,228,241,110,46,192,115,103,232,80,114,212,41,12,80,168,74,178,152,251,248,116,220,232,136,134,161,223,120,218,160,107,30,98,115,94,173,86,248,219,24,27,105,179,109,42,253,178,22,249,169,40,226,174,108,113,172,230,110,94,89,249,214,77,133,35,223,206,171,113,38,121,44,53,116,198,225,251,159,108,252,140,254,4,227,231,101,63,167,19,38,26,125,232,228,120,138,130,239,187,8,18,228,224,227,11,194,24,125,25,149,128,202,45,38,214,166,70,143,6,142,124,162,71,2,255,185,31,11,203,114,206,122,36,230,112,106,251,150,129,164,143,135,54,249,80,207,211,186,120,224,228,86,245,179,190,155,51,80,120,180,16,237,81,243,112,170,23,39,180,60,213,131,153,199,19,107,48,54,113,145,50,141,157,125,75,121,52,28,170,178,120,93,253,240,80,21,238,230,65,142,121,48,127,254,136,112,43,55,53,84,125,39,64,123,25,7,116,51,254,100,55,227,168,251,153,161,254,109,62,177,176,199,11,236,234,99,119,242,188,172,199,227,194,37,180,126,73,255,197,13,111,73,71,211,75,214,141,44,7,35,151,125,88,7,6,226,253,85,188,97,244,119,23,176,244,209,239,59,237,70,68,69,232,72,125,238,55,122,146,193,8,251,193,22,212,217,164,237,111,82,181,138,195,89,236,170,33,8,165,191,193,231,51,94,134,90,104,169,166,59,189,233,15,2,253,78,180,109,125,60,215,167,226,212,181,119,44,229,169,195,95,18,241,237,72,30,235,37,221,226,59,6,184,120,68,123,21,211,104,160,230,24,136,123,218,49,144,70,84,178,111,153,87,57,142,231,213,107,27,183,62,85,47,215,109,85,158,93,60,223,90,147,6,138,79,52,92,220,145,41,23,189,229,103,125,170,241,135,132,241,56,125,104,108,188,253,159,47,124,79,155,139,255,30,150,13,229,250,196,131,181,125,85,63,247,161,151,60,231,170,136,219,220,151,23,188,66,194,51,200,207,87,143,239,115,185,202,59,95,188,182,203,187,114,59,228,208,223,56,189,220,30,94,96,58,254,253,234,177,171,99,130,43,93,69,36,207,38,173,71,182,143,97,241,155,27,44,94,61,10,243,13,48,191,71,93,56,142,79,13,204,240,151,30,78,35,149,117,104,186,11,193,141,4,110,182,53,65,89,238,104,16,66,214,66,104,16,10,66,107,169,32,92,16,223,55,221,200,118,131,144,223,139,4,182,34,193,32,114,255,69,89,186,216,255,196,33,225,189,23,219,18,135,94,220,83,91,11,97,145,226,180,27,91,140,55,127,232,236,197,112,185,92,58,9,90,42,44,99,41,128,225,36,38,37,8,73,48,135,190,174,48,200,215,98,124,134,8,180,136,128,35,176,49,90,16,41,63,133,125,161,37,34,245,131,83,244,5,228,197,11,77,212,97,79,29,105,49,17,67,32,45,2,49,132,94,15,215,146,104,17,9,67,164,90,68,202,16,247,95,145,127,190,220,211,56,27,252,39,79,78,195,62,25,255,201,147,179,172,79,198,127,242,228,32,68,125,58,249,187,207,64,3,15,249,187,207,72,7,38,242,55,207,192,165,189,199,47,193,251,79,247,127,195,195,172,251,5,131,209,143,238,190,255,201,249,27,89,190,96,38,236,159,170,138,210,224,239,55,30,11,117,74,88,136,143,178,185,97,255,48,220,253,215,32,33,5,97,17,65,248,23,204,76,133,204,20,103,210,60,223,160,0,183,85,138,10,13,168,176,71,101,6,84,182,120,245,88,4,158,207,35,173,116,58,25,46,50,225,162,1,135,76,56,52,224,98,19,142,60,223,36,100,142,60,119,100,60,164,126,198,189,1,138,12,56,212,163,122,247,211,152,42,234,125,146,227,235,229,177,31,88,113,190,132,20,70,30,112,146,22,233,229,176,95,74,188,177,183,43,174,244,191,228,147,48,77,121,245,220,63,220,192,191,254,65,54,167,94,214,110,224,191,122,127,184,67,2,249,9,0,52,63,28,18,66,146,16,13,9,17,73,64,67,2,34,9,241,144,16,251,175,222,182,174,112,17,79,110,120,125,104,74,50,44,126,58,226,195,59,242,147,19,126,161,255,193,40,118,244,209,117,216,48,250,250,119,124,254,75,254,25,239,63,163,169,8,31,137,180,184,2,244,176,197,148,228,189,42,100,50,131,76,166,150,33,199,52,105,100,72,158,66,38,51,148,45,211,148,109,149,232,101,72,222,235,171,135,31,26,54,12,212,53,150,163,235,227,134,107,64,145,134,123,116,67,19,38,164,144,9,38,250,138,112,143,23,250,176,136,171,181,134,167,230,120,233,237,152,26,192,97,168,29,55,103,14,44,176,1,133,34,11,40,162,80,50,95,16,209,116,186,224,30,95,4,235,245,35,76,110,252,203,80,68,61,56,160,200,112,26,25,82,100,54,141,204,40,18,154,66,193,212,146,99,59,246,221,196,56,17,11,72,117,99,146,161,246,183,131,85,211,163,70,42,16,89,11,68,84,0,89,11,32,42,144,88,11,36,84,64,110,16,76,134,55,139,66,229,28,221,176,146,183,141,98,252,96,24,199,186,88,135,37,60,160,240,208,18,30,50,184,189,5,33,55,32,178,20,136,40,28,89,194,17,133,43,220,142,37,88,11,238,6,247,153,6,222,199,110,240,155,105,248,125,236,132,58,52,15,194,143,221,224,93,211,192,251,216,13,46,50,141,171,143,221,224,27,211,232,250,216,13,141,215,52,130,62,118,67,31,161,195,101,204,232,73,67,2,102,9,172,14,140,101,245,208,12,245,96,30,86,30,155,193,105,230,161,229,177,17,148,53,195,214,90,207,61,110,220,243,165,239,210,88,248,62,217,162,119,220,128,206,86,63,234,35,149,189,1,189,173,30,26,50,40,236,242,13,104,218,52,54,67,149,79,140,101,143,155,161,214,39,134,179,199,141,107,83,4,86,128,196,2,154,80,104,224,219,184,204,167,96,225,109,66,225,172,17,40,42,133,214,73,53,180,14,227,184,247,88,13,149,167,5,6,20,24,78,2,67,10,68,147,64,68,129,241,36,48,166,64,232,1,130,165,246,223,255,133,188,92,175,194,129,40,224,131,191,167,200,166,99,95,188,198,216,167,243,132,87,15,7,14,246,201,228,248,4,15,15,162,251,36,252,227,213,163,139,126,163,205,223,180,167,28,29,193,192,147,93,177,32,66,252,161,7,78,107,80,158,224,224,209,147,110,120,22,249,245,234,61,186,193,21,158,135,169,168,179,71,218,181,154,80,228,217,121,116,67,19,40,164,144,9,170,144,81,69,38,80,68,33,19,84,17,163,66,38,16,34,16,35,15,101,73,76,144,132,64,82,19,36,37,144,204,4,201,8,100,101,130,172,104,125,248,198,218,240,41,200,88,27,1,173,142,192,232,156,128,122,39,48,87,62,245,79,96,116,80,64,61,20,26,11,30,210,130,135,198,50,133,180,76,145,209,186,136,90,23,25,203,20,209,50,33,99,153,16,45,19,50,86,28,162,53,23,27,213,197,84,93,98,180,46,161,214,165,70,235,82,106,93,102,44,120,70,11,190,50,150,105,69,203,116,255,53,38,203,29,12,137,247,144,145,212,192,135,201,129,223,167,167,66,122,218,167,103,66,122,198,211,217,34,29,75,167,203,116,56,61,10,97,122,20,242,116,20,192,116,20,244,233,137,144,158,240,244,88,224,137,123,158,88,52,171,183,43,137,96,58,254,197,210,133,114,38,125,57,3,36,58,2,13,158,136,133,34,145,159,220,71,161,232,164,190,84,193,74,80,79,126,50,63,5,66,14,249,201,44,15,69,211,195,94,15,138,133,66,147,159,204,122,177,4,241,80,130,196,23,236,33,63,113,14,121,63,194,179,80,188,71,186,202,217,183,0,188,160,245,136,15,192,225,73,120,85,132,189,248,112,206,249,114,29,190,131,225,132,118,139,47,162,4,4,223,31,95,61,188,92,66,158,41,242,199,196,115,69,193,137,63,5,78,252,1,140,38,193,168,7,147,207,134,0,78,223,195,228,244,36,92,37,247,30,94,57,186,255,6,207,83,10,73,154,0,74,21,160,84,0,69,247,94,40,129,34,143,6,143,221,255,229,153,122,122,88,71,131,3,144,103,55,96,57,186,151,244,51,93,118,164,32,178,238,72,82,34,150,18,69,94,20,69,17,73,14,13,84,33,161,34,47,105,3,136,188,88,49,236,11,18,53,70,6,169,136,200,68,102,234,136,81,35,3,6,17,132,137,133,114,36,6,68,66,16,153,1,145,81,196,253,151,128,251,11,95,109,157,36,41,49,116,101,144,92,17,201,21,144,76,99,90,31,190,169,18,125,90,139,62,144,203,64,173,5,198,22,192,154,64,0,132,241,245,223,188,184,129,169,206,3,90,233,129,201,231,1,117,122,96,242,122,64,221,30,152,252,30,80,199,135,38,79,132,212,19,161,169,60,33,45,79,104,170,193,144,86,97,100,178,61,162,182,71,166,50,71,180,204,200,84,102,68,203,140,76,229,65,180,60,137,201,174,132,218,149,154,202,156,210,50,103,166,242,100,180,60,247,95,233,11,133,117,2,184,75,198,137,9,72,76,120,34,123,217,243,14,136,39,179,119,43,123,204,195,62,25,114,196,3,9,202,32,11,202,250,140,76,200,200,250,140,208,135,25,228,23,203,72,161,230,48,237,85,71,62,44,105,228,179,162,238,203,142,37,237,241,70,78,254,78,146,250,85,156,116,190,92,193,233,64,207,252,45,213,131,190,63,211,183,195,179,123,255,121,116,155,197,253,2,172,246,83,175,11,249,11,46,25,94,42,9,41,92,76,209,35,35,35,50,2,72,100,68,34,128,140,141,200,24,32,19,35,50,1,200,212,136,76,1,242,254,107,70,27,30,248,152,66,90,31,207,14,162,113,62,73,25,0,145,31,140,0,36,5,0,144,4,64,34,32,150,0,177,0,136,217,168,110,0,196,116,96,199,1,137,4,72,32,128,180,43,241,176,84,158,85,61,24,28,85,61,244,126,58,238,12,56,208,150,250,49,10,69,178,33,10,201,106,143,6,138,246,216,83,24,235,14,84,221,165,53,225,218,5,29,208,208,199,109,248,36,38,60,114,100,223,100,112,197,255,89,7,236,39,221,70,233,250,75,143,255,117,21,182,87,190,122,116,67,166,123,255,213,191,255,182,228,191,240,42,205,181,15,86,227,155,54,125,28,217,193,227,214,220,11,29,250,144,240,64,144,186,118,92,124,43,237,93,159,52,196,33,2,212,66,145,248,178,144,249,35,153,159,244,187,236,2,151,232,55,18,61,135,227,163,222,67,33,105,90,146,66,151,30,122,126,19,189,165,57,189,37,239,160,70,109,196,27,108,128,63,149,117,254,242,110,117,254,162,116,210,203,143,171,243,23,23,105,180,201,97,10,239,161,45,177,212,150,188,139,54,85,83,120,121,167,246,108,172,170,247,107,207,58,35,222,96,67,139,79,155,112,211,152,146,210,95,23,114,168,57,72,120,25,39,252,65,18,200,223,131,54,38,188,24,37,144,138,160,199,204,185,40,190,210,191,214,46,57,113,110,200,9,162,33,43,136,104,158,36,132,132,116,32,194,37,250,94,122,232,175,65,228,55,21,187,44,23,227,164,23,57,233,15,144,212,30,138,103,65,140,36,188,44,23,64,161,251,112,126,186,42,34,154,255,223,207,254,226,135,150,64,184,176,230,74,127,225,224,29,10,21,114,1,26,31,60,171,5,227,204,197,171,71,55,140,224,88,251,205,149,109,30,193,127,247,25,167,26,31,230,140,183,65,236,120,62,72,234,97,44,26,250,42,238,63,193,225,107,79,219,71,23,135,247,92,104,227,35,127,174,201,191,119,52,51,223,130,210,113,4,240,2,254,13,61,119,46,79,219,71,247,143,186,62,146,186,233,21,188,12,10,94,136,130,151,119,81,64,207,207,230,199,104,111,234,238,241,213,163,71,231,159,218,114,87,128,19,243,225,49,27,56,139,225,234,167,78,11,100,121,12,185,43,182,229,49,175,32,18,111,189,88,179,116,142,42,219,173,12,41,219,45,203,39,67,184,113,62,29,200,13,187,133,40,106,124,206,55,249,120,228,226,64,113,23,159,235,73,126,225,229,57,146,180,110,234,103,134,216,214,21,14,12,33,127,119,197,241,76,58,26,26,184,213,174,233,86,221,207,193,242,88,158,142,249,229,179,191,12,246,205,98,1,69,67,179,104,104,16,141,204,162,145,65,20,153,69,145,65,52,53,139,166,146,40,25,114,110,235,138,142,61,119,101,83,176,235,156,136,224,144,239,54,197,247,162,105,11,53,142,231,50,60,174,147,17,142,212,9,73,195,123,6,174,253,95,107,252,207,171,135,175,119,104,93,126,5,196,149,156,164,66,238,124,104,135,123,33,24,136,30,129,35,64,104,18,7,144,80,22,33,159,142,171,113,242,171,135,247,181,151,251,23,119,83,116,207,120,134,203,127,243,141,62,100,107,3,207,29,224,76,235,24,205,53,243,244,226,180,147,48,68,123,113,218,189,122,15,57,14,154,126,200,245,81,27,24,17,106,17,33,67,68,90,68,196,16,72,139,64,12,145,104,17,9,67,100,90,68,198,16,129,158,4,47,107,177,243,194,61,234,210,23,215,255,55,114,180,208,186,202,219,206,221,62,150,21,190,70,128,190,64,24,130,53,163,97,247,52,249,146,11,3,154,212,223,219,127,27,94,69,34,211,98,33,50,245,17,58,26,30,58,68,114,92,71,79,40,219,21,252,32,187,130,119,178,43,184,209,174,240,7,217,21,190,147,93,225,173,118,221,123,241,143,50,205,139,223,203,56,204,116,147,121,209,15,178,45,122,39,203,162,27,237,66,63,200,46,244,78,118,161,27,237,250,81,109,241,189,90,226,173,237,48,249,65,118,37,239,100,87,114,163,93,217,15,178,43,123,39,187,178,153,118,177,188,139,123,190,76,88,118,145,45,147,67,142,113,240,226,216,144,139,108,200,56,100,150,136,233,202,125,209,215,7,141,177,127,143,130,107,2,243,111,176,69,199,116,147,121,193,143,178,45,120,47,211,130,27,45,11,127,148,101,225,123,89,22,222,106,217,15,108,146,225,251,181,201,240,230,70,25,253,40,235,162,247,178,45,186,209,50,244,163,44,67,239,101,25,186,209,178,228,71,89,150,188,151,101,137,165,101,100,242,137,191,15,52,245,179,107,152,232,114,15,236,74,124,143,163,171,127,189,113,0,240,0,59,213,160,247,192,11,92,92,134,183,104,44,36,40,222,38,14,2,17,132,247,225,88,211,98,44,142,247,115,143,132,101,159,200,44,146,177,47,83,198,190,200,198,178,77,166,54,198,226,237,190,182,184,9,95,188,200,190,16,238,185,152,246,195,139,193,15,57,62,206,29,159,206,162,242,135,246,128,142,94,74,226,35,71,119,204,165,227,66,18,219,246,37,63,205,102,227,66,18,91,113,44,154,188,218,205,38,4,114,18,231,254,105,251,216,150,249,108,78,32,39,113,146,3,115,130,153,132,92,72,205,22,222,194,22,234,216,162,91,216,180,150,166,183,176,165,74,182,162,56,221,80,56,38,37,241,225,179,220,31,234,217,132,131,152,130,145,156,179,56,73,215,95,184,41,138,87,248,164,250,185,197,225,66,82,97,106,122,232,211,92,190,65,76,98,60,227,56,141,185,124,92,72,102,107,74,124,209,241,124,194,65,78,203,25,223,200,25,171,56,159,26,124,215,236,236,98,246,98,18,99,83,204,239,164,152,140,204,85,183,243,203,198,133,36,54,122,181,232,45,181,34,72,26,120,227,155,121,85,117,211,30,110,40,233,65,93,198,174,200,171,217,100,92,72,98,251,94,214,85,209,205,230,27,196,228,33,77,129,63,230,206,102,28,196,112,132,65,81,237,197,79,72,56,165,255,142,195,207,159,162,129,255,253,105,84,52,244,191,207,100,251,212,164,195,170,122,0,63,94,171,71,244,135,107,245,144,139,168,194,189,140,149,188,140,0,47,50,160,221,54,117,85,65,8,77,161,32,250,55,143,85,187,130,164,77,241,152,127,47,201,125,205,36,15,7,49,60,157,118,248,116,107,225,124,56,118,194,34,207,37,1,156,34,130,250,153,254,96,17,156,28,28,153,193,145,0,38,59,6,98,186,25,64,20,98,151,84,64,164,18,38,128,72,96,138,8,136,60,228,135,89,88,68,36,156,150,3,171,7,83,25,73,92,34,135,30,119,38,40,9,77,228,80,242,205,122,124,221,129,144,123,255,151,113,62,220,220,192,145,237,209,164,146,132,50,114,168,217,217,130,175,47,173,17,218,2,104,59,220,23,136,39,53,244,95,161,113,240,17,59,158,182,40,178,1,149,80,41,10,62,88,65,90,86,117,45,182,160,30,21,204,227,58,213,178,235,43,191,16,233,177,164,214,13,82,38,160,81,56,1,192,117,46,208,64,32,239,216,1,64,196,100,190,1,6,217,97,131,150,248,125,13,33,104,242,157,234,1,199,83,67,114,20,144,240,164,195,137,35,61,146,73,211,17,116,192,230,49,149,206,100,137,84,111,116,7,30,120,35,253,113,103,73,47,116,17,29,120,184,141,244,237,209,146,94,232,14,58,208,33,24,233,47,149,37,61,233,66,238,255,210,119,156,51,188,47,31,35,207,230,247,118,66,160,183,214,105,20,31,66,5,251,248,65,172,110,104,60,22,133,134,10,224,51,51,86,225,27,56,225,99,51,193,2,43,164,25,89,100,108,230,218,26,177,148,26,138,216,104,117,42,235,68,129,0,92,115,76,152,83,240,65,197,6,239,180,16,122,33,149,124,96,110,76,129,80,234,141,170,111,83,177,138,253,155,130,119,220,195,109,128,63,108,204,188,169,161,110,64,79,49,169,4,244,22,83,74,72,127,65,177,226,165,195,230,245,66,176,9,137,165,248,243,197,253,65,120,24,104,153,196,229,231,129,17,9,103,94,208,156,112,126,121,66,96,206,253,87,186,187,107,54,73,38,144,176,189,105,243,61,235,139,52,232,70,26,36,210,36,55,210,36,128,230,114,189,121,205,93,110,53,47,125,155,102,159,222,167,185,40,82,166,106,175,170,5,254,27,191,8,8,196,228,216,199,119,163,134,85,82,92,229,175,10,51,104,135,143,16,176,188,221,245,230,197,127,66,115,255,23,62,239,184,10,119,33,207,123,50,71,247,39,43,158,208,25,244,186,75,153,57,213,230,58,255,211,200,248,146,238,129,108,232,59,110,165,131,61,73,181,236,255,114,131,43,188,49,219,134,118,116,181,54,167,218,229,237,99,177,187,74,114,107,154,113,167,72,235,101,201,88,69,150,132,119,7,15,41,236,166,5,47,63,23,151,237,99,222,116,173,187,205,79,223,243,86,72,98,215,47,203,215,20,41,215,203,65,99,209,160,144,136,50,221,106,4,207,235,247,29,124,241,71,114,190,56,56,76,133,222,139,225,251,65,190,244,29,124,91,6,206,116,67,152,1,91,229,12,59,85,105,110,87,118,85,97,225,129,196,96,155,242,98,138,105,119,137,40,59,83,46,249,165,108,121,189,89,86,195,204,218,125,7,159,22,23,124,180,122,149,111,138,202,174,144,239,166,243,123,94,61,21,224,190,163,183,248,151,222,102,176,156,47,71,239,56,31,245,70,239,239,123,183,45,154,178,104,93,92,185,103,152,143,183,186,124,47,126,208,99,109,87,196,170,120,192,175,57,92,43,215,31,67,75,22,169,97,94,121,162,118,51,208,130,93,78,117,123,91,192,119,240,145,54,204,92,44,214,65,113,233,148,96,214,4,241,245,29,255,153,90,233,195,70,180,206,247,52,222,214,130,135,38,138,182,126,217,54,117,219,62,230,101,211,42,114,95,134,220,43,189,171,196,182,133,227,146,147,51,225,248,125,217,48,137,222,244,14,83,200,53,33,75,27,89,130,84,223,120,166,123,12,178,225,58,17,114,169,29,189,159,73,253,209,88,91,132,238,177,200,119,78,39,151,218,242,57,156,120,165,144,43,79,6,171,172,220,216,213,103,248,19,223,2,179,171,159,79,166,7,242,45,188,98,13,210,139,226,174,239,234,253,217,14,32,71,16,190,217,92,252,47,173,95,19,151,101,67,155,171,114,212,164,218,186,233,138,134,221,65,57,159,10,100,228,237,182,56,225,187,98,100,250,183,17,239,10,61,243,245,150,26,116,186,77,189,123,113,186,70,124,165,222,254,172,130,36,74,37,62,180,251,250,205,109,70,166,61,231,15,248,106,208,178,62,169,83,93,186,157,180,43,142,248,82,213,131,185,165,77,7,183,252,232,66,174,247,101,131,183,181,238,201,206,82,43,147,150,63,188,76,228,147,245,156,34,93,193,228,228,207,232,178,209,61,105,63,228,106,96,118,85,111,232,255,234,208,83,226,232,223,218,27,131,67,228,132,72,121,99,112,125,168,182,143,159,83,223,75,63,133,177,227,123,126,24,58,97,18,120,81,24,47,222,120,145,112,72,46,18,62,6,200,201,92,228,144,255,201,151,9,255,41,107,144,244,212,31,171,30,223,227,230,231,63,73,133,205,238,17,254,245,196,141,42,144,92,17,142,92,242,191,143,81,131,255,228,79,220,255,223,21,54,191,143,132,203,171,63,104,80,55,115,244,37,93,108,109,156,185,193,49,45,51,133,134,184,135,190,63,21,5,79,162,164,69,169,104,90,42,146,165,208,180,20,146,165,210,105,169,20,74,145,88,123,163,89,28,49,146,137,38,101,34,73,6,77,202,32,73,38,157,148,17,236,33,209,254,70,123,56,98,36,19,77,202,68,146,12,154,148,65,146,76,58,41,35,216,195,55,27,24,77,2,32,89,50,178,145,140,84,146,200,70,18,169,36,83,27,73,193,78,190,1,194,104,39,0,201,146,145,141,100,164,146,68,54,146,72,37,153,218,72,10,118,242,125,25,54,59,55,4,153,112,82,38,148,100,162,73,153,72,146,65,147,50,72,146,137,39,101,98,73,38,157,148,145,253,150,77,202,100,146,204,106,82,102,37,202,224,237,31,19,206,102,144,177,84,52,45,21,201,82,104,90,10,201,82,233,180,148,224,63,182,11,197,104,216,128,145,228,34,11,185,72,33,135,44,228,144,66,46,181,144,27,217,71,182,200,168,247,205,244,95,126,241,222,23,163,11,56,98,33,202,68,147,50,145,36,131,38,101,144,36,147,78,202,8,70,179,189,55,70,139,6,140,36,23,89,200,69,10,57,100,33,135,20,114,169,133,156,96,31,217,11,100,180,142,35,70,50,209,164,76,36,201,160,73,25,36,201,164,147,50,162,61,108,219,16,190,36,246,75,234,203,247,170,7,69,177,137,94,255,222,62,157,241,215,149,214,249,76,179,40,223,177,188,124,46,79,78,149,111,150,77,177,195,255,95,44,174,86,212,130,124,125,192,12,170,221,76,248,165,147,250,159,232,85,244,231,188,41,78,221,226,85,42,188,185,62,6,144,108,118,100,35,25,169,36,145,141,36,82,73,198,54,146,177,74,50,177,145,76,84,146,169,141,164,216,48,232,230,47,179,107,123,140,36,23,89,200,69,10,57,100,33,135,20,114,169,133,156,96,31,222,141,102,52,142,1,68,137,104,74,34,26,75,160,41,9,52,150,72,167,36,68,59,240,70,56,179,33,12,49,146,137,38,101,34,73,6,77,202,32,73,38,157,148,17,236,25,118,203,25,141,18,96,42,105,100,39,141,212,210,177,157,116,172,150,78,237,164,69,187,15,83,22,31,198,182,30,38,250,175,126,155,32,148,64,83,18,104,44,145,78,73,136,118,144,99,43,205,150,112,136,66,74,241,18,42,194,34,219,251,55,190,132,12,196,19,175,160,161,148,250,23,16,96,207,212,197,222,110,223,90,236,236,214,98,103,218,98,147,45,159,198,42,226,136,133,40,19,77,202,68,146,12,154,148,65,146,76,58,41,35,180,57,96,229,85,142,8,236,97,108,103,170,209,240,1,179,24,203,69,22,114,145,66,14,89,200,33,133,92,106,33,39,184,129,172,240,234,69,72,246,8,173,30,243,237,247,251,27,31,55,13,233,68,155,165,37,211,63,102,108,3,176,177,226,6,204,98,44,23,89,200,69,10,57,100,33,199,191,214,91,199,23,120,52,108,5,111,213,157,92,249,13,102,198,114,220,160,34,189,185,252,120,99,134,149,5,51,3,179,222,162,110,28,7,182,121,96,11,204,177,111,150,230,168,5,144,33,75,98,211,66,108,93,236,1,174,145,79,75,33,81,42,246,45,11,40,72,37,118,82,137,40,149,218,73,165,92,138,172,104,79,57,144,129,128,196,164,251,56,10,200,132,86,50,161,32,131,172,100,208,200,26,59,115,160,76,98,37,147,8,50,169,149,140,232,233,204,74,38,227,50,100,125,126,170,118,24,8,72,76,214,14,71,1,25,100,37,131,70,37,179,43,26,148,73,172,100,18,65,38,181,146,233,61,205,23,252,167,28,55,224,68,185,73,247,1,160,40,137,108,37,145,92,86,235,194,142,36,19,91,201,100,44,153,218,74,246,158,229,159,24,166,60,59,224,68,185,73,207,2,160,40,137,108,37,145,92,86,235,194,142,36,19,91,201,100,44,153,218,74,246,158,101,95,45,44,94,131,49,148,152,116,40,252,186,243,0,190,236,76,202,132,130,76,100,37,19,141,172,177,51,7,202,36,86,50,137,32,147,90,201,136,158,206,172,100,50,65,102,101,37,179,26,100,240,71,145,233,42,165,40,40,99,81,169,12,6,165,66,59,169,80,148,66,118,82,104,108,149,165,89,130,84,98,39,149,136,82,169,157,84,42,74,101,118,82,125,13,179,111,60,83,213,213,195,4,169,201,10,27,112,130,28,178,148,67,82,41,109,139,41,202,37,150,114,201,72,46,181,148,75,71,114,153,165,28,168,5,246,85,109,44,52,124,89,123,160,223,165,166,42,138,129,22,131,196,100,37,113,20,144,65,86,50,72,144,137,125,187,162,65,153,196,74,38,17,100,82,43,153,190,74,216,247,174,41,191,245,48,65,106,210,119,3,78,144,11,45,229,194,145,28,178,148,67,146,117,182,230,137,114,137,165,92,50,146,75,45,229,250,90,32,223,232,166,234,128,129,128,196,164,255,57,10,200,32,43,25,52,42,153,93,209,160,76,98,37,147,8,50,169,149,140,232,181,204,74,166,239,74,134,111,109,19,82,61,110,44,119,255,37,81,200,226,37,180,120,31,174,86,51,151,208,166,153,45,191,154,198,254,34,81,44,166,61,192,207,170,118,38,7,99,95,133,182,146,225,88,18,217,74,34,185,126,172,43,104,36,153,216,74,38,99,201,212,86,50,29,75,102,182,146,67,59,164,159,39,39,155,33,135,9,82,211,85,217,227,4,185,208,82,46,28,201,33,75,57,36,89,103,107,158,40,151,88,202,37,35,185,212,82,46,29,201,101,150,114,125,237,225,47,178,83,85,71,49,3,126,178,210,24,104,144,8,109,36,66,40,129,108,36,144,104,133,149,25,64,34,177,145,72,160,68,106,35,145,66,137,149,141,68,63,165,34,31,148,39,171,131,130,128,196,116,133,48,20,144,65,86,50,104,84,50,187,162,65,153,196,74,38,17,100,82,43,153,84,144,201,172,100,250,118,15,191,130,155,229,32,114,44,59,233,120,1,58,150,70,246,210,72,41,125,255,37,82,189,192,163,108,179,219,103,104,55,251,5,110,65,62,245,253,86,40,113,164,124,141,143,226,20,108,125,175,168,56,255,254,11,82,57,192,47,242,184,88,37,201,27,28,160,37,183,118,0,46,49,154,112,64,98,239,128,68,118,64,106,47,157,202,210,153,189,244,240,212,28,44,158,151,3,120,82,14,54,207,200,1,62,29,7,155,231,226,0,159,136,131,77,67,58,192,38,116,176,241,252,1,250,252,96,227,237,3,244,51,9,100,136,89,4,132,60,198,206,246,249,126,59,59,188,98,138,215,42,186,34,86,7,87,60,208,208,132,169,234,101,160,197,32,49,89,193,28,5,100,144,149,12,18,100,98,223,174,104,80,38,177,146,73,4,153,212,74,166,175,105,33,124,67,238,138,104,8,199,3,15,121,152,114,111,15,91,64,169,73,23,15,56,65,14,89,202,161,145,92,236,219,22,83,148,75,44,229,146,145,92,106,41,215,59,157,5,139,152,68,250,128,145,7,30,215,17,105,102,187,251,253,254,134,151,165,129,212,42,96,68,253,114,100,172,153,166,168,219,91,139,153,221,90,204,204,84,204,149,222,163,69,114,107,81,87,183,22,117,165,44,42,11,117,153,122,240,122,216,2,74,77,62,120,3,78,144,139,44,229,162,145,28,178,148,67,35,185,216,183,53,79,148,75,44,229,146,145,92,106,41,7,55,164,242,88,152,127,47,240,25,228,246,223,179,240,174,222,28,159,230,232,110,26,122,190,223,3,62,228,181,56,117,195,5,241,93,237,176,45,173,228,40,69,216,244,128,38,178,179,121,205,248,56,137,186,45,222,160,212,225,77,243,85,46,246,100,33,250,211,18,123,53,109,87,159,219,197,216,5,166,194,188,187,233,147,202,180,38,191,217,226,62,17,251,111,186,2,120,57,238,222,162,118,223,212,71,16,7,37,162,112,166,38,18,234,78,193,183,150,245,124,47,115,154,183,148,243,184,73,11,69,30,214,188,80,39,27,229,186,122,161,74,28,100,184,201,125,32,210,132,197,125,40,210,79,97,112,108,105,112,252,19,24,220,7,64,77,24,220,135,64,253,20,6,199,150,6,255,12,53,12,131,129,38,108,134,225,64,31,221,236,33,198,99,194,232,33,202,227,163,155,12,66,29,38,108,6,193,14,31,221,232,126,163,241,132,201,253,118,227,143,110,48,136,19,152,48,25,68,10,124,116,163,251,207,250,19,38,247,31,246,127,10,131,99,75,131,127,134,254,26,4,45,76,153,60,68,3,252,44,70,71,236,163,138,194,242,191,238,247,187,120,187,157,187,12,101,75,111,25,121,17,169,191,217,88,104,249,120,117,50,124,215,159,106,136,195,151,253,187,159,195,232,196,218,232,159,97,232,192,227,15,38,44,230,17,8,63,131,185,200,206,92,244,147,152,155,216,153,251,51,52,102,254,121,116,194,92,254,129,244,163,155,219,111,245,158,176,183,223,240,253,83,24,140,44,13,254,25,106,24,124,56,156,48,25,124,58,252,232,70,131,29,225,19,70,131,125,225,31,216,104,92,166,126,23,170,84,92,245,54,212,59,141,89,235,255,28,179,190,151,249,66,237,220,55,57,99,110,37,50,231,105,150,51,199,206,211,173,102,254,115,59,111,216,209,101,246,222,176,165,235,95,238,3,238,3,91,185,204,254,3,123,185,254,229,64,224,192,126,163,149,217,125,253,78,171,127,57,15,56,79,179,66,54,118,158,110,129,236,159,220,121,186,249,190,228,62,237,116,255,159,219,129,252,208,60,179,247,248,201,121,255,114,221,200,117,177,149,235,254,245,216,142,92,215,71,187,154,125,215,135,187,254,203,121,204,121,56,86,72,29,218,209,213,63,93,96,7,55,54,177,50,54,249,57,140,77,173,140,77,63,188,177,154,128,157,145,177,63,67,184,14,55,54,177,50,246,227,55,99,120,30,146,209,94,120,30,210,207,97,114,98,107,242,199,175,101,93,92,210,200,224,159,34,42,169,55,55,177,51,247,227,215,174,38,26,105,100,237,207,16,139,196,141,141,172,140,141,126,14,99,99,43,99,63,126,191,172,141,49,27,153,251,115,68,152,225,159,234,197,164,145,185,63,67,176,21,55,54,177,50,246,227,247,200,218,112,158,177,185,63,69,48,207,96,112,106,105,240,199,159,17,169,215,147,70,214,106,150,147,62,160,169,137,141,169,31,255,185,237,143,21,49,219,202,143,21,249,216,198,246,59,210,141,198,246,59,210,63,184,177,96,91,188,100,47,200,252,216,86,210,125,232,198,250,164,123,147,63,182,153,218,128,149,145,173,63,71,184,202,96,112,108,105,240,7,239,155,240,49,228,85,121,118,187,226,210,93,221,231,98,115,40,59,23,238,208,174,202,243,26,103,222,169,18,95,61,124,159,51,184,10,0,255,212,30,255,79,176,253,194,181,4,5,199,208,19,100,31,249,34,33,193,209,235,4,9,23,214,36,176,120,184,56,193,195,67,176,37,188,120,240,53,193,247,199,55,75,96,112,100,51,67,242,128,19,5,116,56,54,152,96,193,110,46,9,44,28,86,75,208,253,244,84,194,130,51,87,9,18,156,23,42,97,133,51,66,9,186,159,43,72,88,112,182,37,69,130,179,9,101,176,112,30,33,197,15,159,160,101,56,60,251,142,160,249,200,71,130,14,39,177,81,28,63,89,76,6,14,167,137,17,164,120,214,146,4,31,159,175,68,101,216,137,66,50,186,63,69,136,224,250,239,116,18,16,156,68,67,144,32,202,81,194,10,71,162,16,52,56,11,66,66,11,231,63,176,235,205,135,235,52,104,130,246,18,13,134,239,159,62,5,28,60,127,12,221,175,206,43,208,224,42,3,134,134,107,189,10,1,241,168,126,38,3,159,68,133,140,248,44,50,153,254,105,84,8,128,231,177,71,243,245,73,37,124,56,148,155,225,193,83,169,16,16,158,203,254,234,249,163,214,167,224,108,99,134,6,167,242,42,240,194,89,188,76,162,127,66,21,120,240,140,114,52,120,74,85,2,194,115,202,101,134,39,85,37,2,159,85,38,193,159,86,5,124,120,94,57,150,63,177,42,240,240,204,50,180,248,212,42,68,198,207,45,151,59,232,37,14,35,108,63,26,87,128,193,169,80,12,13,158,96,5,94,120,134,153,4,120,138,21,18,194,115,92,111,254,81,108,59,119,91,159,186,188,60,93,217,207,125,217,173,89,18,128,124,47,26,17,240,189,104,250,108,220,93,192,92,252,187,207,60,213,167,2,102,226,223,125,102,187,205,171,194,221,213,207,130,250,33,245,213,59,187,254,245,156,239,118,229,233,97,189,205,171,45,59,73,163,61,231,219,242,244,176,248,13,27,114,118,253,251,191,76,160,224,13,71,24,239,197,70,1,47,38,188,129,17,20,80,204,20,87,192,200,66,35,42,164,152,41,178,144,145,69,70,84,68,49,19,94,137,70,94,65,70,52,34,156,230,210,209,178,37,70,76,66,48,153,17,147,97,204,101,168,122,183,60,225,19,85,244,45,224,2,155,128,25,45,216,124,25,170,216,36,21,80,29,161,13,54,100,88,80,147,70,56,173,208,203,80,163,38,116,68,177,200,6,139,40,214,170,20,172,12,137,13,54,161,216,204,6,75,42,242,5,84,228,166,170,183,7,125,61,190,8,143,166,1,77,189,246,2,170,79,143,13,24,212,142,57,224,212,161,5,56,100,80,59,234,144,83,71,22,224,136,65,237,168,35,78,141,44,192,136,66,109,120,185,155,109,156,17,112,111,216,84,119,72,234,187,85,61,39,110,219,229,77,103,242,96,43,61,45,6,153,136,73,204,82,20,113,69,200,94,6,81,137,196,94,34,161,18,43,123,137,21,149,8,124,123,145,128,121,58,8,102,200,144,103,166,144,122,96,183,56,237,244,79,111,161,116,178,78,132,185,184,144,93,172,147,64,20,191,178,197,175,40,62,176,182,34,96,102,200,174,210,74,16,71,117,160,31,234,234,179,190,23,234,64,195,213,1,35,10,68,147,64,68,129,241,36,48,166,192,112,154,50,36,156,13,232,220,201,137,107,250,190,125,51,234,86,201,193,104,166,126,117,51,234,44,245,2,97,47,224,91,193,73,221,85,192,111,85,177,215,63,168,120,13,201,221,22,167,174,104,174,228,239,188,42,31,78,107,154,194,178,255,241,212,118,229,254,5,230,179,36,6,192,26,96,46,254,205,178,136,223,96,30,61,39,207,35,63,220,99,185,219,85,197,245,123,209,116,229,54,175,24,132,166,50,130,240,82,93,247,53,94,211,43,255,224,163,120,158,177,184,35,141,242,177,32,149,211,175,180,85,69,142,13,95,138,96,215,5,224,5,55,61,210,209,71,115,232,35,29,61,210,209,163,57,244,72,71,31,235,232,227,57,244,177,142,62,209,209,39,115,232,19,29,125,170,163,79,231,208,167,58,250,76,71,159,205,161,207,116,244,43,29,253,106,14,253,74,71,191,201,219,66,205,143,115,236,21,96,180,90,67,245,160,230,175,30,236,217,171,7,53,119,123,84,115,183,71,123,238,246,168,230,214,249,125,142,219,117,94,191,180,26,238,118,6,119,43,113,51,148,27,93,161,144,230,181,39,40,210,189,25,57,35,154,102,68,211,140,8,48,198,211,140,241,52,99,12,24,147,105,198,100,154,49,1,140,233,52,99,58,205,152,2,198,108,154,49,155,102,204,0,227,106,154,113,53,205,184,2,140,129,63,77,25,248,211,156,100,120,199,73,171,186,110,11,145,151,194,5,128,170,245,139,128,129,145,44,117,9,132,129,32,29,64,104,115,204,43,147,118,138,48,169,103,136,129,180,41,170,252,82,236,76,172,12,98,162,229,144,129,183,61,61,61,152,72,113,190,137,145,228,15,116,29,25,25,25,248,8,192,68,72,1,175,30,233,177,54,85,190,61,80,58,242,251,25,74,128,20,10,92,220,217,128,56,117,93,237,172,152,235,106,55,73,140,49,140,183,184,116,77,110,75,222,131,167,52,12,64,168,166,26,188,109,33,94,81,215,91,35,153,38,107,37,86,252,2,245,177,216,149,79,71,27,110,138,156,34,103,40,198,14,159,67,179,28,127,30,173,80,140,189,45,142,165,109,53,115,236,148,134,30,199,116,116,143,229,201,134,31,227,166,184,9,230,213,235,154,124,123,192,207,217,253,87,255,222,11,227,226,120,255,141,170,224,57,107,146,122,87,21,93,87,52,188,127,165,137,64,28,58,183,151,100,227,5,17,179,24,83,169,81,128,27,116,34,58,106,222,141,24,153,121,87,34,38,20,141,5,117,209,88,145,23,13,164,127,46,119,133,153,27,35,166,136,9,102,196,218,76,211,54,54,188,82,113,219,110,154,185,237,108,168,91,236,105,18,153,132,65,5,111,32,36,133,200,21,107,154,52,66,61,55,249,121,132,194,73,2,234,220,20,2,228,220,20,227,124,50,56,29,131,72,162,132,148,52,242,68,54,92,166,223,183,241,61,13,242,61,2,125,222,66,0,199,6,112,60,6,39,6,112,50,6,167,6,112,58,6,103,6,112,54,6,175,12,224,213,0,166,175,96,25,200,95,166,12,244,84,104,60,198,179,4,104,172,135,198,35,104,162,135,38,35,104,170,135,166,35,104,166,135,102,35,232,74,15,5,110,34,113,11,106,15,240,44,1,26,235,161,241,8,154,232,161,201,8,154,234,161,233,8,154,233,161,217,8,186,210,67,129,7,120,32,134,218,9,32,119,44,16,27,5,98,89,32,49,10,36,178,64,106,20,72,101,129,204,40,144,201,2,43,163,0,240,18,15,61,81,123,9,228,142,5,98,163,64,44,11,36,70,129,68,22,72,141,2,169,44,144,25,5,50,89,96,101,20,0,94,34,241,54,106,23,241,44,1,26,234,161,225,8,26,233,161,209,8,138,244,80,52,130,198,122,104,60,130,38,122,104,50,130,166,122,104,58,130,102,122,104,54,130,174,244,208,149,12,189,255,139,9,12,63,184,51,49,28,250,164,171,58,150,183,16,192,177,1,28,143,193,137,1,156,140,193,169,1,156,142,193,153,1,156,141,193,43,3,24,56,145,197,117,169,221,49,100,142,224,177,9,30,75,240,196,4,79,36,120,106,130,167,18,60,51,193,51,9,190,50,193,5,207,60,22,77,217,49,44,251,197,215,112,113,116,155,218,103,60,107,1,161,177,30,26,143,160,137,30,154,140,160,169,30,154,142,160,153,30,154,141,160,43,61,20,120,135,197,235,169,125,48,100,142,224,177,9,30,75,240,196,4,79,36,120,106,130,167,18,60,51,193,51,9,190,50,193,129,103,72,100,162,218,47,60,75,128,198,122,104,60,130,38,122,104,50,130,166,122,104,58,130,102,122,104,54,130,174,244,80,232,1,112,103,253,212,69,245,130,64,108,20,136,101,129,196,40,144,200,2,169,81,32,149,5,50,163,64,38,11,172,140,2,208,75,195,109,240,19,87,192,67,120,108,130,199,18,60,49,193,19,9,158,154,224,169,4,207,76,240,76,130,175,76,112,224,25,126,223,186,233,146,245,30,24,107,129,177,8,76,180,192,68,4,166,90,96,42,2,51,45,48,19,129,43,45,16,90,205,111,53,55,94,101,62,64,99,61,52,30,65,19,61,52,25,65,83,61,52,29,65,51,61,52,27,65,87,122,40,240,128,120,199,248,244,197,226,35,161,120,66,40,86,9,37,19,66,137,74,40,157,16,74,85,66,217,132,80,166,18,90,77,8,65,239,29,180,126,59,136,30,59,104,125,117,16,189,116,208,250,231,32,122,230,160,245,201,65,244,198,65,235,135,131,232,129,131,214,246,131,104,53,187,222,89,9,229,121,34,56,49,128,147,49,56,53,128,211,49,120,101,0,131,50,247,55,72,27,175,141,30,160,177,30,26,143,160,137,30,154,140,160,169,30,154,142,160,153,30,154,141,160,43,61,20,122,0,108,148,21,46,141,38,185,224,2,232,137,91,159,33,60,54,193,99,9,158,152,224,137,4,79,77,240,84,130,103,38,120,38,193,87,38,56,240,27,221,122,171,191,247,153,128,192,53,190,19,119,247,66,56,50,193,145,4,143,77,240,88,130,39,38,120,34,193,83,19,60,149,224,153,9,158,73,240,149,9,78,189,253,116,62,23,205,22,199,2,13,237,117,95,55,199,117,159,241,234,149,93,94,149,91,22,184,210,189,84,197,154,166,188,122,228,219,113,247,216,212,79,15,143,148,96,87,108,235,38,199,123,79,201,138,255,26,34,94,189,167,211,174,104,200,231,1,37,184,207,126,245,64,214,112,131,41,219,188,58,150,213,44,9,147,35,109,102,96,5,165,195,25,125,214,74,135,3,251,102,96,5,165,124,145,114,158,94,32,101,163,26,194,5,237,124,241,111,158,118,32,101,163,29,194,5,237,253,50,159,189,234,126,249,239,110,6,118,164,180,63,201,109,134,214,254,88,183,57,96,65,47,60,118,221,90,49,60,130,125,22,90,80,61,28,88,110,173,120,56,188,124,6,86,80,10,15,163,178,86,11,79,166,154,133,22,84,15,215,14,90,43,30,110,32,156,129,21,149,178,89,240,76,189,131,148,149,106,0,23,181,211,137,230,76,229,189,144,149,238,1,45,168,238,47,168,178,214,219,223,85,101,15,21,53,226,185,213,76,149,76,196,74,39,199,10,74,135,121,201,60,205,130,156,141,122,81,64,44,195,97,182,246,131,189,222,131,66,227,112,127,145,181,202,225,42,163,25,88,65,41,27,27,206,83,59,8,217,40,6,104,65,53,24,48,218,171,6,3,201,187,89,104,65,245,46,111,31,139,157,52,74,162,163,47,154,41,226,235,174,211,227,73,230,8,255,180,169,10,45,30,103,10,248,231,252,251,139,6,141,179,4,172,47,1,187,199,114,123,56,21,109,187,246,5,100,96,64,6,231,139,128,13,13,216,112,132,69,6,44,26,97,51,3,54,195,216,115,149,111,139,199,186,218,21,32,216,99,189,6,201,19,81,33,144,128,71,64,76,201,131,72,9,40,206,195,7,166,196,65,152,1,20,7,159,217,167,24,196,47,242,144,4,124,133,158,34,17,63,88,67,18,62,28,155,98,0,195,54,73,60,181,20,87,105,103,159,29,167,229,135,239,147,144,96,248,68,55,197,32,124,204,131,20,252,235,213,20,1,248,202,5,197,135,143,61,83,4,194,103,33,72,193,191,145,76,17,128,111,41,130,248,240,45,97,146,65,248,236,32,144,244,43,238,147,28,112,109,30,82,176,245,234,41,249,97,89,91,16,102,235,189,147,210,195,186,48,20,23,86,66,167,56,198,203,166,2,209,193,142,226,160,18,230,75,89,83,210,96,201,11,138,15,107,59,83,4,194,42,16,164,24,22,44,166,40,132,165,141,124,139,247,1,14,113,104,236,183,49,28,141,97,96,44,142,86,76,12,201,97,176,62,72,68,43,6,98,69,24,6,68,3,104,165,132,160,0,134,234,191,123,106,165,192,231,79,46,51,124,255,210,75,193,207,96,12,197,191,17,105,133,134,79,69,92,130,127,93,209,139,12,31,89,24,6,172,65,106,165,132,165,200,26,199,169,118,47,110,24,95,217,159,56,128,121,72,143,252,33,61,26,146,99,144,12,208,9,72,78,134,228,20,36,167,32,25,232,76,1,11,94,49,228,25,193,171,215,62,230,187,250,153,70,223,210,191,215,190,19,156,47,78,116,190,56,190,211,239,197,162,121,212,200,37,89,199,245,253,32,95,44,41,56,60,95,28,23,255,49,133,191,219,212,23,174,167,199,150,167,182,232,88,42,56,233,141,38,55,100,123,199,56,143,164,214,251,189,82,80,45,194,18,184,201,100,243,171,104,118,24,159,47,78,236,19,91,194,41,99,144,255,103,50,166,60,157,120,116,54,43,16,81,232,248,164,106,208,116,93,250,187,63,147,57,213,195,184,69,226,90,9,112,253,184,145,69,51,91,250,196,230,4,227,209,199,106,150,199,221,200,244,222,144,192,206,112,94,225,110,248,177,12,111,143,255,140,189,144,220,9,225,150,78,122,34,55,182,171,240,12,63,26,164,215,74,62,152,237,173,162,198,195,15,211,87,225,236,37,249,215,13,174,99,129,181,200,66,202,176,92,248,14,254,31,217,55,138,109,253,155,163,44,200,115,185,235,30,23,11,49,143,122,96,251,212,224,239,169,228,199,159,198,9,110,56,223,252,240,39,50,31,205,55,31,253,68,230,103,243,205,207,126,14,243,89,231,212,111,176,186,255,18,251,87,169,219,90,255,117,191,90,109,125,63,243,95,255,222,62,157,113,160,122,235,124,166,89,116,210,112,44,47,159,203,147,83,229,155,101,83,236,240,255,23,139,171,45,187,64,81,31,48,137,34,73,189,33,44,246,63,45,65,152,198,98,220,237,230,213,249,49,95,8,144,215,222,108,62,49,213,89,29,249,153,191,223,223,104,245,4,249,124,163,251,105,244,155,108,230,59,163,116,54,251,254,38,221,165,55,218,60,65,62,223,230,126,31,215,155,108,6,91,160,12,102,111,210,91,171,122,154,127,190,229,112,219,214,155,140,7,203,40,58,227,139,32,204,247,155,27,141,159,230,159,111,60,92,250,121,147,241,124,49,72,103,121,146,167,97,22,222,104,249,4,249,124,179,251,165,171,55,218,204,54,252,232,219,250,54,141,179,155,141,54,179,223,98,53,223,160,244,38,179,135,21,60,109,101,135,241,254,230,238,124,146,126,190,225,96,205,241,77,150,243,13,58,58,187,51,127,187,187,249,229,61,65,62,223,234,126,59,209,155,108,30,54,227,104,135,44,69,82,220,108,245,36,253,124,187,193,246,161,55,89,206,215,156,181,118,39,81,180,202,111,180,123,130,124,190,213,253,10,249,219,108,30,246,214,232,171,59,93,197,187,91,205,158,228,191,193,114,176,31,232,93,140,79,112,225,144,250,5,190,143,147,112,159,36,111,50,94,207,127,187,241,56,102,22,189,135,241,43,189,241,121,28,165,193,230,141,198,175,126,128,241,171,55,27,223,127,40,210,181,250,124,139,54,55,191,210,38,233,111,48,125,248,180,245,166,54,207,190,118,105,31,246,77,184,141,146,27,205,54,115,207,183,153,127,153,123,155,193,236,91,157,214,226,125,24,197,183,78,203,38,200,111,48,153,127,89,124,147,205,194,158,39,237,96,181,200,227,98,117,163,225,54,26,230,91,47,238,213,122,155,11,14,102,227,253,60,46,110,125,188,205,220,55,152,125,120,7,131,249,118,32,195,60,60,207,111,109,231,19,228,243,77,238,55,47,189,201,230,225,139,186,118,132,190,139,209,205,221,248,36,253,124,187,65,12,192,155,44,31,54,218,104,151,30,118,155,240,230,81,250,36,253,124,203,193,214,160,219,44,39,11,174,253,1,41,163,5,96,221,81,41,4,193,135,13,33,54,39,145,101,255,186,223,23,104,87,172,86,243,124,101,197,109,57,162,193,103,192,36,35,183,188,142,138,31,79,152,45,238,147,39,32,112,85,163,70,136,239,28,171,159,58,178,1,137,253,151,5,177,246,53,35,36,47,238,248,79,178,34,79,99,82,121,18,186,137,2,65,138,225,208,21,158,98,62,124,101,83,61,177,0,7,252,215,26,255,131,63,35,44,238,246,101,213,21,205,80,4,156,179,28,154,219,134,28,138,142,67,90,65,34,190,125,168,201,219,110,41,92,33,248,66,110,5,2,105,143,79,248,126,167,46,239,96,98,121,194,71,170,131,132,54,239,158,26,17,211,22,231,50,7,191,119,77,125,102,13,127,201,108,33,167,163,143,236,161,120,158,187,248,184,182,241,111,249,74,211,218,227,7,182,140,127,179,86,90,118,105,63,166,101,189,174,171,168,122,221,255,245,57,240,253,79,31,210,182,129,215,229,61,247,144,180,30,254,252,156,248,187,226,225,67,154,72,41,174,128,110,77,255,243,113,107,141,75,184,253,192,132,37,172,249,31,159,227,143,106,26,206,190,14,200,53,249,247,227,86,21,45,242,245,35,118,232,249,246,64,146,192,216,2,38,129,65,6,188,59,152,228,75,230,66,65,104,119,159,174,114,64,159,171,240,68,159,167,114,73,159,169,244,77,159,43,57,169,207,97,33,192,170,44,133,35,135,60,234,209,187,127,249,129,248,129,28,99,124,162,247,77,95,135,63,221,115,83,159,139,166,123,161,51,131,37,188,92,154,38,212,13,217,210,68,126,8,227,223,165,114,223,220,18,223,119,185,164,183,109,46,229,123,178,151,210,77,220,203,241,181,216,75,110,232,16,54,179,236,15,60,160,127,225,19,76,150,212,193,204,147,180,114,151,154,198,191,28,255,222,149,237,185,202,95,150,184,18,105,57,218,114,83,86,88,43,190,204,19,103,157,235,18,95,126,228,22,223,139,83,215,222,1,151,117,229,17,79,94,246,79,167,45,254,61,180,168,34,111,11,54,157,218,21,251,252,169,98,39,53,40,197,22,11,200,185,123,162,78,28,200,120,138,158,144,35,22,66,229,186,121,85,41,43,56,175,170,15,100,69,95,227,74,91,166,218,195,159,221,80,254,55,222,251,32,136,175,211,248,216,42,53,225,12,32,24,242,217,119,15,240,66,181,160,23,66,185,72,150,139,52,114,81,251,234,97,31,185,252,76,125,252,131,89,204,210,23,211,142,230,200,87,239,153,92,38,255,72,190,142,14,213,11,82,135,106,29,38,223,195,53,34,226,60,30,167,223,201,73,120,208,82,245,55,237,242,238,224,169,37,187,192,112,6,21,28,39,188,122,167,26,95,183,219,180,221,253,218,61,182,46,90,159,234,238,243,154,164,184,219,199,178,218,45,174,199,188,121,40,79,211,215,5,186,248,30,157,17,223,249,34,19,46,61,220,211,158,93,25,90,182,159,215,207,143,69,83,124,166,144,133,44,236,252,166,46,144,75,86,63,40,49,35,37,221,121,177,115,91,183,122,80,80,3,86,76,202,58,124,194,198,254,197,125,243,83,203,234,147,254,32,215,67,49,104,113,218,153,129,154,242,224,251,151,172,203,211,213,103,114,193,156,82,7,190,243,9,224,200,123,91,7,28,21,134,139,205,42,200,104,41,169,119,25,89,73,2,56,176,30,69,149,86,57,116,64,161,174,16,12,210,212,7,118,181,69,109,24,96,175,127,199,119,126,228,159,31,241,123,110,77,254,93,92,89,233,200,47,92,60,50,7,69,177,162,108,4,130,139,197,102,165,40,222,21,15,175,162,252,134,45,244,225,181,90,19,197,120,172,129,23,62,247,55,4,238,188,143,242,137,149,81,186,48,25,203,107,162,130,118,120,82,239,253,95,76,250,133,99,124,225,161,208,50,31,248,198,62,205,168,63,120,84,32,230,123,236,124,115,41,249,246,59,31,148,176,127,128,234,237,83,123,191,166,113,229,170,199,7,231,99,146,127,214,144,115,217,77,164,17,217,185,74,191,52,46,208,242,55,224,99,185,219,21,167,73,106,187,119,40,235,34,246,117,179,45,216,227,209,174,243,109,87,126,47,250,199,109,182,126,142,164,206,196,135,65,112,213,248,111,167,173,171,114,231,208,99,247,250,182,154,183,238,253,215,167,234,254,219,253,250,216,186,137,170,165,230,237,103,156,252,84,45,180,175,68,237,93,195,5,158,216,60,22,219,67,177,35,29,71,127,163,8,84,132,81,139,53,131,253,47,85,207,161,187,148,68,226,231,119,112,220,78,15,110,241,144,216,249,253,22,183,179,131,27,50,36,118,112,89,196,237,10,196,27,39,36,29,224,170,133,219,117,136,247,53,72,58,120,232,237,237,10,192,190,115,5,59,59,86,255,45,244,195,201,252,18,255,112,70,253,237,10,132,115,238,37,13,60,106,243,118,126,112,140,188,196,62,196,70,222,206,47,28,207,46,105,224,167,143,223,206,15,206,47,151,217,213,175,226,153,10,132,215,178,172,163,63,13,251,13,42,224,137,218,146,6,118,200,244,237,244,195,41,213,50,55,59,197,249,13,228,195,57,208,18,187,112,16,242,237,42,198,231,41,203,122,14,111,213,112,208,114,243,211,111,111,39,7,231,231,74,236,195,137,177,183,243,11,167,206,74,26,134,195,176,110,215,32,28,168,69,52,8,199,172,60,214,207,167,251,53,157,242,36,178,22,9,139,245,209,81,156,253,139,95,161,16,79,217,130,251,47,161,165,70,124,109,124,236,127,210,243,185,253,226,148,251,50,135,152,95,48,199,101,215,142,27,251,159,156,187,62,105,24,210,14,168,203,66,145,248,98,178,22,20,206,191,181,100,42,23,251,139,119,46,41,89,217,195,199,129,204,41,37,21,186,172,241,215,170,59,144,242,34,165,252,65,83,232,119,228,97,24,79,229,23,163,132,190,156,108,0,76,27,169,162,100,36,127,70,195,244,71,196,184,49,134,6,90,220,250,84,60,225,136,71,104,132,200,64,104,85,183,46,122,83,229,170,202,148,188,185,76,201,123,148,137,86,111,26,79,149,134,183,171,52,30,53,171,81,194,31,36,225,182,70,117,190,24,171,254,156,239,118,116,230,76,166,79,54,173,64,188,77,209,192,109,49,165,129,148,250,41,141,129,113,60,139,129,132,250,89,140,129,112,60,113,129,132,198,137,139,129,83,49,87,129,180,198,185,138,129,86,49,61,129,180,252,86,179,89,156,224,42,52,5,161,118,70,98,100,28,77,66,32,165,105,18,98,224,148,231,29,144,148,223,40,53,139,18,92,67,37,17,14,215,50,205,162,20,110,115,146,72,245,179,11,3,229,120,66,33,16,154,38,20,38,78,121,14,33,208,26,230,16,38,86,105,218,0,73,181,211,6,3,227,104,166,32,208,105,103,10,38,190,209,228,0,18,78,76,14,12,172,202,249,128,64,125,184,129,244,160,165,211,79,1,12,124,227,81,63,36,52,141,250,13,148,242,64,31,146,14,215,33,204,34,21,110,81,128,164,242,74,177,234,253,250,79,184,80,44,57,137,190,114,35,163,227,77,75,197,189,188,138,156,188,125,111,231,230,226,42,106,242,30,190,157,154,139,171,168,249,235,248,118,118,192,160,82,192,95,204,183,43,0,12,42,5,124,27,192,141,236,96,23,129,130,26,191,174,223,194,205,228,85,228,236,189,125,59,251,64,160,162,39,239,240,219,201,185,184,138,154,189,203,111,39,31,8,84,244,228,189,126,59,57,23,87,82,179,215,251,27,216,7,6,165,2,250,166,127,3,127,79,160,162,199,175,253,219,185,153,180,146,24,191,255,223,192,204,196,85,212,195,32,224,118,126,129,67,169,228,240,38,250,131,150,152,140,14,110,103,230,226,42,106,54,74,184,157,124,32,80,209,179,241,194,237,244,3,1,137,241,197,65,27,85,209,117,248,51,247,190,170,243,142,196,141,172,97,198,149,164,175,113,250,88,2,247,38,34,86,252,164,88,156,118,202,9,119,36,233,38,99,168,244,82,141,52,147,235,153,202,63,250,69,1,134,90,220,209,239,168,5,142,93,25,70,34,85,145,227,169,254,82,4,187,46,0,47,100,171,177,142,77,93,237,68,213,132,144,228,61,67,45,32,133,8,45,238,44,48,74,99,249,37,215,162,90,227,205,217,12,89,158,10,178,32,185,61,144,207,228,229,174,104,251,26,43,121,0,24,207,231,222,17,225,139,59,170,143,87,137,6,37,170,236,175,207,130,202,244,87,108,241,48,210,225,75,226,138,110,73,92,175,121,150,34,170,37,240,131,44,156,125,12,207,77,186,108,206,29,90,41,182,60,190,190,122,249,158,84,100,190,105,235,234,169,43,214,228,247,149,5,200,174,133,64,120,44,113,119,174,105,216,95,47,209,83,208,37,209,251,175,225,249,114,255,109,146,71,177,60,74,46,138,24,145,161,91,201,16,32,195,107,170,254,189,23,79,242,232,22,87,189,120,33,144,217,26,137,249,160,85,71,188,192,55,37,36,116,60,218,85,190,129,49,121,7,198,100,96,100,33,29,83,156,44,148,154,133,81,50,89,86,3,155,170,222,30,172,25,160,208,80,10,55,152,36,96,157,166,202,158,0,216,227,162,183,48,33,200,20,191,133,41,134,76,201,91,152,64,109,61,91,88,71,195,17,39,140,123,182,48,78,79,20,67,162,228,13,68,130,105,251,167,170,178,228,194,159,114,122,73,30,104,105,37,207,226,39,89,220,100,228,33,63,204,194,34,202,192,99,75,33,148,105,41,38,90,52,83,24,38,58,17,60,10,2,71,69,45,232,253,181,32,89,203,198,86,203,166,238,186,250,104,165,140,65,181,150,145,119,19,254,198,103,169,90,51,172,160,55,137,42,168,195,55,83,135,58,234,232,205,212,145,130,26,92,76,127,59,187,120,187,61,87,192,35,17,39,105,77,223,240,121,60,34,127,29,246,35,64,27,79,219,184,88,220,211,50,253,142,253,152,123,94,152,177,124,39,210,253,215,251,95,239,127,237,135,20,208,196,245,47,191,220,105,205,87,19,125,209,82,125,153,195,133,223,237,147,254,23,248,73,104,41,252,49,14,36,129,117,76,63,210,210,94,218,16,82,98,87,2,192,72,191,235,191,225,211,240,184,180,188,223,28,135,241,206,46,169,246,121,229,15,149,180,117,131,56,7,236,72,48,236,211,128,175,46,237,30,13,241,253,166,218,41,98,167,236,13,155,66,36,165,199,221,45,74,143,59,75,165,199,157,74,105,123,188,69,105,123,180,84,218,30,85,74,47,213,45,74,193,54,23,179,82,178,205,69,218,109,163,174,83,227,198,26,80,161,230,141,53,164,66,233,238,150,99,225,250,96,15,139,229,250,137,223,203,15,187,99,72,155,7,76,186,173,48,186,6,175,129,200,138,170,7,27,53,183,238,184,145,212,29,119,179,213,141,26,185,1,38,171,107,143,179,213,141,154,183,1,38,171,187,84,179,213,141,26,182,1,54,86,215,168,235,110,178,177,142,70,165,86,13,155,235,220,168,117,218,80,141,212,154,158,59,174,149,79,75,196,135,138,167,18,101,54,195,111,138,164,163,111,127,196,189,81,114,223,58,182,247,95,189,122,7,55,84,224,104,239,83,247,72,217,63,215,187,157,213,30,10,118,47,217,14,108,157,152,75,4,238,163,227,60,252,156,249,89,60,253,225,244,3,15,56,181,125,22,21,60,237,125,96,3,199,160,207,98,19,111,206,227,108,253,22,135,57,84,96,87,195,192,195,206,180,154,73,52,156,132,197,153,134,3,176,103,81,9,119,245,113,174,126,131,194,28,38,176,39,129,243,128,173,8,115,152,132,221,7,156,139,31,126,60,139,9,220,41,216,243,12,71,166,205,163,18,142,90,235,217,250,51,90,231,145,193,91,11,57,23,59,251,116,22,209,112,147,97,207,194,142,19,157,71,51,220,110,200,121,132,131,57,103,145,137,71,122,2,198,195,13,92,135,49,11,63,70,114,22,77,127,246,228,192,51,28,203,56,139,73,188,209,145,113,209,201,202,28,154,254,12,190,157,16,240,63,183,52,224,132,197,87,15,159,162,49,218,99,55,112,133,167,25,187,234,122,166,62,244,116,6,17,136,60,237,121,250,136,211,25,60,32,224,180,231,129,129,166,51,168,196,56,211,158,13,198,151,206,96,19,195,75,123,54,214,187,207,97,98,34,18,203,204,2,129,216,84,192,195,99,82,103,17,13,33,169,61,19,8,69,157,65,37,68,162,246,92,125,4,234,12,38,16,128,218,243,128,192,211,25,76,66,220,105,207,213,199,155,206,96,2,225,166,3,15,8,51,157,67,37,68,153,14,108,67,116,233,28,50,24,92,218,115,241,160,210,25,68,67,76,233,192,194,99,73,231,208,12,161,164,61,143,24,66,58,131,108,28,65,58,48,30,230,115,29,36,150,62,96,116,6,13,136,23,237,121,64,156,232,12,38,33,76,180,231,2,225,161,51,184,132,232,208,250,140,185,246,85,65,142,60,249,138,127,126,91,174,207,245,25,159,63,224,226,159,203,53,254,119,113,229,223,8,49,246,213,35,97,33,238,115,217,61,150,167,251,245,31,110,224,175,97,210,245,15,252,136,23,120,253,111,140,29,173,173,227,119,154,32,57,185,144,78,95,103,34,169,16,201,157,142,41,167,46,90,23,185,72,140,203,136,97,118,92,172,255,115,196,197,42,60,19,188,209,51,193,79,235,153,240,141,158,9,127,90,207,160,55,122,6,253,180,158,25,226,204,53,30,50,135,150,43,24,251,224,114,107,66,16,79,174,224,235,35,202,173,249,64,16,185,130,15,134,145,91,83,138,145,227,10,214,254,179,167,53,37,248,218,169,227,139,102,243,25,202,199,227,195,103,16,14,33,225,10,70,16,20,110,77,41,196,129,43,56,251,72,112,107,70,16,252,173,224,3,225,223,214,140,66,196,183,130,19,6,102,91,147,138,177,216,6,214,248,22,214,88,199,202,131,176,173,25,135,184,107,5,155,24,30,109,205,57,142,136,86,49,31,230,114,30,12,108,125,32,180,53,29,136,125,86,240,129,232,103,107,70,33,224,89,193,9,66,158,173,57,197,40,103,129,115,116,8,147,76,249,30,199,62,217,171,156,115,210,147,242,52,58,118,70,153,120,124,2,205,181,220,17,30,220,186,35,156,159,34,55,138,238,161,186,109,98,120,68,2,254,140,162,105,14,0,5,52,252,29,29,14,4,211,11,101,161,146,2,205,161,80,151,34,158,67,17,43,41,178,57,20,217,136,130,140,21,44,93,193,177,50,1,154,65,128,84,4,241,12,130,88,69,144,205,32,24,251,128,140,111,44,125,192,177,50,1,154,65,128,84,4,241,12,130,88,69,144,205,32,24,251,128,15,200,44,221,0,224,74,26,52,143,6,105,104,226,121,52,177,134,38,155,71,51,246,13,95,1,182,244,13,128,43,105,208,60,26,164,161,137,231,209,196,26,154,108,30,205,216,55,124,25,220,130,98,88,254,30,137,7,190,189,124,160,210,31,206,32,8,85,4,209,12,130,72,69,128,102,16,32,21,65,54,131,64,89,7,171,25,4,43,137,0,207,76,172,189,200,192,10,10,52,135,2,41,41,226,57,20,177,146,34,155,67,49,118,38,155,82,89,58,99,64,171,72,208,44,18,164,38,137,103,145,196,106,146,108,22,201,216,39,100,82,104,233,17,142,149,9,208,12,2,164,34,136,103,16,196,42,130,108,6,193,216,7,108,26,107,233,133,1,173,34,65,179,72,144,154,36,158,69,18,171,73,178,89,36,99,159,144,239,98,150,30,225,88,153,0,205,32,64,42,130,120,6,65,172,34,200,102,16,72,62,232,215,12,172,40,122,180,146,196,242,77,40,110,65,144,105,194,121,52,161,134,6,205,163,65,90,207,204,116,141,154,38,157,71,147,106,104,178,121,52,82,117,211,79,174,182,30,238,209,42,18,52,139,4,169,73,226,89,36,177,154,36,155,69,50,246,9,94,228,178,116,8,131,74,226,200,94,28,41,196,99,123,241,88,33,158,217,139,75,182,227,79,222,182,198,51,172,76,128,102,16,32,21,65,60,131,32,86,17,100,51,8,198,62,24,22,36,45,29,33,8,104,168,208,92,42,164,165,138,231,82,197,90,170,108,46,149,228,171,131,189,151,14,10,255,28,236,61,115,80,248,228,96,239,141,131,194,15,7,123,15,28,100,219,201,170,176,165,241,28,43,19,160,25,4,72,69,16,207,32,136,85,4,217,12,2,201,7,195,17,1,58,14,186,142,11,100,216,218,183,165,231,6,244,66,65,130,102,145,32,53,73,60,139,36,86,147,100,179,72,198,126,100,55,146,4,90,14,118,243,73,144,207,59,35,98,134,6,171,235,77,2,249,88,136,65,5,251,0,97,89,177,3,122,161,32,65,179,72,144,154,36,158,69,34,207,177,78,69,142,119,138,184,155,10,126,91,232,111,162,235,15,184,232,106,135,110,112,112,200,129,49,160,134,128,222,242,152,63,20,107,70,202,57,140,85,118,107,1,28,94,129,175,19,230,76,150,14,94,101,73,85,182,93,125,110,23,58,63,53,182,197,36,155,77,126,132,163,230,149,96,210,83,205,15,242,212,116,125,254,160,150,100,167,120,202,47,239,216,128,70,231,14,83,94,115,128,55,148,220,84,249,246,160,149,34,185,146,4,139,10,215,11,245,33,224,80,174,143,2,215,201,129,144,111,40,7,163,190,117,162,98,136,55,148,134,81,222,58,105,49,164,27,74,143,150,147,109,214,144,197,67,134,141,114,26,125,233,148,92,170,150,91,77,201,173,20,114,60,78,92,47,56,4,133,139,87,112,245,113,225,58,81,33,8,92,125,125,23,20,85,220,212,5,133,250,224,113,157,58,16,41,14,229,64,176,184,78,82,136,12,23,238,5,227,193,225,58,73,16,9,174,186,79,44,54,137,170,214,55,164,19,139,167,164,245,186,83,11,233,84,43,157,89,72,103,90,233,149,133,180,220,24,65,208,187,86,24,70,184,67,89,30,228,174,19,28,34,218,5,41,30,212,174,21,27,34,216,161,28,15,57,215,137,13,241,229,80,170,15,49,215,137,129,120,114,40,7,66,202,117,146,66,252,56,148,165,123,147,116,98,124,31,18,148,0,65,231,58,49,33,194,156,201,226,141,187,13,137,64,161,82,227,171,139,73,86,15,234,197,104,236,36,222,238,11,94,171,44,140,211,119,2,28,102,29,196,231,139,227,70,231,139,51,138,184,100,97,160,100,126,228,251,65,190,88,250,14,142,36,77,48,30,89,224,255,12,49,163,124,116,80,61,53,244,16,16,224,7,114,239,184,243,17,239,129,103,86,245,42,93,127,52,108,162,201,3,224,243,7,189,240,158,25,58,208,139,150,14,233,0,242,217,223,21,15,31,217,90,202,36,90,74,211,88,214,7,175,77,46,8,190,191,8,132,61,224,51,62,254,230,67,91,138,81,98,69,146,36,154,241,65,171,145,5,111,226,109,75,136,133,127,246,251,149,144,223,231,178,56,193,97,234,68,145,218,240,65,56,131,18,41,250,144,181,9,6,16,174,166,32,72,44,9,84,37,232,231,86,19,4,96,138,37,18,192,73,214,4,135,56,215,18,105,224,108,107,130,70,156,116,137,52,98,180,255,213,230,208,56,5,65,98,73,160,46,1,159,24,77,50,12,243,35,145,2,204,144,38,56,132,137,146,72,210,207,122,38,40,192,228,71,36,0,211,159,9,10,97,22,36,146,244,243,160,9,10,48,29,26,17,140,195,239,103,109,3,148,104,18,123,26,101,105,134,137,198,20,11,156,111,136,36,124,198,49,193,48,76,60,70,226,124,234,49,37,63,204,64,68,2,113,35,237,4,203,120,243,236,136,234,96,71,114,80,139,247,243,154,9,121,48,189,17,9,192,4,103,130,66,152,231,136,36,96,222,50,65,34,76,95,84,87,5,245,27,76,237,118,150,138,91,74,255,185,247,146,138,155,72,255,185,119,143,138,219,70,255,185,247,139,138,27,69,255,185,119,136,10,91,67,145,47,247,27,230,45,35,50,71,60,131,35,214,112,36,51,56,18,137,67,220,148,58,107,55,42,100,64,246,12,72,205,16,219,51,196,106,134,196,158,65,246,131,184,153,118,214,46,90,200,128,236,25,144,154,33,182,103,136,213,12,137,61,131,236,7,184,239,99,154,68,220,246,161,226,137,103,241,196,90,158,100,22,143,108,23,220,179,49,205,35,110,217,80,241,196,179,120,98,45,79,50,139,71,182,107,52,225,154,179,175,90,185,161,122,214,78,106,200,128,236,25,144,154,33,182,103,136,213,12,137,61,131,202,147,124,239,132,13,197,176,117,66,125,217,152,45,71,164,225,64,51,56,144,134,35,158,193,17,107,56,146,25,28,178,79,193,246,137,105,18,97,247,132,130,37,158,195,18,235,88,210,57,44,242,92,161,223,65,49,205,1,54,80,40,47,117,179,100,136,212,12,200,158,1,169,25,98,123,134,88,205,144,218,51,200,158,4,91,40,166,57,132,29,20,10,150,120,14,75,172,99,73,230,176,200,173,189,223,69,49,205,1,54,81,40,175,205,179,100,136,212,12,200,158,1,169,25,98,123,134,88,205,144,216,51,40,60,57,62,74,98,238,25,18,35,30,52,139,7,105,121,226,89,60,177,150,39,157,197,35,63,59,96,243,130,5,13,220,187,160,185,232,208,154,37,210,177,160,57,44,72,199,18,207,97,137,117,44,201,28,22,185,245,225,149,191,192,138,130,33,21,242,145,181,124,164,148,71,214,242,72,41,31,91,203,199,74,249,196,90,94,225,63,190,19,194,130,96,216,8,33,49,196,246,12,177,154,33,177,103,144,173,16,119,48,76,211,140,55,48,168,185,226,153,92,178,101,124,231,128,5,203,65,89,150,131,117,41,14,58,253,137,181,188,236,87,241,16,154,89,167,207,64,6,100,207,128,212,12,177,61,67,172,102,72,236,25,100,63,128,56,254,105,14,33,140,95,193,18,207,97,137,117,44,201,28,22,217,34,16,192,62,205,34,196,175,43,88,226,57,44,130,69,170,243,119,222,249,172,31,141,146,57,167,251,140,137,72,8,209,236,178,114,22,229,37,53,56,235,63,225,170,26,101,9,58,99,9,222,241,98,21,166,94,113,109,9,213,254,35,47,47,81,234,222,152,116,191,251,69,24,244,116,169,239,101,91,110,170,98,116,220,37,75,253,39,63,239,82,244,205,232,248,64,217,69,22,231,7,246,140,202,147,190,4,202,247,59,93,204,78,233,252,30,72,34,214,48,142,238,58,17,146,23,189,81,224,10,67,77,177,195,119,224,15,13,252,172,173,132,147,142,209,50,192,205,247,106,146,169,29,248,19,196,233,13,196,169,137,152,198,10,219,82,246,151,19,146,6,118,191,222,62,53,45,109,230,155,13,190,28,154,166,95,105,242,154,39,191,122,187,178,205,55,21,190,242,141,73,156,234,14,223,62,88,63,23,187,53,207,228,98,32,15,74,14,123,30,240,40,97,16,50,45,20,15,210,53,62,196,174,35,71,52,244,162,44,109,237,197,234,3,243,118,121,151,187,247,95,219,162,42,182,93,177,187,255,125,159,87,109,113,255,237,126,45,159,224,246,149,128,57,148,34,191,205,57,213,13,151,214,66,31,251,138,117,179,58,38,111,169,141,125,43,186,89,27,147,183,212,54,124,202,185,89,225,64,97,169,115,248,204,114,179,206,129,194,82,39,63,196,234,102,141,224,20,44,59,125,116,153,254,13,250,40,129,165,190,126,29,253,102,133,61,131,165,70,182,210,124,179,62,38,111,169,173,95,11,190,89,95,207,96,169,145,173,150,222,172,143,201,219,106,227,107,100,183,235,227,12,150,26,233,98,210,205,234,168,184,173,46,186,234,115,187,50,42,111,169,141,46,132,220,172,140,138,91,234,98,235,13,55,43,99,242,150,218,250,21,129,155,245,245,12,150,26,251,25,251,205,26,123,6,28,48,46,169,236,154,39,162,17,30,15,59,82,133,33,223,236,15,139,53,169,224,39,169,206,215,0,206,96,53,41,224,199,148,206,87,0,14,56,53,41,0,7,128,206,215,33,158,30,106,82,3,206,210,156,175,70,60,136,211,164,134,199,56,204,215,1,162,35,204,10,216,151,255,91,52,12,65,3,38,21,195,81,132,243,117,8,199,24,154,148,240,143,211,243,85,128,207,218,38,5,195,193,121,243,85,8,135,238,153,148,240,207,168,243,85,128,15,176,70,5,195,188,238,6,29,194,164,208,168,166,255,68,119,131,22,248,121,207,164,132,29,217,53,95,195,112,214,151,145,158,29,138,117,3,255,112,156,150,73,129,112,216,212,124,45,227,179,170,140,170,14,183,42,57,216,208,243,51,145,230,243,131,211,148,76,10,134,163,131,230,171,16,142,29,50,41,25,142,177,153,175,68,56,2,135,43,193,251,201,238,127,223,214,199,115,85,96,101,223,132,99,197,153,18,12,26,48,223,172,143,25,55,43,225,203,13,183,40,129,75,21,19,74,88,164,213,109,90,134,48,45,179,154,33,2,234,22,61,66,252,148,89,17,15,255,184,69,13,8,29,153,80,50,4,83,220,164,71,136,197,152,80,213,135,21,220,164,9,6,37,152,21,177,207,230,183,104,25,190,184,155,85,8,95,144,111,81,52,254,4,109,86,55,124,205,187,69,151,240,45,112,164,136,126,84,128,125,65,54,82,66,17,223,172,239,11,48,41,224,167,180,204,87,0,206,119,49,43,96,103,85,223,162,97,56,230,218,164,98,56,251,121,190,14,225,220,104,147,18,126,132,238,124,21,224,240,93,163,130,225,172,146,27,116,8,7,157,24,213,244,39,161,222,160,5,158,162,106,82,130,31,218,213,45,26,152,224,4,189,112,72,229,124,37,227,51,46,77,170,134,29,120,243,245,192,221,123,108,169,254,88,158,216,39,29,228,55,197,113,113,245,218,227,253,26,147,150,219,107,127,52,23,253,253,74,242,254,112,243,167,174,238,119,133,227,31,52,131,237,186,205,219,238,74,254,92,175,86,171,21,205,58,182,110,120,61,230,205,67,121,114,203,19,251,172,148,55,157,242,126,156,112,209,11,33,107,33,196,133,54,174,207,133,232,231,91,37,220,103,240,77,85,111,15,253,253,157,228,23,205,192,87,121,142,238,245,196,201,15,77,185,235,147,241,15,154,76,191,4,246,25,52,48,0,103,176,114,11,108,32,141,73,187,232,250,88,224,15,210,70,211,30,221,196,4,75,122,88,106,130,165,61,44,240,77,184,192,31,212,26,139,151,240,242,61,187,232,74,155,146,201,138,103,55,49,160,146,30,21,248,6,88,95,184,103,119,101,162,91,13,124,164,209,82,228,208,100,113,13,226,103,3,55,79,242,119,87,28,207,228,186,165,109,93,61,29,79,237,186,41,206,69,222,125,14,151,199,242,116,204,47,159,253,101,176,111,22,139,177,120,100,22,143,148,226,184,5,184,77,253,124,37,127,236,202,166,216,146,167,173,169,159,89,235,233,138,99,235,110,139,83,87,52,215,188,42,31,78,46,73,90,211,36,10,250,199,83,219,149,251,23,119,83,116,207,69,113,186,242,223,248,32,9,124,52,42,118,70,193,115,95,215,207,143,69,83,124,166,79,57,201,121,113,253,127,195,31,11,63,131,96,137,197,130,29,104,193,16,77,241,189,104,218,98,237,223,241,71,11,63,41,240,113,84,63,100,191,13,33,1,34,211,98,33,50,21,167,157,145,135,110,112,117,92,71,79,184,80,216,118,113,209,132,109,23,217,54,185,175,81,183,231,177,113,23,217,56,70,101,180,14,233,173,187,76,89,151,253,40,235,178,247,178,46,187,193,186,93,249,189,220,21,238,69,107,28,7,0,235,250,131,35,84,161,12,125,216,17,137,100,24,67,113,44,18,232,66,130,243,101,176,125,172,105,49,22,199,209,73,35,97,217,94,153,133,245,0,60,98,169,122,224,225,73,218,48,35,8,199,239,151,145,128,207,222,103,52,209,191,66,147,39,28,65,139,47,18,16,13,146,8,13,159,145,82,152,228,3,63,156,80,30,132,176,140,30,8,142,241,213,30,218,140,161,103,55,188,158,243,221,14,7,69,152,134,10,103,23,25,113,168,199,37,70,28,127,93,156,47,174,207,129,172,166,141,195,136,243,101,40,128,9,223,151,163,149,248,13,99,155,94,75,33,75,245,15,159,78,166,115,195,172,23,234,234,179,218,143,25,131,211,211,70,233,11,135,158,142,138,223,58,194,251,134,36,163,75,117,221,215,248,72,213,242,143,190,125,177,140,197,29,141,142,162,67,134,190,237,85,69,142,203,176,20,193,174,11,192,11,88,138,88,167,34,158,163,34,54,169,216,228,109,161,214,129,115,236,149,96,180,94,75,123,84,235,104,143,246,26,218,163,158,255,210,170,249,47,173,61,255,165,85,242,19,94,60,81,120,58,210,222,128,36,60,67,62,144,194,144,139,59,43,20,176,0,132,88,77,30,27,66,94,127,244,76,194,161,147,234,79,61,244,105,104,221,159,33,246,17,23,52,223,119,228,136,59,26,40,72,126,93,249,184,76,56,241,11,159,103,126,39,79,31,152,60,123,214,201,80,201,154,5,10,9,108,12,233,222,127,189,255,245,254,215,251,111,140,17,178,172,127,249,229,78,171,65,29,229,69,166,10,55,156,205,15,228,110,59,131,245,85,49,149,205,232,84,246,184,211,79,101,113,30,126,121,147,121,1,109,3,160,75,165,83,4,140,193,1,208,4,131,251,206,33,89,57,11,198,25,179,167,186,68,168,112,147,171,102,84,165,120,69,17,145,110,152,232,234,186,117,159,97,149,179,92,156,161,152,229,226,100,197,44,23,39,43,103,185,56,99,114,150,75,164,221,251,175,217,249,114,255,141,79,38,179,51,200,9,3,152,21,6,48,15,133,48,15,133,48,111,21,195,60,252,11,112,38,130,32,249,9,114,83,161,52,228,39,200,93,33,33,23,255,28,114,147,88,200,37,63,65,110,38,232,37,63,121,46,105,53,44,99,104,52,207,110,112,255,37,98,211,211,40,242,162,40,138,62,241,172,112,200,74,18,47,73,146,180,207,66,153,105,198,157,45,56,238,254,235,42,33,69,162,104,252,131,103,73,243,98,154,188,127,170,42,150,140,15,106,100,109,46,191,184,152,44,96,53,66,126,83,204,80,43,28,20,7,99,16,73,25,129,86,233,24,132,83,134,102,120,227,244,154,55,110,237,244,26,2,248,176,92,1,228,89,172,157,79,205,199,49,104,222,124,156,26,154,159,221,236,250,144,171,159,226,108,152,29,145,14,237,39,155,181,247,30,192,99,110,90,177,174,206,21,190,202,21,23,55,250,81,211,224,232,189,166,193,209,204,105,48,180,238,231,153,228,19,179,204,147,88,136,104,193,188,248,125,119,76,65,45,133,164,229,61,54,38,145,215,238,91,38,227,128,96,230,100,156,72,218,76,198,25,208,102,50,142,161,54,147,113,138,155,158,140,83,92,108,196,197,61,110,122,210,78,113,169,17,151,246,184,192,76,24,244,140,151,65,181,105,90,223,227,95,220,97,174,77,71,235,154,14,157,14,45,201,221,12,197,190,131,83,109,114,247,10,200,126,80,79,238,112,91,180,157,220,85,15,210,228,174,231,255,65,147,83,242,122,253,161,147,199,222,130,57,147,71,210,173,126,128,201,163,114,134,69,6,144,55,204,176,128,220,187,205,176,18,68,103,88,213,131,126,134,133,243,148,211,36,156,161,156,146,224,12,229,36,131,100,76,127,37,163,176,216,4,139,123,216,228,199,52,10,11,66,227,87,178,144,1,167,63,126,81,84,108,64,197,61,106,234,19,25,69,5,161,233,19,217,80,50,105,136,143,147,223,240,233,75,20,159,61,54,199,226,198,177,57,6,76,14,181,49,104,230,80,155,148,59,63,187,161,175,29,107,135,62,43,160,121,148,66,90,240,91,222,238,128,96,230,219,157,72,218,188,221,25,208,230,237,142,161,54,111,119,140,251,145,111,13,210,50,126,232,91,163,183,96,206,91,131,116,114,31,245,173,65,122,177,27,222,26,64,238,221,222,26,25,11,49,185,84,250,183,6,206,83,190,53,112,134,242,173,129,51,148,111,13,146,225,102,198,48,135,12,87,48,6,42,186,73,156,108,236,168,48,192,220,81,144,66,191,165,163,0,4,51,59,10,34,105,211,81,48,160,77,71,129,161,54,29,5,198,253,200,142,130,212,204,15,237,40,122,11,230,116,20,164,93,127,132,111,19,184,160,236,107,192,241,226,6,254,228,71,5,97,49,64,27,146,163,236,128,200,83,120,67,7,4,228,222,173,3,90,37,180,3,186,143,66,109,119,194,242,148,61,10,207,195,81,71,134,78,5,135,29,189,122,77,87,225,160,184,18,59,142,28,55,194,22,119,214,187,178,249,220,116,213,98,249,117,87,54,191,55,93,245,109,248,203,249,109,113,37,62,218,215,205,209,165,210,108,5,150,240,81,7,146,129,214,133,44,26,219,146,146,250,4,194,96,53,39,248,18,253,70,110,227,249,205,13,22,119,61,102,104,6,64,108,161,72,124,89,176,194,141,202,22,222,92,54,39,246,63,57,239,88,146,55,122,169,119,208,91,138,228,210,219,188,46,228,96,187,57,197,97,114,107,7,75,126,114,238,232,245,95,195,67,77,179,23,163,132,94,47,187,91,43,200,172,181,178,91,183,130,12,95,182,37,178,224,207,38,56,245,254,219,76,50,42,214,175,111,18,206,241,242,165,29,163,245,106,104,192,219,2,185,174,112,214,3,56,44,199,208,203,130,133,98,75,209,71,111,44,183,196,199,11,126,46,240,181,64,236,132,35,124,6,17,30,150,88,106,91,151,237,103,94,106,204,179,160,135,147,252,175,223,22,87,76,197,70,56,255,95,117,103,183,220,56,110,236,241,251,243,20,147,221,202,169,113,106,157,149,73,226,131,118,78,106,223,35,78,165,100,139,30,171,40,75,46,137,51,179,179,83,147,103,63,69,138,31,32,209,141,102,163,145,139,92,236,94,140,129,223,191,209,160,36,176,209,64,123,50,139,207,77,33,87,243,63,219,153,138,254,108,119,166,62,191,86,207,117,123,25,73,103,125,255,51,54,251,94,108,55,175,124,147,250,126,255,254,203,205,218,81,81,191,138,222,216,186,79,104,228,216,118,219,115,221,255,36,13,118,183,255,244,75,247,255,246,169,92,252,78,93,219,247,169,5,193,14,221,111,151,219,100,124,134,175,135,172,237,248,133,52,7,64,79,44,81,226,171,203,95,7,165,134,227,31,114,165,233,32,9,40,212,157,186,78,34,52,144,16,161,225,232,117,18,45,7,134,200,13,71,176,147,200,57,48,68,110,188,16,94,172,53,221,23,143,11,233,100,66,58,44,100,146,9,153,176,144,77,38,20,154,163,254,60,82,10,165,241,104,19,40,53,29,75,146,107,185,71,156,16,177,238,213,52,78,105,120,175,5,201,221,209,249,36,131,24,72,200,16,250,3,244,73,164,38,22,34,54,28,232,146,75,77,71,195,96,33,231,98,54,185,150,123,56,63,40,103,83,202,5,70,55,158,38,75,160,230,156,76,3,197,218,131,101,73,148,122,16,38,211,158,236,79,163,211,147,16,161,217,225,126,185,218,226,174,0,88,178,78,244,104,244,32,68,166,59,241,159,68,103,32,33,66,253,185,255,36,82,19,11,17,235,207,2,38,17,155,88,211,58,246,122,4,16,92,151,178,227,160,93,54,160,203,117,10,128,133,20,194,197,192,0,160,137,4,26,12,104,35,129,190,43,167,42,95,60,158,83,241,203,199,169,56,156,66,112,38,14,103,16,156,141,195,1,190,27,43,131,241,112,78,149,48,31,103,226,112,6,193,217,56,28,48,88,183,128,24,143,56,47,38,6,66,77,52,212,224,80,27,13,5,134,239,214,25,227,65,231,53,199,64,168,137,134,26,28,106,163,161,192,240,199,114,100,60,226,236,242,173,37,46,143,195,229,8,174,136,195,21,8,78,197,225,20,130,211,113,56,141,224,76,28,206,32,56,27,135,195,30,148,50,14,87,66,184,161,104,26,151,55,21,80,3,128,42,18,168,48,160,137,4,26,12,104,35,129,192,148,56,197,218,120,196,89,225,54,8,105,98,145,6,69,218,88,36,56,112,252,133,31,126,187,159,247,31,235,177,241,12,114,106,179,249,56,19,135,51,8,206,198,225,0,103,57,101,219,120,192,89,9,55,8,105,98,145,6,69,218,88,36,48,240,177,178,26,15,232,84,89,243,113,38,14,103,16,156,141,195,65,131,37,66,45,43,227,42,48,180,136,134,22,56,84,69,67,21,14,53,209,80,131,67,109,52,52,48,81,229,102,243,248,107,177,6,252,243,86,229,230,238,73,235,31,191,93,62,191,191,159,206,205,229,195,199,235,159,174,106,111,251,223,63,238,143,31,14,219,167,95,206,213,174,253,239,166,187,71,95,164,58,67,159,234,22,14,141,176,253,105,47,54,127,254,197,73,212,184,222,242,235,138,79,5,231,152,110,116,139,207,65,72,19,139,52,40,210,198,34,129,185,30,234,194,241,120,83,141,56,15,166,162,96,10,134,153,40,152,129,97,54,10,6,249,108,168,69,199,164,77,117,233,124,156,137,195,25,4,103,227,112,192,96,233,40,232,234,144,39,6,46,4,224,34,4,54,2,176,9,129,173,0,12,249,184,142,114,66,13,15,191,142,26,120,13,15,185,142,26,108,13,15,179,203,12,136,192,13,253,150,192,177,104,31,143,231,20,240,243,113,38,14,103,16,156,141,195,1,131,117,106,251,241,128,179,58,127,16,210,196,34,13,138,180,177,72,96,224,125,44,158,31,178,153,58,34,200,34,22,89,160,72,19,139,52,40,210,198,34,161,72,234,186,136,144,115,21,212,250,224,80,181,46,60,68,179,103,174,112,74,46,32,216,245,53,23,102,64,37,0,42,8,168,5,64,13,1,141,0,8,250,208,10,128,22,2,150,2,96,57,7,14,181,43,34,120,179,178,23,46,174,136,199,21,0,78,197,227,20,128,211,241,56,13,224,76,60,206,0,56,27,143,179,0,174,140,199,45,30,148,161,6,73,4,110,86,190,196,197,169,120,156,2,112,58,30,167,1,156,137,199,25,0,103,227,113,22,192,149,241,184,197,204,58,149,95,34,136,203,186,49,11,168,18,65,21,12,213,34,168,134,161,70,4,53,48,212,138,160,22,134,150,34,232,98,246,157,130,60,17,208,101,57,159,5,84,137,160,10,134,106,17,84,195,80,35,130,26,24,106,69,80,11,67,75,17,116,49,251,196,38,239,234,42,75,46,46,143,199,229,0,78,197,227,20,128,211,241,56,13,224,76,60,206,0,56,27,143,179,48,238,241,215,124,45,242,231,187,42,43,243,178,216,69,133,147,163,36,137,88,242,56,176,28,13,36,127,162,246,159,73,199,121,31,137,190,182,87,20,207,173,11,54,3,22,2,96,1,1,149,0,168,32,160,22,0,53,4,52,2,160,129,128,86,0,180,16,176,20,0,23,143,205,84,174,45,130,184,168,245,54,71,22,18,100,1,34,149,4,169,64,164,150,32,53,136,52,18,164,1,145,86,130,180,32,178,148,32,189,135,40,148,190,128,30,188,31,251,15,5,253,34,12,154,213,2,116,113,42,30,167,0,156,142,199,105,0,103,226,113,6,192,217,120,156,5,112,101,60,110,241,100,76,117,20,35,128,139,34,140,115,164,146,32,21,136,212,18,164,6,145,70,130,52,32,210,74,144,22,68,150,18,228,98,198,135,178,150,17,192,89,69,76,23,87,196,227,10,0,167,226,113,10,192,233,120,156,6,112,38,30,103,0,156,141,199,89,0,87,198,227,150,15,10,153,224,195,169,108,186,128,22,34,104,1,67,149,8,170,96,168,22,65,53,12,53,34,168,129,161,86,4,181,48,180,20,65,75,20,202,121,127,188,166,35,69,191,63,198,169,50,210,145,66,111,145,235,242,160,144,33,71,102,96,197,170,38,201,192,114,75,21,199,60,57,243,90,197,115,100,33,65,22,32,82,73,144,10,68,106,9,82,131,72,35,65,26,16,105,37,72,11,34,75,9,114,241,85,209,87,148,142,224,185,181,168,29,152,138,134,41,31,166,163,97,218,135,153,104,152,241,97,54,26,102,125,88,25,13,91,206,102,95,191,59,134,230,150,254,118,113,42,30,167,0,156,142,199,105,0,103,226,113,6,192,217,120,156,5,112,101,60,110,49,179,107,242,254,214,149,22,45,48,176,22,130,53,6,54,66,176,9,128,57,63,246,155,92,151,219,187,232,31,251,88,93,226,231,126,62,206,208,15,254,154,76,74,94,121,89,15,92,10,193,203,167,182,142,125,175,233,123,46,97,42,26,166,124,152,142,134,105,31,102,162,97,198,135,217,104,152,245,97,101,52,108,57,155,93,70,105,183,214,213,235,63,116,47,119,38,123,42,203,216,15,93,132,38,245,129,27,144,55,58,244,97,155,132,13,115,176,79,185,124,176,38,249,96,13,61,88,21,245,160,12,125,111,32,32,203,123,217,70,223,89,169,247,84,122,239,169,149,222,123,252,181,100,14,182,210,242,193,150,201,7,91,6,6,219,37,90,199,125,167,15,93,111,150,56,21,143,83,0,78,199,227,52,128,51,241,56,3,224,108,60,206,2,184,50,30,183,248,122,119,175,228,93,251,16,119,55,244,142,132,62,27,61,238,233,152,58,223,248,72,37,65,42,16,169,37,72,13,34,141,4,105,64,164,149,32,45,136,44,37,200,197,51,243,245,117,223,84,17,180,174,159,11,234,147,239,227,30,157,169,51,128,44,36,200,2,68,26,9,210,128,72,43,65,90,16,89,74,144,238,60,191,156,79,111,243,80,103,166,96,114,119,129,211,167,246,218,251,182,176,104,219,111,140,42,111,98,126,232,68,202,140,48,107,166,144,31,188,88,3,46,205,233,253,50,221,105,53,254,251,151,253,246,250,183,95,252,191,13,37,16,110,128,191,181,118,220,192,255,28,236,215,156,110,160,127,156,250,204,39,153,88,7,2,78,134,23,16,15,255,237,222,104,78,211,202,121,141,47,154,211,61,188,234,254,175,247,196,203,254,112,32,18,67,219,38,225,100,208,75,115,62,213,21,117,132,232,218,138,56,56,212,163,194,7,16,0,146,119,236,160,7,145,153,238,0,11,202,111,239,113,100,234,52,128,131,18,166,123,92,216,241,0,11,115,61,145,116,8,146,150,169,134,61,138,74,66,3,88,64,234,89,15,11,231,40,1,40,47,51,169,7,81,233,48,0,10,72,130,233,97,225,244,8,0,229,37,69,12,32,98,247,11,66,249,123,94,61,44,184,189,2,144,150,155,42,3,38,24,213,135,56,203,88,126,15,10,6,228,0,206,50,12,215,99,194,175,128,0,199,123,241,235,65,212,187,2,128,2,222,16,174,151,254,119,223,59,119,24,9,59,157,119,7,115,50,46,39,131,57,57,151,147,195,156,130,203,41,96,142,226,114,16,63,107,46,71,47,57,221,145,55,198,116,13,237,1,74,198,164,100,32,37,103,82,114,144,82,48,41,5,72,81,76,138,2,41,154,73,241,230,168,251,5,102,204,209,208,30,160,100,76,74,6,82,114,38,37,7,41,5,147,82,128,20,197,164,40,144,162,153,20,111,142,134,149,13,99,154,156,46,48,43,227,179,50,140,149,243,89,57,198,42,248,172,2,99,41,62,75,97,44,205,103,121,243,56,44,41,25,243,232,116,129,89,25,159,149,97,172,156,207,202,49,86,193,103,21,24,75,241,89,10,99,105,62,203,155,199,254,28,220,90,78,223,28,96,48,30,132,161,61,64,201,152,148,12,164,228,76,74,14,82,10,38,165,64,124,203,117,46,68,209,76,10,60,207,134,73,49,32,197,50,41,22,164,148,76,74,233,83,218,215,71,214,99,215,119,128,56,25,151,147,193,156,156,203,201,97,78,193,229,20,48,71,113,57,10,230,104,46,199,123,2,251,87,116,198,132,77,61,64,82,198,38,101,8,41,103,147,114,132,84,176,73,5,66,82,108,146,66,72,154,77,242,230,174,139,137,48,102,110,104,15,80,50,38,37,3,41,57,147,146,131,148,130,73,41,64,138,98,82,20,72,209,76,138,55,71,125,176,137,49,75,83,15,144,148,177,73,25,66,202,217,164,28,33,21,108,82,129,144,20,155,164,16,146,102,147,188,185,235,162,123,140,153,27,218,3,148,140,73,201,64,74,206,164,228,32,165,96,82,10,144,162,152,20,5,82,52,147,226,207,81,191,73,199,153,166,169,11,204,202,248,172,12,99,229,124,86,142,177,10,62,171,192,88,138,207,82,24,75,243,89,232,60,26,62,203,96,44,203,103,89,140,85,242,89,222,218,184,15,241,115,30,213,177,7,72,202,216,164,12,33,229,108,82,142,144,10,54,169,64,72,138,77,82,8,73,179,73,222,243,217,110,170,48,38,174,111,238,51,50,30,35,131,24,57,143,145,67,140,130,199,40,32,134,226,49,20,196,208,60,134,63,47,237,38,21,103,98,250,246,0,37,99,82,50,144,146,51,41,57,72,41,152,148,2,164,40,38,69,129,20,205,164,120,115,52,157,19,96,76,212,172,19,198,203,99,120,57,206,43,98,120,5,206,83,49,60,111,22,218,13,84,142,231,106,200,103,53,107,93,179,60,135,49,50,114,30,35,135,24,5,143,81,64,12,197,99,128,62,213,60,134,255,92,119,233,62,156,153,25,58,64,156,140,203,201,96,78,206,229,228,48,167,224,114,10,152,163,184,28,111,174,186,141,127,134,155,135,246,0,37,99,82,50,144,146,51,41,57,72,41,152,148,2,164,40,38,5,246,174,102,82,188,207,66,159,81,193,152,165,169,7,72,202,216,164,12,33,229,108,82,142,144,10,54,169,64,72,138,77,82,8,73,179,73,222,220,5,178,185,169,20,238,169,255,227,159,120,132,63,237,223,218,172,224,237,177,153,177,250,60,100,198,115,52,245,184,129,72,25,155,148,33,164,156,77,202,17,82,193,38,21,8,73,177,73,10,33,105,54,201,125,142,118,213,243,233,188,109,83,72,137,172,145,219,175,213,83,189,111,191,117,126,111,110,157,94,129,108,146,7,70,91,192,158,112,134,196,122,123,198,204,137,7,70,91,192,30,114,191,127,189,73,110,30,192,3,175,57,96,24,185,129,189,222,48,119,99,251,129,215,28,48,44,188,215,186,222,170,113,15,246,129,209,22,180,39,184,247,198,49,104,216,147,123,224,52,6,76,162,54,149,214,219,228,108,54,61,176,90,3,86,133,183,80,214,219,52,110,173,60,48,218,2,246,80,91,3,235,45,114,182,12,30,88,173,1,171,194,129,240,245,54,141,1,242,7,70,91,200,30,42,172,203,48,201,9,247,62,240,154,67,134,17,209,60,134,93,83,148,239,129,213,26,176,42,24,197,90,111,210,16,221,122,88,223,20,50,38,24,176,97,88,51,4,114,30,24,109,1,123,86,92,51,178,222,168,249,157,35,15,220,14,144,121,117,26,195,234,245,38,213,168,49,225,23,177,245,214,140,47,104,15,140,182,128,61,212,11,198,122,139,156,23,143,7,86,107,192,42,106,185,186,222,42,103,25,251,192,106,61,88,245,126,216,62,87,175,167,67,91,168,41,156,25,127,239,182,93,149,38,239,178,131,217,220,20,218,75,237,118,201,193,28,100,138,236,37,36,187,100,42,67,150,130,67,233,178,46,159,202,220,164,248,80,26,167,203,15,230,26,82,112,47,241,208,35,43,9,25,183,57,148,91,70,163,151,137,102,46,155,200,127,162,224,64,50,148,75,15,102,236,80,108,47,125,199,37,19,121,37,20,27,72,50,113,233,193,76,8,138,237,165,69,204,200,196,62,61,9,7,54,237,103,252,240,30,43,137,247,55,92,93,122,104,119,144,66,47,183,10,103,220,208,174,22,9,94,110,113,185,100,122,207,134,194,195,27,56,51,141,90,64,175,113,110,48,14,76,129,189,160,176,75,38,162,149,20,27,8,93,186,116,34,134,69,209,129,128,214,233,125,251,188,111,190,221,98,167,245,251,191,223,255,53,83,227,33,194,215,237,238,244,117,170,219,247,248,171,13,29,253,238,155,247,23,161,148,42,223,109,54,207,207,49,151,28,72,132,129,59,14,136,107,15,166,186,132,118,113,203,207,120,32,124,48,232,240,254,186,189,129,239,69,232,155,12,133,235,88,190,186,43,243,231,39,43,242,85,140,46,223,85,99,89,190,4,158,26,10,193,177,60,181,217,168,23,35,243,84,140,46,223,83,99,153,187,4,158,114,170,167,177,157,85,104,145,179,34,165,249,254,114,43,196,37,112,153,83,114,140,229,50,187,221,220,149,133,200,101,145,210,124,151,185,101,213,18,184,108,42,118,197,249,230,234,10,108,137,252,21,163,203,119,214,120,176,39,137,167,250,250,75,188,79,227,157,214,249,70,232,170,8,225,24,95,13,245,165,18,56,107,42,53,196,242,86,110,178,237,246,89,228,173,56,101,190,187,156,98,74,9,252,53,148,222,225,121,107,167,115,225,98,43,70,151,239,171,177,176,80,2,79,77,133,107,120,11,211,151,76,186,48,141,83,230,123,203,41,205,147,192,95,67,229,22,150,183,182,217,102,83,200,62,135,49,186,124,95,141,117,105,82,120,106,74,121,103,57,235,249,185,80,89,38,115,86,156,116,132,191,156,180,254,20,46,27,203,51,176,60,166,171,187,187,39,217,135,49,78,57,194,97,83,1,138,4,254,234,235,30,48,191,185,54,230,78,246,120,69,200,242,61,53,212,116,72,225,166,190,142,0,239,59,43,223,108,114,35,243,83,132,110,132,163,134,42,9,9,60,53,187,202,158,183,48,53,170,180,74,228,174,104,113,190,207,230,87,246,167,112,92,253,45,230,205,186,180,178,55,235,8,217,8,103,213,201,220,52,92,183,204,142,64,168,173,200,79,49,186,124,71,141,151,73,39,240,212,116,213,48,203,87,106,183,169,158,101,63,133,113,202,124,111,57,151,41,39,240,215,116,101,47,47,84,99,138,39,225,58,62,78,153,239,47,231,82,98,137,191,206,251,35,85,66,190,67,117,237,86,108,144,78,188,50,154,87,46,121,228,41,218,16,18,218,154,155,81,131,101,229,150,100,81,45,187,120,217,20,197,236,58,220,233,229,229,82,145,55,2,78,242,125,251,53,87,4,186,237,187,160,190,17,224,7,0,72,39,114,140,105,186,151,48,236,54,167,51,134,105,1,40,247,215,237,65,39,255,210,26,80,26,175,219,35,124,79,209,10,1,239,226,162,57,61,156,149,187,6,191,204,176,117,219,83,229,205,87,8,0,69,206,221,14,225,210,216,43,248,94,129,108,183,57,153,252,74,243,129,60,86,183,3,145,200,74,243,189,172,212,25,157,202,254,92,193,247,19,57,221,14,225,76,78,26,191,204,203,156,177,195,137,153,43,224,203,44,75,183,121,56,143,145,134,47,179,18,221,214,68,90,34,13,247,114,12,221,230,100,146,33,205,7,242,5,221,14,212,153,155,21,10,238,33,156,223,222,170,221,126,251,241,245,244,165,58,223,119,255,31,127,77,219,226,10,239,183,221,191,117,5,25,166,77,31,164,134,213,253,254,242,113,248,67,215,249,230,74,132,171,174,92,183,161,226,74,106,253,103,77,91,187,45,133,22,222,154,153,183,234,158,146,144,125,196,146,107,46,250,114,122,254,124,113,151,137,54,80,135,11,80,237,250,131,11,179,235,124,197,213,181,250,15,219,182,118,194,208,242,87,239,85,155,131,121,53,111,197,205,208,174,109,109,215,222,180,127,175,188,51,218,83,11,103,196,114,196,252,244,216,165,86,56,71,150,163,229,39,204,46,181,200,172,89,142,28,152,66,187,84,36,243,104,57,138,96,82,237,82,49,156,255,202,145,243,147,97,125,173,96,70,44,79,204,75,143,93,170,81,57,178,28,57,40,97,118,169,23,206,154,229,168,249,41,180,75,45,42,143,150,163,6,37,213,46,245,194,153,181,28,53,63,205,214,211,98,252,214,208,114,80,226,173,167,72,100,223,178,4,129,84,220,165,94,48,31,151,35,230,37,231,122,74,193,12,93,150,148,151,174,187,212,90,145,179,203,17,68,18,120,61,213,58,149,94,77,40,133,243,122,57,82,126,146,239,82,139,202,244,229,168,65,105,191,75,61,42,247,151,163,55,75,4,118,149,144,123,239,80,182,228,70,60,87,183,91,105,141,25,183,220,1,134,98,135,83,26,47,170,59,164,175,166,148,29,83,98,81,213,33,21,52,165,234,152,94,138,170,58,9,149,41,133,221,60,77,84,219,201,76,76,169,237,38,60,162,218,193,72,90,164,176,23,92,3,84,251,148,185,180,178,67,30,30,170,59,229,158,165,20,118,50,218,80,229,33,147,43,165,238,152,29,134,170,78,25,81,41,117,157,60,43,84,121,200,47,74,169,59,230,44,225,170,196,125,157,177,194,192,157,158,190,246,152,240,146,84,122,74,163,65,149,251,4,146,148,178,67,78,10,174,217,231,98,36,21,29,242,59,80,213,89,54,67,74,233,121,154,4,174,95,167,87,174,9,205,96,205,231,72,81,175,24,180,167,74,84,15,142,212,5,202,10,123,202,68,61,219,72,101,160,208,237,203,254,124,105,110,15,85,211,140,177,194,96,165,147,89,135,53,101,79,182,47,29,249,233,116,30,79,235,98,123,50,215,182,223,159,79,199,166,173,158,61,110,115,247,255,112,243,208,67,86,20,242,152,171,146,223,136,209,194,208,151,98,175,189,34,58,67,201,174,136,209,28,182,151,102,28,103,69,232,181,141,111,159,95,247,135,221,247,190,199,254,120,216,31,171,219,10,44,98,188,74,76,167,20,115,55,29,78,187,93,23,91,39,66,161,199,230,245,170,242,241,180,219,17,85,153,253,80,232,32,18,142,128,114,52,188,8,232,32,17,14,124,114,36,188,192,231,32,65,198,59,57,42,80,188,115,16,34,195,156,28,33,40,204,57,8,133,159,103,142,138,247,48,207,36,108,50,9,11,74,4,227,166,60,141,101,220,116,16,161,194,165,28,21,32,92,58,200,132,163,164,28,17,47,74,58,72,80,193,81,142,8,16,28,29,100,194,49,81,142,136,23,19,29,37,168,80,40,75,5,8,147,140,66,68,4,148,165,227,71,64,7,153,96,224,147,163,177,12,124,142,2,193,120,39,75,97,25,239,28,36,86,132,57,57,58,112,152,115,20,171,83,201,212,176,64,56,168,201,81,240,130,154,131,4,21,203,228,136,0,177,204,65,134,10,97,114,100,128,187,12,170,47,213,209,89,79,104,90,38,59,174,90,78,104,72,36,120,107,39,71,195,187,138,115,148,8,38,201,113,36,188,100,185,81,130,202,148,227,168,64,25,115,163,16,149,46,199,17,130,210,230,70,161,240,146,149,161,226,45,87,231,18,38,149,132,129,37,66,185,121,60,141,101,142,222,40,66,220,129,201,81,1,174,181,28,101,130,151,90,114,68,188,155,42,71,9,34,85,143,35,2,164,236,141,50,193,124,61,142,136,151,183,55,73,16,119,73,178,84,128,219,33,39,161,112,118,32,75,199,207,18,28,101,66,41,130,28,141,101,170,224,36,16,202,19,100,41,44,243,5,71,9,250,78,70,142,14,124,199,226,36,86,39,146,169,17,129,96,122,34,71,193,75,83,28,37,136,28,69,142,8,144,171,56,202,16,55,27,114,100,128,203,10,187,120,219,237,215,125,243,186,63,122,113,38,116,13,227,246,250,78,6,149,20,170,71,220,51,63,215,161,46,157,159,163,157,205,214,114,213,48,232,253,213,18,29,199,138,29,214,213,90,222,166,42,32,21,222,86,93,45,229,237,164,2,82,228,94,234,106,53,104,251,20,16,12,175,59,86,171,121,171,14,76,202,166,145,34,71,21,220,36,101,104,45,247,69,1,49,106,103,116,181,26,176,25,10,200,133,183,67,87,139,121,59,160,128,84,191,110,145,127,162,39,80,72,142,12,184,175,214,131,2,236,128,96,187,0,144,15,174,167,132,132,86,108,190,173,150,131,247,219,32,209,58,137,92,77,10,133,183,217,86,43,121,59,107,128,20,181,183,182,90,12,216,78,3,228,250,159,112,249,51,50,129,130,135,23,134,179,1,206,182,23,186,42,232,218,126,15,111,110,185,107,1,128,173,37,108,13,176,135,53,64,65,128,233,248,72,17,160,43,49,93,5,232,70,76,55,1,186,21,211,45,72,239,214,49,18,183,15,0,140,173,164,108,133,179,141,148,109,112,182,149,178,97,127,119,139,57,137,191,7,0,198,86,82,182,194,217,70,202,54,56,219,74,217,176,191,135,229,172,196,229,14,35,160,160,18,40,168,160,130,73,160,96,130,10,54,129,2,60,15,67,156,84,50,15,14,35,160,160,18,40,168,160,130,73,160,96,130,10,54,129,2,60,15,225,171,241,87,224,189,235,241,23,108,37,101,43,156,173,165,108,141,179,141,148,109,112,182,149,178,177,185,108,223,50,101,147,217,19,80,186,22,211,117,128,110,196,116,19,160,91,49,29,246,123,255,190,45,113,252,132,192,249,74,206,87,33,190,145,243,77,136,111,229,124,216,255,93,8,66,226,253,1,128,177,149,148,173,112,182,145,178,13,206,182,82,54,236,239,62,10,35,241,248,132,192,249,74,206,87,33,190,145,243,77,136,111,229,124,216,255,221,14,157,196,251,3,0,99,43,41,91,225,108,35,101,27,156,109,165,108,196,223,125,20,80,228,242,137,17,80,80,9,20,84,80,65,39,80,208,65,5,147,64,193,4,21,108,2,5,100,166,175,187,197,162,137,30,17,56,95,201,249,42,196,55,114,190,9,241,173,156,15,251,191,13,129,75,156,223,247,71,200,90,72,214,40,217,8,201,6,37,91,33,25,241,115,155,79,32,114,116,15,192,216,74,202,86,56,219,72,217,6,103,91,41,27,246,247,180,215,34,113,250,140,18,84,81,73,84,20,161,98,146,168,24,66,197,38,81,65,230,165,22,206,72,141,206,69,45,156,133,26,245,127,45,244,124,141,250,188,22,122,187,198,252,220,109,201,73,28,61,0,48,182,146,178,21,206,54,82,182,193,217,86,202,134,253,221,239,74,74,60,62,33,112,190,146,243,85,136,111,228,124,19,226,91,57,31,246,63,113,77,221,26,190,123,77,29,198,55,114,190,9,241,173,156,15,248,199,185,98,44,15,11,96,91,151,121,16,170,226,160,10,129,118,155,119,108,67,135,94,56,82,69,33,49,43,187,45,47,182,149,67,47,28,169,162,144,152,149,195,158,16,219,80,167,99,16,172,98,193,152,197,195,238,9,219,98,167,99,16,172,98,193,152,197,253,166,9,15,218,119,194,129,236,241,15,189,66,54,198,25,137,33,219,0,125,132,153,125,183,0,84,197,65,49,75,251,88,54,219,212,169,95,8,171,34,177,152,181,93,28,152,109,235,208,11,71,170,40,36,102,101,31,47,101,219,57,245,11,97,85,36,22,179,182,139,53,178,109,29,122,225,72,21,133,68,173,236,67,101,119,108,234,212,49,8,206,99,193,57,1,86,177,96,202,21,101,44,184,196,192,215,104,24,223,19,99,191,16,86,69,98,49,55,180,1,37,182,169,125,39,20,168,98,128,168,133,109,12,134,111,98,223,11,71,170,40,36,102,229,20,150,96,155,58,235,10,195,235,24,108,29,6,170,24,32,54,252,238,197,149,109,226,208,11,71,170,40,36,102,101,255,130,199,182,115,234,23,194,170,72,44,102,109,224,56,14,70,156,159,195,113,97,253,187,27,123,232,83,191,16,86,69,98,103,247,125,247,215,21,245,169,197,196,139,95,215,24,79,67,246,223,255,230,244,240,235,26,1,247,222,218,230,236,240,75,22,193,246,222,181,230,108,242,165,136,192,67,239,70,115,5,242,37,134,80,128,222,101,230,10,225,55,5,2,239,189,48,44,217,193,213,61,9,95,46,242,231,116,106,61,78,224,129,101,249,156,31,94,69,19,116,111,49,61,103,83,235,94,130,14,44,127,231,252,240,106,149,160,123,139,214,5,123,213,49,200,136,243,143,147,2,177,186,162,4,252,69,214,156,31,92,21,17,240,229,226,104,65,14,174,101,40,244,114,73,51,103,175,216,125,34,4,224,157,167,133,74,45,224,215,33,114,120,9,65,160,189,149,196,156,77,253,232,19,116,224,183,127,206,167,126,89,9,62,112,97,137,123,189,51,117,212,119,221,25,223,217,225,222,34,108,41,125,170,183,240,109,117,240,74,138,87,65,188,150,226,53,130,15,159,190,161,233,222,225,27,15,174,132,112,21,130,107,33,60,232,22,35,132,155,16,220,10,225,22,129,135,143,247,208,112,239,116,143,7,87,66,184,10,193,181,16,174,67,112,43,132,99,62,39,143,248,208,124,232,132,15,36,161,228,18,138,144,208,114,9,108,22,200,51,56,180,4,116,4,7,146,80,114,9,69,72,104,185,4,230,168,240,33,25,154,239,157,145,241,224,74,8,87,33,184,22,194,131,110,177,66,184,69,225,193,195,44,107,232,203,179,44,62,94,73,241,42,136,215,82,188,14,226,173,20,143,249,158,58,208,66,243,129,243,44,128,128,18,11,168,176,128,22,11,232,176,128,17,11,96,203,146,240,161,22,26,239,157,105,241,224,74,8,87,33,184,22,194,117,8,110,132,240,160,207,173,16,142,125,168,168,83,51,52,30,56,52,3,8,40,177,128,10,11,104,177,0,54,185,225,131,45,52,222,59,215,226,193,149,16,174,66,112,45,132,7,221,98,133,112,236,177,36,15,183,172,224,3,103,91,32,9,37,151,80,132,132,150,75,160,179,64,156,13,89,161,224,31,13,1,4,148,88,64,133,5,180,88,128,112,145,21,11,96,15,107,240,124,8,77,95,30,15,89,162,149,12,173,2,104,45,67,235,0,218,202,208,168,175,131,103,68,86,176,151,71,68,60,184,18,194,85,8,174,133,112,204,227,43,142,114,208,10,240,73,14,88,70,165,144,81,164,140,78,33,131,58,173,150,185,171,14,56,170,150,185,168,14,56,167,150,185,165,198,29,18,62,16,65,179,189,243,16,30,92,9,225,42,4,215,66,120,208,45,70,8,55,33,184,21,194,177,111,75,234,196,5,141,7,14,92,0,2,74,44,160,194,2,90,44,128,77,46,117,40,130,22,0,206,68,0,2,74,44,160,194,2,90,44,224,223,229,251,101,127,217,63,29,170,245,49,193,161,7,47,54,184,219,95,182,79,135,106,183,42,15,123,104,76,165,98,55,219,219,199,127,92,154,109,83,61,254,223,243,233,237,253,80,53,213,238,241,159,67,201,214,225,6,181,114,179,249,71,215,184,107,58,181,252,39,92,169,149,190,81,173,92,173,63,152,155,76,159,57,254,107,184,173,76,106,64,79,92,105,65,31,109,74,105,194,132,92,105,67,247,30,154,210,130,1,184,86,127,74,198,77,103,194,34,193,119,133,21,215,87,156,164,70,140,200,149,54,244,87,205,38,51,192,189,186,150,86,159,214,139,41,109,152,81,87,90,50,125,29,39,51,99,241,13,63,179,225,243,249,92,29,27,255,155,177,88,232,95,219,69,127,47,22,43,181,187,47,177,44,153,246,128,91,169,221,239,206,36,19,119,119,123,40,245,105,123,34,145,252,98,191,131,210,31,2,149,137,212,103,113,79,82,123,138,214,165,146,95,196,255,72,11,198,56,88,42,3,230,129,53,74,191,143,213,36,18,119,35,63,148,242,236,189,63,145,190,31,75,160,172,152,150,209,137,76,112,215,229,253,173,212,111,251,227,237,215,253,174,121,189,47,54,231,234,109,188,153,250,242,214,127,0,95,171,243,190,89,169,213,183,254,241,215,182,247,56,140,230,188,61,94,222,183,173,209,43,57,63,111,54,155,205,15,199,146,105,17,140,189,149,124,15,238,230,79,246,16,137,114,120,138,28,120,139,247,196,117,238,11,32,134,139,29,202,238,7,237,33,133,199,6,126,0,51,109,221,153,126,219,73,102,186,237,157,106,166,223,118,242,153,158,236,73,59,211,19,55,217,76,123,200,244,51,173,11,119,166,15,159,36,51,221,246,78,53,211,45,75,58,211,147,61,105,103,122,226,38,155,105,15,153,126,166,237,236,219,251,247,131,100,166,219,222,169,102,186,101,73,103,122,178,39,237,76,79,220,100,51,237,33,83,205,244,220,242,199,127,60,254,239,191,154,167,211,238,219,191,154,115,187,102,240,46,115,254,208,253,245,67,115,102,220,223,124,243,195,7,99,247,57,79,124,249,197,206,75,217,169,232,214,227,199,174,80,215,77,107,9,52,54,110,157,68,96,140,176,216,252,221,203,110,48,205,216,215,175,107,120,26,183,164,45,119,58,140,186,123,20,32,125,186,194,233,144,222,191,66,104,62,226,18,30,113,171,24,59,228,114,28,242,227,253,241,212,60,126,124,188,127,217,159,135,234,239,87,35,58,64,181,187,189,220,30,79,199,170,109,246,209,109,116,51,28,141,184,52,219,115,211,255,255,188,221,237,63,95,238,55,15,195,105,186,227,110,241,151,133,234,84,114,126,46,90,57,162,83,155,133,102,75,135,20,221,127,39,244,134,94,183,27,84,107,127,60,236,143,85,63,148,111,135,170,247,102,243,245,118,52,230,219,161,186,121,240,155,95,127,13,54,63,126,252,246,126,62,189,87,231,230,219,135,174,95,247,189,118,216,54,213,237,239,223,47,223,142,205,246,247,251,159,254,242,211,67,255,157,127,185,127,217,30,46,213,195,254,184,111,246,219,195,237,151,237,225,115,117,191,193,33,223,82,64,254,136,135,92,158,183,7,206,80,238,96,192,55,41,224,143,120,192,249,212,16,211,129,244,248,198,238,241,199,250,30,151,186,250,202,177,169,107,207,176,232,125,123,228,224,219,230,28,250,254,248,252,122,251,199,233,244,198,24,193,251,246,185,186,253,118,123,174,190,84,231,75,37,120,38,59,208,239,114,208,110,255,101,191,75,66,114,191,45,86,83,46,167,195,126,135,216,148,192,77,159,218,175,201,234,216,220,190,159,46,251,102,127,58,174,159,170,177,235,203,217,153,225,191,117,63,50,127,39,236,184,46,208,48,224,151,253,54,41,175,57,37,197,93,154,211,251,37,194,79,95,246,219,232,190,173,143,253,57,250,219,161,58,126,106,94,111,223,171,243,115,117,108,182,159,42,106,100,155,63,7,205,75,160,160,2,18,205,41,133,194,221,198,151,56,84,219,221,254,248,105,189,103,95,78,199,230,246,107,181,255,244,218,172,239,212,156,183,207,53,75,230,242,186,221,157,190,174,255,124,126,216,124,0,31,190,43,231,186,130,227,170,223,110,15,239,175,206,39,74,230,233,253,241,82,53,201,198,229,210,184,163,155,245,77,58,198,41,49,128,241,235,222,37,63,37,117,75,140,25,78,207,84,198,244,71,55,46,85,195,244,198,233,229,165,53,166,91,5,47,63,239,127,231,254,82,185,68,194,39,203,111,243,151,151,151,16,45,149,159,78,159,155,110,229,159,224,7,254,233,240,153,49,231,79,231,246,107,236,88,93,24,191,44,207,167,99,115,222,94,26,214,111,209,183,110,157,189,190,203,235,231,170,95,245,114,30,224,47,213,153,97,214,233,125,251,188,111,24,203,210,203,182,249,124,102,153,116,169,222,157,21,9,217,124,119,62,189,147,15,85,160,19,247,35,239,118,77,250,53,232,130,47,251,63,24,30,107,3,16,93,111,230,131,60,118,139,120,162,199,206,252,71,123,236,26,241,140,143,125,99,30,246,177,51,247,169,31,59,178,31,255,177,39,255,115,48,117,101,126,32,90,29,214,187,69,181,189,84,188,239,178,234,216,172,254,202,253,233,167,31,191,213,213,183,151,243,246,173,186,124,184,188,239,143,223,155,211,247,46,20,242,114,58,191,221,95,103,241,99,174,55,187,234,211,205,15,183,241,251,231,195,165,250,174,54,127,254,222,59,254,254,175,234,199,143,255,249,127,232,169,56,178,115,23,4,0 };
-
-const char * etag_index_html = "e560d87048241b11da6efabfd46457ca";
-const char * etag_favicon_svg = "40b1801e31087893008e0b7c32ea7fa9";
-const char * etag_assets_index_CVKlz8qs_js = "025068497f0ca5f3d137ecdb09c1c9ba";
-const char * etag_assets_index_BiYBMfdF_css = "f258a921e9b8313e8affa0a21f433ac7";
-static esp_err_t file_handler_INDEX_HTML (httpd_req_t *req)
-{
-    httpd_resp_set_type(req, "text/html");
-    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
-    httpd_resp_set_hdr(req, "ETag", etag_index_html);
-    httpd_resp_send(req, datagzip_index_html, 470);
-    return ESP_OK;
-}
-static const httpd_uri_t route_def_INDEX_HTML = {
-    .uri = "/",
-    .method = HTTP_GET,
-    .handler = file_handler_INDEX_HTML,
-};
-static const httpd_uri_t route_INDEX_HTML = {
-    .uri = "/index.html",
-    .method = HTTP_GET,
-    .handler = file_handler_INDEX_HTML,
-};
-static esp_err_t file_handler_FAVICON_SVG (httpd_req_t *req)
-{
-    httpd_resp_set_type(req, "image/svg+xml");
-    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
-    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
-    httpd_resp_set_hdr(req, "ETag", etag_favicon_svg);
-    httpd_resp_send(req, datagzip_favicon_svg, 676);
-    return ESP_OK;
-}
-static const httpd_uri_t route_FAVICON_SVG = {
-    .uri = "/favicon.svg",
-    .method = HTTP_GET,
-    .handler = file_handler_FAVICON_SVG,
-};
-static esp_err_t file_handler_ASSETS_INDEX_CVKLZ8QS_JS (httpd_req_t *req)
-{
-    httpd_resp_set_type(req, "text/javascript");
-    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
-    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
-    httpd_resp_set_hdr(req, "ETag", etag_assets_index_CVKlz8qs_js);
-    httpd_resp_send(req, datagzip_assets_index_CVKlz8qs_js, 12112);
-    return ESP_OK;
-}
-static const httpd_uri_t route_ASSETS_INDEX_CVKLZ8QS_JS = {
-    .uri = "/assets/index-CVKlz8qs.js",
-    .method = HTTP_GET,
-    .handler = file_handler_ASSETS_INDEX_CVKLZ8QS_JS,
-};
-static esp_err_t file_handler_ASSETS_INDEX_BIYBMFDF_CSS (httpd_req_t *req)
-{
-    httpd_resp_set_type(req, "text/css");
-    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
-    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
-    httpd_resp_set_hdr(req, "ETag", etag_assets_index_BiYBMfdF_css);
-    httpd_resp_send(req, datagzip_assets_index_BiYBMfdF_css, 32878);
-    return ESP_OK;
-}
-static const httpd_uri_t route_ASSETS_INDEX_BIYBMFDF_CSS = {
-    .uri = "/assets/index-BiYBMfdF.css",
-    .method = HTTP_GET,
-    .handler = file_handler_ASSETS_INDEX_BIYBMFDF_CSS,
-};
-static inline void initSvelteStaticFiles(httpd_handle_t server) {
-    httpd_register_uri_handler(server, &route_def_INDEX_HTML);
-    httpd_register_uri_handler(server, &route_INDEX_HTML);
-    httpd_register_uri_handler(server, &route_FAVICON_SVG);
-    httpd_register_uri_handler(server, &route_ASSETS_INDEX_CVKLZ8QS_JS);
-    httpd_register_uri_handler(server, &route_ASSETS_INDEX_BIYBMFDF_CSS);
-}
\ No newline at end of file
@@ -1,72 +1,460 @@
+#include <atomic>
 #include <string>
+#include <utility>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
 #include "esp_log.h"
 
+#include "ble_service.h"
+#include "services/boot/boot.hh"
+#include "services/config/config_store.hh"
+#include "services/gps/gps.hh"
+#include "services/history/history.hh"
+#include "services/input/hid_input.hh"
+#include "services/log/deferred_log.hh"
+#include "services/lte/lte.hh"
+#include "services/lte/modem.hh"
+#include "services/mem/mem.hh"
+#include "services/ota/ota.hh"
+#include "services/power/power.hh"
+#include "services/ride/ride.hh"
+#include "services/sim/motor_sim.hh"
 #include "services/web/http_server.hh"
+#include "services/web/live_broadcast.hh"
+#include "services/wifi/home_sync.hh"
 #include "services/wifi/wifi.hh"
+#include "telemetry/bms/bms_controller.h"
+#include "telemetry/motor/motor_controller.h"
 
 namespace
 {
 constexpr const char* kLogTag = "JarvisMain";
-}
+
+// Live telemetry for phones; layout at BleService::kTelemetryRecordSize
+constexpr const char* kTelemetryServiceUuid        = "7a8e0001-5c3b-4b6e-9f21-4d2a6c1e8b50";
+constexpr const char* kTelemetryCharacteristicUuid = "7a8e0002-5c3b-4b6e-9f21-4d2a6c1e8b50";
+
+// Commands from a paired phone: "softap" brings the setup AP up
+constexpr const char* kControlServiceUuid        = "7a8e0003-5c3b-4b6e-9f21-4d2a6c1e8b50";
+constexpr const char* kControlCharacteristicUuid = "7a8e0004-5c3b-4b6e-9f21-4d2a6c1e8b50";
 
 /**
- * MAIN function
+ * Everything app_main brings up. Static: together the services outgrow
+ * app_main's stack, and they must outlive the task.
  */
-extern "C" void app_main(void)
+struct App
+{
+    WifiService       wifi;
+    NvsConfigBackend  settingsBackend;
+    ConfigStore       settings{settingsBackend};
+    RideService       rides;
+    TelemetryHistory  history;
+    LiveBroadcast     live;
+    MotorController   motor;
+#if CONFIG_JARVIS_BLE
+    BleService        ble;
+    std::atomic<bool> bleStarted{false}; ///< Frames may arrive from the simulator first
+    BmsController     bms;
+#endif
+#if CONFIG_JARVIS_HID_INPUT
+    HidInputService   hid;
+#endif
+#if CONFIG_JARVIS_LTE
+    UartSerialLink    modemLink;
+    AtModemTransport  modem{modemLink, CONFIG_JARVIS_LTE_UPLOAD_URL};
+    LteService        uplink{modem};
+#endif
+#if CONFIG_JARVIS_GPS
+    UartSerialLink    gpsLink{gpsUartConfig()};
+    GpsService        gps{gpsLink};
+#endif
+    HomeSyncTransport homeLink{wifi};
+#if CONFIG_JARVIS_LTE
+    HomeSyncService   homeSync{rides, &uplink, homeLink};
+#else
+    HomeSyncService   homeSync{rides, nullptr, homeLink};
+#endif
+#if CONFIG_JARVIS_SIMULATOR
+    MotorSimService   simulator;
+#endif
+    httpd_handle_t    server = nullptr;
+};
+
+void onSoftApSettingsChanged(void* context, const Settings&, uint32_t)
+{
+    static_cast<WifiService*>(context)->requestReconfigure();
+}
+
+WifiService::SoftApConfig softApConfigFromSettings(void* context)
+{
+    return static_cast<ConfigStore*>(context)->snapshot().softApConfig();
+}
+
+void onMotorSettingsChanged(void* context, const Settings& settings, uint32_t)
+{
+    // Runs on the task that saved the settings; the frame path picks the
+    // new values up itself
+    static_cast<MotorController*>(context)->setConfig(settings.motorConfig());
+}
+
+#if CONFIG_JARVIS_SIMULATOR
+// Same entry point as the controller's BLE notify target.
+void onSimulatedFrame(void* context, const uint8_t* data, std::size_t length)
+{
+    static_cast<MotorController*>(context)->handleNotification(data, length);
+}
+#endif
+
+// Boot stages; see BootSequencer
+
+esp_err_t startPower(void*)
+{
+    // Frequency scaling and light sleep; services declare what they need
+    return PowerManager::start();
+}
+
+esp_err_t initNvs(void*)
 {
-    // Initialize WiFi service (softAP)
-    WifiService wifiService;
+    return NvsConfigBackend::initFlash();
+}
 
-    esp_err_t err = wifiService.init();
+esp_err_t loadSettings(void* context)
+{
+    // Settings live in RAM; NVS is only touched on load and batched commits.
+    // A failed load leaves the defaults, which is still a usable bike.
+    JARVIS_MEM_SCOPE(Config);
+    const esp_err_t err = static_cast<App*>(context)->settings.load();
+    if (err != ESP_OK)
+    {
+        ESP_LOGW(kLogTag, "Settings load failed (%d), using defaults", err);
+    }
+    return ESP_OK;
+}
+
+esp_err_t startRides(void* context)
+{
+    // Stored rides load before telemetry flows, so numbering continues
+    const esp_err_t err = static_cast<App*>(context)->rides.start();
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(kLogTag, "Ride tracking failed to start: %d", err);
+    }
+    return err;
+}
+
+esp_err_t initWifi(void* context)
+{
+    JARVIS_MEM_SCOPE(Wifi);
+    const esp_err_t err = static_cast<App*>(context)->wifi.init();
     if (err != ESP_OK)
     {
         ESP_LOGE(kLogTag, "Wi-Fi init failed: %d", err);
     }
-    else
+    return err;
+}
+
+esp_err_t startSoftAp(void* context)
+{
+    JARVIS_MEM_SCOPE(Wifi);
+    auto* app = static_cast<App*>(context);
+    app->settings.subscribe(kConfigGroupSoftAp, &onSoftApSettingsChanged, &app->wifi);
+
+    // The AP comes up on request and goes down again when idle
+    WifiService::OnDemandConfig apConfig;
+    apConfig.source   = &softApConfigFromSettings;
+    apConfig.context  = &app->settings;
+    apConfig.startNow = CONFIG_JARVIS_WIFI_AP_AT_BOOT;
+#if CONFIG_JARVIS_BLE
+    apConfig.remoteTrigger = true; // The BLE control characteristic
+#endif
+
+    const esp_err_t err = app->wifi.startOnDemand(apConfig);
+    if (err != ESP_OK)
     {
-        WifiService::SoftApConfig apConfig;
-        apConfig.ssid     = "Jarvis-Setup";
-        apConfig.password = "jarvissetup";
+        ESP_LOGE(kLogTag, "Failed to start on-demand SoftAP: %d", err);
+    }
+    return err;
+}
 
-        err = wifiService.startSoftAp(apConfig);
-        if (err != ESP_OK)
+#if CONFIG_JARVIS_LTE
+esp_err_t startUplink(void* context)
+{
+    // Bundles queue from the first sample; the modem stays off until a
+    // session is due
+    JARVIS_MEM_SCOPE(Lte);
+    const esp_err_t err = static_cast<App*>(context)->uplink.start();
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(kLogTag, "LTE uplink failed to start: %d", err);
+    }
+    return err;
+}
+#endif
+
+#if CONFIG_JARVIS_GPS
+#if CONFIG_JARVIS_LTE
+void onTrackPoint(void* context, const TrackPoint& point)
+{
+    static_cast<LteService*>(context)->record(point);
+}
+#endif
+
+esp_err_t startGps(void* context)
+{
+    // The simplified track rides along with the telemetry bundles
+    JARVIS_MEM_SCOPE(Gps);
+    auto* app = static_cast<App*>(context);
+#if CONFIG_JARVIS_LTE
+    app->gps.setTrackCallback(&onTrackPoint, &app->uplink);
+#else
+    ESP_LOGI(kLogTag, "GPS track not kept: the LTE uplink is off");
+#endif
+    const esp_err_t err = app->gps.start();
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(kLogTag, "GPS failed to start: %d", err);
+    }
+    return err;
+}
+#endif
+
+esp_err_t startHomeSync(void* context)
+{
+    // Rides, and the LTE queue when there is one, go out over home Wi-Fi
+    // each time the bike parks
+    JARVIS_MEM_SCOPE(Wifi);
+    auto* app = static_cast<App*>(context);
+    if (!app->homeLink.configured())
+    {
+        ESP_LOGI(kLogTag, "Home sync off: no home network configured");
+        return ESP_OK;
+    }
+    const esp_err_t err = app->homeSync.start();
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(kLogTag, "Home sync failed to start: %d", err);
+    }
+    return err;
+}
+
+esp_err_t startTelemetry(void* context)
+{
+    // Frames come from the controller's BLE link or, on the bench, from the
+    // simulator
+    JARVIS_MEM_SCOPE(Telemetry);
+    auto* app = static_cast<App*>(context);
+    app->settings.subscribe(kConfigGroupMotor, &onMotorSettingsChanged, &app->motor);
+    app->motor.setConfig(app->settings.snapshot().motorConfig());
+    app->motor.setTelemetryCallback([app](const TelemetryState& state, const char*) {
+        BootSequencer::markTelemetry();
+        app->rides.update(state);
+        app->history.record(state);
+        app->live.publish(state);
+#if CONFIG_JARVIS_LTE
+        app->uplink.record(state);
+#endif
+#if CONFIG_JARVIS_BLE
+        if (app->bleStarted.load(std::memory_order_acquire))
         {
-            ESP_LOGE(kLogTag, "Failed to start SoftAP: %d", err);
+            app->ble.publishTelemetry(state);
         }
-        else
+#endif
+        // A turning wheel keeps the bike out of parked mode
+        if (state.data.rpm > 0)
         {
-            ESP_LOGI(kLogTag, "SoftAP running SSID='%s'", apConfig.ssid.c_str());
+            PowerManager::reportActivity();
         }
+    });
+
+#if CONFIG_JARVIS_SIMULATOR
+    app->simulator.setSink(&onSimulatedFrame, &app->motor);
+#if CONFIG_JARVIS_SIM_AT_BOOT
+    MotorSimService::RunConfig run;
+    run.durationMs = 0;
+    return app->simulator.start(run);
+#endif
+#endif
+    return ESP_OK;
+}
+
+#if CONFIG_JARVIS_BLE
+esp_err_t startBle(void* context)
+{
+    // The controller link; scanning and connecting run on BleService's task
+    JARVIS_MEM_SCOPE(Ble);
+    auto* app = static_cast<App*>(context);
+
+    BleService::ClientTarget motorLink;
+    motorLink.serviceUuid              = NimBLEUUID(CONFIG_JARVIS_BLE_MOTOR_SERVICE_UUID);
+    motorLink.notifyCharacteristicUuid = NimBLEUUID(CONFIG_JARVIS_BLE_MOTOR_NOTIFY_UUID);
+    motorLink.onNotify                 = [app](const BleService::NotificationEvent& event) {
+        app->motor.handleNotification(event.payload.data(), event.payload.size());
+    };
+    app->ble.addClientTarget(std::move(motorLink));
+
+    // The BMS is optional; its decoder keeps the latest pack state
+    if (CONFIG_JARVIS_BLE_BMS_SERVICE_UUID[0] != '\0')
+    {
+        BleService::ClientTarget bmsLink;
+        bmsLink.serviceUuid              = NimBLEUUID(CONFIG_JARVIS_BLE_BMS_SERVICE_UUID);
+        bmsLink.notifyCharacteristicUuid = NimBLEUUID(CONFIG_JARVIS_BLE_BMS_NOTIFY_UUID);
+        bmsLink.onNotify                 = [app](const BleService::NotificationEvent& event) {
+            app->bms.handleNotification(event.payload.data(), event.payload.size());
+        };
+        app->ble.addClientTarget(std::move(bmsLink));
     }
 
-    // Initialize the HTTP server
-    // Begin hosting our backend & REST APIs
-    httpd_handle_t server = nullptr;
-    if (err == ESP_OK)
+    BleService::ServerConfig control;
+    control.serviceUuid        = NimBLEUUID(kControlServiceUuid);
+    control.characteristicUuid = NimBLEUUID(kControlCharacteristicUuid);
+    control.onRead             = [app]() {
+        return std::string(app->wifi.onDemandStats().active ? "softap=up" : "softap=down");
+    };
+    control.onWrite = [app](const std::string& command) {
+        if (command == "softap")
+        {
+            app->wifi.requestSoftAp();
+        }
+    };
+    app->ble.setServerConfig(std::move(control));
+
+    BleService::TelemetryConfig telemetry;
+    telemetry.serviceUuid        = NimBLEUUID(kTelemetryServiceUuid);
+    telemetry.characteristicUuid = NimBLEUUID(kTelemetryCharacteristicUuid);
+    app->ble.enableTelemetryServer(telemetry);
+
+#if CONFIG_JARVIS_HID_INPUT
+    app->ble.enableHidServer(true);
+#else
+    app->ble.enableHidServer(false);
+#endif
+
+    if (!app->ble.start())
     {
-        server = start_http_server();
-        if (server == nullptr)
+        // Without the control characteristic only a reboot could restart an
+        // idled-out AP
+        ESP_LOGE(kLogTag, "BLE failed to start");
+        app->wifi.keepSoftApUp();
+        return ESP_FAIL;
+    }
+    app->bleStarted.store(true, std::memory_order_release);
+
+    // Parked, scanning drops to a low duty cycle
+    if (PowerManager::subscribe(&BleService::onPowerState, &app->ble) != ESP_OK)
+    {
+        ESP_LOGW(kLogTag, "BLE scan duty will not follow the power state");
+    }
+    BleService::onPowerState(&app->ble, PowerManager::state());
+    return ESP_OK;
+}
+#endif
+
+#if CONFIG_JARVIS_HID_INPUT
+esp_err_t startHid(void* context)
+{
+    // Handlebar buttons, sent as keyboard reports by the BLE HID server
+    auto*           app       = static_cast<App*>(context);
+    const HidButton buttons[] = {
+        {CONFIG_JARVIS_HID_UP_GPIO, 0x52, true},    // Up Arrow
+        {CONFIG_JARVIS_HID_DOWN_GPIO, 0x51, true},  // Down Arrow
+        {CONFIG_JARVIS_HID_ENTER_GPIO, 0x28, true}, // Enter
+    };
+    for (const HidButton& button : buttons)
+    {
+        if (button.gpio < 0)
         {
-            ESP_LOGE(kLogTag, "HTTP server failed to start");
+            continue;
         }
-        else
+        const esp_err_t err = app->hid.addButton(button);
+        if (err != ESP_OK)
         {
-            ESP_LOGI(kLogTag, "HTTP server started");
+            ESP_LOGE(kLogTag, "Button on GPIO %d rejected: %d", button.gpio, err);
+            return err;
         }
     }
-    else
+
+    app->hid.setSink(&BleService::hidReportSink, &app->ble);
+    const esp_err_t err = app->hid.start();
+    if (err != ESP_OK)
     {
-        ESP_LOGW(kLogTag, "Skipping HTTP server startup due to earlier error");
+        ESP_LOGE(kLogTag, "Handlebar controls failed to start: %d", err);
     }
+    return err;
+}
+#endif
 
-    (void)server;
+esp_err_t startHttp(void* context)
+{
+    // Begin hosting our backend & REST APIs
+    JARVIS_MEM_SCOPE(Http);
+    auto* app = static_cast<App*>(context);
+#if CONFIG_JARVIS_SIMULATOR
+    MotorSimService* simulator = &app->simulator;
+#else
+    MotorSimService* simulator = nullptr;
+#endif
+    app->server = start_http_server(&app->settings, simulator, &app->wifi, &app->rides, &app->history, &app->live);
+    if (app->server == nullptr)
+    {
+        ESP_LOGE(kLogTag, "HTTP server failed to start");
+        return ESP_FAIL;
+    }
+    ESP_LOGI(kLogTag, "HTTP server started");
+    return ESP_OK;
+}
+} // namespace
 
-    for (;;)
+/**
+ * MAIN function
+ */
+extern "C" void app_main(void)
+{
+    // Telemetry logs are recorded in binary from here on
+    DeferredLog::start();
+
+    static App app;
+
+    // Independent stages run in parallel; the web side waits for telemetry
+    BootSequencer::add("power", &startPower, nullptr);
+    const BootStage nvs      = BootSequencer::add("nvs", &initNvs, nullptr);
+    const BootStage settings = BootSequencer::add("settings", &loadSettings, &app, {nvs});
+    const BootStage rides    = BootSequencer::add("rides", &startRides, &app, {nvs});
+    const BootStage wifi     = BootSequencer::add("wifi", &initWifi, &app, {nvs});
+#if CONFIG_JARVIS_LTE
+    const BootStage lte = BootSequencer::add("lte", &startUplink, &app);
+    BootSequencer::add("home_sync", &startHomeSync, &app, {rides, wifi, lte}, BootStageKind::Deferred);
+#else
+    BootSequencer::add("home_sync", &startHomeSync, &app, {rides, wifi}, BootStageKind::Deferred);
+#endif
+#if CONFIG_JARVIS_GPS && CONFIG_JARVIS_LTE
+    BootSequencer::add("gps", &startGps, &app, {lte});
+#elif CONFIG_JARVIS_GPS
+    BootSequencer::add("gps", &startGps, &app);
+#endif
+    [[maybe_unused]] const BootStage telemetry =
+        BootSequencer::add("telemetry", &startTelemetry, &app, {settings, rides}, BootStageKind::Telemetry);
+#if CONFIG_JARVIS_BLE
+    [[maybe_unused]] const BootStage ble = BootSequencer::add("ble", &startBle, &app, {telemetry}, BootStageKind::Telemetry);
+#endif
+#if CONFIG_JARVIS_HID_INPUT
+    BootSequencer::add("hid", &startHid, &app, {ble});
+#endif
+    BootSequencer::add("softap", &startSoftAp, &app, {wifi, settings}, BootStageKind::Deferred);
+    BootSequencer::add("http", &startHttp, &app, {wifi, settings}, BootStageKind::Deferred);
+    BootSequencer::run();
+
+    // Everything long-lived exists now; hot paths must not allocate from here
+    MemAccounting::sealStartup();
+
+    // A freshly installed image stays on probation until here. It is kept
+    // only if it can still take the next update, so its server must answer
+    // a real request; otherwise the bootloader returns to the previous slot.
+    if (OtaUpdater::runningImagePendingVerify())
     {
-        vTaskDelay(pdMS_TO_TICKS(1000));
+        OtaUpdater::confirmRunningImage(http_server_self_check());
     }
+
+    // Returning deletes the main task and frees its stack
 }
@@ -0,0 +1,381 @@
+#include "boot.hh"
+
+#include <atomic>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+namespace
+{
+constexpr const char* kLogTag         = "Boot";
+constexpr int64_t     kDeferTimeoutUs = CONFIG_JARVIS_BOOT_DEFER_TIMEOUT_MS * 1000LL;
+constexpr int64_t     kTargetUs       = CONFIG_JARVIS_BOOT_TELEMETRY_TARGET_MS * 1000LL;
+constexpr BootStage   kStopWorker     = kNoBootStage;
+
+// Stages are what app_main used to run inline; give them the same stack
+constexpr uint32_t kWorkerStack = CONFIG_ESP_MAIN_TASK_STACK_SIZE;
+
+static_assert(BootSequencer::kMaxStages <= 32, "dependency masks hold one bit per stage");
+
+struct Stage
+{
+    BootSequencer::StageInfo info{};
+    BootSequencer::StageFn   fn      = nullptr;
+    void*                    context = nullptr;
+};
+
+class LockGuard
+{
+public:
+    explicit LockGuard(SemaphoreHandle_t mutex) : mutex_(mutex) { xSemaphoreTake(mutex_, portMAX_DELAY); }
+    ~LockGuard() { xSemaphoreGive(mutex_); }
+
+    LockGuard(const LockGuard&)            = delete;
+    LockGuard& operator=(const LockGuard&) = delete;
+
+private:
+    SemaphoreHandle_t mutex_;
+};
+
+Stage                     s_stages[BootSequencer::kMaxStages];
+std::size_t               s_stageCount = 0;
+bool                      s_started    = false;
+int64_t                   s_runStartUs = 0;
+int64_t                   s_releaseUs  = 0;
+int64_t                   s_finishUs   = 0;
+std::atomic<int64_t>      s_telemetryUs{0};
+std::atomic<TaskHandle_t> s_coordinator{nullptr};
+QueueHandle_t             s_ready         = nullptr;
+SemaphoreHandle_t         s_workersExited = nullptr;
+
+// Stages may be declared before anything else has started.
+SemaphoreHandle_t mutex()
+{
+    static StaticSemaphore_t storage;
+    static SemaphoreHandle_t handle = xSemaphoreCreateMutexStatic(&storage);
+    return handle;
+}
+
+void workerTask(void*)
+{
+    BootStage index = kStopWorker;
+    while (xQueueReceive(s_ready, &index, portMAX_DELAY) == pdTRUE && index != kStopWorker)
+    {
+        Stage& stage = s_stages[index];
+
+        const int64_t   startUs = esp_timer_get_time();
+        const esp_err_t result  = stage.fn(stage.context);
+        const int64_t   endUs   = esp_timer_get_time();
+
+        {
+            LockGuard lock(mutex());
+            stage.info.startUs = startUs;
+            stage.info.endUs   = endUs;
+            stage.info.result  = result;
+            stage.info.state   = result == ESP_OK ? BootStageState::Done : BootStageState::Failed;
+        }
+        if (result == ESP_OK)
+        {
+            ESP_LOGI(kLogTag,
+                     "%s: %u us (at %u ms)",
+                     stage.info.name,
+                     static_cast<unsigned>(endUs - startUs),
+                     static_cast<unsigned>(startUs / 1000));
+        }
+        else
+        {
+            ESP_LOGE(kLogTag, "%s failed: %d", stage.info.name, result);
+        }
+
+        const TaskHandle_t coordinator = s_coordinator.load(std::memory_order_acquire);
+        if (coordinator != nullptr)
+        {
+            xTaskNotifyGive(coordinator);
+        }
+    }
+
+    xSemaphoreGive(s_workersExited);
+    vTaskDelete(nullptr);
+}
+
+// True while a Telemetry stage may still produce the first frame. Caller
+// holds the mutex.
+bool telemetryExpected()
+{
+    for (std::size_t i = 0; i < s_stageCount; ++i)
+    {
+        const BootSequencer::StageInfo& info = s_stages[i].info;
+        if (info.kind == BootStageKind::Telemetry && info.state != BootStageState::Failed &&
+            info.state != BootStageState::Skipped)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Starts what can start and marks what never will. Dependencies always
+// point at earlier stages, so one pass in declaration order settles every
+// stage. Caller holds the mutex.
+std::size_t dispatch(bool released)
+{
+    uint32_t    done        = 0;
+    uint32_t    dead        = 0;
+    std::size_t outstanding = 0;
+
+    for (std::size_t i = 0; i < s_stageCount; ++i)
+    {
+        BootSequencer::StageInfo& info = s_stages[i].info;
+        const uint32_t            bit  = 1U << i;
+
+        if (info.state == BootStageState::Pending)
+        {
+            if ((info.after & dead) != 0)
+            {
+                info.state = BootStageState::Skipped;
+                ESP_LOGW(kLogTag, "%s skipped", info.name);
+            }
+            else if ((info.after & ~done) == 0 && (released || info.kind != BootStageKind::Deferred))
+            {
+                const BootStage index = static_cast<BootStage>(i);
+                info.state            = BootStageState::Running;
+                xQueueSend(s_ready, &index, portMAX_DELAY);
+            }
+        }
+
+        switch (info.state)
+        {
+            case BootStageState::Done:
+                done |= bit;
+                break;
+            case BootStageState::Failed:
+            case BootStageState::Skipped:
+                dead |= bit;
+                break;
+            default:
+                ++outstanding;
+                break;
+        }
+    }
+    return outstanding;
+}
+} // namespace
+
+BootStage BootSequencer::add(const char* name, StageFn fn, void* context, std::initializer_list<BootStage> after,
+                             BootStageKind kind)
+{
+    LockGuard lock(mutex());
+    if (s_started || s_stageCount >= kMaxStages || fn == nullptr)
+    {
+        return kNoBootStage;
+    }
+
+    uint32_t mask = 0;
+    for (const BootStage dependency : after)
+    {
+        if (dependency < 0 || static_cast<std::size_t>(dependency) >= s_stageCount)
+        {
+            ESP_LOGE(kLogTag, "%s: invalid dependency %d", name, dependency);
+            return kNoBootStage;
+        }
+        mask |= 1U << dependency;
+    }
+
+    Stage& stage     = s_stages[s_stageCount];
+    stage.info       = StageInfo{};
+    stage.info.name  = name;
+    stage.info.kind  = kind;
+    stage.info.after = mask;
+    stage.fn         = fn;
+    stage.context    = context;
+    return static_cast<BootStage>(s_stageCount++);
+}
+
+esp_err_t BootSequencer::run()
+{
+    {
+        LockGuard lock(mutex());
+        if (s_started)
+        {
+            return ESP_ERR_INVALID_STATE;
+        }
+        s_started    = true;
+        s_runStartUs = esp_timer_get_time();
+    }
+
+    s_ready         = xQueueCreate(kMaxStages + kWorkers, sizeof(BootStage));
+    s_workersExited = xSemaphoreCreateCounting(kWorkers, 0);
+    if (s_ready == nullptr || s_workersExited == nullptr)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+    s_coordinator.store(xTaskGetCurrentTaskHandle(), std::memory_order_release);
+
+    // Workers run at the caller's priority, on whichever core is free
+    const UBaseType_t priority = uxTaskPriorityGet(nullptr);
+    std::size_t       workers  = 0;
+    while (workers < kWorkers && workers < s_stageCount &&
+           xTaskCreatePinnedToCore(&workerTask, "boot", kWorkerStack, nullptr, priority, nullptr, tskNO_AFFINITY) ==
+               pdPASS)
+    {
+        ++workers;
+    }
+    if (workers == 0 && s_stageCount > 0)
+    {
+        ESP_LOGE(kLogTag, "No boot workers");
+        return ESP_ERR_NO_MEM;
+    }
+
+    const int64_t deferUntilUs = s_runStartUs + kDeferTimeoutUs;
+    while (true)
+    {
+        const int64_t nowUs       = esp_timer_get_time();
+        bool          released    = s_telemetryUs.load(std::memory_order_acquire) != 0 || nowUs >= deferUntilUs;
+        std::size_t   outstanding = 0;
+        {
+            LockGuard lock(mutex());
+            released = released || !telemetryExpected();
+            if (released && s_releaseUs == 0)
+            {
+                s_releaseUs = nowUs;
+            }
+            outstanding = dispatch(released);
+        }
+        if (outstanding == 0)
+        {
+            break;
+        }
+
+        // Woken by a finished stage or the first telemetry frame
+        const TickType_t wait = released ? portMAX_DELAY : pdMS_TO_TICKS((deferUntilUs - nowUs) / 1000) + 1;
+        ulTaskNotifyTake(pdTRUE, wait);
+    }
+
+    s_coordinator.store(nullptr, std::memory_order_release);
+    for (std::size_t i = 0; i < workers; ++i)
+    {
+        xQueueSend(s_ready, &kStopWorker, portMAX_DELAY);
+    }
+    for (std::size_t i = 0; i < workers; ++i)
+    {
+        xSemaphoreTake(s_workersExited, portMAX_DELAY);
+    }
+    vQueueDelete(s_ready);
+    vSemaphoreDelete(s_workersExited);
+    s_ready         = nullptr;
+    s_workersExited = nullptr;
+
+    esp_err_t result = ESP_OK;
+    {
+        LockGuard lock(mutex());
+        s_finishUs = esp_timer_get_time();
+        for (std::size_t i = 0; i < s_stageCount && result == ESP_OK; ++i)
+        {
+            if (s_stages[i].info.state == BootStageState::Failed)
+            {
+                result = s_stages[i].info.result;
+            }
+        }
+    }
+
+    ESP_LOGI(kLogTag,
+             "%u stage(s) finished at %u ms, %u ms after run()",
+             static_cast<unsigned>(s_stageCount),
+             static_cast<unsigned>(s_finishUs / 1000),
+             static_cast<unsigned>((s_finishUs - s_runStartUs) / 1000));
+    return result;
+}
+
+void BootSequencer::markTelemetry()
+{
+    if (s_telemetryUs.load(std::memory_order_relaxed) != 0)
+    {
+        return;
+    }
+
+    int64_t       expected = 0;
+    const int64_t nowUs    = esp_timer_get_time();
+    if (!s_telemetryUs.compare_exchange_strong(expected, nowUs, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    if (nowUs <= kTargetUs)
+    {
+        ESP_LOGI(kLogTag, "First telemetry at %u ms", static_cast<unsigned>(nowUs / 1000));
+    }
+    else
+    {
+        ESP_LOGW(kLogTag,
+                 "First telemetry at %u ms, target %u ms",
+                 static_cast<unsigned>(nowUs / 1000),
+                 static_cast<unsigned>(CONFIG_JARVIS_BOOT_TELEMETRY_TARGET_MS));
+    }
+
+    const TaskHandle_t coordinator = s_coordinator.load(std::memory_order_acquire);
+    if (coordinator != nullptr)
+    {
+        xTaskNotifyGive(coordinator);
+    }
+}
+
+BootSequencer::Timeline BootSequencer::timeline()
+{
+    Timeline timeline;
+    timeline.telemetryUs = s_telemetryUs.load(std::memory_order_acquire);
+    timeline.targetMet   = timeline.telemetryUs != 0 && timeline.telemetryUs <= kTargetUs;
+
+    LockGuard lock(mutex());
+    timeline.runStartUs = s_runStartUs;
+    timeline.releaseUs  = s_releaseUs;
+    timeline.finishUs   = s_finishUs;
+    return timeline;
+}
+
+std::size_t BootSequencer::stages(StageInfo* out, std::size_t capacity)
+{
+    LockGuard   lock(mutex());
+    std::size_t count = 0;
+    for (; count < s_stageCount && count < capacity; ++count)
+    {
+        out[count] = s_stages[count].info;
+    }
+    return count;
+}
+
+const char* BootSequencer::stateName(BootStageState state)
+{
+    switch (state)
+    {
+        case BootStageState::Pending:
+            return "pending";
+        case BootStageState::Running:
+            return "running";
+        case BootStageState::Done:
+            return "done";
+        case BootStageState::Failed:
+            return "failed";
+        case BootStageState::Skipped:
+            return "skipped";
+    }
+    return "unknown";
+}
+
+const char* BootSequencer::kindName(BootStageKind kind)
+{
+    switch (kind)
+    {
+        case BootStageKind::Normal:
+            return "normal";
+        case BootStageKind::Telemetry:
+            return "telemetry";
+        case BootStageKind::Deferred:
+            return "deferred";
+    }
+    return "unknown";
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+/**
+ * @file boot.hh
+ * @brief Dependency-ordered, parallel startup with a recorded timeline.
+ *
+ * app_main declares each startup step as a stage with the stages it needs
+ * and calls run(). A small pool of worker tasks runs every stage whose
+ * dependencies have finished, so independent steps (NVS and settings, the
+ * Wi-Fi driver, the telemetry path) overlap instead of queueing behind one
+ * another. A stage that fails takes its dependents down with it; they are
+ * skipped, not run against a half-initialised service.
+ *
+ * Deferred stages (the HTTP server and web UI, anything a rider does not
+ * need to see numbers) also wait for the first telemetry frame, which the
+ * telemetry path reports with markTelemetry(). They are released at once
+ * when no Telemetry stage is declared or it failed, and otherwise after
+ * CONFIG_JARVIS_BOOT_DEFER_TIMEOUT_MS at the latest, so a bike without a
+ * powered controller still gets its web UI.
+ *
+ * Start and end of every stage and the first telemetry frame are recorded
+ * against esp_timer, i.e. time since boot, and reported by GET /api/boot.
+ * A first frame later than CONFIG_JARVIS_BOOT_TELEMETRY_TARGET_MS is
+ * logged as a missed target.
+ */
+
+using BootStage = int8_t;
+
+constexpr BootStage kNoBootStage = -1;
+
+enum class BootStageState : uint8_t
+{
+    Pending,
+    Running,
+    Done,
+    Failed,
+    Skipped, ///< A dependency failed or was skipped
+};
+
+enum class BootStageKind : uint8_t
+{
+    Normal,
+    Telemetry, ///< Starts the telemetry path; deferred stages wait for its first frame
+    Deferred,  ///< Waits for the first telemetry frame as well as its dependencies
+};
+
+class BootSequencer
+{
+public:
+    /**
+     * Runs on a boot worker. Return ESP_OK to release the stages that depend
+     * on this one.
+     */
+    using StageFn = esp_err_t (*)(void* context);
+
+    static constexpr std::size_t kMaxStages = 16;
+    static constexpr std::size_t kWorkers   = 3;
+
+    struct StageInfo
+    {
+        const char*    name    = nullptr;
+        BootStageState state   = BootStageState::Pending;
+        esp_err_t      result  = ESP_OK;
+        BootStageKind  kind    = BootStageKind::Normal;
+        uint32_t       after   = 0; ///< Bitmask of the stages this one waits for
+        int64_t        startUs = 0; ///< Since boot
+        int64_t        endUs   = 0;
+    };
+
+    struct Timeline
+    {
+        int64_t  runStartUs  = 0; ///< run() entered
+        int64_t  releaseUs   = 0; ///< Deferred stages released
+        int64_t  finishUs    = 0; ///< Last stage finished
+        int64_t  telemetryUs = 0; ///< First telemetry frame, 0 until seen
+        uint32_t targetMs    = CONFIG_JARVIS_BOOT_TELEMETRY_TARGET_MS;
+        bool     targetMet   = false;
+    };
+
+    /**
+     * @brief Declares a stage. Dependencies are stages added earlier, so the
+     *        order of add() calls is always a valid sequential order.
+     * @return The stage, or kNoBootStage when kMaxStages are declared, a
+     *         dependency is invalid or run() has already been called.
+     */
+    static BootStage add(const char* name, StageFn fn, void* context, std::initializer_list<BootStage> after = {},
+                         BootStageKind kind = BootStageKind::Normal);
+
+    /**
+     * @brief Runs every stage and returns once all have finished, failed or
+     *        been skipped.
+     * @return ESP_OK if all stages succeeded, else the first failure.
+     */
+    static esp_err_t run();
+
+    /**
+     * @brief Records the first telemetry frame and releases deferred stages.
+     *        One relaxed load once recorded, so it can stay on the frame path.
+     */
+    static void markTelemetry();
+
+    static Timeline timeline();
+
+    /**
+     * @brief Copies up to @p capacity stages, in declaration order.
+     * @return Number copied.
+     */
+    static std::size_t stages(StageInfo* out, std::size_t capacity);
+
+    static const char* stateName(BootStageState state);
+    static const char* kindName(BootStageKind kind);
+};
@@ -0,0 +1,537 @@
+#include "can.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#if CONFIG_SOC_TWAI_SUPPORTED
+#include "esp_twai_onchip.h"
+#endif
+
+#include "services/mem/mem.hh"
+
+namespace
+{
+constexpr const char* kLogTag            = "CanService";
+constexpr uint32_t    kStdIdMask         = 0x7FF;
+constexpr uint32_t    kExtIdMask         = 0x1FFFFFFF;
+constexpr uint32_t    kDispatchStackSize = 4096;
+constexpr UBaseType_t kDispatchPriority  = 12;
+
+/**
+ * Bits that stay constant across every identifier in [first, last]: the
+ * common prefix of both bounds.
+ */
+uint32_t rangePrefixMask(uint32_t first, uint32_t last, uint32_t idMask)
+{
+    const uint32_t diff = first ^ last;
+    if (diff == 0)
+    {
+        return idMask;
+    }
+    const int      width   = 32 - __builtin_clz(diff);
+    const uint32_t varying = width >= 32 ? UINT32_MAX : ((1U << width) - 1U);
+    return idMask & ~varying;
+}
+} // namespace
+
+#if CONFIG_SOC_TWAI_SUPPORTED
+TwaiCanTransport::~TwaiCanTransport()
+{
+    stop();
+    if (txFree_ != nullptr)
+    {
+        vSemaphoreDelete(txFree_);
+    }
+}
+
+esp_err_t TwaiCanTransport::start(const CanAcceptanceFilter& filter, RxSink sink, void* context)
+{
+    if (node_ != nullptr)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (config_.txGpio < 0 || config_.rxGpio < 0)
+    {
+        ESP_LOGE(kLogTag, "No TWAI pins configured");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (txFree_ == nullptr)
+    {
+        txFree_ = xSemaphoreCreateCounting(kTxSlots, kTxSlots);
+        if (txFree_ == nullptr)
+        {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    twai_onchip_node_config_t nodeConfig{};
+    nodeConfig.io_cfg.tx                = static_cast<gpio_num_t>(config_.txGpio);
+    nodeConfig.io_cfg.rx                = static_cast<gpio_num_t>(config_.rxGpio);
+    nodeConfig.io_cfg.quanta_clk_out    = GPIO_NUM_NC;
+    nodeConfig.io_cfg.bus_off_indicator = GPIO_NUM_NC;
+    nodeConfig.bit_timing.bitrate       = config_.bitrate;
+    nodeConfig.tx_queue_depth           = kTxSlots;
+
+    esp_err_t err = twai_new_node_onchip(&nodeConfig, &node_);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(kLogTag, "twai_new_node_onchip failed: %d", err);
+        node_ = nullptr;
+        return err;
+    }
+
+    twai_mask_filter_config_t maskFilter{};
+    maskFilter.id     = filter.id;
+    maskFilter.mask   = filter.mask;
+    maskFilter.is_ext = filter.extended;
+    err               = twai_node_config_mask_filter(node_, 0, &maskFilter);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(kLogTag, "Failed to program acceptance filter: %d", err);
+        twai_node_delete(node_);
+        node_ = nullptr;
+        return err;
+    }
+
+    sink_    = sink;
+    context_ = context;
+
+    twai_event_callbacks_t callbacks{};
+    callbacks.on_rx_done = &TwaiCanTransport::onRxDone;
+    callbacks.on_tx_done = &TwaiCanTransport::onTxDone;
+    err                  = twai_node_register_event_callbacks(node_, &callbacks, this);
+    if (err == ESP_OK)
+    {
+        err = twai_node_enable(node_);
+    }
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(kLogTag, "Failed to enable TWAI node: %d", err);
+        twai_node_delete(node_);
+        node_ = nullptr;
+        return err;
+    }
+
+    ESP_LOGI(kLogTag,
+             "TWAI started tx=%d rx=%d bitrate=%u filter id=0x%08X mask=0x%08X",
+             config_.txGpio,
+             config_.rxGpio,
+             static_cast<unsigned>(config_.bitrate),
+             static_cast<unsigned>(filter.id),
+             static_cast<unsigned>(filter.mask));
+    return ESP_OK;
+}
+
+esp_err_t TwaiCanTransport::stop()
+{
+    if (node_ == nullptr)
+    {
+        return ESP_OK;
+    }
+
+    twai_node_disable(node_);
+    const esp_err_t err = twai_node_delete(node_);
+    node_               = nullptr;
+
+    // Frames still queued went with the node; nothing refers to their slots
+    for (uint32_t busy = txBusy_.exchange(0, std::memory_order_acq_rel); busy != 0; busy &= busy - 1)
+    {
+        xSemaphoreGive(txFree_);
+    }
+    return err;
+}
+
+esp_err_t TwaiCanTransport::transmit(const CanFrame& frame, uint32_t timeoutMs)
+{
+    if (node_ == nullptr)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (xSemaphoreTake(txFree_, pdMS_TO_TICKS(timeoutMs)) != pdTRUE)
+    {
+        return ESP_ERR_TIMEOUT;
+    }
+
+    // Holding a count guarantees a clear bit; only tx-done clears them again
+    uint32_t    busy  = txBusy_.load(std::memory_order_relaxed);
+    std::size_t index = 0;
+    for (;;)
+    {
+        index = static_cast<std::size_t>(__builtin_ctz(~busy));
+        if (txBusy_.compare_exchange_weak(busy, busy | (1U << index), std::memory_order_acquire))
+        {
+            break;
+        }
+    }
+
+    TxSlot&       slot   = txSlots_[index];
+    const uint8_t length = std::min<uint8_t>(frame.dlc, sizeof(slot.data));
+    std::memcpy(slot.data, frame.data.data(), length);
+    slot.frame            = twai_frame_t{};
+    slot.frame.header.id  = frame.id;
+    slot.frame.header.dlc = length;
+    slot.frame.header.ide = frame.extended;
+    slot.frame.header.rtr = frame.remote;
+    slot.frame.buffer     = slot.data;
+    slot.frame.buffer_len = length;
+
+    const esp_err_t err = twai_node_transmit(node_, &slot.frame, static_cast<int>(timeoutMs));
+    if (err != ESP_OK)
+    {
+        // Not queued, so no tx-done will come for it
+        txBusy_.fetch_and(~(1U << index), std::memory_order_release);
+        xSemaphoreGive(txFree_);
+    }
+    return err;
+}
+
+bool TwaiCanTransport::onTxDone(twai_node_handle_t /*handle*/, const twai_tx_done_event_data_t* event, void* context)
+{
+    auto* self = static_cast<TwaiCanTransport*>(context);
+    for (std::size_t i = 0; i < kTxSlots; ++i)
+    {
+        if (event->done_tx_frame != &self->txSlots_[i].frame)
+        {
+            continue;
+        }
+        self->txBusy_.fetch_and(~(1U << i), std::memory_order_release);
+        BaseType_t woken = pdFALSE;
+        xSemaphoreGiveFromISR(self->txFree_, &woken);
+        return woken == pdTRUE;
+    }
+    return false;
+}
+
+bool TwaiCanTransport::onRxDone(twai_node_handle_t handle, const twai_rx_done_event_data_t* /*event*/, void* context)
+{
+    auto* self = static_cast<TwaiCanTransport*>(context);
+
+    CanFrame     frame{};
+    twai_frame_t rxFrame{};
+    rxFrame.buffer     = frame.data.data();
+    rxFrame.buffer_len = frame.data.size();
+    if (twai_node_receive_from_isr(handle, &rxFrame) != ESP_OK || self->sink_ == nullptr)
+    {
+        return false;
+    }
+
+    frame.id          = rxFrame.header.id;
+    frame.dlc         = static_cast<uint8_t>(std::min<uint32_t>(rxFrame.header.dlc, 8));
+    frame.extended    = rxFrame.header.ide;
+    frame.remote      = rxFrame.header.rtr;
+    frame.timestampUs = static_cast<uint32_t>(esp_timer_get_time());
+    return self->sink_(self->context_, frame);
+}
+#endif
+
+esp_err_t LoopbackCanTransport::start(const CanAcceptanceFilter& filter, RxSink sink, void* context)
+{
+    filter_  = filter;
+    sink_    = sink;
+    context_ = context;
+    return ESP_OK;
+}
+
+esp_err_t LoopbackCanTransport::stop()
+{
+    sink_    = nullptr;
+    context_ = nullptr;
+    return ESP_OK;
+}
+
+esp_err_t LoopbackCanTransport::transmit(const CanFrame& frame, uint32_t /*timeoutMs*/)
+{
+    if (sink_ == nullptr)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    inject(frame);
+    return ESP_OK;
+}
+
+bool LoopbackCanTransport::inject(const CanFrame& frame)
+{
+    if (sink_ == nullptr || !filter_.accepts(frame))
+    {
+        return false;
+    }
+    sink_(context_, frame);
+    return true;
+}
+
+CanService::CanService(CanTransport& transport) : transport_(transport) {}
+
+CanService::~CanService()
+{
+    stop();
+}
+
+esp_err_t CanService::registerDecoder(uint32_t firstId, uint32_t lastId, DecoderCallback callback, bool extended)
+{
+    if (isRunning())
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    const uint32_t idMask = extended ? kExtIdMask : kStdIdMask;
+    if (!callback || firstId > lastId || lastId > idMask)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // The controller has one acceptance filter, and a filter matches one
+    // frame format; a second format would be dropped in hardware
+    if (!decoders_.empty() && decoders_.front().extended != extended)
+    {
+        ESP_LOGE(kLogTag,
+                 "Decoder range 0x%X-0x%X is %s, registered ranges are %s",
+                 static_cast<unsigned>(firstId),
+                 static_cast<unsigned>(lastId),
+                 extended ? "extended" : "standard",
+                 extended ? "standard" : "extended");
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    for (const DecoderEntry& entry : decoders_)
+    {
+        if (firstId <= entry.lastId && entry.firstId <= lastId)
+        {
+            ESP_LOGE(kLogTag,
+                     "Decoder range 0x%X-0x%X overlaps an existing one",
+                     static_cast<unsigned>(firstId),
+                     static_cast<unsigned>(lastId));
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+
+    DecoderEntry entry{};
+    entry.firstId  = firstId;
+    entry.lastId   = lastId;
+    entry.extended = extended;
+    entry.callback = std::move(callback);
+
+    const auto position = std::upper_bound(decoders_.begin(),
+                                           decoders_.end(),
+                                           entry,
+                                           [](const DecoderEntry& lhs, const DecoderEntry& rhs) {
+                                               return lhs.firstId < rhs.firstId;
+                                           });
+    decoders_.insert(position, std::move(entry));
+    return ESP_OK;
+}
+
+CanAcceptanceFilter CanService::acceptanceFilter() const
+{
+    CanAcceptanceFilter filter{};
+    if (decoders_.empty())
+    {
+        return filter;
+    }
+
+    // registerDecoder() keeps every range in one frame format
+    const bool     extended = decoders_.front().extended;
+    const uint32_t idMask   = extended ? kExtIdMask : kStdIdMask;
+
+    const uint32_t id   = decoders_.front().firstId;
+    uint32_t       mask = idMask;
+    for (const DecoderEntry& entry : decoders_)
+    {
+        mask &= rangePrefixMask(entry.firstId, entry.lastId, idMask);
+        mask &= ~(id ^ entry.firstId);
+    }
+
+    filter.id       = id & mask;
+    filter.mask     = mask;
+    filter.extended = extended;
+    return filter;
+}
+
+esp_err_t CanService::start()
+{
+    if (isRunning())
+    {
+        return ESP_OK;
+    }
+    if (decoders_.empty())
+    {
+        ESP_LOGW(kLogTag, "No decoders registered, CAN service not started");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (taskStopped_ == nullptr)
+    {
+        taskStopped_ = xSemaphoreCreateBinary();
+        if (taskStopped_ == nullptr)
+        {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    running_.store(true, std::memory_order_release);
+    if (xTaskCreate(&CanService::dispatchTask, "can_dispatch", kDispatchStackSize, this, kDispatchPriority, &task_) !=
+        pdPASS)
+    {
+        running_.store(false, std::memory_order_release);
+        task_ = nullptr;
+        ESP_LOGE(kLogTag, "Failed to create dispatch task");
+        return ESP_ERR_NO_MEM;
+    }
+
+    const esp_err_t err = transport_.start(acceptanceFilter(), &CanService::onFrame, this);
+    if (err != ESP_OK)
+    {
+        stop();
+        return err;
+    }
+
+    ESP_LOGI(kLogTag, "CAN service started with %zu decoder range(s)", decoders_.size());
+    return ESP_OK;
+}
+
+esp_err_t CanService::stop()
+{
+    if (!isRunning())
+    {
+        return ESP_OK;
+    }
+
+    const esp_err_t err = transport_.stop();
+
+    running_.store(false, std::memory_order_release);
+    if (task_ != nullptr)
+    {
+        xTaskNotifyGive(task_);
+        xSemaphoreTake(taskStopped_, portMAX_DELAY);
+        task_ = nullptr;
+    }
+    return err;
+}
+
+esp_err_t CanService::transmit(const CanFrame& frame, uint32_t timeoutMs)
+{
+    return transport_.transmit(frame, timeoutMs);
+}
+
+bool CanService::onFrame(void* context, const CanFrame& frame)
+{
+    auto* self = static_cast<CanService*>(context);
+    if (!self->ring_.push(frame))
+    {
+        self->dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    self->received_.fetch_add(1, std::memory_order_relaxed);
+
+    if (self->task_ == nullptr)
+    {
+        return false;
+    }
+
+    if (xPortInIsrContext())
+    {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(self->task_, &woken);
+        return woken == pdTRUE;
+    }
+    xTaskNotifyGive(self->task_);
+    return false;
+}
+
+void CanService::dispatchTask(void* arg)
+{
+    auto* self = static_cast<CanService*>(arg);
+    MemAccounting::setTaskTag(MemTag::Can);
+
+    while (self->isRunning())
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        self->processPending();
+    }
+
+    xSemaphoreGive(self->taskStopped_);
+    vTaskDelete(nullptr);
+}
+
+std::size_t CanService::processPending()
+{
+    CanFrame    batch[kBatchSize];
+    std::size_t total = 0;
+
+    for (;;)
+    {
+        const std::size_t count = ring_.popBatch(batch, kBatchSize);
+        if (count == 0)
+        {
+            break;
+        }
+        ++batches_;
+        dispatchBatch(batch, count);
+        total += count;
+    }
+    return total;
+}
+
+const CanService::DecoderEntry* CanService::findDecoder(const CanFrame& frame) const
+{
+    // Entries share one format, are sorted by firstId and do not overlap.
+    const auto it = std::upper_bound(decoders_.begin(),
+                                     decoders_.end(),
+                                     frame,
+                                     [](const CanFrame& key, const DecoderEntry& entry) {
+                                         return key.id < entry.firstId;
+                                     });
+    if (it == decoders_.begin())
+    {
+        return nullptr;
+    }
+
+    const DecoderEntry& candidate = *std::prev(it);
+    if (candidate.extended != frame.extended || frame.id > candidate.lastId)
+    {
+        return nullptr;
+    }
+    return &candidate;
+}
+
+void CanService::dispatchBatch(const CanFrame* frames, std::size_t count)
+{
+    // Hand each decoder the longest run of consecutive frames it owns so the
+    // callback is invoked once per run rather than once per frame.
+    std::size_t         runStart   = 0;
+    const DecoderEntry* runDecoder = count > 0 ? findDecoder(frames[0]) : nullptr;
+
+    for (std::size_t i = 1; i <= count; ++i)
+    {
+        const DecoderEntry* decoder = i < count ? findDecoder(frames[i]) : nullptr;
+        if (i < count && decoder == runDecoder)
+        {
+            continue;
+        }
+
+        if (runDecoder != nullptr)
+        {
+            runDecoder->callback(&frames[runStart], i - runStart);
+        }
+        else
+        {
+            unmatched_ += static_cast<uint32_t>(i - runStart);
+        }
+
+        runStart   = i;
+        runDecoder = decoder;
+    }
+}
+
+CanService::Stats CanService::stats() const
+{
+    Stats stats{};
+    stats.received  = received_.load(std::memory_order_relaxed);
+    stats.dropped   = dropped_.load(std::memory_order_relaxed);
+    stats.unmatched = unmatched_;
+    stats.batches   = batches_;
+    return stats;
+}
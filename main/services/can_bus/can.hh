@@ -0,0 +1,257 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#include "util/spsc_ring.hh"
+
+#if CONFIG_SOC_TWAI_SUPPORTED
+#include "esp_twai.h"
+#endif
+
+/**
+ * @file can.hh
+ * @brief Declares CanService, which receives CAN frames through a pluggable
+ *        transport and dispatches them in batches to per-ID-range decoders.
+ *
+ * Frames travel from the transport's interrupt handler into a lock-free ring
+ * and are drained by a single dispatch task. The hardware acceptance filter is
+ * derived from the registered decoder ranges so the controller discards
+ * unrelated traffic before it ever reaches the CPU.
+ *
+ * This is a library: app_main does not start it, since the motor controller
+ * and BMS decoders in the tree speak BLE. A build for a CAN-equipped bike
+ * constructs a TwaiCanTransport with its pins, registers its decoders and
+ * calls `start()`.
+ */
+
+/**
+ * @brief Classic CAN 2.0 frame as seen by decoders.
+ */
+struct CanFrame
+{
+    uint32_t               id          = 0;
+    uint8_t                dlc         = 0;
+    bool                   extended    = false;
+    bool                   remote      = false;
+    std::array<uint8_t, 8> data{};
+    uint32_t               timestampUs = 0; ///< Low 32 bits of esp_timer at reception
+};
+
+/**
+ * @brief Single id/mask acceptance filter. A frame passes when
+ *        `(frame.id & mask) == (id & mask)`.
+ */
+struct CanAcceptanceFilter
+{
+    uint32_t id       = 0;
+    uint32_t mask     = 0; ///< 0 accepts every identifier
+    bool     extended = false;
+
+    bool accepts(const CanFrame& frame) const
+    {
+        return frame.extended == extended && (frame.id & mask) == (id & mask);
+    }
+};
+
+/**
+ * @brief Link-layer abstraction so the same pipeline can run on the TWAI
+ *        peripheral or on a virtual bus.
+ */
+class CanTransport
+{
+public:
+    /**
+     * Invoked for every accepted frame. May run in interrupt context, so
+     * implementations must not block.
+     *
+     * @return true when a higher priority task was woken.
+     */
+    using RxSink = bool (*)(void* context, const CanFrame& frame);
+
+    virtual ~CanTransport() = default;
+
+    virtual esp_err_t start(const CanAcceptanceFilter& filter, RxSink sink, void* context) = 0;
+    virtual esp_err_t stop()                                                                = 0;
+    virtual esp_err_t transmit(const CanFrame& frame, uint32_t timeoutMs)                    = 0;
+};
+
+#if CONFIG_SOC_TWAI_SUPPORTED
+/**
+ * @brief Transport backed by the on-chip TWAI controller.
+ */
+class TwaiCanTransport : public CanTransport
+{
+public:
+    /** Frames queued in the driver at once; each keeps its own buffer. */
+    static constexpr std::size_t kTxSlots = 4;
+
+    /** No board wiring is assumed: the caller picks the pins. */
+    struct Config
+    {
+        int      txGpio  = -1;
+        int      rxGpio  = -1;
+        uint32_t bitrate = 250000; ///< What most e-bike controllers and BMSs use
+    };
+
+    explicit TwaiCanTransport(const Config& config) : config_(config) {}
+    ~TwaiCanTransport() override;
+
+    esp_err_t start(const CanAcceptanceFilter& filter, RxSink sink, void* context) override;
+    esp_err_t stop() override;
+
+    /**
+     * @brief Queues @p frame and returns once the driver holds it, waiting up
+     *        to @p timeoutMs for one of the kTxSlots to come free.
+     */
+    esp_err_t transmit(const CanFrame& frame, uint32_t timeoutMs) override;
+
+private:
+    /** The driver keeps a pointer to both until tx-done. */
+    struct TxSlot
+    {
+        twai_frame_t frame{};
+        uint8_t      data[8]{};
+    };
+
+    static bool onRxDone(twai_node_handle_t handle, const twai_rx_done_event_data_t* event, void* context);
+    static bool onTxDone(twai_node_handle_t handle, const twai_tx_done_event_data_t* event, void* context);
+
+    Config                       config_{};
+    twai_node_handle_t           node_    = nullptr;
+    RxSink                       sink_    = nullptr;
+    void*                        context_ = nullptr;
+    std::array<TxSlot, kTxSlots> txSlots_{};
+    std::atomic<uint32_t>        txBusy_{0};        ///< Bit per slot queued in the driver
+    SemaphoreHandle_t            txFree_ = nullptr; ///< Counts free slots
+};
+#endif
+
+/**
+ * @brief Virtual bus for host builds, tests and benchmarks.
+ *
+ * `inject()` behaves like a frame arriving on the wire: it applies the
+ * acceptance filter and hands the frame to the sink exactly as the TWAI
+ * interrupt would. Transmitted frames are looped back the same way.
+ */
+class LoopbackCanTransport : public CanTransport
+{
+public:
+    esp_err_t start(const CanAcceptanceFilter& filter, RxSink sink, void* context) override;
+    esp_err_t stop() override;
+    esp_err_t transmit(const CanFrame& frame, uint32_t timeoutMs) override;
+
+    /**
+     * @return true when the frame passed the filter and was delivered.
+     */
+    bool inject(const CanFrame& frame);
+
+private:
+    CanAcceptanceFilter filter_{};
+    RxSink              sink_    = nullptr;
+    void*               context_ = nullptr;
+};
+
+class CanService
+{
+public:
+    /**
+     * Receives a run of consecutive frames that all fall into the decoder's
+     * identifier range. The pointer is only valid for the duration of the
+     * call.
+     */
+    using DecoderCallback = std::function<void(const CanFrame* frames, std::size_t count)>;
+
+    struct Stats
+    {
+        uint32_t received  = 0; ///< Frames accepted into the ring
+        uint32_t dropped   = 0; ///< Frames lost because the ring was full
+        uint32_t unmatched = 0; ///< Frames that passed the filter but had no decoder
+        uint32_t batches   = 0; ///< Ring drains performed by the dispatch task
+    };
+
+    static constexpr std::size_t kRingCapacity = 256;
+    static constexpr std::size_t kBatchSize    = 32;
+
+    explicit CanService(CanTransport& transport);
+    ~CanService();
+
+    CanService(const CanService&)            = delete;
+    CanService& operator=(const CanService&) = delete;
+
+    /**
+     * @brief Registers a decoder for the inclusive identifier range
+     *        [`firstId`, `lastId`]. Must be called before `start()`.
+     *
+     * All ranges must use the same frame format: the hardware filter can
+     * pass standard or extended identifiers, not both.
+     *
+     * @return ESP_ERR_NOT_SUPPORTED when @p extended differs from the ranges
+     *         already registered.
+     */
+    esp_err_t registerDecoder(uint32_t firstId, uint32_t lastId, DecoderCallback callback, bool extended = false);
+
+    /**
+     * @brief Programs the acceptance filter and starts the dispatch task.
+     */
+    esp_err_t start();
+
+    /**
+     * @brief Stops the transport and the dispatch task.
+     */
+    esp_err_t stop();
+
+    esp_err_t transmit(const CanFrame& frame, uint32_t timeoutMs = 10);
+
+    /**
+     * @brief Drains the ring on the calling task. The dispatch task runs it
+     *        on every wake-up; call it directly only while stopped.
+     * @return Number of frames dispatched.
+     */
+    std::size_t processPending();
+
+    /**
+     * @return Smallest single id/mask filter accepting every registered range.
+     */
+    CanAcceptanceFilter acceptanceFilter() const;
+
+    Stats stats() const;
+    bool  isRunning() const { return running_.load(std::memory_order_acquire); }
+
+private:
+    struct DecoderEntry
+    {
+        uint32_t        firstId  = 0;
+        uint32_t        lastId   = 0;
+        bool            extended = false;
+        DecoderCallback callback{};
+    };
+
+    static bool onFrame(void* context, const CanFrame& frame);
+    static void dispatchTask(void* arg);
+
+    const DecoderEntry* findDecoder(const CanFrame& frame) const;
+    void                dispatchBatch(const CanFrame* frames, std::size_t count);
+
+    CanTransport&                      transport_;
+    std::vector<DecoderEntry>          decoders_;
+    SpscRing<CanFrame, kRingCapacity>  ring_;
+    TaskHandle_t                       task_        = nullptr;
+    SemaphoreHandle_t                  taskStopped_ = nullptr;
+    std::atomic<bool>                  running_{false};
+    std::atomic<uint32_t>              received_{0};
+    std::atomic<uint32_t>              dropped_{0};
+    uint32_t                           unmatched_ = 0;
+    uint32_t                           batches_   = 0;
+};
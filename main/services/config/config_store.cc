@@ -0,0 +1,717 @@
+#include "config_store.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "esp_log.h"
+#include "nvs_flash.h"
+
+namespace
+{
+constexpr const char* kLogTag = "ConfigStore";
+
+// clang-format off
+const ConfigField kSchema[] = {
+    {"wheelCircumferenceM", "wheel_circ",  ConfigType::Float,  offsetof(Settings, wheelCircumferenceM), sizeof(Settings::wheelCircumferenceM), 0.5f, 4.0f,  kConfigGroupMotor,  false},
+    {"reductionRatio",      "ratio",       ConfigType::Float,  offsetof(Settings, reductionRatio),      sizeof(Settings::reductionRatio),      0.1f, 50.0f, kConfigGroupMotor,  false},
+    {"apSsid",              "ap_ssid",     ConfigType::String, offsetof(Settings, apSsid),              sizeof(Settings::apSsid),              1,    32,    kConfigGroupSoftAp, false},
+    {"apPassword",          "ap_pass",     ConfigType::String, offsetof(Settings, apPassword),          sizeof(Settings::apPassword),          0,    63,    kConfigGroupSoftAp, true},
+    {"apChannel",           "ap_chan",     ConfigType::Int,    offsetof(Settings, apChannel),           sizeof(Settings::apChannel),           1,    13,    kConfigGroupSoftAp, false},
+    {"apMaxConnections",    "ap_max_conn", ConfigType::Int,    offsetof(Settings, apMaxConnections),    sizeof(Settings::apMaxConnections),    1,    10,    kConfigGroupSoftAp, false},
+    {"apHidden",            "ap_hidden",   ConfigType::Bool,   offsetof(Settings, apHidden),            sizeof(Settings::apHidden),            0,    1,     kConfigGroupSoftAp, false},
+};
+// clang-format on
+
+constexpr std::size_t kSchemaSize = sizeof(kSchema) / sizeof(kSchema[0]);
+static_assert(kSchemaSize <= 32, "dirty mask holds one bit per field");
+
+class LockGuard
+{
+public:
+    explicit LockGuard(SemaphoreHandle_t mutex) : mutex_(mutex) { xSemaphoreTake(mutex_, portMAX_DELAY); }
+    ~LockGuard() { xSemaphoreGive(mutex_); }
+
+    LockGuard(const LockGuard&)            = delete;
+    LockGuard& operator=(const LockGuard&) = delete;
+
+private:
+    SemaphoreHandle_t mutex_;
+};
+
+void* member(Settings& settings, const ConfigField& field)
+{
+    return reinterpret_cast<uint8_t*>(&settings) + field.offset;
+}
+
+const void* member(const Settings& settings, const ConfigField& field)
+{
+    return reinterpret_cast<const uint8_t*>(&settings) + field.offset;
+}
+
+bool sameValue(const ConfigField& field, const Settings& a, const Settings& b)
+{
+    if (field.type == ConfigType::String)
+    {
+        return std::strcmp(static_cast<const char*>(member(a, field)), static_cast<const char*>(member(b, field))) == 0;
+    }
+    return std::memcmp(member(a, field), member(b, field), field.size) == 0;
+}
+
+/**
+ * Minimal reader for the flat `{"name": value, ...}` objects the settings
+ * API accepts: string, number and boolean values only.
+ */
+class FlatJsonReader
+{
+public:
+    FlatJsonReader(const char* json, std::size_t length) : pos_(json), end_(json + length) {}
+
+    bool begin() { return consume('{'); }
+
+    /**
+     * @return 1 for a key, 0 at the closing brace, -1 on malformed input.
+     */
+    int nextKey(std::string& key)
+    {
+        skipSpace();
+        if (consume('}'))
+        {
+            return 0;
+        }
+        if (!first_ && !consume(','))
+        {
+            return -1;
+        }
+        first_ = false;
+        skipSpace();
+        if (!readString(key))
+        {
+            return -1;
+        }
+        skipSpace();
+        return consume(':') ? 1 : -1;
+    }
+
+    bool readValue(const ConfigField& field, Settings& settings)
+    {
+        skipSpace();
+        void* target = member(settings, field);
+        switch (field.type)
+        {
+            case ConfigType::Bool:
+                if (matchWord("true"))
+                {
+                    *static_cast<bool*>(target) = true;
+                    return true;
+                }
+                if (matchWord("false"))
+                {
+                    *static_cast<bool*>(target) = false;
+                    return true;
+                }
+                return false;
+            case ConfigType::Int:
+            {
+                float value = 0.0f;
+                if (!readNumber(value) || value != std::floor(value))
+                {
+                    return false;
+                }
+                *static_cast<int32_t*>(target) = static_cast<int32_t>(value);
+                return true;
+            }
+            case ConfigType::Float:
+                return readNumber(*static_cast<float*>(target));
+            case ConfigType::String:
+            {
+                std::string value;
+                if (!readString(value) || value.size() >= field.size)
+                {
+                    return false;
+                }
+                std::memcpy(target, value.c_str(), value.size() + 1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    void skipSpace()
+    {
+        while (pos_ < end_ && (*pos_ == ' ' || *pos_ == '\t' || *pos_ == '\r' || *pos_ == '\n'))
+        {
+            ++pos_;
+        }
+    }
+
+    bool consume(char c)
+    {
+        skipSpace();
+        if (pos_ < end_ && *pos_ == c)
+        {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    bool matchWord(const char* word)
+    {
+        const std::size_t length = std::strlen(word);
+        if (static_cast<std::size_t>(end_ - pos_) < length || std::strncmp(pos_, word, length) != 0)
+        {
+            return false;
+        }
+        pos_ += length;
+        return true;
+    }
+
+    bool readString(std::string& out)
+    {
+        out.clear();
+        if (pos_ >= end_ || *pos_ != '"')
+        {
+            return false;
+        }
+        ++pos_;
+        while (pos_ < end_ && *pos_ != '"')
+        {
+            char c = *pos_++;
+            if (c == '\\')
+            {
+                if (pos_ >= end_)
+                {
+                    return false;
+                }
+                c = *pos_++;
+                if (c != '"' && c != '\\' && c != '/')
+                {
+                    return false; // no control or unicode escapes in settings
+                }
+            }
+            out.push_back(c);
+        }
+        if (pos_ >= end_)
+        {
+            return false;
+        }
+        ++pos_;
+        return true;
+    }
+
+    bool readNumber(float& out)
+    {
+        char        buffer[24];
+        std::size_t length = 0;
+        while (pos_ < end_ && length + 1 < sizeof(buffer) &&
+               (std::strchr("+-.eE", *pos_) != nullptr || (*pos_ >= '0' && *pos_ <= '9')))
+        {
+            buffer[length++] = *pos_++;
+        }
+        buffer[length] = '\0';
+        char* parsedEnd = nullptr;
+        out             = std::strtof(buffer, &parsedEnd);
+        return length > 0 && parsedEnd == buffer + length && std::isfinite(out);
+    }
+
+    const char* pos_;
+    const char* end_;
+    bool        first_ = true;
+};
+
+void appendJsonString(std::string& out, const char* value)
+{
+    out.push_back('"');
+    for (const char* p = value; *p != '\0'; ++p)
+    {
+        if (*p == '"' || *p == '\\')
+        {
+            out.push_back('\\');
+        }
+        out.push_back(*p);
+    }
+    out.push_back('"');
+}
+} // namespace
+
+MotorController::Config Settings::motorConfig() const
+{
+    MotorController::Config config{};
+    config.wheelCircumferenceMeters = wheelCircumferenceM;
+    config.reductionRatio           = reductionRatio;
+    return config;
+}
+
+WifiService::SoftApConfig Settings::softApConfig() const
+{
+    WifiService::SoftApConfig config{};
+    config.ssid           = apSsid;
+    config.password       = apPassword;
+    config.channel        = static_cast<uint8_t>(apChannel);
+    config.maxConnections = static_cast<uint8_t>(apMaxConnections);
+    config.ssidHidden     = apHidden;
+    config.applySecurityDefaults();
+    return config;
+}
+
+NvsConfigBackend::~NvsConfigBackend()
+{
+    if (open_)
+    {
+        nvs_close(handle_);
+    }
+}
+
+esp_err_t NvsConfigBackend::initFlash()
+{
+    esp_err_t err = nvs_flash_init();
+    if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND)
+    {
+        ESP_LOGW(kLogTag, "NVS init failed (%d), erasing", err);
+        err = nvs_flash_erase();
+        if (err != ESP_OK)
+        {
+            ESP_LOGE(kLogTag, "Failed to erase NVS partition: %d", err);
+            return err;
+        }
+        err = nvs_flash_init();
+    }
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(kLogTag, "Failed to initialise NVS: %d", err);
+    }
+    return err;
+}
+
+esp_err_t NvsConfigBackend::ensureOpen()
+{
+    if (open_)
+    {
+        return ESP_OK;
+    }
+    const esp_err_t err = nvs_open(namespace_, NVS_READWRITE, &handle_);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(kLogTag, "nvs_open(%s) failed: %d", namespace_, err);
+        return err;
+    }
+    open_ = true;
+    return ESP_OK;
+}
+
+esp_err_t NvsConfigBackend::readU32(const char* key, uint32_t& value)
+{
+    const esp_err_t err = ensureOpen();
+    if (err != ESP_OK)
+    {
+        return err;
+    }
+    const esp_err_t readErr = nvs_get_u32(handle_, key, &value);
+    return readErr == ESP_ERR_NVS_NOT_FOUND ? ESP_ERR_NOT_FOUND : readErr;
+}
+
+esp_err_t NvsConfigBackend::readString(const char* key, char* value, std::size_t capacity)
+{
+    const esp_err_t err = ensureOpen();
+    if (err != ESP_OK)
+    {
+        return err;
+    }
+    std::size_t     length  = capacity;
+    const esp_err_t readErr = nvs_get_str(handle_, key, value, &length);
+    return readErr == ESP_ERR_NVS_NOT_FOUND ? ESP_ERR_NOT_FOUND : readErr;
+}
+
+esp_err_t NvsConfigBackend::writeU32(const char* key, uint32_t value)
+{
+    const esp_err_t err = ensureOpen();
+    return err != ESP_OK ? err : nvs_set_u32(handle_, key, value);
+}
+
+esp_err_t NvsConfigBackend::writeString(const char* key, const char* value)
+{
+    const esp_err_t err = ensureOpen();
+    return err != ESP_OK ? err : nvs_set_str(handle_, key, value);
+}
+
+esp_err_t NvsConfigBackend::commit()
+{
+    const esp_err_t err = ensureOpen();
+    return err != ESP_OK ? err : nvs_commit(handle_);
+}
+
+ConfigStore::ConfigStore(ConfigBackend& backend) : ConfigStore(backend, Config{}) {}
+
+ConfigStore::ConfigStore(ConfigBackend& backend, const Config& config) : backend_(backend), config_(config)
+{
+    mutex_ = xSemaphoreCreateMutex();
+
+    esp_timer_create_args_t timerArgs{};
+    timerArgs.callback = &ConfigStore::commitTimerCallback;
+    timerArgs.arg      = this;
+    timerArgs.name     = "config_commit";
+    if (esp_timer_create(&timerArgs, &commitTimer_) != ESP_OK)
+    {
+        ESP_LOGE(kLogTag, "Failed to create commit timer, changes are only saved on flush()");
+        commitTimer_ = nullptr;
+    }
+}
+
+ConfigStore::~ConfigStore()
+{
+    if (commitTimer_ != nullptr)
+    {
+        esp_timer_stop(commitTimer_);
+        esp_timer_delete(commitTimer_);
+    }
+    flush();
+    if (mutex_ != nullptr)
+    {
+        vSemaphoreDelete(mutex_);
+    }
+}
+
+const ConfigField* ConfigStore::schema(std::size_t& count)
+{
+    count = kSchemaSize;
+    return kSchema;
+}
+
+const ConfigField* ConfigStore::findField(const char* name, std::size_t length)
+{
+    for (const ConfigField& field : kSchema)
+    {
+        if (std::strncmp(field.name, name, length) == 0 && field.name[length] == '\0')
+        {
+            return &field;
+        }
+    }
+    return nullptr;
+}
+
+bool ConfigStore::validate(const ConfigField& field, const Settings& settings)
+{
+    const void* value = member(settings, field);
+    switch (field.type)
+    {
+        case ConfigType::Bool:
+            return true;
+        case ConfigType::Int:
+        {
+            const int32_t v = *static_cast<const int32_t*>(value);
+            return v >= static_cast<int32_t>(field.min) && v <= static_cast<int32_t>(field.max);
+        }
+        case ConfigType::Float:
+        {
+            const float v = *static_cast<const float*>(value);
+            return std::isfinite(v) && v >= field.min && v <= field.max;
+        }
+        case ConfigType::String:
+        {
+            const std::size_t length = strnlen(static_cast<const char*>(value), field.size);
+            if (length >= field.size || length < field.min || length > field.max)
+            {
+                return false;
+            }
+            // A non-empty SoftAP password must satisfy WPA2-PSK.
+            if (field.offset == offsetof(Settings, apPassword))
+            {
+                return length == 0 || length >= 8;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+esp_err_t ConfigStore::load()
+{
+    Settings loaded{};
+    for (const ConfigField& field : kSchema)
+    {
+        Settings  candidate = loaded;
+        void*     target    = member(candidate, field);
+        esp_err_t err       = ESP_OK;
+
+        if (field.type == ConfigType::String)
+        {
+            err = backend_.readString(field.key, static_cast<char*>(target), field.size);
+        }
+        else
+        {
+            uint32_t raw = 0;
+            err          = backend_.readU32(field.key, raw);
+            if (err == ESP_OK && field.type == ConfigType::Bool)
+            {
+                *static_cast<bool*>(target) = raw != 0;
+            }
+            else if (err == ESP_OK)
+            {
+                std::memcpy(target, &raw, sizeof(raw));
+            }
+        }
+
+        if (err == ESP_ERR_NOT_FOUND)
+        {
+            continue;
+        }
+        if (err != ESP_OK || !validate(field, candidate))
+        {
+            ESP_LOGW(kLogTag, "Ignoring stored '%s' (%d), using default", field.name, err);
+            continue;
+        }
+        loaded = candidate;
+    }
+
+    LockGuard lock(mutex_);
+    current_ = loaded;
+    return ESP_OK;
+}
+
+Settings ConfigStore::snapshot() const
+{
+    LockGuard lock(mutex_);
+    return current_;
+}
+
+esp_err_t ConfigStore::subscribe(uint32_t groups, Listener listener, void* context)
+{
+    LockGuard lock(mutex_);
+    if (subscriptionCount_ == kMaxListeners)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+    subscriptions_[subscriptionCount_++] = Subscription{groups, listener, context};
+    return ESP_OK;
+}
+
+esp_err_t ConfigStore::update(const Settings& candidate, const char** invalidField)
+{
+    for (const ConfigField& field : kSchema)
+    {
+        if (!validate(field, candidate))
+        {
+            if (invalidField != nullptr)
+            {
+                *invalidField = field.name;
+            }
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+
+    uint32_t                                changedGroups = 0;
+    std::array<Subscription, kMaxListeners> subscriptions{};
+    std::size_t                             subscriptionCount = 0;
+    {
+        LockGuard lock(mutex_);
+        for (std::size_t i = 0; i < kSchemaSize; ++i)
+        {
+            if (!sameValue(kSchema[i], current_, candidate))
+            {
+                dirtyFields_ |= 1u << i;
+                changedGroups |= kSchema[i].groups;
+            }
+        }
+        if (changedGroups == 0)
+        {
+            return ESP_OK;
+        }
+
+        current_ = candidate;
+        ++stats_.updates;
+        scheduleCommitLocked();
+
+        subscriptions     = subscriptions_;
+        subscriptionCount = subscriptionCount_;
+    }
+
+    // Listeners run unlocked so they may call back into the store.
+    for (std::size_t i = 0; i < subscriptionCount; ++i)
+    {
+        if ((subscriptions[i].groups & changedGroups) != 0)
+        {
+            subscriptions[i].listener(subscriptions[i].context, candidate, changedGroups);
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t ConfigStore::updateFromJson(const char* json, std::size_t length, const char** invalidField)
+{
+    Settings       candidate = snapshot();
+    FlatJsonReader reader(json, length);
+    if (!reader.begin())
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    std::string key;
+    for (;;)
+    {
+        const int next = reader.nextKey(key);
+        if (next == 0)
+        {
+            break;
+        }
+        if (next < 0)
+        {
+            return ESP_ERR_INVALID_ARG;
+        }
+
+        const ConfigField* field = findField(key.c_str(), key.size());
+        if (field == nullptr || !reader.readValue(*field, candidate))
+        {
+            if (invalidField != nullptr)
+            {
+                *invalidField = field != nullptr ? field->name : "unknown";
+            }
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+
+    return update(candidate, invalidField);
+}
+
+std::string ConfigStore::toJson() const
+{
+    const Settings settings = snapshot();
+
+    std::string out = "{";
+    char        number[24];
+    for (const ConfigField& field : kSchema)
+    {
+        if (field.secret)
+        {
+            continue;
+        }
+        if (out.size() > 1)
+        {
+            out.push_back(',');
+        }
+        appendJsonString(out, field.name);
+        out.push_back(':');
+
+        const void* value = member(settings, field);
+        switch (field.type)
+        {
+            case ConfigType::Bool:
+                out += *static_cast<const bool*>(value) ? "true" : "false";
+                break;
+            case ConfigType::Int:
+                std::snprintf(number, sizeof(number), "%ld", static_cast<long>(*static_cast<const int32_t*>(value)));
+                out += number;
+                break;
+            case ConfigType::Float:
+                std::snprintf(number, sizeof(number), "%g", static_cast<double>(*static_cast<const float*>(value)));
+                out += number;
+                break;
+            case ConfigType::String:
+                appendJsonString(out, static_cast<const char*>(value));
+                break;
+        }
+    }
+    out.push_back('}');
+    return out;
+}
+
+void ConfigStore::scheduleCommitLocked()
+{
+    if (commitTimer_ == nullptr)
+    {
+        return;
+    }
+
+    const int64_t nowUs = esp_timer_get_time();
+    if (!esp_timer_is_active(commitTimer_))
+    {
+        firstDirtyUs_ = nowUs;
+        esp_timer_start_once(commitTimer_, static_cast<uint64_t>(config_.debounceMs) * 1000);
+        return;
+    }
+
+    // Keep pushing the commit back while changes arrive, but not past
+    // maxDelayMs after the first unsaved one.
+    const int64_t deadlineUs = firstDirtyUs_ + static_cast<int64_t>(config_.maxDelayMs) * 1000;
+    const int64_t debouncedUs = nowUs + static_cast<int64_t>(config_.debounceMs) * 1000;
+    if (debouncedUs <= deadlineUs)
+    {
+        esp_timer_restart(commitTimer_, static_cast<uint64_t>(config_.debounceMs) * 1000);
+    }
+}
+
+void ConfigStore::commitTimerCallback(void* arg)
+{
+    static_cast<ConfigStore*>(arg)->flush();
+}
+
+esp_err_t ConfigStore::flush()
+{
+    uint32_t dirty = 0;
+    Settings settings{};
+    {
+        LockGuard lock(mutex_);
+        dirty        = dirtyFields_;
+        settings     = current_;
+        dirtyFields_ = 0;
+    }
+    if (dirty == 0)
+    {
+        return ESP_OK;
+    }
+
+    esp_err_t err    = ESP_OK;
+    uint32_t  writes = 0;
+    for (std::size_t i = 0; i < kSchemaSize && err == ESP_OK; ++i)
+    {
+        if ((dirty & (1u << i)) == 0)
+        {
+            continue;
+        }
+        const ConfigField& field = kSchema[i];
+        const void*        value = member(settings, field);
+        if (field.type == ConfigType::String)
+        {
+            err = backend_.writeString(field.key, static_cast<const char*>(value));
+        }
+        else if (field.type == ConfigType::Bool)
+        {
+            err = backend_.writeU32(field.key, *static_cast<const bool*>(value) ? 1u : 0u);
+        }
+        else
+        {
+            uint32_t raw = 0;
+            std::memcpy(&raw, value, sizeof(raw));
+            err = backend_.writeU32(field.key, raw);
+        }
+        ++writes;
+    }
+    if (err == ESP_OK)
+    {
+        err = backend_.commit();
+    }
+
+    LockGuard lock(mutex_);
+    stats_.fieldWrites += writes;
+    if (err != ESP_OK)
+    {
+        // Keep the fields dirty and try again later.
+        dirtyFields_ |= dirty;
+        ++stats_.commitErrors;
+        scheduleCommitLocked();
+        ESP_LOGE(kLogTag, "Settings commit failed: %d", err);
+        return err;
+    }
+
+    ++stats_.commits;
+    ESP_LOGI(kLogTag, "Committed %u setting(s)", static_cast<unsigned>(writes));
+    return ESP_OK;
+}
+
+ConfigStore::Stats ConfigStore::stats() const
+{
+    LockGuard lock(mutex_);
+    return stats_;
+}
@@ -0,0 +1,234 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "nvs.h"
+
+#include "services/wifi/wifi.hh"
+#include "telemetry/motor/motor_controller.h"
+
+/**
+ * @file config_store.hh
+ * @brief Typed, schema-described runtime settings with live apply and
+ *        debounced persistence.
+ *
+ * All settings live in one plain `Settings` struct held in RAM; services get
+ * their values pushed to them through listeners and never read NVS on a hot
+ * path. The schema (`ConfigStore::schema()`) names every field, its storage
+ * key, type, range and the services it affects, and drives validation, the
+ * JSON API and persistence alike.
+ *
+ * Updates are validated as a whole, applied immediately and marked dirty.
+ * Dirty fields are written to the backend in one batch once updates have
+ * been quiet for `debounceMs` (or at the latest `maxDelayMs` after the first
+ * change), so dragging a slider in the UI costs one flash commit, not fifty.
+ */
+
+/**
+ * @brief Every persisted setting, with its default value.
+ */
+struct Settings
+{
+    float   wheelCircumferenceM = 2.1f;
+    float   reductionRatio      = 1.0f;
+    char    apSsid[33]          = "Jarvis-Setup";
+    char    apPassword[65]      = "jarvissetup";
+    int32_t apChannel           = 1;
+    int32_t apMaxConnections    = 4;
+    bool    apHidden            = false;
+
+    MotorController::Config   motorConfig() const;
+    WifiService::SoftApConfig softApConfig() const;
+};
+
+/**
+ * @brief Services a field change must be applied to (bit mask).
+ */
+enum ConfigGroup : uint32_t
+{
+    kConfigGroupMotor  = 1u << 0,
+    kConfigGroupSoftAp = 1u << 1,
+};
+
+enum class ConfigType : uint8_t
+{
+    Bool,
+    Int,
+    Float,
+    String,
+};
+
+/**
+ * @brief Schema entry describing one member of `Settings`.
+ *
+ * For numbers `min`/`max` bound the value; for strings they bound the
+ * length.
+ */
+struct ConfigField
+{
+    const char* name;   ///< JSON name
+    const char* key;    ///< Storage key (NVS keys are at most 15 characters)
+    ConfigType  type;
+    std::size_t offset; ///< offsetof(Settings, member)
+    std::size_t size;   ///< sizeof(member)
+    float       min;
+    float       max;
+    uint32_t    groups;
+    bool        secret; ///< Accepted but never reported back
+};
+
+/**
+ * @brief Persistence behind the store. `NvsConfigBackend` on the device; a
+ *        map-backed stand-in can be used on the host.
+ */
+class ConfigBackend
+{
+public:
+    virtual ~ConfigBackend() = default;
+
+    /**
+     * @return ESP_ERR_NOT_FOUND when the key has never been written.
+     */
+    virtual esp_err_t readU32(const char* key, uint32_t& value)                      = 0;
+    virtual esp_err_t readString(const char* key, char* value, std::size_t capacity) = 0;
+    virtual esp_err_t writeU32(const char* key, uint32_t value)                      = 0;
+    virtual esp_err_t writeString(const char* key, const char* value)                = 0;
+    virtual esp_err_t commit()                                                       = 0;
+};
+
+/**
+ * @brief ConfigBackend over an NVS namespace. initFlash() must have run
+ *        before first use.
+ */
+class NvsConfigBackend : public ConfigBackend
+{
+public:
+    explicit NvsConfigBackend(const char* nvsNamespace = "jarvis") : namespace_(nvsNamespace) {}
+    ~NvsConfigBackend() override;
+
+    /**
+     * @brief Initialises the default NVS partition, erasing it when it is
+     *        full or was written by a newer NVS version. Safe to call again.
+     */
+    static esp_err_t initFlash();
+
+    esp_err_t readU32(const char* key, uint32_t& value) override;
+    esp_err_t readString(const char* key, char* value, std::size_t capacity) override;
+    esp_err_t writeU32(const char* key, uint32_t value) override;
+    esp_err_t writeString(const char* key, const char* value) override;
+    esp_err_t commit() override;
+
+private:
+    esp_err_t ensureOpen();
+
+    const char*  namespace_;
+    nvs_handle_t handle_ = 0;
+    bool         open_   = false;
+};
+
+class ConfigStore
+{
+public:
+    struct Config
+    {
+        uint32_t debounceMs = 2000;
+        uint32_t maxDelayMs = 10000;
+    };
+
+    struct Stats
+    {
+        uint32_t updates      = 0;
+        uint32_t commits      = 0;
+        uint32_t fieldWrites  = 0;
+        uint32_t commitErrors = 0;
+    };
+
+    /**
+     * Called after a change touching any of the subscribed groups, on the
+     * task that made the change.
+     */
+    using Listener = void (*)(void* context, const Settings& settings, uint32_t changedGroups);
+
+    static constexpr std::size_t kMaxListeners = 4;
+
+    explicit ConfigStore(ConfigBackend& backend);
+    ConfigStore(ConfigBackend& backend, const Config& config);
+    ~ConfigStore();
+
+    ConfigStore(const ConfigStore&)            = delete;
+    ConfigStore& operator=(const ConfigStore&) = delete;
+
+    /**
+     * @brief Replaces the in-RAM settings with the persisted ones. Missing
+     *        or invalid stored values keep their defaults.
+     */
+    esp_err_t load();
+
+    Settings snapshot() const;
+
+    esp_err_t subscribe(uint32_t groups, Listener listener, void* context);
+
+    /**
+     * @brief Validates @p candidate, makes it current and notifies
+     *        listeners. Nothing changes if any field is invalid.
+     *
+     * @param invalidField Set to the offending field's name on
+     *                     ESP_ERR_INVALID_ARG.
+     */
+    esp_err_t update(const Settings& candidate, const char** invalidField = nullptr);
+
+    /**
+     * @brief Applies a flat JSON object of `name: value` pairs on top of the
+     *        current settings. Unknown names are rejected.
+     */
+    esp_err_t updateFromJson(const char* json, std::size_t length, const char** invalidField = nullptr);
+
+    /**
+     * @brief Serialises the current settings (secrets omitted) as a JSON
+     *        object.
+     */
+    std::string toJson() const;
+
+    /**
+     * @brief Writes pending changes now instead of waiting for the debounce.
+     */
+    esp_err_t flush();
+
+    Stats stats() const;
+
+    static const ConfigField* schema(std::size_t& count);
+    static const ConfigField* findField(const char* name, std::size_t length);
+    static bool               validate(const ConfigField& field, const Settings& settings);
+
+private:
+    struct Subscription
+    {
+        uint32_t groups;
+        Listener listener;
+        void*    context;
+    };
+
+    static void commitTimerCallback(void* arg);
+    void        scheduleCommitLocked();
+
+    ConfigBackend& backend_;
+    Config         config_{};
+    Settings       current_{};
+    uint32_t       dirtyFields_  = 0;
+    int64_t        firstDirtyUs_ = 0;
+    Stats          stats_{};
+
+    std::array<Subscription, kMaxListeners> subscriptions_{};
+    std::size_t                             subscriptionCount_ = 0;
+
+    mutable SemaphoreHandle_t mutex_       = nullptr;
+    esp_timer_handle_t        commitTimer_ = nullptr;
+};
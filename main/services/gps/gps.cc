@@ -0,0 +1,201 @@
+#include "gps.hh"
+
+#include <algorithm>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "services/mem/mem.hh"
+
+namespace
+{
+constexpr const char* kLogTag          = "GpsService";
+constexpr std::size_t kReadChunk       = 256;
+constexpr uint32_t    kReadTimeoutMs   = 100;
+constexpr uint32_t    kErrorDelayMs    = 10;   ///< First wait after a failed read
+constexpr uint32_t    kErrorDelayMaxMs = 1000; ///< Cap for repeated failures
+constexpr uint32_t    kTaskStack       = 3072;
+constexpr UBaseType_t kTaskPriority    = 4;
+
+class LockGuard
+{
+public:
+    explicit LockGuard(SemaphoreHandle_t mutex) : mutex_(mutex) { xSemaphoreTake(mutex_, portMAX_DELAY); }
+    ~LockGuard() { xSemaphoreGive(mutex_); }
+
+    LockGuard(const LockGuard&)            = delete;
+    LockGuard& operator=(const LockGuard&) = delete;
+
+private:
+    SemaphoreHandle_t mutex_;
+};
+} // namespace
+
+GpsService::GpsService(SerialLink& link) : GpsService(link, Config{}) {}
+
+GpsService::GpsService(SerialLink& link, const Config& config)
+    : link_(link), config_(config), simplifier_(config.track)
+{
+    mutex_ = xSemaphoreCreateMutex();
+    parser_.setFixCallback(&GpsService::onFix, this);
+}
+
+GpsService::~GpsService()
+{
+    stop();
+    if (mutex_ != nullptr)
+    {
+        vSemaphoreDelete(mutex_);
+    }
+    if (taskStopped_ != nullptr)
+    {
+        vSemaphoreDelete(taskStopped_);
+    }
+}
+
+esp_err_t GpsService::start()
+{
+    if (running_)
+    {
+        return ESP_OK;
+    }
+    if (mutex_ == nullptr)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+    if (taskStopped_ == nullptr)
+    {
+        taskStopped_ = xSemaphoreCreateBinary();
+        if (taskStopped_ == nullptr)
+        {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    esp_err_t err = link_.open();
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(kLogTag, "Failed to open receiver link: %d", err);
+        return err;
+    }
+
+    running_ = true;
+    if (xTaskCreate(&GpsService::taskEntry, "gps_rx", kTaskStack, this, kTaskPriority, &task_) != pdPASS)
+    {
+        running_ = false;
+        task_    = nullptr;
+        link_.close();
+        ESP_LOGE(kLogTag, "Failed to create reader task");
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(kLogTag, "GPS started");
+    return ESP_OK;
+}
+
+void GpsService::stop()
+{
+    if (!running_)
+    {
+        return;
+    }
+
+    running_ = false;
+    if (task_ != nullptr)
+    {
+        xSemaphoreTake(taskStopped_, portMAX_DELAY);
+        task_ = nullptr;
+    }
+    link_.close();
+}
+
+void GpsService::setTrackCallback(TrackSimplifier::PointCallback callback, void* context)
+{
+    LockGuard lock(mutex_);
+    simplifier_.setPointCallback(callback, context);
+}
+
+bool GpsService::latestFix(GpsFix& out) const
+{
+    LockGuard lock(mutex_);
+    out = latest_;
+    return latest_.valid;
+}
+
+void GpsService::flushTrack()
+{
+    LockGuard lock(mutex_);
+    simplifier_.flush();
+    simplifier_.reset();
+}
+
+GpsService::Stats GpsService::stats() const
+{
+    LockGuard lock(mutex_);
+    Stats     stats{};
+    stats.parser     = parser_.stats();
+    stats.track      = simplifier_.stats();
+    stats.bytesRead  = bytesRead_;
+    stats.readErrors = readErrors_;
+    return stats;
+}
+
+void GpsService::onFix(void* context, const GpsFix& fix)
+{
+    // Runs on the reader task with mutex_ held.
+    auto* self    = static_cast<GpsService*>(context);
+    self->latest_ = fix;
+
+    if (!fix.valid || fix.speedMmps < self->config_.minSpeedMmps)
+    {
+        // Parked or drifting; stationary jitter would only add points.
+        return;
+    }
+
+    TrackPoint point{};
+    point.latE7     = fix.latE7;
+    point.lonE7     = fix.lonE7;
+    point.timeMs    = static_cast<uint32_t>(esp_timer_get_time() / 1000);
+    point.speedMmps = fix.speedMmps;
+    self->simplifier_.add(point);
+}
+
+void GpsService::taskEntry(void* arg)
+{
+    auto*    self = static_cast<GpsService*>(arg);
+    MemAccounting::setTaskTag(MemTag::Gps);
+    uint8_t  chunk[kReadChunk];
+    uint32_t errorDelayMs = 0;
+
+    while (self->running_)
+    {
+        const int length = self->link_.read(chunk, sizeof(chunk), kReadTimeoutMs);
+        if (length < 0)
+        {
+            // A failed link returns at once; back off instead of spinning
+            if (errorDelayMs == 0)
+            {
+                ESP_LOGW(kLogTag, "Receiver read failed: %d", length);
+            }
+            errorDelayMs = errorDelayMs == 0 ? kErrorDelayMs : std::min(errorDelayMs * 2, kErrorDelayMaxMs);
+            {
+                LockGuard lock(self->mutex_);
+                ++self->readErrors_;
+            }
+            vTaskDelay(pdMS_TO_TICKS(errorDelayMs));
+            continue;
+        }
+        errorDelayMs = 0;
+        if (length == 0)
+        {
+            continue;
+        }
+
+        LockGuard lock(self->mutex_);
+        self->parser_.feed(chunk, static_cast<std::size_t>(length));
+        self->bytesRead_ += static_cast<uint32_t>(length);
+    }
+
+    xSemaphoreGive(self->taskStopped_);
+    vTaskDelete(nullptr);
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#include "services/gps/gps_parser.hh"
+#include "services/gps/track_simplifier.hh"
+#include "services/lte/modem.hh"
+
+/**
+ * @file gps.hh
+ * @brief Declares GpsService, which turns the receiver's serial stream into
+ *        fixes and a simplified track.
+ *
+ * A reader task pulls whatever the UART driver has buffered and hands it to
+ * the streaming parser in place. Valid fixes update the latest-fix snapshot
+ * and are fed to the track simplifier; only the points it keeps reach the
+ * track callback, which is what storage and the uplink should consume.
+ */
+class GpsService
+{
+public:
+    struct Config
+    {
+        TrackSimplifier::Config track{};
+        uint32_t                minSpeedMmps = 500; ///< Fixes slower than this are not added to the track
+    };
+
+    struct Stats
+    {
+        GpsStreamParser::Stats parser{};
+        TrackSimplifier::Stats track{};
+        uint32_t               bytesRead  = 0;
+        uint32_t               readErrors = 0; ///< Failed link reads, each followed by a growing delay
+    };
+
+    explicit GpsService(SerialLink& link);
+    GpsService(SerialLink& link, const Config& config);
+    ~GpsService();
+
+    GpsService(const GpsService&)            = delete;
+    GpsService& operator=(const GpsService&) = delete;
+
+    esp_err_t start();
+    void      stop();
+
+    void setTrackCallback(TrackSimplifier::PointCallback callback, void* context);
+
+    /**
+     * @brief Copies the most recent fix.
+     * @return false if no valid fix has been received yet.
+     */
+    bool latestFix(GpsFix& out) const;
+
+    /**
+     * @brief Closes the current track segment, e.g. at the end of a ride.
+     */
+    void flushTrack();
+
+    Stats stats() const;
+
+private:
+    static void taskEntry(void* arg);
+    static void onFix(void* context, const GpsFix& fix);
+
+    SerialLink&     link_;
+    Config          config_{};
+    GpsStreamParser parser_{};
+    TrackSimplifier simplifier_;
+    GpsFix          latest_{};
+    uint32_t        bytesRead_  = 0;
+    uint32_t        readErrors_ = 0;
+
+    mutable SemaphoreHandle_t mutex_       = nullptr;
+    SemaphoreHandle_t         taskStopped_ = nullptr;
+    TaskHandle_t              task_        = nullptr;
+    volatile bool             running_     = false;
+};
+
+#if CONFIG_JARVIS_GPS && !CONFIG_IDF_TARGET_LINUX
+/**
+ * @return UART settings for the GPS receiver taken from Kconfig.
+ */
+inline UartSerialLink::Config gpsUartConfig()
+{
+    UartSerialLink::Config config{};
+    config.port     = CONFIG_JARVIS_GPS_UART_PORT;
+    config.txGpio   = CONFIG_JARVIS_GPS_TX_GPIO;
+    config.rxGpio   = CONFIG_JARVIS_GPS_RX_GPIO;
+    config.baudRate = CONFIG_JARVIS_GPS_BAUD_RATE;
+    return config;
+}
+#endif
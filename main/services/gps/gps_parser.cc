@@ -0,0 +1,486 @@
+#include "gps_parser.hh"
+
+namespace
+{
+constexpr uint8_t  kUbxSync1      = 0xB5;
+constexpr uint8_t  kUbxSync2      = 0x62;
+constexpr uint8_t  kUbxClassNav   = 0x01;
+constexpr uint8_t  kUbxIdNavPvt   = 0x07;
+constexpr uint16_t kNavPvtLength  = 92;
+constexpr uint16_t kUbxMaxLength  = 1024;
+constexpr uint32_t kMmpsPerKnotE6 = 514444; ///< 1 knot = 514.444 mm/s
+
+constexpr uint32_t tag(char a, char b, char c)
+{
+    return (static_cast<uint32_t>(a) << 16) | (static_cast<uint32_t>(b) << 8) | static_cast<uint32_t>(c);
+}
+
+constexpr uint32_t kTagRmc = tag('R', 'M', 'C');
+constexpr uint32_t kTagGga = tag('G', 'G', 'A');
+
+constexpr uint32_t kPow10[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+
+/**
+ * NAV-PVT fields picked out of the payload as the bytes stream past, in
+ * ascending offset order.
+ */
+struct UbxSlot
+{
+    uint16_t offset;
+    uint8_t  size;
+};
+
+enum NavPvtSlot : uint8_t
+{
+    kSlotItow,
+    kSlotYear,
+    kSlotMonth,
+    kSlotDay,
+    kSlotHour,
+    kSlotMinute,
+    kSlotSecond,
+    kSlotFixType,
+    kSlotFlags,
+    kSlotNumSv,
+    kSlotLon,
+    kSlotLat,
+    kSlotHmsl,
+    kSlotGroundSpeed,
+    kSlotHeading,
+    kSlotPdop,
+    kSlotCount,
+};
+
+constexpr UbxSlot kNavPvtSlots[] = {
+    {0, 4},  // iTOW, ms
+    {4, 2},  // year
+    {6, 1},  // month
+    {7, 1},  // day
+    {8, 1},  // hour
+    {9, 1},  // min
+    {10, 1}, // sec
+    {20, 1}, // fixType
+    {21, 1}, // flags
+    {23, 1}, // numSV
+    {24, 4}, // lon, 1e-7 deg
+    {28, 4}, // lat, 1e-7 deg
+    {36, 4}, // hMSL, mm
+    {60, 4}, // gSpeed, mm/s
+    {64, 4}, // headMot, 1e-5 deg
+    {76, 2}, // pDOP, 0.01
+};
+static_assert(sizeof(kNavPvtSlots) / sizeof(kNavPvtSlots[0]) == kSlotCount, "NAV-PVT slot table out of sync");
+
+int hexValue(uint8_t byte)
+{
+    if (byte >= '0' && byte <= '9')
+    {
+        return byte - '0';
+    }
+    if (byte >= 'A' && byte <= 'F')
+    {
+        return byte - 'A' + 10;
+    }
+    if (byte >= 'a' && byte <= 'f')
+    {
+        return byte - 'a' + 10;
+    }
+    return -1;
+}
+} // namespace
+
+void GpsStreamParser::setFixCallback(FixCallback callback, void* context)
+{
+    callback_ = callback;
+    context_  = context;
+}
+
+void GpsStreamParser::feed(const uint8_t* data, std::size_t length)
+{
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        feed(data[i]);
+    }
+}
+
+void GpsStreamParser::feed(uint8_t byte)
+{
+    switch (state_)
+    {
+        case State::Idle:
+            if (byte == '$')
+            {
+                beginNmea();
+            }
+            else if (byte == kUbxSync1)
+            {
+                state_ = State::UbxSync2;
+            }
+            break;
+
+        case State::NmeaBody:
+            if (byte == '*')
+            {
+                endField();
+                state_ = State::NmeaChecksumHigh;
+            }
+            else if (byte == '$')
+            {
+                beginNmea(); // truncated sentence, resync on the new one
+            }
+            else if (byte == '\r' || byte == '\n' || byte < 0x20 || byte > 0x7E)
+            {
+                state_ = State::Idle;
+            }
+            else
+            {
+                checksum_ ^= byte;
+                if (byte == ',')
+                {
+                    endField();
+                }
+                else
+                {
+                    nmeaChar(byte);
+                }
+            }
+            break;
+
+        case State::NmeaChecksumHigh:
+        {
+            const int nibble = hexValue(byte);
+            received_        = static_cast<uint8_t>(nibble << 4);
+            state_           = nibble < 0 ? State::Idle : State::NmeaChecksumLow;
+            break;
+        }
+
+        case State::NmeaChecksumLow:
+        {
+            const int nibble = hexValue(byte);
+            state_           = State::Idle;
+            if (nibble >= 0 && static_cast<uint8_t>(received_ | nibble) == checksum_)
+            {
+                finishNmea();
+            }
+            else
+            {
+                ++stats_.checksumErrors;
+            }
+            break;
+        }
+
+        case State::UbxSync2:
+            if (byte == kUbxSync2)
+            {
+                ubxCkA_ = 0;
+                ubxCkB_ = 0;
+                state_  = State::UbxClass;
+            }
+            else
+            {
+                state_ = State::Idle;
+                if (byte == '$')
+                {
+                    beginNmea();
+                }
+            }
+            break;
+
+        case State::UbxClass:
+            ubxChecksum(byte);
+            ubxClass_ = byte;
+            state_    = State::UbxId;
+            break;
+
+        case State::UbxId:
+            ubxChecksum(byte);
+            ubxId_ = byte;
+            state_ = State::UbxLength1;
+            break;
+
+        case State::UbxLength1:
+            ubxChecksum(byte);
+            ubxLength_ = byte;
+            state_     = State::UbxLength2;
+            break;
+
+        case State::UbxLength2:
+            ubxChecksum(byte);
+            ubxLength_ = static_cast<uint16_t>(ubxLength_ | (byte << 8));
+            if (ubxLength_ > kUbxMaxLength)
+            {
+                state_ = State::Idle;
+                break;
+            }
+            ubxOffset_   = 0;
+            ubxNextSlot_ = 0;
+            for (uint32_t& slot : ubxSlots_)
+            {
+                slot = 0;
+            }
+            state_ = ubxLength_ == 0 ? State::UbxChecksumA : State::UbxPayload;
+            break;
+
+        case State::UbxPayload:
+            ubxChecksum(byte);
+            ubxPayloadByte(byte);
+            if (++ubxOffset_ == ubxLength_)
+            {
+                state_ = State::UbxChecksumA;
+            }
+            break;
+
+        case State::UbxChecksumA:
+            if (byte == ubxCkA_)
+            {
+                state_ = State::UbxChecksumB;
+            }
+            else
+            {
+                ++stats_.checksumErrors;
+                state_ = State::Idle;
+            }
+            break;
+
+        case State::UbxChecksumB:
+            state_ = State::Idle;
+            if (byte == ubxCkB_)
+            {
+                finishUbx();
+            }
+            else
+            {
+                ++stats_.checksumErrors;
+            }
+            break;
+    }
+}
+
+void GpsStreamParser::beginNmea()
+{
+    state_      = State::NmeaBody;
+    sentence_   = Sentence::Unknown;
+    checksum_   = 0;
+    fieldIndex_ = 0;
+    typeTag_    = 0;
+}
+
+void GpsStreamParser::nmeaChar(uint8_t byte)
+{
+    if (fieldIndex_ == 0)
+    {
+        // Address field, e.g. "GNRMC": only the sentence type matters.
+        typeTag_ = ((typeTag_ << 8) | byte) & 0xFFFFFF;
+        return;
+    }
+    if (fieldIndex_ >= kMaxFields || sentence_ == Sentence::Unknown)
+    {
+        return;
+    }
+
+    Field& field  = fields_[fieldIndex_];
+    field.present = true;
+
+    if (byte >= '0' && byte <= '9')
+    {
+        const uint32_t digit = byte - '0';
+        if (!field.afterPoint)
+        {
+            field.whole = field.whole * 10 + digit;
+        }
+        else if (field.fracDigits < 8)
+        {
+            field.fraction = field.fraction * 10 + digit;
+            ++field.fracDigits;
+        }
+    }
+    else if (byte == '.')
+    {
+        field.afterPoint = true;
+    }
+    else if (byte == '-')
+    {
+        field.negative = true;
+    }
+    else if (field.flag == 0)
+    {
+        field.flag = static_cast<char>(byte);
+    }
+}
+
+void GpsStreamParser::endField()
+{
+    if (fieldIndex_ == 0)
+    {
+        sentence_ = typeTag_ == kTagRmc ? Sentence::Rmc : typeTag_ == kTagGga ? Sentence::Gga : Sentence::Unknown;
+    }
+    if (static_cast<std::size_t>(fieldIndex_) + 1 < kMaxFields)
+    {
+        fields_[fieldIndex_ + 1] = Field{};
+    }
+    ++fieldIndex_;
+}
+
+void GpsStreamParser::finishNmea()
+{
+    ++stats_.sentences;
+    switch (sentence_)
+    {
+        case Sentence::Rmc:
+            applyRmc();
+            break;
+        case Sentence::Gga:
+            applyGga();
+            break;
+        case Sentence::Unknown:
+            break;
+    }
+}
+
+void GpsStreamParser::applyRmc()
+{
+    // $xxRMC,time,status,lat,N/S,lon,E/W,speed(kn),course,date,...
+    if (fieldIndex_ < 10)
+    {
+        return;
+    }
+
+    fix_.timeOfDayMs = timeOfDayMs(fields_[1]);
+    fix_.valid       = fields_[2].flag == 'A';
+    if (fields_[3].present && fields_[5].present)
+    {
+        fix_.latE7 = coordinateE7(fields_[3], fields_[4].flag == 'S');
+        fix_.lonE7 = coordinateE7(fields_[5], fields_[6].flag == 'W');
+    }
+
+    const uint64_t knotsE3 = scaled(fields_[7], 3);
+    fix_.speedMmps         = static_cast<uint32_t>(knotsE3 * kMmpsPerKnotE6 / 1000000ULL);
+    fix_.courseE5          = static_cast<int32_t>(scaled(fields_[8], 5));
+
+    const uint32_t ddmmyy = fields_[9].whole;
+    if (fields_[9].present)
+    {
+        const uint32_t yy = ddmmyy % 100;
+        fix_.dateYmd      = (yy < 80 ? 2000 + yy : 1900 + yy) * 10000 + ((ddmmyy / 100) % 100) * 100 + ddmmyy / 10000;
+    }
+
+    publish();
+}
+
+void GpsStreamParser::applyGga()
+{
+    // $xxGGA,time,lat,N/S,lon,E/W,quality,satellites,hdop,altitude,M,...
+    if (fieldIndex_ < 10)
+    {
+        return;
+    }
+
+    if (fields_[2].present && fields_[4].present)
+    {
+        fix_.latE7 = coordinateE7(fields_[2], fields_[3].flag == 'S');
+        fix_.lonE7 = coordinateE7(fields_[4], fields_[5].flag == 'W');
+    }
+    fix_.fixQuality = static_cast<uint8_t>(fields_[6].whole);
+    fix_.satellites = static_cast<uint8_t>(fields_[7].whole);
+    fix_.hdopCenti  = static_cast<uint16_t>(scaled(fields_[8], 2));
+
+    const int32_t altitudeMm = static_cast<int32_t>(scaled(fields_[9], 3));
+    fix_.altitudeMm          = fields_[9].negative ? -altitudeMm : altitudeMm;
+}
+
+void GpsStreamParser::ubxChecksum(uint8_t byte)
+{
+    ubxCkA_ = static_cast<uint8_t>(ubxCkA_ + byte);
+    ubxCkB_ = static_cast<uint8_t>(ubxCkB_ + ubxCkA_);
+}
+
+void GpsStreamParser::ubxPayloadByte(uint8_t byte)
+{
+    if (ubxClass_ != kUbxClassNav || ubxId_ != kUbxIdNavPvt || ubxLength_ != kNavPvtLength)
+    {
+        return;
+    }
+
+    while (ubxNextSlot_ < kSlotCount)
+    {
+        const UbxSlot& slot = kNavPvtSlots[ubxNextSlot_];
+        if (ubxOffset_ < slot.offset)
+        {
+            return;
+        }
+        if (ubxOffset_ < slot.offset + slot.size)
+        {
+            ubxSlots_[ubxNextSlot_] |= static_cast<uint32_t>(byte) << (8 * (ubxOffset_ - slot.offset));
+            if (ubxOffset_ + 1 == slot.offset + slot.size)
+            {
+                ++ubxNextSlot_;
+            }
+            return;
+        }
+        ++ubxNextSlot_;
+    }
+}
+
+void GpsStreamParser::finishUbx()
+{
+    ++stats_.ubxMessages;
+    if (ubxClass_ != kUbxClassNav || ubxId_ != kUbxIdNavPvt || ubxLength_ != kNavPvtLength)
+    {
+        return;
+    }
+
+    const uint32_t fixType   = ubxSlots_[kSlotFixType];
+    const bool     gnssFixOk = (ubxSlots_[kSlotFlags] & 0x01) != 0;
+    const int32_t  speed     = static_cast<int32_t>(ubxSlots_[kSlotGroundSpeed]);
+
+    fix_.latE7       = static_cast<int32_t>(ubxSlots_[kSlotLat]);
+    fix_.lonE7       = static_cast<int32_t>(ubxSlots_[kSlotLon]);
+    fix_.altitudeMm  = static_cast<int32_t>(ubxSlots_[kSlotHmsl]);
+    fix_.speedMmps   = speed > 0 ? static_cast<uint32_t>(speed) : 0;
+    fix_.courseE5    = static_cast<int32_t>(ubxSlots_[kSlotHeading]);
+    fix_.timeOfDayMs = ((ubxSlots_[kSlotHour] * 60 + ubxSlots_[kSlotMinute]) * 60 + ubxSlots_[kSlotSecond]) * 1000 +
+                       ubxSlots_[kSlotItow] % 1000;
+    fix_.dateYmd     = ubxSlots_[kSlotYear] * 10000 + ubxSlots_[kSlotMonth] * 100 + ubxSlots_[kSlotDay];
+    fix_.pdopCenti   = static_cast<uint16_t>(ubxSlots_[kSlotPdop]);
+    fix_.satellites  = static_cast<uint8_t>(ubxSlots_[kSlotNumSv]);
+    fix_.fixQuality  = fixType >= 2 ? 1 : 0;
+    fix_.valid       = gnssFixOk && fixType >= 2 && fixType <= 4;
+
+    publish();
+}
+
+void GpsStreamParser::publish()
+{
+    ++stats_.fixes;
+    if (callback_ != nullptr)
+    {
+        callback_(context_, fix_);
+    }
+}
+
+int32_t GpsStreamParser::coordinateE7(const Field& field, bool negative)
+{
+    // NMEA coordinates are (d)ddmm.mmmm: whole degrees followed by decimal
+    // minutes.
+    const uint32_t degrees   = field.whole / 100;
+    const uint64_t minutesE5 = static_cast<uint64_t>(field.whole % 100) * 100000 +
+                               (field.fracDigits <= 5 ? static_cast<uint64_t>(field.fraction) * kPow10[5 - field.fracDigits]
+                                                      : field.fraction / kPow10[field.fracDigits - 5]);
+    // minutes * 1e7 / 60 == minutesE5 * 100 / 60
+    const int64_t valueE7 = static_cast<int64_t>(degrees) * 10000000 + static_cast<int64_t>(minutesE5 * 100 / 60);
+    return static_cast<int32_t>(negative ? -valueE7 : valueE7);
+}
+
+uint32_t GpsStreamParser::scaled(const Field& field, uint8_t digits)
+{
+    const uint32_t fraction = field.fracDigits <= digits ? field.fraction * kPow10[digits - field.fracDigits]
+                                                         : field.fraction / kPow10[field.fracDigits - digits];
+    return field.whole * kPow10[digits] + fraction;
+}
+
+uint32_t GpsStreamParser::timeOfDayMs(const Field& field)
+{
+    const uint32_t hhmmss  = field.whole;
+    const uint32_t seconds = (hhmmss / 10000) * 3600 + ((hhmmss / 100) % 100) * 60 + hhmmss % 100;
+    return seconds * 1000 + scaled(Field{0, field.fraction, field.fracDigits}, 3);
+}
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file gps_parser.hh
+ * @brief Incremental NMEA 0183 and UBX parser producing fixed-point fixes.
+ *
+ * Bytes are consumed one at a time straight from the UART buffer. NMEA fields
+ * are converted to integers as their digits arrive and UBX payload fields are
+ * assembled from their byte offsets, so no sentence or payload is ever
+ * buffered and no `strtok`/`atof` style parsing takes place.
+ *
+ * Supported messages: RMC and GGA from any talker (GP, GN, GL, ...) and
+ * UBX NAV-PVT.
+ */
+
+/**
+ * @brief Position fix in integer units.
+ */
+struct GpsFix
+{
+    int32_t  latE7       = 0; ///< Latitude, degrees * 1e7
+    int32_t  lonE7       = 0; ///< Longitude, degrees * 1e7
+    int32_t  altitudeMm  = 0; ///< Height above mean sea level (mm)
+    uint32_t speedMmps   = 0; ///< Ground speed (mm/s)
+    int32_t  courseE5    = 0; ///< Course over ground, degrees * 1e5
+    uint32_t timeOfDayMs = 0; ///< UTC time of day (ms)
+    uint32_t dateYmd     = 0; ///< UTC date as yyyymmdd, 0 when unknown
+    uint16_t hdopCenti   = 0; ///< Horizontal dilution of precision * 100, from GGA; 0 when unknown
+    uint16_t pdopCenti   = 0; ///< Position (3D) dilution of precision * 100, from NAV-PVT; 0 when unknown
+    uint8_t  satellites  = 0;
+    uint8_t  fixQuality  = 0; ///< 0 = none, 1 = GPS, 2 = DGPS, ...
+    bool     valid       = false;
+};
+
+class GpsStreamParser
+{
+public:
+    /**
+     * Invoked whenever a complete, checksum-verified RMC or NAV-PVT message
+     * has updated the fix. GGA only refines altitude, satellites and HDOP.
+     */
+    using FixCallback = void (*)(void* context, const GpsFix& fix);
+
+    struct Stats
+    {
+        uint32_t sentences      = 0; ///< NMEA sentences with a valid checksum
+        uint32_t ubxMessages    = 0; ///< UBX frames with a valid checksum
+        uint32_t checksumErrors = 0;
+        uint32_t fixes          = 0;
+    };
+
+    void setFixCallback(FixCallback callback, void* context);
+
+    void feed(const uint8_t* data, std::size_t length);
+    void feed(uint8_t byte);
+
+    const GpsFix& currentFix() const { return fix_; }
+    const Stats&  stats() const { return stats_; }
+
+private:
+    static constexpr std::size_t kMaxFields = 16;
+
+    enum class State : uint8_t
+    {
+        Idle,
+        NmeaBody,
+        NmeaChecksumHigh,
+        NmeaChecksumLow,
+        UbxSync2,
+        UbxClass,
+        UbxId,
+        UbxLength1,
+        UbxLength2,
+        UbxPayload,
+        UbxChecksumA,
+        UbxChecksumB,
+    };
+
+    enum class Sentence : uint8_t
+    {
+        Unknown,
+        Rmc,
+        Gga,
+    };
+
+    /**
+     * One NMEA field reduced to integers: digits before and after the
+     * decimal point plus the first character for flag fields (N/S/E/W/A/V).
+     */
+    struct Field
+    {
+        uint32_t whole      = 0;
+        uint32_t fraction   = 0;
+        uint8_t  fracDigits = 0;
+        char     flag       = 0;
+        bool     afterPoint = false;
+        bool     negative   = false;
+        bool     present    = false;
+    };
+
+    void beginNmea();
+    void nmeaChar(uint8_t byte);
+    void endField();
+    void finishNmea();
+    void applyRmc();
+    void applyGga();
+
+    void ubxChecksum(uint8_t byte);
+    void ubxPayloadByte(uint8_t byte);
+    void finishUbx();
+    void publish();
+
+    static int32_t  coordinateE7(const Field& field, bool negative);
+    static uint32_t scaled(const Field& field, uint8_t digits);
+    static uint32_t timeOfDayMs(const Field& field);
+
+    State    state_      = State::Idle;
+    Sentence sentence_   = Sentence::Unknown;
+    uint8_t  checksum_   = 0;
+    uint8_t  received_   = 0;
+    uint8_t  fieldIndex_ = 0;
+    uint32_t typeTag_    = 0; ///< Last three characters of the address field
+    Field    fields_[kMaxFields]{};
+
+    static constexpr std::size_t kUbxSlots = 16;
+
+    uint8_t  ubxClass_    = 0;
+    uint8_t  ubxId_       = 0;
+    uint16_t ubxLength_   = 0;
+    uint16_t ubxOffset_   = 0;
+    uint8_t  ubxCkA_      = 0;
+    uint8_t  ubxCkB_      = 0;
+    uint8_t  ubxNextSlot_ = 0;
+    uint32_t ubxSlots_[kUbxSlots]{}; ///< NAV-PVT fields assembled in place
+
+    GpsFix      fix_{};
+    Stats       stats_{};
+    FixCallback callback_ = nullptr;
+    void*       context_  = nullptr;
+};
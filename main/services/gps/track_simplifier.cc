@@ -0,0 +1,126 @@
+#include "track_simplifier.hh"
+
+#include <cmath>
+
+namespace
+{
+constexpr float kCmPerLatE7 = 1.1131949f; ///< One 1e-7 degree of latitude in cm
+constexpr float kPi         = 3.14159265f;
+} // namespace
+
+void TrackSimplifier::setPointCallback(PointCallback callback, void* context)
+{
+    callback_ = callback;
+    context_  = context;
+}
+
+void TrackSimplifier::add(const TrackPoint& point)
+{
+    ++stats_.input;
+
+    if (!haveAnchor_)
+    {
+        setAnchor(point);
+        emit(point);
+        return;
+    }
+
+    const TrackPoint& previous = windowSize_ > 0 ? window_[windowSize_ - 1] : anchor_;
+    const bool        gap      = point.timeMs - previous.timeMs >= config_.maxGapMs;
+
+    if (windowSize_ > 0 && (gap || !windowFits(point)))
+    {
+        // The previous point is the furthest one the current segment can
+        // reach within tolerance; it closes the segment and opens the next.
+        const TrackPoint end = window_[windowSize_ - 1];
+        emit(end);
+        setAnchor(end);
+    }
+
+    if (gap)
+    {
+        // Do not interpolate across signal loss.
+        emit(point);
+        setAnchor(point);
+        return;
+    }
+
+    window_[windowSize_++] = point;
+    if (windowSize_ == kMaxWindow)
+    {
+        const TrackPoint end = window_[windowSize_ - 1];
+        emit(end);
+        setAnchor(end);
+    }
+}
+
+void TrackSimplifier::flush()
+{
+    if (windowSize_ == 0)
+    {
+        return;
+    }
+    const TrackPoint end = window_[windowSize_ - 1];
+    emit(end);
+    setAnchor(end);
+}
+
+void TrackSimplifier::reset()
+{
+    haveAnchor_ = false;
+    windowSize_ = 0;
+}
+
+void TrackSimplifier::emit(const TrackPoint& point)
+{
+    ++stats_.output;
+    if (callback_ != nullptr)
+    {
+        callback_(context_, point);
+    }
+}
+
+void TrackSimplifier::setAnchor(const TrackPoint& point)
+{
+    anchor_     = point;
+    haveAnchor_ = true;
+    windowSize_ = 0;
+    // Local equirectangular projection around the anchor; segments are
+    // short enough that the error is far below the tolerance.
+    cmPerLonE7_ = kCmPerLatE7 * std::cos(static_cast<float>(point.latE7) * 1e-7f * kPi / 180.0f);
+}
+
+bool TrackSimplifier::windowFits(const TrackPoint& end) const
+{
+    const float endX      = static_cast<float>(end.lonE7 - anchor_.lonE7) * cmPerLonE7_;
+    const float endY      = static_cast<float>(end.latE7 - anchor_.latE7) * kCmPerLatE7;
+    const float tolerance = static_cast<float>(config_.toleranceCm);
+
+    for (std::size_t i = 0; i < windowSize_; ++i)
+    {
+        if (crossTrackCm(window_[i], endX, endY) > tolerance)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+float TrackSimplifier::crossTrackCm(const TrackPoint& point, float endX, float endY) const
+{
+    const float x = static_cast<float>(point.lonE7 - anchor_.lonE7) * cmPerLonE7_;
+    const float y = static_cast<float>(point.latE7 - anchor_.latE7) * kCmPerLatE7;
+
+    const float lengthSq = endX * endX + endY * endY;
+    if (lengthSq <= 0.0f)
+    {
+        return std::sqrt(x * x + y * y);
+    }
+
+    // Distance to the segment, clamped to its end points.
+    float t = (x * endX + y * endY) / lengthSq;
+    t       = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+    const float dx = x - t * endX;
+    const float dy = y - t * endY;
+    return std::sqrt(dx * dx + dy * dy);
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file track_simplifier.hh
+ * @brief Online polyline simplification for GPS tracks.
+ *
+ * Implements the opening-window variant of Douglas-Peucker: points are
+ * collected behind an anchor for as long as a straight line from the anchor
+ * to the newest point stays within `toleranceCm` of every collected point.
+ * When it no longer does, the last point that still fitted is emitted and
+ * becomes the new anchor. Every emitted point is therefore within the error
+ * bound of the original track, memory is a fixed window and each point costs
+ * O(window) work. Straight roads collapse to their end points, which is where
+ * the order-of-magnitude reduction comes from.
+ */
+
+struct TrackPoint
+{
+    int32_t  latE7     = 0;
+    int32_t  lonE7     = 0;
+    uint32_t timeMs    = 0;
+    uint32_t speedMmps = 0;
+};
+
+class TrackSimplifier
+{
+public:
+    static constexpr std::size_t kMaxWindow = 64;
+
+    struct Config
+    {
+        uint32_t toleranceCm = 500;       ///< Maximum cross-track error
+        uint32_t maxGapMs    = 30 * 1000; ///< Always keep a point after a gap this long
+    };
+
+    struct Stats
+    {
+        uint32_t input  = 0;
+        uint32_t output = 0;
+    };
+
+    using PointCallback = void (*)(void* context, const TrackPoint& point);
+
+    TrackSimplifier() : TrackSimplifier(Config{}) {}
+    explicit TrackSimplifier(const Config& config) : config_(config) {}
+
+    void setPointCallback(PointCallback callback, void* context);
+
+    void add(const TrackPoint& point);
+
+    /**
+     * @brief Emits the pending end point, e.g. when a ride ends.
+     */
+    void flush();
+
+    /**
+     * @brief Forgets the anchor so the next point starts a new track.
+     */
+    void reset();
+
+    const Stats& stats() const { return stats_; }
+
+private:
+    void  emit(const TrackPoint& point);
+    void  setAnchor(const TrackPoint& point);
+    bool  windowFits(const TrackPoint& end) const;
+    float crossTrackCm(const TrackPoint& point, float endX, float endY) const;
+
+    Config                             config_{};
+    Stats                              stats_{};
+    TrackPoint                         anchor_{};
+    bool                               haveAnchor_ = false;
+    float                              cmPerLonE7_ = 0.0f;
+    std::array<TrackPoint, kMaxWindow> window_{};
+    std::size_t                        windowSize_ = 0;
+    PointCallback                      callback_   = nullptr;
+    void*                              context_    = nullptr;
+};
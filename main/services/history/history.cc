@@ -0,0 +1,478 @@
+#include "history.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "esp_timer.h"
+
+#include "telemetry/motor/motor_controller.h"
+
+namespace
+{
+constexpr uint16_t    kEmpty       = UINT16_MAX; ///< speedDeciKph of a period without telemetry
+constexpr std::size_t kBlockTicks  = 32;         ///< Periods read per lock in raw and edge sweeps
+constexpr std::size_t kMinLttb     = 3;          ///< First, last and one bucket
+constexpr std::size_t kSeriesCount = static_cast<std::size_t>(HistorySeries::Count);
+
+static_assert(TelemetryHistory::kCapacity >= 2, "history must hold at least two periods");
+
+const char* const kSeriesNames[] = {"speed", "power", "voltage", "motorTemp", "controllerTemp"};
+const char* const kSeriesUnits[] = {"km/h", "kW", "V", "C", "C"};
+const char* const kModeNames[]   = {"lttb", "minmax", "raw"};
+
+static_assert(sizeof(kSeriesNames) / sizeof(kSeriesNames[0]) == kSeriesCount, "one name per series");
+
+class LockGuard
+{
+public:
+    explicit LockGuard(SemaphoreHandle_t mutex) : mutex_(mutex) { xSemaphoreTake(mutex_, portMAX_DELAY); }
+    ~LockGuard() { xSemaphoreGive(mutex_); }
+
+    LockGuard(const LockGuard&)            = delete;
+    LockGuard& operator=(const LockGuard&) = delete;
+
+private:
+    SemaphoreHandle_t mutex_;
+};
+
+template <typename T>
+T saturate(float value)
+{
+    const float clamped = std::clamp(std::round(value),
+                                     static_cast<float>(std::numeric_limits<T>::min()),
+                                     static_cast<float>(std::numeric_limits<T>::max()));
+    return static_cast<T>(clamped);
+}
+
+bool emit(TelemetryHistory::PointSink sink, void* context, uint32_t tick, float value,
+          TelemetryHistory::QueryStats& stats)
+{
+    const TelemetryHistory::Point point{tick * TelemetryHistory::kPeriodMs, value};
+    ++stats.points;
+    return sink(context, point);
+}
+
+// Bucket b of @p buckets over [first, first + span), evenly by period
+uint32_t bucketStart(uint32_t first, uint32_t span, std::size_t buckets, std::size_t b)
+{
+    return first + static_cast<uint32_t>(static_cast<uint64_t>(span) * b / buckets);
+}
+} // namespace
+
+TelemetryHistory::TelemetryHistory()
+{
+    mutex_ = xSemaphoreCreateMutex();
+}
+
+TelemetryHistory::~TelemetryHistory()
+{
+    if (mutex_ != nullptr)
+    {
+        vSemaphoreDelete(mutex_);
+    }
+}
+
+void TelemetryHistory::record(const TelemetryState& state)
+{
+    if (mutex_ == nullptr)
+    {
+        return;
+    }
+
+    const uint32_t tick = static_cast<uint32_t>(esp_timer_get_time() / (int64_t{kPeriodMs} * 1000));
+
+    LockGuard lock(mutex_);
+    if (accCount_ != 0 && tick != accTick_)
+    {
+        commitLocked();
+    }
+    if (accCount_ == 0)
+    {
+        accTick_ = tick;
+    }
+    ++accCount_;
+    accSpeed_ += state.data.speedKph;
+    accPower_ += state.data.powerKw;
+    accVolts_ += state.data.voltage;
+    accMotor_ += state.data.motorC;
+    accCtrl_ += state.data.controllerC;
+}
+
+// Stores the averaged period. It waits for the first frame of a later
+// period, so the period in progress is not visible to queries yet.
+void TelemetryHistory::commitLocked()
+{
+    const float n = static_cast<float>(accCount_);
+    Sample      sample{};
+    sample.speedDeciKph = std::min<uint16_t>(saturate<uint16_t>(accSpeed_ / n * 10.0f), kEmpty - 1);
+    sample.powerDecaW   = saturate<int16_t>(accPower_ / n * 100.0f);
+    sample.voltageDeciV = saturate<uint16_t>(accVolts_ / n * 10.0f);
+    sample.motorC       = saturate<int8_t>(accMotor_ / n);
+    sample.controllerC  = saturate<int8_t>(accCtrl_ / n);
+
+    if (!haveData_)
+    {
+        oldestTick_ = accTick_;
+    }
+    else
+    {
+        // Periods without frames become gaps; after a ring's worth of them
+        // nothing older survives anyway
+        const uint32_t gap = std::min<uint32_t>(accTick_ - newestTick_ - 1, kCapacity);
+        for (uint32_t i = 1; i <= gap; ++i)
+        {
+            ring_[(newestTick_ + i) % kCapacity].speedDeciKph = kEmpty;
+        }
+    }
+
+    ring_[accTick_ % kCapacity] = sample;
+    newestTick_                 = accTick_;
+    haveData_                   = true;
+
+    accCount_ = 0;
+    accSpeed_ = accPower_ = accVolts_ = accMotor_ = accCtrl_ = 0.0f;
+}
+
+bool TelemetryHistory::rangeLocked(uint32_t& firstTick, uint32_t& lastTick) const
+{
+    if (!haveData_)
+    {
+        return false;
+    }
+    lastTick  = newestTick_;
+    firstTick = newestTick_ - oldestTick_ >= kCapacity ? newestTick_ - (kCapacity - 1) : oldestTick_;
+    return true;
+}
+
+// Periods the ring has since overwritten read as gaps, so a sweep that
+// races the recorder never mixes laps
+bool TelemetryHistory::readLocked(uint32_t tick, HistorySeries series, float& value) const
+{
+    if (!haveData_ || tick < oldestTick_ || tick > newestTick_ || newestTick_ - tick >= kCapacity)
+    {
+        return false;
+    }
+    const Sample& sample = ring_[tick % kCapacity];
+    if (sample.speedDeciKph == kEmpty)
+    {
+        return false;
+    }
+
+    switch (series)
+    {
+        case HistorySeries::Speed:
+            value = sample.speedDeciKph / 10.0f;
+            break;
+        case HistorySeries::Power:
+            value = sample.powerDecaW / 100.0f;
+            break;
+        case HistorySeries::Voltage:
+            value = sample.voltageDeciV / 10.0f;
+            break;
+        case HistorySeries::MotorTemp:
+            value = sample.motorC;
+            break;
+        case HistorySeries::ControllerTemp:
+            value = sample.controllerC;
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
+void TelemetryHistory::scan(uint32_t firstTick, uint32_t endTick, HistorySeries series, Bucket& bucket,
+                            QueryStats& stats) const
+{
+    bucket = Bucket{};
+    LockGuard lock(mutex_);
+    for (uint32_t tick = firstTick; tick < endTick; ++tick)
+    {
+        float value = 0.0f;
+        ++stats.scanned;
+        if (!readLocked(tick, series, value))
+        {
+            continue;
+        }
+        const Reading reading{tick, value};
+        if (bucket.count == 0 || value < bucket.min.value)
+        {
+            bucket.min = reading;
+        }
+        if (bucket.count == 0 || value > bucket.max.value)
+        {
+            bucket.max = reading;
+        }
+        ++bucket.count;
+        bucket.sumT += tick;
+        bucket.sumV += value;
+    }
+}
+
+esp_err_t TelemetryHistory::query(const Query& query, PointSink sink, void* context, QueryStats* stats) const
+{
+    QueryStats local;
+    QueryStats& out = stats != nullptr ? *stats : local;
+    out             = QueryStats{};
+    if (mutex_ == nullptr || sink == nullptr || static_cast<std::size_t>(query.series) >= kSeriesCount)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint32_t first = 0;
+    uint32_t last  = 0;
+    {
+        LockGuard lock(mutex_);
+        if (!rangeLocked(first, last))
+        {
+            return ESP_ERR_NOT_FOUND;
+        }
+    }
+    first = std::max(first, query.fromMs / kPeriodMs);
+    last  = std::min(last, query.toMs / kPeriodMs);
+    if (first > last)
+    {
+        return ESP_ERR_NOT_FOUND;
+    }
+    out.fromMs = first * kPeriodMs;
+    out.toMs   = last * kPeriodMs;
+
+    switch (query.mode)
+    {
+        case Downsample::MinMax:
+            return queryMinMax(first, last, query, sink, context, out);
+        case Downsample::Lttb:
+            return queryLttb(first, last, query, sink, context, out);
+        case Downsample::Raw:
+        default:
+            return queryRaw(first, last, query, sink, context, out);
+    }
+}
+
+esp_err_t TelemetryHistory::queryRaw(uint32_t first, uint32_t last, const Query& query, PointSink sink,
+                                     void* context, QueryStats& stats) const
+{
+    Reading buffer[kBlockTicks];
+    for (uint64_t block = first; block <= last; block += kBlockTicks)
+    {
+        const uint32_t end   = static_cast<uint32_t>(std::min<uint64_t>(block + kBlockTicks, uint64_t{last} + 1));
+        std::size_t    count = 0;
+        {
+            LockGuard lock(mutex_);
+            for (uint32_t tick = static_cast<uint32_t>(block); tick < end; ++tick)
+            {
+                float value = 0.0f;
+                ++stats.scanned;
+                if (readLocked(tick, query.series, value))
+                {
+                    buffer[count++] = Reading{tick, value};
+                }
+            }
+        }
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (!emit(sink, context, buffer[i].tick, buffer[i].value, stats))
+            {
+                return ESP_FAIL;
+            }
+        }
+    }
+    return stats.points == 0 ? ESP_ERR_NOT_FOUND : ESP_OK;
+}
+
+esp_err_t TelemetryHistory::queryMinMax(uint32_t first, uint32_t last, const Query& query, PointSink sink,
+                                        void* context, QueryStats& stats) const
+{
+    const uint32_t    span    = last - first + 1;
+    const std::size_t buckets = std::max<std::size_t>(query.points / 2, 1);
+    if (span <= query.points)
+    {
+        return queryRaw(first, last, query, sink, context, stats);
+    }
+
+    for (std::size_t b = 0; b < buckets; ++b)
+    {
+        Bucket bucket;
+        scan(bucketStart(first, span, buckets, b), bucketStart(first, span, buckets, b + 1), query.series, bucket,
+             stats);
+        if (bucket.count == 0)
+        {
+            continue;
+        }
+        const Reading& early = bucket.min.tick <= bucket.max.tick ? bucket.min : bucket.max;
+        const Reading& late  = bucket.min.tick <= bucket.max.tick ? bucket.max : bucket.min;
+        if (!emit(sink, context, early.tick, early.value, stats))
+        {
+            return ESP_FAIL;
+        }
+        if (late.tick != early.tick && !emit(sink, context, late.tick, late.value, stats))
+        {
+            return ESP_FAIL;
+        }
+    }
+    return stats.points == 0 ? ESP_ERR_NOT_FOUND : ESP_OK;
+}
+
+esp_err_t TelemetryHistory::queryLttb(uint32_t first, uint32_t last, const Query& query, PointSink sink,
+                                      void* context, QueryStats& stats) const
+{
+    const std::size_t points = std::max(query.points, kMinLttb);
+    if (last - first + 1 <= points)
+    {
+        return queryRaw(first, last, query, sink, context, stats);
+    }
+
+    // Anchors: the first and last stored samples in range
+    Reading start{};
+    Reading end{};
+    bool    haveStart = false;
+    bool    haveEnd   = false;
+    for (uint64_t block = first; block <= last && !haveStart; block += kBlockTicks)
+    {
+        const uint64_t hi = std::min<uint64_t>(block + kBlockTicks, uint64_t{last} + 1);
+        LockGuard      lock(mutex_);
+        for (uint64_t tick = block; tick < hi && !haveStart; ++tick)
+        {
+            ++stats.scanned;
+            start.tick = static_cast<uint32_t>(tick);
+            haveStart  = readLocked(start.tick, query.series, start.value);
+        }
+    }
+    for (uint64_t block = uint64_t{last} + 1; block > first && !haveEnd;)
+    {
+        const uint64_t lo = block > uint64_t{first} + kBlockTicks ? block - kBlockTicks : first;
+        LockGuard      lock(mutex_);
+        for (uint64_t tick = block; tick > lo && !haveEnd; --tick)
+        {
+            ++stats.scanned;
+            end.tick = static_cast<uint32_t>(tick - 1);
+            haveEnd  = readLocked(end.tick, query.series, end.value);
+        }
+        block = lo;
+    }
+    if (!haveStart || !haveEnd)
+    {
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (!emit(sink, context, start.tick, start.value, stats))
+    {
+        return ESP_FAIL;
+    }
+    if (end.tick == start.tick)
+    {
+        return ESP_OK;
+    }
+
+    // Interior periods, split evenly into the buckets between the anchors
+    const uint32_t    inner   = start.tick + 1;
+    const uint32_t    span    = end.tick - inner;
+    const std::size_t buckets = points - 2;
+    double            aT      = start.tick;
+    double            aV      = start.value;
+
+    for (std::size_t b = 0; b < buckets && span > 0; ++b)
+    {
+        const uint32_t lo = bucketStart(inner, span, buckets, b);
+        const uint32_t hi = bucketStart(inner, span, buckets, b + 1);
+        if (lo == hi)
+        {
+            continue;
+        }
+
+        // Third vertex: the next bucket's average, or the end anchor
+        double cT = end.tick;
+        double cV = end.value;
+        if (b + 1 < buckets)
+        {
+            Bucket next;
+            scan(hi, bucketStart(inner, span, buckets, b + 2), query.series, next, stats);
+            if (next.count != 0)
+            {
+                cT = next.sumT / next.count;
+                cV = next.sumV / next.count;
+            }
+        }
+
+        bool    found    = false;
+        Reading best{};
+        double  bestArea = -1.0;
+        {
+            LockGuard lock(mutex_);
+            for (uint32_t tick = lo; tick < hi; ++tick)
+            {
+                float value = 0.0f;
+                ++stats.scanned;
+                if (!readLocked(tick, query.series, value))
+                {
+                    continue;
+                }
+                // Twice the triangle's area; only the comparison matters
+                const double area = std::fabs((aT - cT) * (value - aV) - (aT - tick) * (cV - aV));
+                if (area > bestArea)
+                {
+                    bestArea = area;
+                    best     = Reading{tick, value};
+                    found    = true;
+                }
+            }
+        }
+        if (!found)
+        {
+            continue;
+        }
+        if (!emit(sink, context, best.tick, best.value, stats))
+        {
+            return ESP_FAIL;
+        }
+        aT = best.tick;
+        aV = best.value;
+    }
+
+    return emit(sink, context, end.tick, end.value, stats) ? ESP_OK : ESP_FAIL;
+}
+
+bool TelemetryHistory::parseSeries(const char* name, HistorySeries& series)
+{
+    for (std::size_t i = 0; i < kSeriesCount; ++i)
+    {
+        if (std::strcmp(name, kSeriesNames[i]) == 0)
+        {
+            series = static_cast<HistorySeries>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool TelemetryHistory::parseMode(const char* name, Downsample& mode)
+{
+    for (std::size_t i = 0; i < sizeof(kModeNames) / sizeof(kModeNames[0]); ++i)
+    {
+        if (std::strcmp(name, kModeNames[i]) == 0)
+        {
+            mode = static_cast<Downsample>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* TelemetryHistory::seriesName(HistorySeries series)
+{
+    const std::size_t index = static_cast<std::size_t>(series);
+    return index < kSeriesCount ? kSeriesNames[index] : "unknown";
+}
+
+const char* TelemetryHistory::seriesUnit(HistorySeries series)
+{
+    const std::size_t index = static_cast<std::size_t>(series);
+    return index < kSeriesCount ? kSeriesUnits[index] : "";
+}
+
+const char* TelemetryHistory::modeName(Downsample mode)
+{
+    const std::size_t index = static_cast<std::size_t>(mode);
+    return index < sizeof(kModeNames) / sizeof(kModeNames[0]) ? kModeNames[index] : "unknown";
+}
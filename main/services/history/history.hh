@@ -0,0 +1,172 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+struct TelemetryState;
+
+/**
+ * @file history.hh
+ * @brief Declares TelemetryHistory, the recent telemetry kept for charts,
+ *        and the downsampling queries that read it.
+ *
+ * Frames are averaged into one 8-byte sample per CONFIG_JARVIS_HISTORY_PERIOD_MS
+ * in a ring covering the last CONFIG_JARVIS_HISTORY_MINUTES, held inline
+ * (28.8 KB at the defaults). Time is implicit in the ring position, so
+ * periods without telemetry are stored as gaps rather than timestamps.
+ *
+ * A query asks for one series over a time range at a target point count
+ * and gets back only what a chart of that width can show:
+ *
+ *   - Lttb: Largest-Triangle-Three-Buckets. Keeps the first and last
+ *     sample and, from each bucket in between, the one spanning the largest
+ *     triangle with the point kept before it and the average of the next
+ *     bucket. Preserves the visual shape, peaks included.
+ *   - MinMax: the lowest and highest sample of each bucket, in time order.
+ *     Exact envelope, twice the points per bucket.
+ *   - Raw: every stored sample, for comparison.
+ *
+ * Queries sweep the range front to back with constant memory; LTTB reads
+ * each sample at most twice (as part of the next bucket's average, then as
+ * a candidate). Points go to a sink as they are chosen, so the HTTP handler
+ * streams them out in chunks. The ring lock is held per bucket, never while
+ * the sink runs.
+ */
+
+enum class HistorySeries : uint8_t
+{
+    Speed,          ///< km/h
+    Power,          ///< kW, negative while regenerating
+    Voltage,        ///< V
+    MotorTemp,      ///< °C
+    ControllerTemp, ///< °C
+    Count,
+};
+
+enum class Downsample : uint8_t
+{
+    Lttb,
+    MinMax,
+    Raw,
+};
+
+class TelemetryHistory
+{
+public:
+    static constexpr uint32_t    kPeriodMs = CONFIG_JARVIS_HISTORY_PERIOD_MS;
+    static constexpr std::size_t kCapacity = CONFIG_JARVIS_HISTORY_MINUTES * 60 * 1000 / kPeriodMs;
+
+    struct Point
+    {
+        uint32_t uptimeMs = 0; ///< Start of the sample's period
+        float    value    = 0.0f;
+    };
+
+    /**
+     * Receives the chosen points in time order. Return false to abandon the
+     * query, e.g. when the client went away.
+     */
+    using PointSink = bool (*)(void* context, const Point& point);
+
+    struct Query
+    {
+        HistorySeries series = HistorySeries::Speed;
+        Downsample    mode   = Downsample::Lttb;
+        uint32_t      fromMs = 0;          ///< Uptime, clamped to what is stored
+        uint32_t      toMs   = UINT32_MAX; ///< Uptime, inclusive
+        std::size_t   points = 300;        ///< Target; Raw ignores it, MinMax rounds down to even
+    };
+
+    struct QueryStats
+    {
+        uint32_t fromMs  = 0; ///< Range actually covered
+        uint32_t toMs    = 0;
+        uint32_t scanned = 0; ///< Samples read, counting re-reads
+        uint32_t points  = 0; ///< Points handed to the sink
+    };
+
+    TelemetryHistory();
+    ~TelemetryHistory();
+
+    TelemetryHistory(const TelemetryHistory&)            = delete;
+    TelemetryHistory& operator=(const TelemetryHistory&) = delete;
+
+    /**
+     * @brief Folds one frame into the current period. Constant time, no
+     *        allocation; call it from the telemetry callback.
+     */
+    void record(const TelemetryState& state);
+
+    /**
+     * @return ESP_ERR_NOT_FOUND when nothing is stored in the range,
+     *         ESP_FAIL when the sink gave up.
+     */
+    esp_err_t query(const Query& query, PointSink sink, void* context, QueryStats* stats = nullptr) const;
+
+    static bool        parseSeries(const char* name, HistorySeries& series);
+    static bool        parseMode(const char* name, Downsample& mode);
+    static const char* seriesName(HistorySeries series);
+    static const char* seriesUnit(HistorySeries series);
+    static const char* modeName(Downsample mode);
+
+private:
+    struct Sample
+    {
+        uint16_t speedDeciKph; ///< kEmpty marks a period without telemetry
+        int16_t  powerDecaW;
+        uint16_t voltageDeciV;
+        int8_t   motorC;
+        int8_t   controllerC;
+    };
+    static_assert(sizeof(Sample) == 8, "history samples are 8 bytes");
+
+    // A stored value at its period index
+    struct Reading
+    {
+        uint32_t tick  = 0;
+        float    value = 0.0f;
+    };
+
+    // Aggregate of the stored samples in a run of periods
+    struct Bucket
+    {
+        uint32_t count = 0;
+        double   sumT  = 0.0; ///< Period indices
+        double   sumV  = 0.0;
+        Reading  min{};
+        Reading  max{};
+    };
+
+    void commitLocked();
+    bool rangeLocked(uint32_t& firstTick, uint32_t& lastTick) const;
+    bool readLocked(uint32_t tick, HistorySeries series, float& value) const;
+    void scan(uint32_t firstTick, uint32_t endTick, HistorySeries series, Bucket& bucket, QueryStats& stats) const;
+
+    esp_err_t queryRaw(uint32_t first, uint32_t last, const Query& query, PointSink sink, void* context,
+                       QueryStats& stats) const;
+    esp_err_t queryMinMax(uint32_t first, uint32_t last, const Query& query, PointSink sink, void* context,
+                          QueryStats& stats) const;
+    esp_err_t queryLttb(uint32_t first, uint32_t last, const Query& query, PointSink sink, void* context,
+                        QueryStats& stats) const;
+
+    SemaphoreHandle_t mutex_      = nullptr;
+    Sample            ring_[kCapacity]{};
+    bool              haveData_   = false;
+    uint32_t          oldestTick_ = 0; ///< First period ever committed
+    uint32_t          newestTick_ = 0; ///< Last committed period
+
+    // The period being averaged
+    uint32_t accTick_  = 0;
+    uint32_t accCount_ = 0;
+    float    accSpeed_ = 0.0f;
+    float    accPower_ = 0.0f;
+    float    accVolts_ = 0.0f;
+    float    accMotor_ = 0.0f;
+    float    accCtrl_  = 0.0f;
+};
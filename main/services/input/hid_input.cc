@@ -0,0 +1,423 @@
+#include "hid_input.hh"
+
+#if CONFIG_JARVIS_HID_INPUT
+
+#include <algorithm>
+
+#include "driver/gpio.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "services/mem/mem.hh"
+
+namespace
+{
+constexpr const char* kLogTag            = "HidInput";
+constexpr uint32_t    kDispatchStackSize = 3072;
+constexpr UBaseType_t kDispatchPriority  = 14; ///< Above CAN dispatch; a key press is the latency-critical input
+constexpr std::size_t kKeySlots          = 6;
+constexpr uint8_t     kFirstModifier     = 0xE0;
+constexpr uint8_t     kLastModifier      = 0xE7;
+constexpr uint8_t     kErrorRollOver     = 0x01;
+} // namespace
+
+HidInputService::HidInputService(const Config& config) : config_(config)
+{
+    if (config_.debounceMs == 0)
+    {
+        config_.debounceMs = 1;
+    }
+}
+
+HidInputService::~HidInputService()
+{
+    stop();
+    if (taskStopped_ != nullptr)
+    {
+        vSemaphoreDelete(taskStopped_);
+    }
+}
+
+esp_err_t HidInputService::addButton(const HidButton& button)
+{
+    if (isRunning())
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!GPIO_IS_VALID_GPIO(button.gpio))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (buttonCount_ >= kMaxButtons)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+
+    Button& slot = buttons_[buttonCount_];
+    slot.config  = button;
+    slot.owner   = this;
+    slot.index   = static_cast<uint8_t>(buttonCount_);
+    ++buttonCount_;
+    return ESP_OK;
+}
+
+void HidInputService::setSink(ReportSink sink, void* context)
+{
+    sink_        = sink;
+    sinkContext_ = context;
+}
+
+esp_err_t HidInputService::start()
+{
+    if (isRunning())
+    {
+        return ESP_OK;
+    }
+    if (sink_ == nullptr || buttonCount_ == 0)
+    {
+        ESP_LOGW(kLogTag, "No report sink or buttons, HID input not started");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (taskStopped_ == nullptr)
+    {
+        taskStopped_ = xSemaphoreCreateBinary();
+        if (taskStopped_ == nullptr)
+        {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    // Another driver may have installed the shared GPIO ISR service already.
+    esp_err_t err = gpio_install_isr_service(0);
+    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE)
+    {
+        ESP_LOGE(kLogTag, "Failed to install GPIO ISR service: %s", esp_err_to_name(err));
+        return err;
+    }
+
+    // Edge interrupts are not a light-sleep wake source, so a parked chip
+    // would miss presses; keep it awake while buttons are live.
+    if (powerClient_ == kNoPowerClient)
+    {
+        powerClient_ = PowerManager::registerClient("hid", kPowerNeedNone, kPowerNeedNone);
+    }
+    PowerManager::setNeeds(powerClient_, kPowerNeedAwake, kPowerNeedAwake);
+
+    pendingKeys_ = 0;
+    sentKeys_    = 0;
+    running_.store(true, std::memory_order_release);
+    if (xTaskCreate(&HidInputService::dispatchTask, "hid_input", kDispatchStackSize, this, kDispatchPriority, &task_) !=
+        pdPASS)
+    {
+        running_.store(false, std::memory_order_release);
+        task_ = nullptr;
+        PowerManager::setNeeds(powerClient_, kPowerNeedNone, kPowerNeedNone);
+        ESP_LOGE(kLogTag, "Failed to create dispatch task");
+        return ESP_ERR_NO_MEM;
+    }
+
+    for (std::size_t i = 0; i < buttonCount_; ++i)
+    {
+        Button&          button = buttons_[i];
+        const gpio_num_t pin    = static_cast<gpio_num_t>(button.config.gpio);
+
+        gpio_config_t io{};
+        io.pin_bit_mask = 1ULL << button.config.gpio;
+        io.mode         = GPIO_MODE_INPUT;
+        io.pull_up_en   = button.config.activeLow ? GPIO_PULLUP_ENABLE : GPIO_PULLUP_DISABLE;
+        io.pull_down_en = button.config.activeLow ? GPIO_PULLDOWN_DISABLE : GPIO_PULLDOWN_ENABLE;
+        io.intr_type    = GPIO_INTR_ANYEDGE;
+
+        err = gpio_config(&io);
+        if (err == ESP_OK)
+        {
+            // A button held through boot is not reported until released.
+            button.pressed = readPressed(button);
+            button.settling.store(false, std::memory_order_release);
+            err = gpio_isr_handler_add(pin, &HidInputService::onEdge, &button);
+        }
+        if (err != ESP_OK)
+        {
+            ESP_LOGE(kLogTag, "Failed to configure GPIO %d: %s", button.config.gpio, esp_err_to_name(err));
+            stop();
+            return err;
+        }
+    }
+
+    ESP_LOGI(kLogTag,
+             "HID input started with %zu button(s), %u ms debounce",
+             buttonCount_,
+             static_cast<unsigned>(config_.debounceMs));
+    return ESP_OK;
+}
+
+esp_err_t HidInputService::stop()
+{
+    if (!isRunning())
+    {
+        return ESP_OK;
+    }
+
+    for (std::size_t i = 0; i < buttonCount_; ++i)
+    {
+        gpio_isr_handler_remove(static_cast<gpio_num_t>(buttons_[i].config.gpio));
+    }
+
+    running_.store(false, std::memory_order_release);
+    if (task_ != nullptr)
+    {
+        xTaskNotifyGive(task_);
+        xSemaphoreTake(taskStopped_, portMAX_DELAY);
+        task_ = nullptr;
+    }
+    PowerManager::setNeeds(powerClient_, kPowerNeedNone, kPowerNeedNone);
+    return ESP_OK;
+}
+
+HidInputService::Stats HidInputService::stats() const
+{
+    Stats stats;
+    stats.keyEvents  = keyEvents_.load(std::memory_order_relaxed);
+    stats.bounces    = bounces_.load(std::memory_order_relaxed);
+    stats.dropped    = dropped_.load(std::memory_order_relaxed);
+    stats.reports    = reports_.load(std::memory_order_relaxed);
+    stats.coalesced  = coalesced_.load(std::memory_order_relaxed);
+    stats.unsent     = unsent_.load(std::memory_order_relaxed);
+    stats.overBudget = overBudget_.load(std::memory_order_relaxed);
+    stats.maxUs      = maxLatencyUs_.load(std::memory_order_relaxed);
+    stats.p50Us      = std::min(latencyUs_.quantile(0.5f), stats.maxUs);
+    stats.p99Us      = std::min(latencyUs_.quantile(0.99f), stats.maxUs);
+    return stats;
+}
+
+bool HidInputService::readPressed(const Button& button) const
+{
+    const int level = gpio_get_level(static_cast<gpio_num_t>(button.config.gpio));
+    return button.config.activeLow ? level == 0 : level != 0;
+}
+
+void HidInputService::onEdge(void* arg)
+{
+    auto*            button = static_cast<Button*>(arg);
+    HidInputService* self   = button->owner;
+
+    // Contact bounce after an accepted edge; the task re-reads the pin once
+    // the button has settled.
+    if (button->settling.load(std::memory_order_acquire))
+    {
+        self->bounces_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    const int64_t nowUs   = esp_timer_get_time();
+    const bool    pressed = self->readPressed(*button);
+    if (pressed == button->pressed)
+    {
+        return; // Glitch shorter than the interrupt latency
+    }
+
+    button->pressed       = pressed;
+    button->settleUntilUs = nowUs + static_cast<int64_t>(self->config_.debounceMs) * 1000;
+    button->settling.store(true, std::memory_order_release);
+
+    KeyEvent event;
+    event.button  = button->index;
+    event.pressed = pressed;
+    event.timeUs  = static_cast<uint32_t>(nowUs);
+    if (!self->ring_.push(event))
+    {
+        // Left for the task's settle check to pick up as a late change.
+        button->pressed = !pressed;
+        self->dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Also wakes the task to schedule the settle check.
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(self->task_, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+void HidInputService::dispatchTask(void* arg)
+{
+    auto* self = static_cast<HidInputService*>(arg);
+    MemAccounting::setTaskTag(MemTag::Ble);
+
+    while (self->isRunning())
+    {
+        ulTaskNotifyTake(pdTRUE, self->settleTimeout());
+        self->processPending();
+    }
+
+    xSemaphoreGive(self->taskStopped_);
+    vTaskDelete(nullptr);
+}
+
+TickType_t HidInputService::settleTimeout() const
+{
+    const int64_t nowUs    = esp_timer_get_time();
+    int64_t       earliest = INT64_MAX;
+    for (std::size_t i = 0; i < buttonCount_; ++i)
+    {
+        if (buttons_[i].settling.load(std::memory_order_acquire))
+        {
+            earliest = std::min(earliest, buttons_[i].settleUntilUs);
+        }
+    }
+    if (earliest == INT64_MAX)
+    {
+        return portMAX_DELAY;
+    }
+    if (earliest <= nowUs)
+    {
+        return 0;
+    }
+    // Rounded up so the task never wakes before the deadline.
+    const int64_t periodUs = 1000 * portTICK_PERIOD_MS;
+    return static_cast<TickType_t>((earliest - nowUs + periodUs - 1) / periodUs);
+}
+
+void HidInputService::processPending()
+{
+    const uint32_t eventsBefore = keyEvents_.load(std::memory_order_relaxed);
+
+    KeyEvent event;
+    while (ring_.pop(event))
+    {
+        applyEvent(event);
+    }
+
+    // Settled buttons: the last edge may not have been the resting state.
+    const int64_t nowUs = esp_timer_get_time();
+    for (std::size_t i = 0; i < buttonCount_; ++i)
+    {
+        Button& button = buttons_[i];
+        if (!button.settling.load(std::memory_order_acquire) || button.settleUntilUs > nowUs)
+        {
+            continue;
+        }
+
+        bool pressed = readPressed(button);
+        if (pressed == button.pressed)
+        {
+            button.settling.store(false, std::memory_order_release);
+
+            // An edge between the read and the release was ignored; take it
+            // here unless the interrupt has already claimed the button again.
+            pressed      = readPressed(button);
+            bool settled = false;
+            if (pressed == button.pressed ||
+                !button.settling.compare_exchange_strong(settled, true, std::memory_order_acq_rel))
+            {
+                continue;
+            }
+        }
+
+        button.pressed       = pressed;
+        button.settleUntilUs = nowUs + static_cast<int64_t>(config_.debounceMs) * 1000;
+
+        KeyEvent late;
+        late.button  = button.index;
+        late.pressed = pressed;
+        late.timeUs  = static_cast<uint32_t>(nowUs);
+        applyEvent(late);
+    }
+
+    if (pendingKeys_ != sentKeys_)
+    {
+        sendReport();
+    }
+
+    // After the report, so waking the power manager adds no latency to it.
+    if (keyEvents_.load(std::memory_order_relaxed) != eventsBefore)
+    {
+        PowerManager::reportActivity();
+    }
+}
+
+void HidInputService::applyEvent(const KeyEvent& event)
+{
+    keyEvents_.fetch_add(1, std::memory_order_relaxed);
+
+    const uint32_t bit = 1U << event.button;
+    if (((pendingKeys_ ^ sentKeys_) & bit) != 0)
+    {
+        // The report being built already changes this key; this event undoes
+        // it (a tap shorter than one wake-up). Send the first change so the
+        // host still sees the tap.
+        sendReport();
+    }
+
+    if (pendingKeys_ == sentKeys_)
+    {
+        pendingSinceUs_ = event.timeUs;
+    }
+    else
+    {
+        coalesced_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (event.pressed)
+    {
+        pendingKeys_ |= bit;
+    }
+    else
+    {
+        pendingKeys_ &= ~bit;
+    }
+}
+
+void HidInputService::sendReport()
+{
+    JARVIS_NO_ALLOC("hid_report");
+    uint8_t     report[kReportLength] = {};
+    std::size_t slot                  = 0;
+    for (std::size_t i = 0; i < buttonCount_; ++i)
+    {
+        if ((pendingKeys_ & (1U << i)) == 0)
+        {
+            continue;
+        }
+        const uint8_t usage = buttons_[i].config.usage;
+        if (usage >= kFirstModifier && usage <= kLastModifier)
+        {
+            report[0] |= static_cast<uint8_t>(1U << (usage - kFirstModifier));
+        }
+        else if (slot < kKeySlots)
+        {
+            report[2 + slot++] = usage;
+        }
+        else
+        {
+            // More keys than slots: report rollover as the HID spec asks.
+            std::fill(&report[2], &report[2 + kKeySlots], kErrorRollOver);
+        }
+    }
+
+    const bool     sent      = sink_(sinkContext_, report, sizeof(report));
+    const uint32_t latencyUs = static_cast<uint32_t>(esp_timer_get_time()) - pendingSinceUs_;
+    sentKeys_                = pendingKeys_;
+
+    reports_.fetch_add(1, std::memory_order_relaxed);
+    if (!sent)
+    {
+        unsent_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    latencyUs_.record(latencyUs);
+    if (latencyUs > maxLatencyUs_.load(std::memory_order_relaxed))
+    {
+        maxLatencyUs_.store(latencyUs, std::memory_order_relaxed);
+    }
+    if (latencyUs > config_.latencyBudgetUs)
+    {
+        overBudget_.fetch_add(1, std::memory_order_relaxed);
+        ESP_LOGW(kLogTag,
+                 "Report took %u us from key change to notify (budget %u us)",
+                 static_cast<unsigned>(latencyUs),
+                 static_cast<unsigned>(config_.latencyBudgetUs));
+    }
+}
+
+#endif // CONFIG_JARVIS_HID_INPUT
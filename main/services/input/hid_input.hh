@@ -0,0 +1,170 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#include "services/metrics/metrics.hh"
+#include "services/power/power.hh"
+#include "util/spsc_ring.hh"
+
+/**
+ * @file hid_input.hh
+ * @brief Declares HidInputService, which turns handlebar buttons into HID
+ *        keyboard input reports.
+ *
+ * Each button raises a GPIO interrupt on both edges. Debouncing happens in
+ * the interrupt: the first edge after a quiet period is taken as the new
+ * state at once, so a press costs no debounce delay, and further edges are
+ * ignored until the button has settled. The dispatch task then re-reads the
+ * pin in case it came to rest in the other state. Accepted key changes go
+ * from the interrupt through a lock-free ring to the dispatch task, which
+ * folds everything that arrived since its last wake-up into one report.
+ *
+ * Reports leave through a sink, normally BleService::hidReportSink with the
+ * BleService as context. Press-to-notify latency (interrupt to sink return)
+ * is recorded per report and checked against a budget of one connection
+ * interval.
+ *
+ * The service exists only with CONFIG_JARVIS_HID_INPUT, whose options hold
+ * its defaults.
+ */
+
+/**
+ * @brief Button wired to a GPIO and the HID keyboard usage it sends.
+ *
+ * Usages 0xE0-0xE7 (Ctrl, Shift, Alt, GUI) go to the modifier byte; all
+ * others take one of the six key slots.
+ */
+struct HidButton
+{
+    int     gpio      = -1;
+    uint8_t usage     = 0;    ///< HID keyboard usage, e.g. 0x52 (Up Arrow)
+    bool    activeLow = true; ///< Pressed pulls the pin to ground (internal pull-up)
+};
+
+#if CONFIG_JARVIS_HID_INPUT
+class HidInputService
+{
+public:
+    /**
+     * Sends one input report. Returns false when it could not be sent, for
+     * example because no host is connected.
+     */
+    using ReportSink = bool (*)(void* context, const uint8_t* report, std::size_t length);
+
+    static constexpr std::size_t kMaxButtons   = 8;
+    static constexpr std::size_t kReportLength = 8; ///< Modifiers, reserved, six key slots
+    static constexpr std::size_t kRingCapacity = 32;
+
+    struct Config
+    {
+        uint32_t debounceMs      = CONFIG_JARVIS_HID_DEBOUNCE_MS;
+        uint32_t latencyBudgetUs = CONFIG_JARVIS_HID_LATENCY_BUDGET_US;
+    };
+
+    struct Stats
+    {
+        uint32_t keyEvents  = 0; ///< Debounced key changes
+        uint32_t bounces    = 0; ///< Edges ignored while a button settled
+        uint32_t dropped    = 0; ///< Key changes lost because the ring was full
+        uint32_t reports    = 0; ///< Reports handed to the sink
+        uint32_t coalesced  = 0; ///< Key changes that shared a report with an earlier one
+        uint32_t unsent     = 0; ///< Reports the sink could not send
+        uint32_t overBudget = 0; ///< Reports slower than latencyBudgetUs
+        uint32_t p50Us      = 0; ///< Press-to-notify latency
+        uint32_t p99Us      = 0;
+        uint32_t maxUs      = 0;
+    };
+
+    HidInputService() : HidInputService(Config{}) {}
+    explicit HidInputService(const Config& config);
+    ~HidInputService();
+
+    HidInputService(const HidInputService&)            = delete;
+    HidInputService& operator=(const HidInputService&) = delete;
+
+    /**
+     * @brief Adds a button. Must be called before start().
+     * @return ESP_ERR_NO_MEM when kMaxButtons are already registered,
+     *         ESP_ERR_INVALID_ARG for an invalid GPIO.
+     */
+    esp_err_t addButton(const HidButton& button);
+
+    /**
+     * @brief Sets where reports go. Must be called before start().
+     */
+    void setSink(ReportSink sink, void* context);
+
+    /**
+     * @brief Configures the pins and starts the dispatch task.
+     */
+    esp_err_t start();
+    esp_err_t stop();
+
+    Stats stats() const;
+    bool  isRunning() const { return running_.load(std::memory_order_acquire); }
+
+private:
+    struct KeyEvent
+    {
+        uint8_t  button  = 0;
+        bool     pressed = false;
+        uint32_t timeUs  = 0; ///< Low 32 bits of esp_timer at the edge
+    };
+
+    struct Button
+    {
+        HidButton         config{};
+        HidInputService*  owner         = nullptr;
+        uint8_t           index         = 0;
+        bool              pressed       = false; ///< Debounced state; the ISR owns it while not settling
+        std::atomic<bool> settling{false};       ///< Set by the ISR on an accepted edge, cleared by the task
+        int64_t           settleUntilUs = 0;
+    };
+
+    static void onEdge(void* arg);
+    static void dispatchTask(void* arg);
+
+    bool       readPressed(const Button& button) const;
+    void       processPending();
+    TickType_t settleTimeout() const;
+    void       applyEvent(const KeyEvent& event);
+    void       sendReport();
+
+    Config                            config_{};
+    std::array<Button, kMaxButtons>   buttons_{};
+    std::size_t                       buttonCount_ = 0;
+    SpscRing<KeyEvent, kRingCapacity> ring_;
+    ReportSink                        sink_        = nullptr;
+    void*                             sinkContext_ = nullptr;
+
+    // Dispatch task state
+    uint32_t pendingKeys_    = 0; ///< Button bitmask of the report being built
+    uint32_t sentKeys_       = 0; ///< Button bitmask of the last report sent
+    uint32_t pendingSinceUs_ = 0; ///< Earliest key change in the report being built
+
+    LatencyHistogram      latencyUs_{};
+    std::atomic<uint32_t> maxLatencyUs_{0};
+    std::atomic<uint32_t> keyEvents_{0};
+    std::atomic<uint32_t> bounces_{0};
+    std::atomic<uint32_t> dropped_{0};
+    std::atomic<uint32_t> reports_{0};
+    std::atomic<uint32_t> coalesced_{0};
+    std::atomic<uint32_t> unsent_{0};
+    std::atomic<uint32_t> overBudget_{0};
+
+    TaskHandle_t      task_        = nullptr;
+    SemaphoreHandle_t taskStopped_ = nullptr;
+    std::atomic<bool> running_{false};
+    PowerClient       powerClient_ = kNoPowerClient;
+};
+#endif
@@ -0,0 +1,230 @@
+#include "deferred_log.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "services/mem/mem.hh"
+#include "util/mpsc_ring.hh"
+
+namespace
+{
+constexpr const char* kLogTag       = "DeferredLog";
+constexpr std::size_t kFormatCount  = static_cast<std::size_t>(LogFormat::Count);
+constexpr uint32_t    kTaskStack    = 3072;
+constexpr UBaseType_t kTaskPriority = tskIDLE_PRIORITY + 1;
+constexpr TickType_t  kDrainPeriod  = pdMS_TO_TICKS(100);
+constexpr std::size_t kLineBytes    = 256;
+constexpr std::size_t kSpecBytes    = 16;
+
+// Indexed by LogFormat; keep in step with the enum.
+constexpr DeferredLog::FormatInfo kFormats[kFormatCount] = {
+    {"[telemetry:idx%u] rpm=%u speed=%.2f km/h gear=%u voltage=%.2f V power=%.2f kW iq=%.2f A id=%.2f A distance=%.3f km", 0},
+    {"[telemetry] unexpected header 0x%02X", 1000},
+    {"[bms] pack=%.1f V current=%.1f A soc=%u%% cells=%u min=%u mV max=%u mV delta=%u mV mean=%u mV weakest=%u", 0},
+};
+
+struct SiteState
+{
+    std::atomic<uint32_t> lastUs{0};
+    std::atomic<uint32_t> suppressed{0};
+};
+
+MpscRing<LogRecord, CONFIG_JARVIS_DLOG_RECORDS> s_ring;
+SiteState                                       s_sites[kFormatCount];
+std::atomic<uint32_t>                           s_written{0};
+std::atomic<uint32_t>                           s_dropped{0};
+std::atomic<uint32_t>                           s_suppressed{0};
+
+float to_float(uint32_t word)
+{
+    float value;
+    std::memcpy(&value, &word, sizeof(value));
+    return value;
+}
+
+#if CONFIG_JARVIS_DLOG_CONSOLE
+TaskHandle_t s_task = nullptr;
+
+void console_task(void*)
+{
+    MemAccounting::setTaskTag(MemTag::Log);
+    char      line[kLineBytes];
+    LogRecord record{};
+    for (;;)
+    {
+        while (DeferredLog::pop(record))
+        {
+            DeferredLog::format(record, line, sizeof(line));
+            if (record.suppressed > 0)
+            {
+                std::printf("%s (+%u suppressed)\n", line, static_cast<unsigned>(record.suppressed));
+            }
+            else
+            {
+                std::printf("%s\n", line);
+            }
+        }
+        vTaskDelay(kDrainPeriod);
+    }
+}
+#endif
+} // namespace
+
+esp_err_t DeferredLog::start()
+{
+#if CONFIG_JARVIS_DLOG_CONSOLE
+    if (s_task != nullptr)
+    {
+        return ESP_OK;
+    }
+    if (xTaskCreate(&console_task, "dlog", kTaskStack, nullptr, kTaskPriority, &s_task) != pdPASS)
+    {
+        ESP_LOGE(kLogTag, "Failed to start formatting task");
+        return ESP_ERR_NO_MEM;
+    }
+#endif
+    return ESP_OK;
+}
+
+void DeferredLog::writeWords(LogFormat format, const uint32_t* words, std::size_t count)
+{
+    JARVIS_NO_ALLOC("dlog_write");
+    const auto index = static_cast<std::size_t>(format);
+    const auto now   = static_cast<uint32_t>(esp_timer_get_time());
+    SiteState& site  = s_sites[index];
+
+    const uint32_t intervalUs = static_cast<uint32_t>(kFormats[index].minIntervalMs) * 1000;
+    if (intervalUs > 0)
+    {
+        // Two tasks racing here may both get through; the limit is a rate
+        // cap, not an exact quota.
+        const uint32_t last = site.lastUs.load(std::memory_order_relaxed);
+        if (last != 0 && now - last < intervalUs)
+        {
+            site.suppressed.fetch_add(1, std::memory_order_relaxed);
+            s_suppressed.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        site.lastUs.store(now != 0 ? now : 1, std::memory_order_relaxed);
+    }
+
+    const uint32_t suppressed = intervalUs > 0 ? site.suppressed.exchange(0, std::memory_order_relaxed) : 0;
+    const bool     stored     = s_ring.emplace([&](LogRecord& record) {
+        record.timestampUs = now;
+        record.format      = static_cast<uint16_t>(format);
+        record.argCount    = static_cast<uint8_t>(count);
+        record.suppressed  = static_cast<uint8_t>(std::min<uint32_t>(suppressed, UINT8_MAX));
+        std::memcpy(record.args, words, count * sizeof(uint32_t));
+    });
+
+    if (stored)
+    {
+        s_written.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        s_dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+bool DeferredLog::pop(LogRecord& record)
+{
+    return s_ring.pop(record);
+}
+
+std::size_t DeferredLog::format(const LogRecord& record, char* out, std::size_t capacity)
+{
+    if (capacity == 0)
+    {
+        return 0;
+    }
+    if (record.format >= kFormatCount)
+    {
+        return static_cast<std::size_t>(std::snprintf(out, capacity, "<unknown log format %u>", record.format));
+    }
+
+    const char* cursor = kFormats[record.format].format;
+    std::size_t length = 0;
+    std::size_t arg    = 0;
+
+    auto emit = [&](int written) {
+        if (written > 0)
+        {
+            length = std::min(length + static_cast<std::size_t>(written), capacity - 1);
+        }
+    };
+
+    while (*cursor != '\0' && length + 1 < capacity)
+    {
+        if (*cursor != '%')
+        {
+            out[length++] = *cursor++;
+            continue;
+        }
+        if (cursor[1] == '%')
+        {
+            out[length++] = '%';
+            cursor += 2;
+            continue;
+        }
+
+        // Copy one conversion spec and format it with its typed argument.
+        char        spec[kSpecBytes];
+        std::size_t specLength = 0;
+        while (*cursor != '\0' && specLength + 1 < sizeof(spec))
+        {
+            spec[specLength++] = *cursor;
+            if (std::strchr("diuxXcfeEgG", *cursor) != nullptr && specLength > 1)
+            {
+                ++cursor;
+                break;
+            }
+            ++cursor;
+        }
+        spec[specLength] = '\0';
+
+        const uint32_t word       = arg < record.argCount ? record.args[arg] : 0;
+        const char     conversion = spec[specLength - 1];
+        ++arg;
+
+        char* const       target    = out + length;
+        const std::size_t available = capacity - length;
+        if (conversion == 'd' || conversion == 'i')
+        {
+            emit(std::snprintf(target, available, spec, static_cast<int>(static_cast<int32_t>(word))));
+        }
+        else if (std::strchr("feEgG", conversion) != nullptr)
+        {
+            emit(std::snprintf(target, available, spec, static_cast<double>(to_float(word))));
+        }
+        else
+        {
+            emit(std::snprintf(target, available, spec, static_cast<unsigned>(word)));
+        }
+    }
+
+    out[length] = '\0';
+    return length;
+}
+
+const DeferredLog::FormatInfo* DeferredLog::formats(std::size_t& count)
+{
+    count = kFormatCount;
+    return kFormats;
+}
+
+DeferredLog::Stats DeferredLog::stats()
+{
+    Stats stats;
+    stats.written    = s_written.load(std::memory_order_relaxed);
+    stats.dropped    = s_dropped.load(std::memory_order_relaxed);
+    stats.suppressed = s_suppressed.load(std::memory_order_relaxed);
+    return stats;
+}
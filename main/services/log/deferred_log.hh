@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+/**
+ * @file deferred_log.hh
+ * @brief Binary logging for hot paths: record now, format later.
+ *
+ * A log call stores a format ID, a timestamp and up to kMaxArgs raw 32-bit
+ * arguments in a lock-free ring; no string is touched on the caller's
+ * task. Records are turned into text either by a low-priority task
+ * (CONFIG_JARVIS_DLOG_CONSOLE) or on the host from a binary dump fetched at
+ * /api/log (`tools/log_dump.py`).
+ *
+ * Format strings live in one table indexed by LogFormat. They support the
+ * printf conversions d i u x X c f e g (with flags, width and precision but
+ * no length modifiers); floats are stored as float. Each format can carry a
+ * minimum interval: calls arriving sooner are counted but not recorded, and
+ * the next record reports how many were suppressed.
+ */
+
+enum class LogFormat : uint16_t
+{
+    MotorSnapshot,
+    MotorBadHeader,
+    BmsSnapshot,
+    Count,
+};
+
+struct LogRecord
+{
+    static constexpr std::size_t kMaxArgs = 10;
+
+    uint32_t timestampUs;
+    uint16_t format;
+    uint8_t  argCount;
+    uint8_t  suppressed; ///< Calls rate-limited away since this site's previous record (saturates)
+    uint32_t args[kMaxArgs];
+};
+
+class DeferredLog
+{
+public:
+    struct FormatInfo
+    {
+        const char* format;
+        uint16_t    minIntervalMs; ///< 0 records every call
+    };
+
+    struct Stats
+    {
+        uint32_t written    = 0;
+        uint32_t dropped    = 0; ///< Ring full
+        uint32_t suppressed = 0; ///< Rate limited
+    };
+
+    /**
+     * @brief Starts the formatting task when CONFIG_JARVIS_DLOG_CONSOLE is
+     *        set; otherwise records wait for a dump.
+     */
+    static esp_err_t start();
+
+    template <typename... Args>
+    static void write(LogFormat format, Args... args)
+    {
+        static_assert(sizeof...(Args) <= LogRecord::kMaxArgs, "Too many log arguments");
+        const uint32_t words[sizeof...(Args) + 1] = {toWord(args)..., 0};
+        writeWords(format, words, sizeof...(Args));
+    }
+
+    /**
+     * @brief Takes the oldest record. Single consumer: the formatting task,
+     *        or the dump handler when that task is disabled.
+     */
+    static bool pop(LogRecord& record);
+
+    /**
+     * @brief Renders @p record as text (without newline).
+     * @return Length written, excluding the terminator.
+     */
+    static std::size_t format(const LogRecord& record, char* out, std::size_t capacity);
+
+    static const FormatInfo* formats(std::size_t& count);
+    static Stats             stats();
+
+private:
+    static void writeWords(LogFormat format, const uint32_t* words, std::size_t count);
+
+    static uint32_t toWord(float value)
+    {
+        uint32_t word;
+        std::memcpy(&word, &value, sizeof(word));
+        return word;
+    }
+    static uint32_t toWord(double value) { return toWord(static_cast<float>(value)); }
+
+    template <typename T, typename = std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>>>
+    static uint32_t toWord(T value)
+    {
+        return static_cast<uint32_t>(value);
+    }
+};
+
+#define JARVIS_DLOG(format, ...) DeferredLog::write(LogFormat::format, ##__VA_ARGS__)
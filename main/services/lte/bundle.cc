@@ -0,0 +1,233 @@
+#include "bundle.hh"
+
+#include <algorithm>
+#include <cstring>
+
+#include "esp_rom_crc.h"
+
+namespace
+{
+constexpr uint16_t kBundleMagic   = 0x424A; // "JB"
+constexpr uint8_t  kBundleVersion = 1;
+
+constexpr std::size_t kOffsetSequence = 8;
+constexpr std::size_t kOffsetBaseMs   = 12;
+constexpr std::size_t kOffsetCount    = 16;
+
+void putU16(uint8_t* out, uint16_t value)
+{
+    out[0] = static_cast<uint8_t>(value);
+    out[1] = static_cast<uint8_t>(value >> 8);
+}
+
+void putU32(uint8_t* out, uint32_t value)
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        out[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+/**
+ * Appends `value` as a zig-zag varint; small magnitudes of either sign take a
+ * single byte.
+ */
+void putVarint(std::vector<uint8_t>& out, int32_t value)
+{
+    uint32_t zigzag = (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+    while (zigzag >= 0x80)
+    {
+        out.push_back(static_cast<uint8_t>(zigzag | 0x80));
+        zigzag >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(zigzag));
+}
+} // namespace
+
+std::array<int32_t, TelemetrySample::kFieldCount> TelemetrySample::fields() const
+{
+    return {static_cast<int32_t>(uptimeMs),
+            rpm,
+            speedCentiKph,
+            voltageDeciV,
+            powerW,
+            iqCentiAmps,
+            controllerC,
+            motorC,
+            throttle,
+            gear,
+            distanceM};
+}
+
+std::array<int32_t, TrackSample::kFieldCount> TrackSample::fields() const
+{
+    return {static_cast<int32_t>(uptimeMs), latE7, lonE7, speedMmps};
+}
+
+TelemetryBundler::TelemetryBundler(std::size_t maxBundleBytes, std::size_t fieldCount)
+    : maxBundleBytes_(std::max(maxBundleBytes, kHeaderSize + kMaxSampleBytes + kTrailerSize)),
+      fieldCount_(std::min(fieldCount, TelemetrySample::kFieldCount))
+{
+    // seal() swaps the two, and record() appends on the telemetry path: both
+    // must hold a full bundle before the first sample arrives
+    buffer_.reserve(maxBundleBytes_ + kTrailerSize);
+    sealed_.reserve(maxBundleBytes_ + kTrailerSize);
+    reset();
+}
+
+void TelemetryBundler::reset()
+{
+    buffer_.assign(kHeaderSize, 0);
+    previous_.fill(0);
+    count_  = 0;
+    baseMs_ = 0;
+}
+
+bool TelemetryBundler::append(const TelemetrySample& sample)
+{
+    return append(sample.fields().data(), TelemetrySample::kFieldCount);
+}
+
+bool TelemetryBundler::append(const TrackSample& sample)
+{
+    return append(sample.fields().data(), TrackSample::kFieldCount);
+}
+
+// fields[0] is always the uptime
+bool TelemetryBundler::append(const int32_t* fields, std::size_t count)
+{
+    if (count != fieldCount_ || buffer_.size() + kMaxSampleBytes + kTrailerSize > maxBundleBytes_ ||
+        count_ == UINT16_MAX)
+    {
+        return false;
+    }
+
+    if (count_ == 0)
+    {
+        baseMs_ = static_cast<uint32_t>(fields[0]);
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        // Wrapping subtraction keeps the uptime delta correct across overflow.
+        const int32_t delta = static_cast<int32_t>(static_cast<uint32_t>(fields[i]) - static_cast<uint32_t>(previous_[i]));
+        putVarint(buffer_, delta);
+        previous_[i] = fields[i];
+    }
+    ++count_;
+    return true;
+}
+
+const std::vector<uint8_t>& TelemetryBundler::seal()
+{
+    uint8_t* header = buffer_.data();
+    putU16(header, kBundleMagic);
+    header[2] = kBundleVersion;
+    header[3] = static_cast<uint8_t>(fieldCount_);
+    putU32(header + 4, bootId_);
+    putU32(header + kOffsetSequence, sequence_);
+    putU32(header + kOffsetBaseMs, baseMs_);
+    putU16(header + kOffsetCount, count_);
+
+    const uint32_t crc = esp_rom_crc32_le(0, buffer_.data(), buffer_.size());
+    uint8_t        trailer[kTrailerSize];
+    putU32(trailer, crc);
+    buffer_.insert(buffer_.end(), trailer, trailer + kTrailerSize);
+
+    sealed_.swap(buffer_);
+    ++sequence_;
+    reset();
+    return sealed_;
+}
+
+BundleStore::BundleStore(std::size_t capacityBytes) : arena_(capacityBytes, 0) {}
+
+bool BundleStore::push(const uint8_t* data, std::size_t length)
+{
+    const std::size_t needed = kRecordHeader + length;
+    if (data == nullptr || length == 0 || length > UINT16_MAX || needed > arena_.size())
+    {
+        return false;
+    }
+
+    while (arena_.size() - used_ < needed)
+    {
+        pop();
+        ++evicted_;
+    }
+
+    const std::size_t tail = (head_ + used_) % arena_.size();
+    uint8_t           lengthBytes[kRecordHeader];
+    putU16(lengthBytes, static_cast<uint16_t>(length));
+    writeBytes(tail, lengthBytes, kRecordHeader);
+    writeBytes((tail + kRecordHeader) % arena_.size(), data, length);
+
+    used_ += needed;
+    ++count_;
+    return true;
+}
+
+bool BundleStore::peek(std::vector<uint8_t>& out) const
+{
+    if (count_ == 0)
+    {
+        return false;
+    }
+
+    const std::size_t length = recordLength(head_);
+    out.resize(length);
+    readBytes((head_ + kRecordHeader) % arena_.size(), out.data(), length);
+    return true;
+}
+
+void BundleStore::pop()
+{
+    if (count_ == 0)
+    {
+        return;
+    }
+
+    const std::size_t recordSize = kRecordHeader + recordLength(head_);
+    head_                        = (head_ + recordSize) % arena_.size();
+    used_ -= recordSize;
+    --count_;
+    if (count_ == 0)
+    {
+        head_ = 0;
+    }
+}
+
+bool BundleStore::oldestSampleMs(uint32_t& out) const
+{
+    if (count_ == 0 || recordLength(head_) < kOffsetBaseMs + 4)
+    {
+        return false;
+    }
+
+    uint8_t bytes[4];
+    readBytes((head_ + kRecordHeader + kOffsetBaseMs) % arena_.size(), bytes, sizeof(bytes));
+    out = static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8) |
+          (static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+    return true;
+}
+
+std::size_t BundleStore::recordLength(std::size_t offset) const
+{
+    uint8_t lengthBytes[kRecordHeader];
+    readBytes(offset, lengthBytes, kRecordHeader);
+    return static_cast<std::size_t>(lengthBytes[0]) | (static_cast<std::size_t>(lengthBytes[1]) << 8);
+}
+
+void BundleStore::writeBytes(std::size_t offset, const uint8_t* data, std::size_t length)
+{
+    const std::size_t first = std::min(length, arena_.size() - offset);
+    std::memcpy(arena_.data() + offset, data, first);
+    std::memcpy(arena_.data(), data + first, length - first);
+}
+
+void BundleStore::readBytes(std::size_t offset, uint8_t* data, std::size_t length) const
+{
+    const std::size_t first = std::min(length, arena_.size() - offset);
+    std::memcpy(data, arena_.data() + offset, first);
+    std::memcpy(data + first, arena_.data(), length - first);
+}
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @file bundle.hh
+ * @brief Compact, sequence-numbered telemetry bundles and the bounded
+ *        store-and-forward queue that holds them until they are uploaded.
+ *
+ * Bundle wire format (little-endian):
+ *
+ *     magic     u16  'JB'
+ *     version   u8
+ *     fields    u8   number of varint fields per sample: 11 for telemetry
+ *                    (TelemetrySample), 4 for GPS track points (TrackSample)
+ *     bootId    u32  random per boot, lets the server tell sequences apart
+ *     sequence  u32  monotonically increasing per boot and sample kind
+ *     baseMs    u32  uptime of the first sample
+ *     count     u16  number of samples
+ *     payload   ...  per sample, `fields` zig-zag varints holding the delta
+ *                    to the previous sample (the first sample is delta
+ *                    encoded against zero)
+ *     crc32     u32  over everything above
+ *
+ * Telemetry moves slowly between samples, so most deltas fit in one byte and
+ * a sample shrinks from ~40 bytes of floats to ~12 bytes on the wire.
+ */
+
+/**
+ * @brief Integer telemetry sample in fixed units, the unit of bundling.
+ */
+struct TelemetrySample
+{
+    uint32_t uptimeMs      = 0;
+    int32_t  rpm           = 0;
+    int32_t  speedCentiKph = 0;
+    int32_t  voltageDeciV  = 0;
+    int32_t  powerW        = 0;
+    int32_t  iqCentiAmps   = 0;
+    int32_t  controllerC   = 0;
+    int32_t  motorC        = 0;
+    int32_t  throttle      = 0;
+    int32_t  gear          = 0;
+    int32_t  distanceM     = 0;
+
+    static constexpr std::size_t kFieldCount = 11;
+
+    std::array<int32_t, kFieldCount> fields() const;
+};
+
+/**
+ * @brief Point the GPS track simplifier kept, in the units of TrackPoint.
+ */
+struct TrackSample
+{
+    uint32_t uptimeMs  = 0;
+    int32_t  latE7     = 0;
+    int32_t  lonE7     = 0;
+    int32_t  speedMmps = 0;
+
+    static constexpr std::size_t kFieldCount = 4;
+
+    std::array<int32_t, kFieldCount> fields() const;
+};
+
+/**
+ * @brief Incrementally delta-encodes samples into a single bundle buffer.
+ *        A bundler holds one kind of sample, chosen at construction.
+ */
+class TelemetryBundler
+{
+public:
+    static constexpr std::size_t kHeaderSize     = 18;
+    static constexpr std::size_t kTrailerSize    = 4;
+    static constexpr std::size_t kMaxSampleBytes = TelemetrySample::kFieldCount * 5;
+
+    explicit TelemetryBundler(std::size_t maxBundleBytes = 1024,
+                              std::size_t fieldCount     = TelemetrySample::kFieldCount);
+
+    void setBootId(uint32_t bootId) { bootId_ = bootId; }
+
+    /**
+     * @brief Appends a sample.
+     * @return false when the bundle has no room left; seal it and retry.
+     *         Also false for a sample of the other kind.
+     */
+    bool append(const TelemetrySample& sample);
+    bool append(const TrackSample& sample);
+
+    /**
+     * @brief Finalises the header and CRC of the open bundle.
+     * @return View of the sealed bytes, valid until the next append/seal.
+     */
+    const std::vector<uint8_t>& seal();
+
+    bool        empty() const { return count_ == 0; }
+    std::size_t sampleCount() const { return count_; }
+    std::size_t sizeBytes() const { return buffer_.size(); }
+    uint32_t    firstSampleMs() const { return baseMs_; }
+    uint32_t    nextSequence() const { return sequence_; }
+
+private:
+    void reset();
+    bool append(const int32_t* fields, std::size_t count);
+
+    // Room for the widest sample kind
+    using FieldArray = std::array<int32_t, TelemetrySample::kFieldCount>;
+    static_assert(TrackSample::kFieldCount <= TelemetrySample::kFieldCount, "FieldArray must fit every sample kind");
+
+    std::size_t          maxBundleBytes_;
+    std::size_t          fieldCount_;
+    std::vector<uint8_t> buffer_;
+    std::vector<uint8_t> sealed_;
+    FieldArray           previous_{};
+    uint32_t             bootId_   = 0;
+    uint32_t             sequence_ = 0;
+    uint32_t             baseMs_   = 0;
+    uint16_t             count_    = 0;
+};
+
+/**
+ * @brief Bounded FIFO of sealed bundles backed by a fixed byte arena.
+ *
+ * When a new bundle does not fit, the oldest bundles are evicted so that the
+ * most recent data survives a long coverage gap. Memory use never exceeds the
+ * arena size chosen at construction.
+ */
+class BundleStore
+{
+public:
+    explicit BundleStore(std::size_t capacityBytes);
+
+    /**
+     * @brief Queues a copy of `data`, evicting the oldest bundles if needed.
+     * @return false when the bundle is larger than the whole arena.
+     */
+    bool push(const uint8_t* data, std::size_t length);
+
+    /**
+     * @brief Copies the oldest bundle into `out` without removing it.
+     */
+    bool peek(std::vector<uint8_t>& out) const;
+
+    /**
+     * @brief Removes the oldest bundle after a confirmed upload.
+     */
+    void pop();
+
+    /**
+     * @brief Reads the first-sample uptime from the oldest bundle's header,
+     *        i.e. when that bundle was opened.
+     * @return false when the store is empty.
+     */
+    bool oldestSampleMs(uint32_t& out) const;
+
+    std::size_t count() const { return count_; }
+    std::size_t usedBytes() const { return used_; }
+    std::size_t capacityBytes() const { return arena_.size(); }
+    uint32_t    evicted() const { return evicted_; }
+
+private:
+    static constexpr std::size_t kRecordHeader = 2;
+
+    void        writeBytes(std::size_t offset, const uint8_t* data, std::size_t length);
+    void        readBytes(std::size_t offset, uint8_t* data, std::size_t length) const;
+    std::size_t recordLength(std::size_t offset) const;
+
+    std::vector<uint8_t> arena_;
+    std::size_t          head_    = 0; ///< Offset of the oldest record
+    std::size_t          used_    = 0;
+    std::size_t          count_   = 0;
+    uint32_t             evicted_ = 0;
+};
@@ -0,0 +1,363 @@
+#include "lte.hh"
+
+#include <algorithm>
+#include <cmath>
+
+#include "esp_log.h"
+#include "esp_random.h"
+#include "esp_timer.h"
+
+#include "services/gps/track_simplifier.hh"
+#include "services/mem/mem.hh"
+#include "telemetry/motor/motor_controller.h"
+
+namespace
+{
+constexpr const char* kLogTag       = "LteService";
+constexpr uint32_t    kTickMs       = 1000;
+constexpr uint32_t    kTaskStack    = 4096;
+constexpr UBaseType_t kTaskPriority = 3;
+
+uint32_t uptimeMs()
+{
+    return static_cast<uint32_t>(esp_timer_get_time() / 1000);
+}
+
+class LockGuard
+{
+public:
+    explicit LockGuard(SemaphoreHandle_t mutex) : mutex_(mutex) { xSemaphoreTake(mutex_, portMAX_DELAY); }
+    ~LockGuard() { xSemaphoreGive(mutex_); }
+
+    LockGuard(const LockGuard&)            = delete;
+    LockGuard& operator=(const LockGuard&) = delete;
+
+private:
+    SemaphoreHandle_t mutex_;
+};
+} // namespace
+
+LteService::LteService(UplinkTransport& transport) : LteService(transport, Config{}) {}
+
+LteService::LteService(UplinkTransport& transport, const Config& config)
+    : transport_(transport),
+      config_(config),
+      bundler_(config.bundleBytes),
+      trackBundler_(config.bundleBytes, TrackSample::kFieldCount),
+      store_(config.storeBytes)
+{
+    mutex_        = xSemaphoreCreateMutex();
+    sessionMutex_ = xSemaphoreCreateMutex();
+    const uint32_t bootId = esp_random();
+    bundler_.setBootId(bootId);
+    trackBundler_.setBootId(bootId);
+}
+
+LteService::~LteService()
+{
+    stop();
+    if (mutex_ != nullptr)
+    {
+        vSemaphoreDelete(mutex_);
+    }
+    if (sessionMutex_ != nullptr)
+    {
+        vSemaphoreDelete(sessionMutex_);
+    }
+    if (taskStopped_ != nullptr)
+    {
+        vSemaphoreDelete(taskStopped_);
+    }
+}
+
+esp_err_t LteService::start()
+{
+    if (running_)
+    {
+        return ESP_OK;
+    }
+    if (mutex_ == nullptr || sessionMutex_ == nullptr)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+    if (taskStopped_ == nullptr)
+    {
+        taskStopped_ = xSemaphoreCreateBinary();
+        if (taskStopped_ == nullptr)
+        {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    running_ = true;
+    if (xTaskCreate(&LteService::taskEntry, "lte_uplink", kTaskStack, this, kTaskPriority, &task_) != pdPASS)
+    {
+        running_ = false;
+        task_    = nullptr;
+        ESP_LOGE(kLogTag, "Failed to create uplink task");
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(kLogTag,
+             "Uplink started store=%u B threshold=%u B",
+             static_cast<unsigned>(store_.capacityBytes()),
+             static_cast<unsigned>(config_.uploadThresholdBytes));
+    return ESP_OK;
+}
+
+void LteService::stop()
+{
+    if (!running_)
+    {
+        return;
+    }
+
+    running_ = false;
+    if (task_ != nullptr)
+    {
+        xTaskNotifyGive(task_);
+        xSemaphoreTake(taskStopped_, portMAX_DELAY);
+        task_ = nullptr;
+    }
+}
+
+void LteService::record(const TelemetryState& state)
+{
+    record(toSample(state, uptimeMs()));
+}
+
+void LteService::record(const TelemetrySample& sample)
+{
+    JARVIS_NO_ALLOC("lte_record");
+    LockGuard lock(mutex_);
+
+    if (haveSample_ && sample.uptimeMs - lastSampleMs_ < config_.sampleIntervalMs)
+    {
+        return;
+    }
+
+    if (bundler_.empty())
+    {
+        bundleOpenedMs_ = sample.uptimeMs;
+    }
+    if (!bundler_.append(sample))
+    {
+        sealLocked(bundler_);
+        bundleOpenedMs_ = sample.uptimeMs;
+        bundler_.append(sample);
+    }
+
+    lastSampleMs_ = sample.uptimeMs;
+    haveSample_   = true;
+    ++stats_.samplesRecorded;
+}
+
+void LteService::record(const TrackPoint& point)
+{
+    TrackSample sample;
+    sample.uptimeMs  = point.timeMs;
+    sample.latE7     = point.latE7;
+    sample.lonE7     = point.lonE7;
+    sample.speedMmps = static_cast<int32_t>(point.speedMmps);
+
+    JARVIS_NO_ALLOC("lte_track");
+    LockGuard lock(mutex_);
+    if (trackBundler_.empty())
+    {
+        trackOpenedMs_ = sample.uptimeMs;
+    }
+    if (!trackBundler_.append(sample))
+    {
+        sealLocked(trackBundler_);
+        trackOpenedMs_ = sample.uptimeMs;
+        trackBundler_.append(sample);
+    }
+    ++stats_.trackPoints;
+}
+
+void LteService::flush()
+{
+    LockGuard lock(mutex_);
+    sealLocked(bundler_);
+    sealLocked(trackBundler_);
+}
+
+void LteService::sealLocked(TelemetryBundler& bundler)
+{
+    if (bundler.empty())
+    {
+        return;
+    }
+
+    const std::vector<uint8_t>& bundle = bundler.seal();
+    store_.push(bundle.data(), bundle.size());
+    ++stats_.bundlesQueued;
+}
+
+bool LteService::shouldUploadLocked(uint32_t nowMs) const
+{
+    uint32_t oldestMs = 0;
+    if (!store_.oldestSampleMs(oldestMs) || static_cast<int32_t>(nowMs - nextAttemptMs_) < 0)
+    {
+        return false;
+    }
+    return store_.usedBytes() >= config_.uploadThresholdBytes || nowMs - oldestMs >= config_.maxLatencyMs;
+}
+
+void LteService::tick(uint32_t nowMs)
+{
+    bool upload = false;
+    {
+        LockGuard lock(mutex_);
+        if (!bundler_.empty() && nowMs - bundleOpenedMs_ >= config_.maxBundleAgeMs)
+        {
+            sealLocked(bundler_);
+        }
+        if (!trackBundler_.empty() && nowMs - trackOpenedMs_ >= config_.maxBundleAgeMs)
+        {
+            sealLocked(trackBundler_);
+        }
+        upload = shouldUploadLocked(nowMs);
+    }
+
+    if (!upload)
+    {
+        return;
+    }
+
+    const esp_err_t err = runSession(transport_);
+
+    LockGuard lock(mutex_);
+    if (err == ESP_OK)
+    {
+        backoffMs_     = 0;
+        nextAttemptMs_ = nowMs;
+        return;
+    }
+
+    // Exponential backoff with +/-25 % jitter.
+    backoffMs_ = backoffMs_ == 0 ? config_.backoffInitialMs : std::min(backoffMs_ * 2, config_.backoffMaxMs);
+    const uint32_t jitter = backoffMs_ / 4;
+    const uint32_t delay  = backoffMs_ - jitter + (jitter == 0 ? 0 : esp_random() % (2 * jitter));
+    nextAttemptMs_        = nowMs + delay;
+    ESP_LOGW(kLogTag, "Upload session failed (%d), retrying in %u s", err, static_cast<unsigned>(delay / 1000));
+}
+
+esp_err_t LteService::uploadNow()
+{
+    return uploadVia(transport_);
+}
+
+esp_err_t LteService::uploadVia(UplinkTransport& transport)
+{
+    if (sessionMutex_ == nullptr)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+    flush();
+    return runSession(transport);
+}
+
+esp_err_t LteService::runSession(UplinkTransport& transport)
+{
+    LockGuard     session(sessionMutex_);
+    const int64_t startUs = esp_timer_get_time();
+    esp_err_t     err     = transport.connect(config_.connectTimeoutMs);
+
+    std::vector<uint8_t> bundle;
+    std::vector<uint8_t> head;
+    uint32_t             sent  = 0;
+    uint64_t             bytes = 0;
+
+    while (err == ESP_OK)
+    {
+        {
+            LockGuard lock(mutex_);
+            if (!store_.peek(bundle))
+            {
+                break;
+            }
+        }
+
+        err = transport.send(bundle.data(), bundle.size());
+        if (err != ESP_OK)
+        {
+            break;
+        }
+
+        LockGuard lock(mutex_);
+        // The bundle may have been evicted by new data while it was in
+        // flight; only drop it if it is still at the head.
+        if (store_.peek(head) && head == bundle)
+        {
+            store_.pop();
+        }
+        ++sent;
+        bytes += bundle.size();
+    }
+
+    transport.disconnect();
+    const uint64_t radioOnMs = static_cast<uint64_t>((esp_timer_get_time() - startUs) / 1000);
+
+    LockGuard lock(mutex_);
+    ++stats_.sessions;
+    if (err != ESP_OK)
+    {
+        ++stats_.failedSessions;
+    }
+    stats_.bundlesUploaded += sent;
+    stats_.bytesUploaded += bytes;
+    stats_.radioOnMs += radioOnMs;
+
+    ESP_LOGI(kLogTag,
+             "Session %s: %u bundle(s), %u B in %u ms radio-on",
+             err == ESP_OK ? "ok" : "failed",
+             static_cast<unsigned>(sent),
+             static_cast<unsigned>(bytes),
+             static_cast<unsigned>(radioOnMs));
+    return err;
+}
+
+LteService::Stats LteService::stats() const
+{
+    LockGuard lock(mutex_);
+    Stats     stats      = stats_;
+    stats.bundlesEvicted = store_.evicted();
+    stats.queuedBytes    = store_.usedBytes();
+    return stats;
+}
+
+void LteService::taskEntry(void* arg)
+{
+    auto* self = static_cast<LteService*>(arg);
+    MemAccounting::setTaskTag(MemTag::Lte);
+
+    while (self->running_)
+    {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(kTickMs));
+        if (self->running_)
+        {
+            self->tick(uptimeMs());
+        }
+    }
+
+    xSemaphoreGive(self->taskStopped_);
+    vTaskDelete(nullptr);
+}
+
+TelemetrySample LteService::toSample(const TelemetryState& state, uint32_t uptimeMs)
+{
+    TelemetrySample sample{};
+    sample.uptimeMs      = uptimeMs;
+    sample.rpm           = state.data.rpm;
+    sample.speedCentiKph = static_cast<int32_t>(std::lround(state.data.speedKph * 100.0f));
+    sample.voltageDeciV  = static_cast<int32_t>(std::lround(state.data.voltage * 10.0f));
+    sample.powerW        = static_cast<int32_t>(std::lround(state.data.powerKw * 1000.0f));
+    sample.iqCentiAmps   = static_cast<int32_t>(std::lround(state.iqAmps * 100.0f));
+    sample.controllerC   = static_cast<int32_t>(std::lround(state.data.controllerC));
+    sample.motorC        = static_cast<int32_t>(std::lround(state.data.motorC));
+    sample.throttle      = state.data.throttle;
+    sample.gear          = state.data.gear;
+    sample.distanceM     = static_cast<int32_t>(std::lround(state.distanceKm * 1000.0f));
+    return sample;
+}
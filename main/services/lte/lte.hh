@@ -0,0 +1,166 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#include "services/lte/bundle.hh"
+#include "services/lte/modem.hh"
+
+struct TelemetryState;
+struct TrackPoint;
+
+/**
+ * @file lte.hh
+ * @brief Declares LteService, the store-and-forward telemetry uplink.
+ *
+ * Telemetry is decimated, delta-encoded into sequence-numbered bundles and
+ * queued in a bounded RAM store. The radio is kept off and only powered up
+ * when enough data has accumulated (or the oldest bundle is getting stale),
+ * then every queued bundle is sent in one session. Amortising the attach and
+ * HTTP setup cost over many kilobytes is what keeps radio-on time per
+ * kilobyte low. Failed sessions back off exponentially so a coverage gap does
+ * not keep the modem searching for a network.
+ *
+ * GPS track points are bundled the same way, in bundles of their own, and
+ * queued alongside.
+ *
+ * The queue is not tied to the modem: uploadVia() drains it through any
+ * other transport, e.g. the home Wi-Fi when the bike is parked at home.
+ *
+ * The store lives in RAM only. Bundles still queued at a reset or power loss
+ * are lost; the server sees the gap as missing sequence numbers under the
+ * old boot id.
+ */
+class LteService
+{
+public:
+    struct Config
+    {
+        std::size_t storeBytes           = CONFIG_JARVIS_LTE_STORE_KB * 1024;
+        std::size_t bundleBytes          = 1024;
+        uint32_t    sampleIntervalMs     = 1000;           ///< Minimum spacing between recorded samples
+        uint32_t    maxBundleAgeMs       = 60 * 1000;      ///< Seal a partially filled bundle after this
+        std::size_t uploadThresholdBytes = 8 * 1024;       ///< Start a session once this much is queued
+        uint32_t    maxLatencyMs         = 15 * 60 * 1000; ///< ...or once the oldest bundle was opened this long ago
+        uint32_t    connectTimeoutMs     = 60 * 1000;
+        uint32_t    backoffInitialMs     = 30 * 1000;
+        uint32_t    backoffMaxMs         = 30 * 60 * 1000;
+    };
+
+    struct Stats
+    {
+        uint32_t    samplesRecorded = 0;
+        uint32_t    trackPoints     = 0;
+        uint32_t    bundlesQueued   = 0;
+        uint32_t    bundlesUploaded = 0;
+        uint32_t    bundlesEvicted  = 0;
+        uint32_t    sessions        = 0;
+        uint32_t    failedSessions  = 0;
+        uint64_t    bytesUploaded   = 0;
+        uint64_t    radioOnMs       = 0;
+        std::size_t queuedBytes     = 0;
+
+        /**
+         * @return Radio-on milliseconds spent per uploaded kilobyte.
+         */
+        float radioOnMsPerKb() const
+        {
+            return bytesUploaded == 0 ? 0.0f : static_cast<float>(radioOnMs) * 1024.0f / static_cast<float>(bytesUploaded);
+        }
+    };
+
+    explicit LteService(UplinkTransport& transport);
+    LteService(UplinkTransport& transport, const Config& config);
+    ~LteService();
+
+    LteService(const LteService&)            = delete;
+    LteService& operator=(const LteService&) = delete;
+
+    /**
+     * @brief Starts the background task that seals bundles and schedules
+     *        upload sessions.
+     */
+    esp_err_t start();
+    void      stop();
+
+    /**
+     * @brief Records a sample. Samples arriving faster than
+     *        `sampleIntervalMs` are dropped. Safe to call from any task;
+     *        never allocates, so it can run on the telemetry path.
+     */
+    void record(const TelemetrySample& sample);
+    void record(const TelemetryState& state);
+
+    /**
+     * @brief Records a point the GPS track simplifier kept. Every point is
+     *        kept; the simplifier already thinned them. Safe to call from any
+     *        task.
+     */
+    void record(const TrackPoint& point);
+
+    /**
+     * @brief Seals the open bundles so they become eligible for upload.
+     */
+    void flush();
+
+    /**
+     * @brief Runs an upload session immediately, ignoring thresholds and
+     *        backoff.
+     */
+    esp_err_t uploadNow();
+
+    /**
+     * @brief Like uploadNow(), but through @p transport instead of the modem.
+     *        Sessions are serialised, so a bundle is never in flight on both
+     *        transports at once.
+     */
+    esp_err_t uploadVia(UplinkTransport& transport);
+
+    /**
+     * @brief Seals a stale bundle and starts a session when one is due. The
+     *        uplink task runs it every second; call it directly only while
+     *        stopped.
+     */
+    void tick(uint32_t nowMs);
+
+    Stats stats() const;
+
+    /**
+     * @brief Converts the controller telemetry into the integer sample
+     *        representation used on the wire.
+     */
+    static TelemetrySample toSample(const TelemetryState& state, uint32_t uptimeMs);
+
+private:
+    static void taskEntry(void* arg);
+    void        sealLocked(TelemetryBundler& bundler);
+    bool        shouldUploadLocked(uint32_t nowMs) const;
+    esp_err_t   runSession(UplinkTransport& transport);
+
+    UplinkTransport&  transport_;
+    Config            config_{};
+    TelemetryBundler  bundler_;
+    TelemetryBundler  trackBundler_;
+    BundleStore       store_;
+    SemaphoreHandle_t mutex_        = nullptr;
+    SemaphoreHandle_t sessionMutex_ = nullptr; ///< Held for a whole upload session
+    SemaphoreHandle_t taskStopped_  = nullptr;
+    TaskHandle_t      task_         = nullptr;
+    volatile bool     running_      = false;
+
+    uint32_t lastSampleMs_   = 0;
+    bool     haveSample_     = false;
+    uint32_t bundleOpenedMs_ = 0;
+    uint32_t trackOpenedMs_  = 0;
+    uint32_t nextAttemptMs_  = 0;
+    uint32_t backoffMs_      = 0;
+    Stats    stats_{};
+};
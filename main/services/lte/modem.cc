@@ -0,0 +1,322 @@
+#include "modem.hh"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#if !CONFIG_IDF_TARGET_LINUX
+#include "driver/uart.h"
+#endif
+
+namespace
+{
+constexpr const char* kLogTag            = "LteModem";
+constexpr int         kUartRxBufferBytes = 2048;
+constexpr uint32_t    kCommandTimeoutMs  = 2000;
+constexpr uint32_t    kHttpTimeoutMs     = 30000;
+constexpr std::size_t kMaxLineLength     = 256;
+
+uint32_t elapsedMs(int64_t sinceUs)
+{
+    return static_cast<uint32_t>((esp_timer_get_time() - sinceUs) / 1000);
+}
+
+bool startsWith(const std::string& line, const char* prefix)
+{
+    return line.compare(0, std::strlen(prefix), prefix) == 0;
+}
+} // namespace
+
+#if !CONFIG_IDF_TARGET_LINUX
+esp_err_t UartSerialLink::open()
+{
+    if (open_)
+    {
+        return ESP_OK;
+    }
+
+    const auto port = static_cast<uart_port_t>(config_.port);
+
+    uart_config_t uartConfig{};
+    uartConfig.baud_rate  = static_cast<int>(config_.baudRate);
+    uartConfig.data_bits  = UART_DATA_8_BITS;
+    uartConfig.parity     = UART_PARITY_DISABLE;
+    uartConfig.stop_bits  = UART_STOP_BITS_1;
+    uartConfig.flow_ctrl  = UART_HW_FLOWCTRL_DISABLE;
+    uartConfig.source_clk = UART_SCLK_DEFAULT;
+
+    esp_err_t err = uart_driver_install(port, kUartRxBufferBytes, 0, 0, nullptr, 0);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(kLogTag, "uart_driver_install failed: %d", err);
+        return err;
+    }
+
+    err = uart_param_config(port, &uartConfig);
+    if (err == ESP_OK)
+    {
+        err = uart_set_pin(port, config_.txGpio, config_.rxGpio, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
+    }
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(kLogTag, "UART configuration failed: %d", err);
+        uart_driver_delete(port);
+        return err;
+    }
+
+    open_ = true;
+    return ESP_OK;
+}
+
+void UartSerialLink::close()
+{
+    if (!open_)
+    {
+        return;
+    }
+    uart_driver_delete(static_cast<uart_port_t>(config_.port));
+    open_ = false;
+}
+
+int UartSerialLink::write(const uint8_t* data, std::size_t length)
+{
+    if (!open_)
+    {
+        return -1;
+    }
+    return uart_write_bytes(static_cast<uart_port_t>(config_.port), data, length);
+}
+
+int UartSerialLink::read(uint8_t* data, std::size_t capacity, uint32_t timeoutMs)
+{
+    if (!open_)
+    {
+        return -1;
+    }
+    return uart_read_bytes(static_cast<uart_port_t>(config_.port), data, capacity, pdMS_TO_TICKS(timeoutMs));
+}
+#endif
+
+AtModemTransport::AtModemTransport(SerialLink& link, std::string url) : link_(link), url_(std::move(url)) {}
+
+bool AtModemTransport::readLine(std::string& line, uint32_t timeoutMs)
+{
+    line.clear();
+    const int64_t startUs = esp_timer_get_time();
+
+    while (elapsedMs(startUs) < timeoutMs)
+    {
+        uint8_t   byte = 0;
+        const int read = link_.read(&byte, 1, timeoutMs - elapsedMs(startUs));
+        if (read < 0)
+        {
+            return false;
+        }
+        if (read == 0)
+        {
+            continue;
+        }
+
+        if (byte == '\n')
+        {
+            if (!line.empty())
+            {
+                return true;
+            }
+            continue;
+        }
+        if (byte != '\r' && line.size() < kMaxLineLength)
+        {
+            line.push_back(static_cast<char>(byte));
+        }
+    }
+    return false;
+}
+
+esp_err_t AtModemTransport::waitFor(const char* expect, uint32_t timeoutMs, std::string* response)
+{
+    const int64_t startUs = esp_timer_get_time();
+    std::string   line;
+
+    while (elapsedMs(startUs) < timeoutMs)
+    {
+        if (!readLine(line, timeoutMs - elapsedMs(startUs)))
+        {
+            break;
+        }
+        if (startsWith(line, expect))
+        {
+            if (response != nullptr)
+            {
+                *response = line;
+            }
+            return ESP_OK;
+        }
+        if (startsWith(line, "ERROR") || startsWith(line, "+CME ERROR"))
+        {
+            ESP_LOGW(kLogTag, "Modem error while waiting for '%s': %s", expect, line.c_str());
+            return ESP_FAIL;
+        }
+    }
+    return ESP_ERR_TIMEOUT;
+}
+
+esp_err_t AtModemTransport::command(const char* command, const char* expect, uint32_t timeoutMs, std::string* response)
+{
+    const std::size_t length = std::strlen(command);
+    if (link_.write(reinterpret_cast<const uint8_t*>(command), length) != static_cast<int>(length) ||
+        link_.write(reinterpret_cast<const uint8_t*>("\r"), 1) != 1)
+    {
+        return ESP_FAIL;
+    }
+    return waitFor(expect, timeoutMs, response);
+}
+
+esp_err_t AtModemTransport::waitForRegistration(uint32_t timeoutMs)
+{
+    const int64_t startUs = esp_timer_get_time();
+    std::string   response;
+
+    while (elapsedMs(startUs) < timeoutMs)
+    {
+        // +CEREG: <n>,<stat>; 1 = home network, 5 = roaming.
+        if (command("AT+CEREG?", "+CEREG:", kCommandTimeoutMs, &response) == ESP_OK)
+        {
+            const std::size_t comma = response.find(',');
+            if (comma != std::string::npos)
+            {
+                const int stat = std::atoi(response.c_str() + comma + 1);
+                if (stat == 1 || stat == 5)
+                {
+                    waitFor("OK", kCommandTimeoutMs, nullptr);
+                    return ESP_OK;
+                }
+            }
+            waitFor("OK", kCommandTimeoutMs, nullptr);
+        }
+        vTaskDelay(pdMS_TO_TICKS(500));
+    }
+    return ESP_ERR_TIMEOUT;
+}
+
+esp_err_t AtModemTransport::connect(uint32_t timeoutMs)
+{
+    if (connected_)
+    {
+        return ESP_OK;
+    }
+
+    esp_err_t err = link_.open();
+    if (err != ESP_OK)
+    {
+        return err;
+    }
+
+    // The modem may still be booting or autobauding; poke it a few times.
+    err = ESP_ERR_TIMEOUT;
+    for (int attempt = 0; attempt < 5 && err != ESP_OK; ++attempt)
+    {
+        err = command("AT", "OK", 500);
+    }
+    if (err != ESP_OK)
+    {
+        ESP_LOGW(kLogTag, "Modem not responding");
+        return err;
+    }
+
+    command("ATE0", "OK", kCommandTimeoutMs);
+
+    err = command("AT+CFUN=1", "OK", 10000);
+    if (err != ESP_OK)
+    {
+        ESP_LOGW(kLogTag, "Failed to enable radio: %d", err);
+        return err;
+    }
+
+    err = waitForRegistration(timeoutMs);
+    if (err != ESP_OK)
+    {
+        ESP_LOGW(kLogTag, "No network registration within %u ms", static_cast<unsigned>(timeoutMs));
+        disconnect();
+        return err;
+    }
+
+    connected_ = true;
+    return ESP_OK;
+}
+
+void AtModemTransport::disconnect()
+{
+    // Minimum functionality: RF off, SIM kept, fastest to bring back.
+    command("AT+CFUN=0", "OK", 10000);
+    connected_ = false;
+}
+
+esp_err_t AtModemTransport::send(const uint8_t* data, std::size_t length)
+{
+    if (!connected_)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    char commandBuffer[96];
+
+    esp_err_t err = command("AT+HTTPINIT", "OK", kCommandTimeoutMs);
+    if (err != ESP_OK)
+    {
+        // A previous session may have been left open after a timeout.
+        command("AT+HTTPTERM", "OK", kCommandTimeoutMs);
+        err = command("AT+HTTPINIT", "OK", kCommandTimeoutMs);
+        if (err != ESP_OK)
+        {
+            return err;
+        }
+    }
+
+    const std::string urlCommand = "AT+HTTPPARA=\"URL\",\"" + url_ + "\"";
+    err                          = command(urlCommand.c_str(), "OK", kCommandTimeoutMs);
+    if (err == ESP_OK)
+    {
+        err = command("AT+HTTPPARA=\"CONTENT\",\"application/octet-stream\"", "OK", kCommandTimeoutMs);
+    }
+    if (err == ESP_OK)
+    {
+        std::snprintf(commandBuffer, sizeof(commandBuffer), "AT+HTTPDATA=%u,10000", static_cast<unsigned>(length));
+        err = command(commandBuffer, "DOWNLOAD", kCommandTimeoutMs);
+    }
+    if (err == ESP_OK)
+    {
+        err = link_.write(data, length) == static_cast<int>(length) ? waitFor("OK", 10000, nullptr) : ESP_FAIL;
+    }
+
+    std::string actionResult;
+    if (err == ESP_OK)
+    {
+        err = command("AT+HTTPACTION=1", "OK", kCommandTimeoutMs);
+    }
+    if (err == ESP_OK)
+    {
+        // +HTTPACTION: <method>,<status>,<datalen>
+        err = waitFor("+HTTPACTION:", kHttpTimeoutMs, &actionResult);
+    }
+    if (err == ESP_OK)
+    {
+        const std::size_t comma  = actionResult.find(',');
+        const int         status = comma == std::string::npos ? 0 : std::atoi(actionResult.c_str() + comma + 1);
+        if (status < 200 || status >= 300)
+        {
+            ESP_LOGW(kLogTag, "Upload rejected with HTTP status %d", status);
+            err = ESP_FAIL;
+        }
+    }
+
+    command("AT+HTTPTERM", "OK", kCommandTimeoutMs);
+    return err;
+}
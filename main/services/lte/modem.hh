@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+/**
+ * @file modem.hh
+ * @brief Serial link abstraction and an AT-command driven uplink for
+ *        SIMCom-style LTE modules (SIM7600, A7670, ...).
+ *
+ * The modem talks to the rest of the firmware only through `SerialLink`, so
+ * a simulated modem can be attached on the host in place of the UART.
+ */
+
+/**
+ * @brief Byte stream to the modem.
+ */
+class SerialLink
+{
+public:
+    virtual ~SerialLink() = default;
+
+    virtual esp_err_t open()  = 0;
+    virtual void      close() = 0;
+
+    /**
+     * @return Bytes written, or a negative value on error.
+     */
+    virtual int write(const uint8_t* data, std::size_t length) = 0;
+
+    /**
+     * @return Bytes read (0 on timeout), or a negative value on error.
+     */
+    virtual int read(uint8_t* data, std::size_t capacity, uint32_t timeoutMs) = 0;
+};
+
+#if !CONFIG_IDF_TARGET_LINUX
+/**
+ * @brief SerialLink over an ESP-IDF UART port.
+ */
+class UartSerialLink : public SerialLink
+{
+public:
+    struct Config
+    {
+        int      port     = CONFIG_JARVIS_LTE_UART_PORT;
+        int      txGpio   = CONFIG_JARVIS_LTE_TX_GPIO;
+        int      rxGpio   = CONFIG_JARVIS_LTE_RX_GPIO;
+        uint32_t baudRate = CONFIG_JARVIS_LTE_BAUD_RATE;
+    };
+
+    UartSerialLink() : UartSerialLink(Config{}) {}
+    explicit UartSerialLink(const Config& config) : config_(config) {}
+    ~UartSerialLink() override { close(); }
+
+    esp_err_t open() override;
+    void      close() override;
+    int       write(const uint8_t* data, std::size_t length) override;
+    int       read(uint8_t* data, std::size_t capacity, uint32_t timeoutMs) override;
+
+private:
+    Config config_{};
+    bool   open_ = false;
+};
+#endif
+
+/**
+ * @brief Destination for sealed bundles.
+ */
+class UplinkTransport
+{
+public:
+    virtual ~UplinkTransport() = default;
+
+    /**
+     * @brief Powers the radio and waits for network registration.
+     */
+    virtual esp_err_t connect(uint32_t timeoutMs) = 0;
+
+    /**
+     * @brief Puts the radio into its lowest power state.
+     */
+    virtual void disconnect() = 0;
+
+    /**
+     * @brief Delivers one bundle. ESP_OK means the server acknowledged it.
+     */
+    virtual esp_err_t send(const uint8_t* data, std::size_t length) = 0;
+};
+
+/**
+ * @brief Uploads bundles with HTTP POST through the modem's built-in HTTP
+ *        client (AT+HTTP* command set).
+ */
+class AtModemTransport : public UplinkTransport
+{
+public:
+    AtModemTransport(SerialLink& link, std::string url);
+
+    esp_err_t connect(uint32_t timeoutMs) override;
+    void      disconnect() override;
+    esp_err_t send(const uint8_t* data, std::size_t length) override;
+
+    /**
+     * @brief Sends `command` and waits for a line starting with `expect`.
+     *
+     * Lines are matched as they arrive; nothing beyond the current line is
+     * buffered. When `response` is non-null the matching line is copied into
+     * it.
+     */
+    esp_err_t command(const char* command, const char* expect, uint32_t timeoutMs, std::string* response = nullptr);
+
+private:
+    esp_err_t waitFor(const char* expect, uint32_t timeoutMs, std::string* response);
+    bool      readLine(std::string& line, uint32_t timeoutMs);
+    esp_err_t waitForRegistration(uint32_t timeoutMs);
+
+    SerialLink& link_;
+    std::string url_;
+    bool        connected_ = false;
+};
@@ -0,0 +1,367 @@
+#include "mem.hh"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "esp_rom_sys.h"
+#include "multi_heap.h"
+
+namespace
+{
+constexpr std::size_t kTagCount = MemAccounting::kTagCount;
+
+const char* const kTagNames[kTagCount] = {
+    "other", "config", "wifi", "http", "ble", "can", "telemetry", "lte", "gps", "ota", "log",
+};
+
+#if CONFIG_JARVIS_MEM_ACCOUNTING
+constexpr uint16_t kHeaderMagic = 0x4D41; // "MA"
+
+// Keeps the payload at the 8-byte alignment malloc() guarantees
+struct Header
+{
+    uint32_t size;
+    uint8_t  tag;
+    uint8_t  pooled;
+    uint16_t magic;
+};
+static_assert(sizeof(Header) == 8, "header must preserve malloc alignment");
+
+struct Counters
+{
+    std::atomic<uint32_t> live{0};
+    std::atomic<uint32_t> peak{0};
+    std::atomic<uint32_t> blocks{0};
+    std::atomic<uint32_t> allocations{0};
+    std::atomic<uint32_t> overflows{0};
+};
+
+Counters s_counters[kTagCount];
+
+// Per task; read only once the scheduler runs, since static constructors
+// allocate before any task has its TLS area
+thread_local MemTag      t_tag     = MemTag::Other;
+thread_local const char* t_hotSite = nullptr;
+
+std::atomic<bool>        s_sealed{false};
+std::atomic<uint32_t>    s_hotAllocations{0};
+std::atomic<const char*> s_hotSite{nullptr};
+std::atomic<uint8_t>     s_hotTag{0};
+
+#if CONFIG_JARVIS_MEM_STATIC_BUDGET
+// Static pool per subsystem, allocator overhead and block headers
+// included. 0 keeps a subsystem on the shared heap.
+constexpr std::size_t kPoolBytes[kTagCount] = {
+    0,                                         // Other: IDF components and libraries
+    4 * 1024,                                  // Config
+    6 * 1024,                                  // Wifi
+    24 * 1024,                                 // Http: request bodies, JSON and Prometheus text
+    12 * 1024,                                 // Ble: connection and subscriber maps
+    4 * 1024,                                  // Can
+    6 * 1024,                                  // Telemetry: controllers, callbacks, simulator
+    (CONFIG_JARVIS_LTE_STORE_KB + 8) * 1024,   // Lte: the bundle store plus one bundle in flight
+    8 * 1024,                                  // Gps: track simplifier window
+    6 * 1024,                                  // Ota: delta decoder state
+    2 * 1024,                                  // Log
+};
+
+constexpr std::size_t poolTotal()
+{
+    std::size_t total = 0;
+    for (const std::size_t bytes : kPoolBytes)
+    {
+        total += bytes;
+    }
+    return total;
+}
+
+alignas(8) uint8_t s_poolMemory[poolTotal()];
+multi_heap_handle_t s_pools[kTagCount]{};
+portMUX_TYPE        s_poolLocks[kTagCount];
+
+multi_heap_handle_t* pools()
+{
+    // The first allocation happens in a static constructor, before the
+    // scheduler; the guard makes this safe either way
+    static const bool ready = [] {
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i < kTagCount; ++i)
+        {
+            if (kPoolBytes[i] == 0)
+            {
+                continue;
+            }
+            s_pools[i] = multi_heap_register(s_poolMemory + offset, kPoolBytes[i]);
+            portMUX_INITIALIZE(&s_poolLocks[i]);
+            multi_heap_set_lock(s_pools[i], &s_poolLocks[i]);
+            offset += kPoolBytes[i];
+        }
+        return true;
+    }();
+    static_cast<void>(ready);
+    return s_pools;
+}
+#endif
+
+bool schedulerRunning()
+{
+    return xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED;
+}
+
+[[noreturn]] void fail(const char* what, std::size_t size, MemTag tag, const char* site)
+{
+    esp_rom_printf("mem: %s: %u B for %s%s%s\n",
+                   what,
+                   static_cast<unsigned>(size),
+                   kTagNames[static_cast<std::size_t>(tag)],
+                   site != nullptr ? " in " : "",
+                   site != nullptr ? site : "");
+    abort();
+}
+
+void raisePeak(Counters& counters, uint32_t live)
+{
+    uint32_t peak = counters.peak.load(std::memory_order_relaxed);
+    while (live > peak && !counters.peak.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+    {
+    }
+}
+
+void* allocate(std::size_t size)
+{
+    const bool        inTask = schedulerRunning();
+    const MemTag      tag    = inTask ? t_tag : MemTag::Other;
+    const char*       site   = inTask ? t_hotSite : nullptr;
+    const std::size_t index  = static_cast<std::size_t>(tag);
+    Counters&         counts = s_counters[index];
+
+    if (site != nullptr && s_sealed.load(std::memory_order_relaxed))
+    {
+#if CONFIG_JARVIS_MEM_STRICT
+        fail("hot-path allocation", size, tag, site);
+#endif
+        s_hotAllocations.fetch_add(1, std::memory_order_relaxed);
+        s_hotSite.store(site, std::memory_order_relaxed);
+        s_hotTag.store(static_cast<uint8_t>(tag), std::memory_order_relaxed);
+    }
+
+    void* block  = nullptr;
+    bool  pooled = false;
+#if CONFIG_JARVIS_MEM_STATIC_BUDGET
+    const multi_heap_handle_t pool = pools()[index];
+    if (pool != nullptr)
+    {
+        block  = multi_heap_malloc(pool, size + sizeof(Header));
+        pooled = block != nullptr;
+        if (!pooled)
+        {
+#if CONFIG_JARVIS_MEM_STRICT
+            fail("pool exhausted", size, tag, site);
+#endif
+            counts.overflows.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+#endif
+    if (block == nullptr)
+    {
+        block = std::malloc(size + sizeof(Header));
+        if (block == nullptr)
+        {
+            return nullptr;
+        }
+    }
+
+    auto* header   = static_cast<Header*>(block);
+    header->size   = static_cast<uint32_t>(size);
+    header->tag    = static_cast<uint8_t>(index);
+    header->pooled = pooled ? 1 : 0;
+    header->magic  = kHeaderMagic;
+
+    const uint32_t live = counts.live.fetch_add(header->size, std::memory_order_relaxed) + header->size;
+    counts.blocks.fetch_add(1, std::memory_order_relaxed);
+    counts.allocations.fetch_add(1, std::memory_order_relaxed);
+    raisePeak(counts, live);
+    return header + 1;
+}
+
+void release(void* pointer)
+{
+    if (pointer == nullptr)
+    {
+        return;
+    }
+
+    auto* header = static_cast<Header*>(pointer) - 1;
+    if (header->magic != kHeaderMagic || header->tag >= kTagCount)
+    {
+        fail("bad delete", 0, MemTag::Other, nullptr);
+    }
+
+    Counters& counts = s_counters[header->tag];
+    counts.live.fetch_sub(header->size, std::memory_order_relaxed);
+    counts.blocks.fetch_sub(1, std::memory_order_relaxed);
+    header->magic = 0;
+
+#if CONFIG_JARVIS_MEM_STATIC_BUDGET
+    if (header->pooled != 0)
+    {
+        multi_heap_free(pools()[header->tag], header);
+        return;
+    }
+#endif
+    std::free(header);
+}
+#endif
+} // namespace
+
+#if CONFIG_JARVIS_MEM_ACCOUNTING
+void* operator new(std::size_t size)
+{
+    void* pointer = allocate(size);
+    if (pointer == nullptr)
+    {
+        // As the default allocator does without exceptions
+        abort();
+    }
+    return pointer;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    release(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    release(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    release(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+    release(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept
+{
+    release(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept
+{
+    release(pointer);
+}
+
+MemHotPath::MemHotPath(const char* site) : previous_(t_hotSite)
+{
+    t_hotSite = site;
+}
+
+MemHotPath::~MemHotPath()
+{
+    t_hotSite = previous_;
+}
+#endif
+
+void MemAccounting::setTaskTag(MemTag tag)
+{
+#if CONFIG_JARVIS_MEM_ACCOUNTING
+    t_tag = tag;
+#else
+    static_cast<void>(tag);
+#endif
+}
+
+MemTag MemAccounting::taskTag()
+{
+#if CONFIG_JARVIS_MEM_ACCOUNTING
+    return t_tag;
+#else
+    return MemTag::Other;
+#endif
+}
+
+void MemAccounting::sealStartup()
+{
+#if CONFIG_JARVIS_MEM_ACCOUNTING
+    s_sealed.store(true, std::memory_order_relaxed);
+#endif
+}
+
+bool MemAccounting::sealed()
+{
+#if CONFIG_JARVIS_MEM_ACCOUNTING
+    return s_sealed.load(std::memory_order_relaxed);
+#else
+    return false;
+#endif
+}
+
+MemAccounting::TagStats MemAccounting::stats(MemTag tag)
+{
+    TagStats          stats;
+    const std::size_t index = static_cast<std::size_t>(tag);
+    if (index >= kTagCount)
+    {
+        return stats;
+    }
+
+#if CONFIG_JARVIS_MEM_ACCOUNTING
+    const Counters& counts = s_counters[index];
+    stats.liveBytes        = counts.live.load(std::memory_order_relaxed);
+    stats.peakBytes        = counts.peak.load(std::memory_order_relaxed);
+    stats.liveBlocks       = counts.blocks.load(std::memory_order_relaxed);
+    stats.allocations      = counts.allocations.load(std::memory_order_relaxed);
+    stats.overflows        = counts.overflows.load(std::memory_order_relaxed);
+#if CONFIG_JARVIS_MEM_STATIC_BUDGET
+    const multi_heap_handle_t pool = pools()[index];
+    if (pool != nullptr)
+    {
+        stats.poolBytes     = static_cast<uint32_t>(kPoolBytes[index]);
+        stats.poolFreeBytes = static_cast<uint32_t>(multi_heap_free_size(pool));
+        stats.poolMinFree   = static_cast<uint32_t>(multi_heap_minimum_free_size(pool));
+    }
+#endif
+#endif
+    return stats;
+}
+
+MemAccounting::HotPathStats MemAccounting::hotPath()
+{
+    HotPathStats stats;
+#if CONFIG_JARVIS_MEM_ACCOUNTING
+    stats.allocations = s_hotAllocations.load(std::memory_order_relaxed);
+    stats.lastSite    = s_hotSite.load(std::memory_order_relaxed);
+    stats.lastTag     = static_cast<MemTag>(s_hotTag.load(std::memory_order_relaxed));
+#endif
+    return stats;
+}
+
+const char* MemAccounting::tagName(MemTag tag)
+{
+    const std::size_t index = static_cast<std::size_t>(tag);
+    return index < kTagCount ? kTagNames[index] : "unknown";
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "sdkconfig.h"
+
+/**
+ * @file mem.hh
+ * @brief Per-subsystem accounting of C++ heap use, optional static pools
+ *        and a check that hot paths do not allocate.
+ *
+ * With CONFIG_JARVIS_MEM_ACCOUNTING the global operator new and delete are
+ * replaced. Every block carries an 8-byte header with its size and the
+ * subsystem (MemTag) it is charged to, so live and peak bytes per subsystem
+ * are known at any time (GET /api/mem). The tag is per task: a service
+ * task sets it once on entry, and code that allocates on another
+ * subsystem's behalf narrows it with a MemScope.
+ *
+ * With CONFIG_JARVIS_MEM_STATIC_BUDGET each subsystem's blocks come from
+ * its own statically sized pool instead of the shared heap, so a subsystem
+ * that outgrows its budget shows up as pool overflow rather than as less
+ * headroom for everyone else. Untagged allocations (MemTag::Other: IDF
+ * components, libraries) stay on the shared heap. FreeRTOS objects and
+ * driver buffers never go through operator new and are not counted.
+ *
+ * Hot paths are marked with JARVIS_NO_ALLOC(site). Once boot has finished
+ * (sealStartup()), any allocation inside one is counted with its site;
+ * CONFIG_JARVIS_MEM_STRICT aborts instead, and tools/alloc_check.py fails a
+ * bench run on either.
+ *
+ * Without CONFIG_JARVIS_MEM_ACCOUNTING the macros compile to nothing, the
+ * default allocator is used and all statistics read zero.
+ */
+
+enum class MemTag : uint8_t
+{
+    Other,
+    Config,
+    Wifi,
+    Http,
+    Ble,
+    Can,
+    Telemetry,
+    Lte,
+    Gps,
+    Ota,
+    Log,
+    Count,
+};
+
+class MemAccounting
+{
+public:
+    static constexpr std::size_t kTagCount = static_cast<std::size_t>(MemTag::Count);
+
+    struct TagStats
+    {
+        uint32_t liveBytes     = 0; ///< Requested bytes, without headers
+        uint32_t peakBytes     = 0;
+        uint32_t liveBlocks    = 0;
+        uint32_t allocations   = 0;
+        uint32_t poolBytes     = 0; ///< 0 without a static pool
+        uint32_t poolFreeBytes = 0;
+        uint32_t poolMinFree   = 0; ///< Lowest poolFreeBytes since boot
+        uint32_t overflows     = 0; ///< Allocations the pool could not serve
+    };
+
+    struct HotPathStats
+    {
+        uint32_t    allocations = 0; ///< Since sealStartup()
+        const char* lastSite    = nullptr;
+        MemTag      lastTag     = MemTag::Other;
+    };
+
+    /**
+     * @brief Charges the calling task's allocations to @p tag from now on.
+     */
+    static void   setTaskTag(MemTag tag);
+    static MemTag taskTag();
+
+    /**
+     * @brief Ends startup: allocations on hot paths count from here on.
+     */
+    static void sealStartup();
+    static bool sealed();
+
+    static TagStats     stats(MemTag tag);
+    static HotPathStats hotPath();
+    static const char*  tagName(MemTag tag);
+};
+
+#if CONFIG_JARVIS_MEM_ACCOUNTING
+/**
+ * Charges the calling task's allocations to another subsystem for the
+ * enclosing scope.
+ */
+class MemScope
+{
+public:
+    explicit MemScope(MemTag tag) : previous_(MemAccounting::taskTag()) { MemAccounting::setTaskTag(tag); }
+    ~MemScope() { MemAccounting::setTaskTag(previous_); }
+
+    MemScope(const MemScope&)            = delete;
+    MemScope& operator=(const MemScope&) = delete;
+
+private:
+    MemTag previous_;
+};
+
+/**
+ * Marks the enclosing scope as a hot path. Nests; the innermost site is
+ * the one reported.
+ */
+class MemHotPath
+{
+public:
+    explicit MemHotPath(const char* site);
+    ~MemHotPath();
+
+    MemHotPath(const MemHotPath&)            = delete;
+    MemHotPath& operator=(const MemHotPath&) = delete;
+
+private:
+    const char* previous_;
+};
+
+#define JARVIS_MEM_JOIN_(a, b) a##b
+#define JARVIS_MEM_JOIN(a, b)  JARVIS_MEM_JOIN_(a, b)
+#define JARVIS_NO_ALLOC(site)  MemHotPath JARVIS_MEM_JOIN(jarvisHotPath, __LINE__)(site)
+#define JARVIS_MEM_SCOPE(tag)  MemScope JARVIS_MEM_JOIN(jarvisMemScope, __LINE__)(MemTag::tag)
+#else
+#define JARVIS_NO_ALLOC(site) static_cast<void>(0)
+#define JARVIS_MEM_SCOPE(tag) static_cast<void>(0)
+#endif
@@ -0,0 +1,176 @@
+#include "metrics.hh"
+
+// Histograms are also used outside the metrics endpoint (the simulator).
+uint32_t LatencyHistogram::quantile(float q) const
+{
+    const uint32_t total = count();
+    if (total == 0)
+    {
+        return 0;
+    }
+    const auto target = static_cast<uint32_t>(q * static_cast<float>(total - 1)) + 1;
+
+    uint32_t seen = 0;
+    for (std::size_t i = 0; i < kBuckets; ++i)
+    {
+        seen += bucket(i);
+        if (seen >= target)
+        {
+            return upperBound(i);
+        }
+    }
+    return upperBound(kBuckets - 1);
+}
+
+#if CONFIG_JARVIS_METRICS
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+
+#include "esp_heap_caps.h"
+#include "esp_rom_sys.h"
+
+namespace
+{
+constexpr std::size_t kProbeCount   = static_cast<std::size_t>(MetricProbe::Count);
+constexpr std::size_t kCounterCount = static_cast<std::size_t>(MetricCounter::Count);
+
+// Exported bucket bounds are powers of two from 2^kFirstExportedBit cycles
+// (about 0.5 us at 240 MHz) upwards; the sub-buckets only sharpen quantiles.
+constexpr unsigned kFirstExportedBit = 7;
+
+constexpr const char* kProbeNames[kProbeCount] = {
+    "ble_notify",
+    "motor_decode",
+    "telemetry_publish",
+    "http_send",
+};
+
+struct CounterInfo
+{
+    const char* name;
+    const char* help;
+};
+
+constexpr CounterInfo kCounters[kCounterCount] = {
+    {"jarvis_ble_notifications_total", "BLE notifications received"},
+    {"jarvis_motor_frames_total", "Motor controller frames decoded"},
+    {"jarvis_motor_frames_dropped_total", "Motor controller frames rejected as malformed"},
+    {"jarvis_telemetry_published_total", "Telemetry snapshots handed to listeners"},
+    {"jarvis_http_responses_total", "JSON API responses sent"},
+};
+
+std::array<LatencyHistogram, kProbeCount>        s_histograms;
+std::array<std::atomic<uint32_t>, kCounterCount> s_counters{};
+
+void append(std::string& out, const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+void append(std::string& out, const char* format, ...)
+{
+    char    line[160];
+    va_list args;
+    va_start(args, format);
+    const int length = std::vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    if (length > 0)
+    {
+        out.append(line, std::min(static_cast<std::size_t>(length), sizeof(line) - 1));
+    }
+}
+
+void append_histogram(std::string& out, const char* stage, const LatencyHistogram& histogram, double secondsPerCycle)
+{
+    uint64_t    cumulative = 0;
+    std::size_t bucket     = 0;
+    for (unsigned bit = kFirstExportedBit; bit < 32; ++bit)
+    {
+        // Every sub-bucket below 2^bit counts towards le = 2^bit cycles.
+        const uint32_t bound = uint32_t{1} << bit;
+        for (; bucket < LatencyHistogram::kBuckets && LatencyHistogram::upperBound(bucket) < bound; ++bucket)
+        {
+            cumulative += histogram.bucket(bucket);
+        }
+        append(out,
+               "jarvis_stage_latency_seconds_bucket{stage=\"%s\",le=\"%.9g\"} %llu\n",
+               stage,
+               bound * secondsPerCycle,
+               static_cast<unsigned long long>(cumulative));
+    }
+
+    const uint32_t count = histogram.count();
+    append(out, "jarvis_stage_latency_seconds_bucket{stage=\"%s\",le=\"+Inf\"} %u\n", stage, static_cast<unsigned>(count));
+    append(out, "jarvis_stage_latency_seconds_sum{stage=\"%s\"} %.9g\n", stage, histogram.sumCycles() * secondsPerCycle);
+    append(out, "jarvis_stage_latency_seconds_count{stage=\"%s\"} %u\n", stage, static_cast<unsigned>(count));
+}
+
+struct HeapRegion
+{
+    const char* name;
+    uint32_t    caps;
+};
+
+constexpr HeapRegion kHeapRegions[] = {
+    {"internal", MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT},
+    {"all", MALLOC_CAP_8BIT},
+};
+
+void append_heap(std::string& out, const char* name, const char* help, std::size_t (*read)(uint32_t caps))
+{
+    append(out, "# HELP %s %s.\n# TYPE %s gauge\n", name, help, name);
+    for (const HeapRegion& region : kHeapRegions)
+    {
+        append(out, "%s{region=\"%s\"} %u\n", name, region.name, static_cast<unsigned>(read(region.caps)));
+    }
+}
+} // namespace
+
+void Metrics::record(MetricProbe probe, uint32_t cycles)
+{
+    s_histograms[static_cast<std::size_t>(probe)].record(cycles);
+}
+
+void Metrics::count(MetricCounter counter, uint32_t amount)
+{
+    s_counters[static_cast<std::size_t>(counter)].fetch_add(amount, std::memory_order_relaxed);
+}
+
+const LatencyHistogram& Metrics::histogram(MetricProbe probe)
+{
+    return s_histograms[static_cast<std::size_t>(probe)];
+}
+
+uint32_t Metrics::counter(MetricCounter counter)
+{
+    return s_counters[static_cast<std::size_t>(counter)].load(std::memory_order_relaxed);
+}
+
+std::string Metrics::renderPrometheus()
+{
+    std::string out;
+    out.reserve(12 * 1024);
+
+    // Converted at scrape time; cycle counts taken while the CPU ran at
+    // another frequency are scaled by the current one.
+    const double secondsPerCycle = 1e-6 / static_cast<double>(esp_rom_get_cpu_ticks_per_us());
+
+    out += "# HELP jarvis_stage_latency_seconds Time spent in each telemetry stage.\n";
+    out += "# TYPE jarvis_stage_latency_seconds histogram\n";
+    for (std::size_t i = 0; i < kProbeCount; ++i)
+    {
+        append_histogram(out, kProbeNames[i], s_histograms[i], secondsPerCycle);
+    }
+
+    for (std::size_t i = 0; i < kCounterCount; ++i)
+    {
+        append(out, "# HELP %s %s.\n# TYPE %s counter\n", kCounters[i].name, kCounters[i].help, kCounters[i].name);
+        append(out, "%s %u\n", kCounters[i].name, static_cast<unsigned>(s_counters[i].load(std::memory_order_relaxed)));
+    }
+
+    append_heap(out, "jarvis_heap_free_bytes", "Free heap", &heap_caps_get_free_size);
+    append_heap(out, "jarvis_heap_min_free_bytes", "Lowest free heap since boot", &heap_caps_get_minimum_free_size);
+    append_heap(out, "jarvis_heap_largest_free_block_bytes", "Largest allocatable block", &heap_caps_get_largest_free_block);
+    return out;
+}
+
+#endif // CONFIG_JARVIS_METRICS
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "sdkconfig.h"
+
+#if CONFIG_JARVIS_METRICS
+#include "esp_cpu.h"
+#endif
+
+/**
+ * @file metrics.hh
+ * @brief Stage latency histograms and event counters for the telemetry
+ *        path, exported in Prometheus text format at /api/metrics.
+ *
+ * Probes sit at fixed points (BLE notify callback, motor frame decode,
+ * telemetry publish, HTTP send) and time their enclosing scope with the CPU
+ * cycle counter. Recording is a handful of relaxed atomic increments, so
+ * probes are safe from any task and never block.
+ *
+ * With CONFIG_JARVIS_METRICS disabled (the default outside debug-optimised
+ * builds) `JARVIS_PROBE` and `JARVIS_COUNT` expand to nothing and the
+ * endpoint is not registered.
+ */
+
+enum class MetricProbe : uint8_t
+{
+    BleNotify,
+    MotorDecode,
+    TelemetryPublish,
+    HttpSend,
+    Count,
+};
+
+enum class MetricCounter : uint8_t
+{
+    BleNotifications,
+    MotorFrames,
+    MotorFramesDropped,
+    TelemetryPublished,
+    HttpResponses,
+    Count,
+};
+
+/**
+ * @brief Log-linear histogram of cycle counts (or any other 32-bit unit).
+ *
+ * Each power of two is split into 2^kSubBucketBits linear sub-buckets, so
+ * any recorded value is known to within 25% across the full 32-bit range
+ * in a fixed 124 counters.
+ */
+class LatencyHistogram
+{
+public:
+    static constexpr unsigned    kSubBucketBits = 2;
+    static constexpr unsigned    kSubBuckets    = 1u << kSubBucketBits;
+    static constexpr std::size_t kBuckets       = (32 - kSubBucketBits + 1) * kSubBuckets;
+    static constexpr unsigned    kSumShift      = 4; ///< sum_ counts units of 16 cycles
+
+    void record(uint32_t cycles)
+    {
+        buckets_[bucketFor(cycles)].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(cycles >> kSumShift, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Clears all buckets. Not atomic with respect to concurrent
+     *        record() calls.
+     */
+    void reset()
+    {
+        for (auto& bucket : buckets_)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        count_.store(0, std::memory_order_relaxed);
+        sum_.store(0, std::memory_order_relaxed);
+    }
+
+    static std::size_t bucketFor(uint32_t cycles)
+    {
+        if (cycles < kSubBuckets)
+        {
+            return cycles;
+        }
+        const unsigned msb = 31u - static_cast<unsigned>(__builtin_clz(cycles));
+        const unsigned sub = (cycles >> (msb - kSubBucketBits)) & (kSubBuckets - 1);
+        return (msb - kSubBucketBits + 1) * kSubBuckets + sub;
+    }
+
+    /**
+     * @return Largest value that falls into @p bucket.
+     */
+    static uint32_t upperBound(std::size_t bucket)
+    {
+        if (bucket < kSubBuckets)
+        {
+            return static_cast<uint32_t>(bucket);
+        }
+        const unsigned shift = static_cast<unsigned>(bucket / kSubBuckets) - 1;
+        const uint64_t lower = static_cast<uint64_t>(kSubBuckets + bucket % kSubBuckets) << shift;
+        return static_cast<uint32_t>(lower + (uint64_t{1} << shift) - 1);
+    }
+
+    uint32_t bucket(std::size_t index) const { return buckets_[index].load(std::memory_order_relaxed); }
+    uint32_t count() const { return count_.load(std::memory_order_relaxed); }
+    uint32_t sumCycles() const { return sum_.load(std::memory_order_relaxed) << kSumShift; }
+
+    /**
+     * @return Upper bound (cycles) of the bucket holding quantile @p q.
+     */
+    uint32_t quantile(float q) const;
+
+private:
+    std::array<std::atomic<uint32_t>, kBuckets> buckets_{};
+    std::atomic<uint32_t>                       count_{0};
+    std::atomic<uint32_t>                       sum_{0};
+};
+
+class Metrics
+{
+public:
+    static void record(MetricProbe probe, uint32_t cycles);
+    static void count(MetricCounter counter, uint32_t amount = 1);
+
+    static const LatencyHistogram& histogram(MetricProbe probe);
+    static uint32_t                counter(MetricCounter counter);
+
+    /**
+     * @brief Renders all histograms, counters and heap watermarks as
+     *        Prometheus text exposition (version 0.0.4).
+     */
+    static std::string renderPrometheus();
+};
+
+#if CONFIG_JARVIS_METRICS
+/**
+ * Times the enclosing scope. The cycle counter is per core; a task that
+ * migrates mid-scope records one odd sample, which the histogram absorbs.
+ */
+class ScopedProbe
+{
+public:
+    explicit ScopedProbe(MetricProbe probe) : probe_(probe), start_(esp_cpu_get_cycle_count()) {}
+    ~ScopedProbe() { Metrics::record(probe_, static_cast<uint32_t>(esp_cpu_get_cycle_count() - start_)); }
+
+    ScopedProbe(const ScopedProbe&)            = delete;
+    ScopedProbe& operator=(const ScopedProbe&) = delete;
+
+private:
+    MetricProbe           probe_;
+    esp_cpu_cycle_count_t start_;
+};
+
+#define JARVIS_PROBE_JOIN_(a, b) a##b
+#define JARVIS_PROBE_JOIN(a, b)  JARVIS_PROBE_JOIN_(a, b)
+#define JARVIS_PROBE(probe)      ScopedProbe JARVIS_PROBE_JOIN(jarvisProbe, __LINE__)(MetricProbe::probe)
+#define JARVIS_COUNT(counter)    Metrics::count(MetricCounter::counter)
+#else
+#define JARVIS_PROBE(probe)   static_cast<void>(0)
+#define JARVIS_COUNT(counter) static_cast<void>(0)
+#endif
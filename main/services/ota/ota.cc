@@ -0,0 +1,297 @@
+#include "ota.hh"
+
+#include <cstring>
+#include <new>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "services/mem/mem.hh"
+
+namespace
+{
+constexpr const char* kLogTag         = "OtaUpdater";
+constexpr uint32_t    kWriterStack    = 3072;
+constexpr UBaseType_t kWriterPriority = 5;
+constexpr uint8_t     kStopIndex      = 0xFF;
+} // namespace
+
+esp_err_t OtaUpdater::begin(std::size_t imageSize)
+{
+    if (active())
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    partition_ = esp_ota_get_next_update_partition(nullptr);
+    if (partition_ == nullptr)
+    {
+        ESP_LOGE(kLogTag, "No OTA slot available");
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (imageSize == 0 || imageSize > partition_->size)
+    {
+        ESP_LOGE(kLogTag, "Image size %u does not fit '%s'", static_cast<unsigned>(imageSize), partition_->label);
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    buffers_.reset(new (std::nothrow) uint8_t[2 * kChunkBytes]);
+    chunks_      = xQueueCreate(2, sizeof(Chunk));
+    freeBuffers_ = xSemaphoreCreateCounting(2, 2);
+    writerDone_  = xSemaphoreCreateBinary();
+    if (!buffers_ || chunks_ == nullptr || freeBuffers_ == nullptr || writerDone_ == nullptr || psa_crypto_init() != PSA_SUCCESS)
+    {
+        release();
+        return ESP_ERR_NO_MEM;
+    }
+
+    hash_ = PSA_HASH_OPERATION_INIT;
+    if (psa_hash_setup(&hash_, PSA_ALG_SHA_256) != PSA_SUCCESS)
+    {
+        release();
+        return ESP_FAIL;
+    }
+
+    // Sequential writes erase each sector just before it is written instead
+    // of blocking for seconds on a full-slot erase here.
+    esp_err_t err = esp_ota_begin(partition_, OTA_WITH_SEQUENTIAL_WRITES, &handle_);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(kLogTag, "esp_ota_begin failed: %d", err);
+        handle_ = 0;
+        release();
+        return err;
+    }
+
+    writeError_ = ESP_OK;
+    writeUs_    = 0;
+    if (xTaskCreate(&OtaUpdater::writerEntry, "ota_writer", kWriterStack, this, kWriterPriority, nullptr) != pdPASS)
+    {
+        abort();
+        return ESP_ERR_NO_MEM;
+    }
+    writerRunning_ = true;
+
+    xSemaphoreTake(freeBuffers_, portMAX_DELAY);
+    fillIndex_    = 0;
+    fillLength_   = 0;
+    expectedSize_ = imageSize;
+    received_     = 0;
+    startUs_      = esp_timer_get_time();
+
+    ESP_LOGI(kLogTag, "Writing %u bytes to '%s'", static_cast<unsigned>(imageSize), partition_->label);
+    return ESP_OK;
+}
+
+esp_err_t OtaUpdater::write(const uint8_t* data, std::size_t length)
+{
+    if (!active())
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (received_ + length > expectedSize_)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if (writeError_ != ESP_OK)
+    {
+        return writeError_;
+    }
+
+    // Hashing here overlaps with the writer flashing the previous chunk.
+    if (psa_hash_update(&hash_, data, length) != PSA_SUCCESS)
+    {
+        return ESP_FAIL;
+    }
+    received_ += length;
+
+    while (length > 0)
+    {
+        const std::size_t space = kChunkBytes - fillLength_;
+        const std::size_t take  = length < space ? length : space;
+        std::memcpy(buffer(fillIndex_) + fillLength_, data, take);
+        fillLength_ += take;
+        data += take;
+        length -= take;
+
+        if (fillLength_ == kChunkBytes)
+        {
+            const esp_err_t err = submitChunk();
+            if (err != ESP_OK)
+            {
+                return err;
+            }
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t OtaUpdater::submitChunk()
+{
+    const Chunk chunk{fillIndex_, fillLength_};
+    xQueueSend(chunks_, &chunk, portMAX_DELAY);
+
+    // Blocks only while the writer still owns the other buffer.
+    xSemaphoreTake(freeBuffers_, portMAX_DELAY);
+    fillIndex_ ^= 1;
+    fillLength_ = 0;
+    return writeError_;
+}
+
+esp_err_t OtaUpdater::finish(const uint8_t* expectedSha256, Result& result)
+{
+    if (!active())
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (received_ != expectedSize_)
+    {
+        ESP_LOGE(kLogTag, "Incomplete image: %u of %u bytes", static_cast<unsigned>(received_), static_cast<unsigned>(expectedSize_));
+        abort();
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    esp_err_t err = fillLength_ > 0 ? submitChunk() : ESP_OK;
+    if (err == ESP_OK)
+    {
+        err = stopWriter();
+    }
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(kLogTag, "esp_ota_write failed: %d", err);
+        abort();
+        return err;
+    }
+
+    std::size_t hashLength = 0;
+    if (psa_hash_finish(&hash_, result.sha256.data(), result.sha256.size(), &hashLength) != PSA_SUCCESS)
+    {
+        abort();
+        return ESP_FAIL;
+    }
+    if (expectedSha256 != nullptr && std::memcmp(expectedSha256, result.sha256.data(), kHashBytes) != 0)
+    {
+        ESP_LOGE(kLogTag, "SHA-256 mismatch, discarding image");
+        abort();
+        return ESP_ERR_INVALID_CRC;
+    }
+
+    // Verifies the image header, segments and the checksum appended by the build.
+    err     = esp_ota_end(handle_);
+    handle_ = 0;
+    if (err == ESP_OK)
+    {
+        err = esp_ota_set_boot_partition(partition_);
+    }
+
+    result.bytes     = received_;
+    result.elapsedMs = static_cast<uint32_t>((esp_timer_get_time() - startUs_) / 1000);
+    result.writeMs   = static_cast<uint32_t>(writeUs_ / 1000);
+    release();
+
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(kLogTag, "Image rejected: %d", err);
+        return err;
+    }
+
+    ESP_LOGI(kLogTag,
+             "Update complete: %u bytes in %u ms (%.1f KiB/s, %u ms in flash writes)",
+             static_cast<unsigned>(result.bytes),
+             static_cast<unsigned>(result.elapsedMs),
+             static_cast<double>(result.kibPerSecond()),
+             static_cast<unsigned>(result.writeMs));
+    return ESP_OK;
+}
+
+void OtaUpdater::abort()
+{
+    stopWriter();
+    if (handle_ != 0)
+    {
+        esp_ota_abort(handle_);
+        handle_ = 0;
+        ESP_LOGW(kLogTag, "Update aborted after %u bytes", static_cast<unsigned>(received_));
+    }
+    psa_hash_abort(&hash_);
+    release();
+}
+
+esp_err_t OtaUpdater::stopWriter()
+{
+    if (!writerRunning_)
+    {
+        return writeError_;
+    }
+    const Chunk stop{kStopIndex, 0};
+    xQueueSend(chunks_, &stop, portMAX_DELAY);
+    xSemaphoreTake(writerDone_, portMAX_DELAY);
+    writerRunning_ = false;
+    return writeError_;
+}
+
+void OtaUpdater::release()
+{
+    if (chunks_ != nullptr)
+    {
+        vQueueDelete(chunks_);
+        chunks_ = nullptr;
+    }
+    if (freeBuffers_ != nullptr)
+    {
+        vSemaphoreDelete(freeBuffers_);
+        freeBuffers_ = nullptr;
+    }
+    if (writerDone_ != nullptr)
+    {
+        vSemaphoreDelete(writerDone_);
+        writerDone_ = nullptr;
+    }
+    buffers_.reset();
+}
+
+void OtaUpdater::writerEntry(void* arg)
+{
+    auto* self = static_cast<OtaUpdater*>(arg);
+    MemAccounting::setTaskTag(MemTag::Ota);
+
+    Chunk chunk{};
+    while (xQueueReceive(self->chunks_, &chunk, portMAX_DELAY) == pdTRUE && chunk.index != kStopIndex)
+    {
+        // After a failure keep draining so the receiver never blocks.
+        if (self->writeError_ == ESP_OK)
+        {
+            const int64_t startUs = esp_timer_get_time();
+            self->writeError_     = esp_ota_write(self->handle_, self->buffer(chunk.index), chunk.length);
+            self->writeUs_        = self->writeUs_ + static_cast<uint64_t>(esp_timer_get_time() - startUs);
+        }
+        xSemaphoreGive(self->freeBuffers_);
+    }
+
+    xSemaphoreGive(self->writerDone_);
+    vTaskDelete(nullptr);
+}
+
+bool OtaUpdater::runningImagePendingVerify()
+{
+    esp_ota_img_states_t state = ESP_OTA_IMG_UNDEFINED;
+    return esp_ota_get_state_partition(esp_ota_get_running_partition(), &state) == ESP_OK &&
+           state == ESP_OTA_IMG_PENDING_VERIFY;
+}
+
+esp_err_t OtaUpdater::confirmRunningImage(bool healthy)
+{
+    if (!runningImagePendingVerify())
+    {
+        return ESP_OK;
+    }
+
+    if (healthy)
+    {
+        ESP_LOGI(kLogTag, "New image passed health checks, cancelling rollback");
+        return esp_ota_mark_app_valid_cancel_rollback();
+    }
+
+    ESP_LOGE(kLogTag, "New image failed health checks, rolling back");
+    return esp_ota_mark_app_invalid_rollback_and_reboot();
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "esp_err.h"
+#include "esp_ota_ops.h"
+#include "psa/crypto.h"
+
+/**
+ * @file ota.hh
+ * @brief Declares OtaUpdater, which streams a firmware image into the next
+ *        OTA slot, and the boot-time confirmation helpers.
+ *
+ * The image is never held in RAM as a whole. Incoming bytes are hashed
+ * (SHA-256) as they arrive and collected into flash-sector-sized chunks;
+ * full chunks are handed to a writer task through a pair of ping-pong
+ * buffers, so `esp_ota_write()` for one sector overlaps with receiving and
+ * hashing the next. The slot is erased sector by sector as it is written
+ * rather than up front.
+ *
+ * After reboot into the new image the bootloader keeps it in
+ * `PENDING_VERIFY` until `confirmRunningImage()` is called; a crash or a
+ * failed health check before that rolls back to the previous slot.
+ */
+class OtaUpdater
+{
+public:
+    static constexpr std::size_t kChunkBytes = 4096; ///< One flash sector
+    static constexpr std::size_t kHashBytes  = 32;
+
+    struct Result
+    {
+        std::size_t                     bytes     = 0;
+        uint32_t                        elapsedMs = 0; ///< begin() to finish()
+        uint32_t                        writeMs   = 0; ///< Time spent inside esp_ota_write()
+        std::array<uint8_t, kHashBytes> sha256{};
+
+        /**
+         * @return Sustained throughput of the whole update in KiB/s.
+         */
+        float kibPerSecond() const
+        {
+            return elapsedMs == 0 ? 0.0f : static_cast<float>(bytes) * 1000.0f / 1024.0f / static_cast<float>(elapsedMs);
+        }
+    };
+
+    OtaUpdater() = default;
+    ~OtaUpdater() { abort(); }
+
+    OtaUpdater(const OtaUpdater&)            = delete;
+    OtaUpdater& operator=(const OtaUpdater&) = delete;
+
+    /**
+     * @param imageSize Expected image size in bytes, checked against the
+     *                  slot size and the number of bytes written.
+     */
+    esp_err_t begin(std::size_t imageSize);
+
+    esp_err_t write(const uint8_t* data, std::size_t length);
+
+    /**
+     * @brief Flushes the last chunk, validates the image and selects it for
+     *        the next boot.
+     *
+     * @param expectedSha256 Optional digest the image must match.
+     */
+    esp_err_t finish(const uint8_t* expectedSha256, Result& result);
+
+    /**
+     * @brief Abandons an update in progress. Safe to call at any time.
+     */
+    void abort();
+
+    bool active() const { return handle_ != 0; }
+
+    /**
+     * @return true when the running image was just installed and awaits
+     *         confirmation.
+     */
+    static bool runningImagePendingVerify();
+
+    /**
+     * @brief Resolves a pending image: keeps it when @p healthy, otherwise
+     *        marks it invalid and reboots into the previous one. No-op for
+     *        confirmed images.
+     */
+    static esp_err_t confirmRunningImage(bool healthy);
+
+private:
+    struct Chunk
+    {
+        uint8_t     index;
+        std::size_t length;
+    };
+
+    esp_err_t   submitChunk();
+    esp_err_t   stopWriter();
+    void        release();
+    static void writerEntry(void* arg);
+
+    uint8_t* buffer(uint8_t index) { return buffers_.get() + index * kChunkBytes; }
+
+    const esp_partition_t* partition_ = nullptr;
+    esp_ota_handle_t       handle_    = 0;
+    psa_hash_operation_t   hash_      = PSA_HASH_OPERATION_INIT;
+
+    std::unique_ptr<uint8_t[]> buffers_; ///< Two chunks, allocated per update
+    uint8_t                    fillIndex_    = 0;
+    std::size_t                fillLength_   = 0;
+    std::size_t                expectedSize_ = 0;
+    std::size_t                received_     = 0;
+    int64_t                    startUs_      = 0;
+
+    QueueHandle_t      chunks_        = nullptr; ///< Filled buffers for the writer
+    SemaphoreHandle_t  freeBuffers_   = nullptr; ///< Buffers available for filling
+    SemaphoreHandle_t  writerDone_    = nullptr;
+    bool               writerRunning_ = false;
+    volatile esp_err_t writeError_    = ESP_OK;
+    volatile uint64_t  writeUs_       = 0;
+};
@@ -0,0 +1,328 @@
+#include "ota_delta.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#include "esp_app_desc.h"
+#include "esp_log.h"
+#include "esp_ota_ops.h"
+#include "rom/miniz.h"
+
+namespace
+{
+constexpr const char* kLogTag          = "OtaDelta";
+constexpr std::size_t kDictionaryBytes = TINFL_LZ_DICT_SIZE;
+constexpr std::size_t kBaseChunkBytes  = 256; ///< Base image bytes read per flash access
+
+uint32_t read_u32(const uint8_t* bytes)
+{
+    return static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8) |
+           (static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+}
+} // namespace
+
+OtaDeltaPatcher::OtaDeltaPatcher(OtaUpdater& updater) : updater_(updater) {}
+
+OtaDeltaPatcher::~OtaDeltaPatcher()
+{
+    abort();
+}
+
+esp_err_t OtaDeltaPatcher::begin(std::size_t patchSize)
+{
+    if (stage_ != Stage::Done || updater_.active())
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (patchSize <= kHeaderBytes)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    base_ = esp_ota_get_running_partition();
+    inflator_.reset(new (std::nothrow) tinfl_decompressor);
+    dictionary_.reset(new (std::nothrow) uint8_t[kDictionaryBytes]);
+    if (base_ == nullptr || !inflator_ || !dictionary_)
+    {
+        release();
+        return ESP_ERR_NO_MEM;
+    }
+    tinfl_init(inflator_.get());
+
+    dictionaryOffset_ = 0;
+    streamEnded_      = false;
+    patchSize_        = patchSize;
+    received_         = 0;
+    headerLength_     = 0;
+    controlLength_    = 0;
+    oldPosition_      = 0;
+    newPosition_      = 0;
+    stage_            = Stage::Header;
+    return ESP_OK;
+}
+
+esp_err_t OtaDeltaPatcher::write(const uint8_t* data, std::size_t length)
+{
+    if (!dictionary_)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (received_ + length > patchSize_)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    received_ += length;
+
+    if (stage_ == Stage::Header)
+    {
+        const std::size_t take = std::min(length, kHeaderBytes - headerLength_);
+        std::memcpy(header_ + headerLength_, data, take);
+        headerLength_ += take;
+        data += take;
+        length -= take;
+
+        if (headerLength_ < kHeaderBytes)
+        {
+            return ESP_OK;
+        }
+        const esp_err_t err = parseHeader();
+        if (err != ESP_OK)
+        {
+            return err;
+        }
+    }
+
+    return length > 0 ? inflate(data, length) : ESP_OK;
+}
+
+esp_err_t OtaDeltaPatcher::parseHeader()
+{
+    const uint16_t version = static_cast<uint16_t>(header_[4] | (header_[5] << 8));
+    if (read_u32(header_) != kMagic || version != kVersion)
+    {
+        ESP_LOGE(kLogTag, "Not a delta patch (magic 0x%08x, version %u)", static_cast<unsigned>(read_u32(header_)), version);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    oldSize_ = read_u32(header_ + 8);
+    newSize_ = read_u32(header_ + 12);
+    std::memcpy(newSha256_, header_ + 48, sizeof(newSha256_));
+
+    // The base is identified by the ELF digest the build embeds in the app
+    // descriptor, which is cheaper than hashing the running partition.
+    const esp_app_desc_t* running = esp_app_get_description();
+    if (oldSize_ > base_->size || std::memcmp(running->app_elf_sha256, header_ + 16, sizeof(running->app_elf_sha256)) != 0)
+    {
+        ESP_LOGE(kLogTag, "Patch was made for a different base image than '%s'", running->version);
+        return ESP_ERR_INVALID_VERSION;
+    }
+
+    ESP_LOGI(kLogTag,
+             "Applying %u byte patch: %u -> %u bytes",
+             static_cast<unsigned>(patchSize_),
+             static_cast<unsigned>(oldSize_),
+             static_cast<unsigned>(newSize_));
+
+    stage_ = Stage::Control;
+    return updater_.begin(newSize_);
+}
+
+esp_err_t OtaDeltaPatcher::inflate(const uint8_t* data, std::size_t length)
+{
+    for (;;)
+    {
+        if (streamEnded_)
+        {
+            return length == 0 ? ESP_OK : ESP_ERR_INVALID_SIZE;
+        }
+
+        std::size_t        inBytes  = length;
+        std::size_t        outBytes = kDictionaryBytes - dictionaryOffset_;
+        const tinfl_status status   = tinfl_decompress(inflator_.get(),
+                                                     data,
+                                                     &inBytes,
+                                                     dictionary_.get(),
+                                                     dictionary_.get() + dictionaryOffset_,
+                                                     &outBytes,
+                                                     TINFL_FLAG_HAS_MORE_INPUT);
+        data += inBytes;
+        length -= inBytes;
+
+        if (outBytes > 0)
+        {
+            const esp_err_t err = apply(dictionary_.get() + dictionaryOffset_, outBytes);
+            if (err != ESP_OK)
+            {
+                return err;
+            }
+            // The dictionary doubles as the output window and wraps around.
+            dictionaryOffset_ = (dictionaryOffset_ + outBytes) & (kDictionaryBytes - 1);
+        }
+
+        if (status < TINFL_STATUS_DONE)
+        {
+            ESP_LOGE(kLogTag, "Corrupt patch stream (%d)", static_cast<int>(status));
+            return ESP_ERR_INVALID_CRC;
+        }
+        if (status == TINFL_STATUS_DONE)
+        {
+            streamEnded_ = true;
+        }
+        else if (status == TINFL_STATUS_NEEDS_MORE_INPUT && length == 0)
+        {
+            return ESP_OK;
+        }
+        else if (inBytes == 0 && outBytes == 0)
+        {
+            return ESP_FAIL;
+        }
+    }
+}
+
+esp_err_t OtaDeltaPatcher::apply(const uint8_t* data, std::size_t length)
+{
+    while (length > 0)
+    {
+        std::size_t taken = 0;
+        esp_err_t   err   = ESP_OK;
+
+        switch (stage_)
+        {
+        case Stage::Control:
+            taken = std::min(length, sizeof(control_) - controlLength_);
+            std::memcpy(control_ + controlLength_, data, taken);
+            controlLength_ += taken;
+            if (controlLength_ == sizeof(control_))
+            {
+                err = startRecord();
+            }
+            break;
+
+        case Stage::Diff:
+        {
+            uint8_t base[kBaseChunkBytes];
+            taken = std::min({length, static_cast<std::size_t>(diffRemaining_), sizeof(base)});
+            err   = esp_partition_read(base_, static_cast<std::size_t>(oldPosition_), base, taken);
+            if (err != ESP_OK)
+            {
+                break;
+            }
+            for (std::size_t i = 0; i < taken; ++i)
+            {
+                base[i] = static_cast<uint8_t>(base[i] + data[i]);
+            }
+            err = updater_.write(base, taken);
+            oldPosition_ += static_cast<int64_t>(taken);
+            newPosition_ += taken;
+            diffRemaining_ -= static_cast<uint32_t>(taken);
+            if (err == ESP_OK && diffRemaining_ == 0)
+            {
+                if (extraRemaining_ > 0)
+                {
+                    stage_ = Stage::Extra;
+                }
+                else
+                {
+                    err = endRecord();
+                }
+            }
+            break;
+        }
+
+        case Stage::Extra:
+            taken = std::min(length, static_cast<std::size_t>(extraRemaining_));
+            err   = updater_.write(data, taken);
+            newPosition_ += taken;
+            extraRemaining_ -= static_cast<uint32_t>(taken);
+            if (err == ESP_OK && extraRemaining_ == 0)
+            {
+                err = endRecord();
+            }
+            break;
+
+        case Stage::Header:
+        case Stage::Done:
+            ESP_LOGE(kLogTag, "Patch continues past the end of the image");
+            return ESP_ERR_INVALID_SIZE;
+        }
+
+        if (err != ESP_OK)
+        {
+            return err;
+        }
+        data += taken;
+        length -= taken;
+    }
+    return ESP_OK;
+}
+
+esp_err_t OtaDeltaPatcher::startRecord()
+{
+    diffRemaining_  = read_u32(control_);
+    extraRemaining_ = read_u32(control_ + 4);
+    seek_           = static_cast<int32_t>(read_u32(control_ + 8));
+    controlLength_  = 0;
+
+    const uint64_t newEnd = static_cast<uint64_t>(newPosition_) + diffRemaining_ + extraRemaining_;
+    if (newEnd > newSize_ || oldPosition_ < 0 || oldPosition_ + diffRemaining_ > oldSize_)
+    {
+        ESP_LOGE(kLogTag, "Patch record out of range at output offset %u", static_cast<unsigned>(newPosition_));
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    if (diffRemaining_ > 0)
+    {
+        stage_ = Stage::Diff;
+        return ESP_OK;
+    }
+    if (extraRemaining_ > 0)
+    {
+        stage_ = Stage::Extra;
+        return ESP_OK;
+    }
+    return endRecord();
+}
+
+esp_err_t OtaDeltaPatcher::endRecord()
+{
+    oldPosition_ += seek_;
+    stage_ = newPosition_ == newSize_ ? Stage::Done : Stage::Control;
+    return ESP_OK;
+}
+
+esp_err_t OtaDeltaPatcher::finish(OtaUpdater::Result& result)
+{
+    if (!dictionary_)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (stage_ != Stage::Done || !streamEnded_ || received_ != patchSize_)
+    {
+        ESP_LOGE(kLogTag,
+                 "Patch incomplete: %u of %u output bytes",
+                 static_cast<unsigned>(newPosition_),
+                 static_cast<unsigned>(newSize_));
+        abort();
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    release();
+    return updater_.finish(newSha256_, result);
+}
+
+void OtaDeltaPatcher::abort()
+{
+    if (updater_.active())
+    {
+        updater_.abort();
+    }
+    release();
+}
+
+void OtaDeltaPatcher::release()
+{
+    inflator_.reset();
+    dictionary_.reset();
+    stage_ = Stage::Done;
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "esp_err.h"
+#include "esp_partition.h"
+
+#include "ota.hh"
+
+struct tinfl_decompressor_tag;
+
+/**
+ * @file ota_delta.hh
+ * @brief Declares OtaDeltaPatcher, which rebuilds a new app image from the
+ *        running one and a binary patch made by `tools/ota_delta.py diff`.
+ *
+ * Patch layout (little endian):
+ *
+ *     header   u32 magic 'JDLT', u16 version, u16 flags, u32 oldSize,
+ *              u32 newSize, u8[32] app_elf_sha256 of the base image,
+ *              u8[32] SHA-256 of the new image
+ *     body     raw deflate stream of records:
+ *              u32 diffLength, u32 extraLength, i32 seek,
+ *              diffLength bytes added (mod 256) to the base image at the
+ *              cursor, extraLength literal bytes; then the cursor moves by
+ *              seek
+ *
+ * The patch is consumed as it arrives: it is inflated through the ROM
+ * decompressor, base bytes are read from the running partition on demand
+ * and the output goes straight into an OtaUpdater. RAM use is fixed at the
+ * inflate dictionary and state (about 43 KiB) regardless of image size.
+ */
+class OtaDeltaPatcher
+{
+public:
+    static constexpr uint32_t    kMagic       = 0x544C444A; ///< 'JDLT'
+    static constexpr uint16_t    kVersion     = 1;
+    static constexpr std::size_t kHeaderBytes = 80;
+
+    explicit OtaDeltaPatcher(OtaUpdater& updater);
+    ~OtaDeltaPatcher();
+
+    OtaDeltaPatcher(const OtaDeltaPatcher&)            = delete;
+    OtaDeltaPatcher& operator=(const OtaDeltaPatcher&) = delete;
+
+    /**
+     * @param patchSize Total patch size in bytes.
+     */
+    esp_err_t begin(std::size_t patchSize);
+
+    /**
+     * @brief Feeds the next patch bytes. The OTA update itself starts once
+     *        the header has been received and matches the running image.
+     *
+     * @return ESP_ERR_INVALID_VERSION when the patch was made against a
+     *         different base image; ESP_ERR_INVALID_ARG for a bad magic or
+     *         version, ESP_ERR_INVALID_CRC for a corrupt deflate stream and
+     *         ESP_ERR_INVALID_SIZE for a record outside either image. All
+     *         of these are faults of the patch, not of the device.
+     */
+    esp_err_t write(const uint8_t* data, std::size_t length);
+
+    /**
+     * @brief Checks that the patch was consumed completely and finishes the
+     *        OTA update against the digest carried in the patch.
+     */
+    esp_err_t finish(OtaUpdater::Result& result);
+
+    void abort();
+
+    std::size_t patchBytes() const { return patchSize_; }
+
+private:
+    enum class Stage : uint8_t
+    {
+        Header,
+        Control,
+        Diff,
+        Extra,
+        Done,
+    };
+
+    esp_err_t parseHeader();
+    esp_err_t inflate(const uint8_t* data, std::size_t length);
+    esp_err_t apply(const uint8_t* data, std::size_t length);
+    esp_err_t startRecord();
+    esp_err_t endRecord();
+    void      release();
+
+    OtaUpdater&            updater_;
+    const esp_partition_t* base_ = nullptr;
+
+    std::unique_ptr<tinfl_decompressor_tag> inflator_;
+    std::unique_ptr<uint8_t[]>              dictionary_;
+    std::size_t                             dictionaryOffset_ = 0;
+    bool                                    streamEnded_      = false;
+
+    Stage       stage_     = Stage::Done;
+    std::size_t patchSize_ = 0;
+    std::size_t received_  = 0;
+
+    uint8_t     header_[kHeaderBytes]{};
+    std::size_t headerLength_ = 0;
+    uint32_t    oldSize_      = 0;
+    uint32_t    newSize_      = 0;
+    uint8_t     newSha256_[OtaUpdater::kHashBytes]{};
+
+    uint8_t     control_[12]{};
+    std::size_t controlLength_  = 0;
+    uint32_t    diffRemaining_  = 0;
+    uint32_t    extraRemaining_ = 0;
+    int32_t     seek_           = 0;
+    int64_t     oldPosition_    = 0;
+    std::size_t newPosition_    = 0;
+};
@@ -0,0 +1,350 @@
+#include "power.hh"
+
+#include <atomic>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "esp_log.h"
+#include "esp_pm.h"
+#include "esp_timer.h"
+
+namespace
+{
+constexpr const char* kLogTag       = "Power";
+constexpr uint32_t    kTaskStack    = 3072;
+constexpr UBaseType_t kTaskPriority = 3;
+constexpr uint32_t    kParkAfterMs  = CONFIG_JARVIS_POWER_PARK_TIMEOUT_S * 1000U;
+constexpr std::size_t kStateCount   = static_cast<std::size_t>(PowerState::Count);
+constexpr std::size_t kRiding       = static_cast<std::size_t>(PowerState::Riding);
+constexpr std::size_t kParked       = static_cast<std::size_t>(PowerState::Parked);
+
+// Bit order of PowerNeed
+constexpr esp_pm_lock_type_t kLockTypes[] = {ESP_PM_CPU_FREQ_MAX, ESP_PM_APB_FREQ_MAX, ESP_PM_NO_LIGHT_SLEEP};
+constexpr std::size_t        kLockCount   = sizeof(kLockTypes) / sizeof(kLockTypes[0]);
+
+struct Client
+{
+    const char*          name = nullptr;
+    uint8_t              needs[kStateCount]{};
+    uint8_t              held = kPowerNeedNone;
+    esp_pm_lock_handle_t locks[kLockCount]{};
+};
+
+struct ListenerEntry
+{
+    PowerManager::Listener listener = nullptr;
+    void*                  context  = nullptr;
+};
+
+class LockGuard
+{
+public:
+    explicit LockGuard(SemaphoreHandle_t mutex) : mutex_(mutex) { xSemaphoreTake(mutex_, portMAX_DELAY); }
+    ~LockGuard() { xSemaphoreGive(mutex_); }
+
+    LockGuard(const LockGuard&)            = delete;
+    LockGuard& operator=(const LockGuard&) = delete;
+
+private:
+    SemaphoreHandle_t mutex_;
+};
+
+Client                   s_clients[PowerManager::kMaxClients];
+std::size_t              s_clientCount = 0;
+ListenerEntry            s_listeners[PowerManager::kMaxListeners];
+std::atomic<std::size_t> s_listenerCount{0};
+
+std::atomic<PowerState> s_state{PowerState::Riding};
+std::atomic<uint32_t>   s_lastActivityMs{0};
+TaskHandle_t            s_task         = nullptr;
+int64_t                 s_stateSinceUs = 0;
+uint64_t                s_totalUs[kStateCount]{};
+uint32_t                s_transitions  = 0;
+bool                    s_pmEnabled    = false;
+int                     s_maxFreqMhz   = 0;
+int                     s_minFreqMhz   = 0;
+bool                    s_lightSleep   = false;
+
+// Clients may register from constructors that run before start().
+SemaphoreHandle_t mutex()
+{
+    static StaticSemaphore_t storage;
+    static SemaphoreHandle_t handle = xSemaphoreCreateMutexStatic(&storage);
+    return handle;
+}
+
+uint32_t now_ms()
+{
+    return static_cast<uint32_t>(esp_timer_get_time() / 1000);
+}
+
+// Takes the locks in @p wanted that @p client does not hold yet. Caller
+// holds the mutex.
+void take(Client& client, uint8_t wanted)
+{
+    for (std::size_t i = 0; i < kLockCount; ++i)
+    {
+        const uint8_t bit = static_cast<uint8_t>(1U << i);
+        if ((wanted & bit) != 0 && (client.held & bit) == 0 && client.locks[i] != nullptr)
+        {
+            esp_pm_lock_acquire(client.locks[i]);
+        }
+    }
+    client.held |= wanted;
+}
+
+// Releases the locks @p client holds that are not in @p wanted.
+void drop(Client& client, uint8_t wanted)
+{
+    for (std::size_t i = 0; i < kLockCount; ++i)
+    {
+        const uint8_t bit = static_cast<uint8_t>(1U << i);
+        if ((wanted & bit) == 0 && (client.held & bit) != 0 && client.locks[i] != nullptr)
+        {
+            esp_pm_lock_release(client.locks[i]);
+        }
+    }
+    client.held &= wanted;
+}
+
+uint8_t needs_in(const Client& client, PowerState state)
+{
+    return client.needs[static_cast<std::size_t>(state)];
+}
+
+// Brings @p client's locks in line with what it needs in @p state.
+void apply(Client& client, PowerState state)
+{
+    take(client, needs_in(client, state));
+    drop(client, needs_in(client, state));
+}
+
+void enter(PowerState next)
+{
+    {
+        LockGuard lock(mutex());
+        const PowerState previous = s_state.load(std::memory_order_relaxed);
+        const int64_t    nowUs    = esp_timer_get_time();
+        s_totalUs[static_cast<std::size_t>(previous)] += static_cast<uint64_t>(nowUs - s_stateSinceUs);
+        s_stateSinceUs = nowUs;
+        ++s_transitions;
+
+        // Every client takes the new state's locks before any lets go of
+        // the old ones, so the clock never dips between two clients that
+        // trade a need across the transition.
+        for (std::size_t i = 0; i < s_clientCount; ++i)
+        {
+            take(s_clients[i], needs_in(s_clients[i], next));
+        }
+        for (std::size_t i = 0; i < s_clientCount; ++i)
+        {
+            drop(s_clients[i], needs_in(s_clients[i], next));
+        }
+        s_state.store(next, std::memory_order_release);
+    }
+
+    ESP_LOGI(kLogTag, "%s", PowerManager::stateName(next));
+
+    const std::size_t listeners = s_listenerCount.load(std::memory_order_acquire);
+    for (std::size_t i = 0; i < listeners; ++i)
+    {
+        s_listeners[i].listener(s_listeners[i].context, next);
+    }
+}
+
+void power_task(void*)
+{
+    for (;;)
+    {
+        // Activity stamped after this load only makes it look older.
+        const uint32_t   lastMs = s_lastActivityMs.load(std::memory_order_relaxed);
+        const uint32_t   idleMs = now_ms() - lastMs;
+        const PowerState next   = idleMs >= kParkAfterMs ? PowerState::Parked : PowerState::Riding;
+        if (next != s_state.load(std::memory_order_relaxed))
+        {
+            // Look again before waiting: activity reported during the
+            // switch to Parked saw Riding and sent no notification.
+            enter(next);
+            continue;
+        }
+
+        // Riding: sleep until the park deadline, which activity may have
+        // moved on by the time it is reached. Parked: wait for
+        // reportActivity().
+        const TickType_t wait = next == PowerState::Riding ? pdMS_TO_TICKS(kParkAfterMs - idleMs) + 1 : portMAX_DELAY;
+        ulTaskNotifyTake(pdTRUE, wait);
+    }
+}
+} // namespace
+
+esp_err_t PowerManager::start()
+{
+    if (s_task != nullptr)
+    {
+        return ESP_OK;
+    }
+
+#if CONFIG_PM_ENABLE
+    esp_pm_config_t config{};
+    config.max_freq_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;
+    config.min_freq_mhz = CONFIG_JARVIS_POWER_MIN_FREQ_MHZ;
+#if CONFIG_JARVIS_POWER_LIGHT_SLEEP
+    config.light_sleep_enable = true;
+#endif
+    const esp_err_t err = esp_pm_configure(&config);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(kLogTag, "esp_pm_configure failed: %d", err);
+    }
+    else
+    {
+        s_pmEnabled  = true;
+        s_maxFreqMhz = config.max_freq_mhz;
+        s_minFreqMhz = config.min_freq_mhz;
+        s_lightSleep = config.light_sleep_enable;
+        ESP_LOGI(kLogTag,
+                 "%d-%d MHz, light sleep %s",
+                 s_maxFreqMhz,
+                 s_minFreqMhz,
+                 s_lightSleep ? "on" : "off");
+    }
+#else
+    ESP_LOGW(kLogTag, "CONFIG_PM_ENABLE is off; tracking power states without clock or sleep control");
+#endif
+
+    // Riding is the manager's own client: full clock and no light sleep, so
+    // the decode path sees the same latency as without power management.
+    registerClient("riding", kPowerNeedCpuMax | kPowerNeedAwake, kPowerNeedNone);
+
+    s_lastActivityMs.store(now_ms(), std::memory_order_relaxed);
+    {
+        LockGuard lock(mutex());
+        s_stateSinceUs = esp_timer_get_time();
+    }
+
+    if (xTaskCreate(&power_task, "power", kTaskStack, nullptr, kTaskPriority, &s_task) != pdPASS)
+    {
+        ESP_LOGE(kLogTag, "Failed to start power task");
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(kLogTag, "Parking after %u s without activity", static_cast<unsigned>(CONFIG_JARVIS_POWER_PARK_TIMEOUT_S));
+    return ESP_OK;
+}
+
+PowerClient PowerManager::registerClient(const char* name, uint8_t ridingNeeds, uint8_t parkedNeeds)
+{
+    LockGuard lock(mutex());
+    if (s_clientCount >= kMaxClients)
+    {
+        ESP_LOGE(kLogTag, "No room for power client '%s'", name);
+        return kNoPowerClient;
+    }
+
+    Client& client        = s_clients[s_clientCount];
+    client.name           = name;
+    client.needs[kRiding] = ridingNeeds;
+    client.needs[kParked] = parkedNeeds;
+    for (std::size_t i = 0; i < kLockCount; ++i)
+    {
+        // Fails with ESP_ERR_NOT_SUPPORTED without CONFIG_PM_ENABLE; the
+        // handle stays null and apply() skips it.
+        esp_pm_lock_create(kLockTypes[i], 0, name, &client.locks[i]);
+    }
+    apply(client, s_state.load(std::memory_order_relaxed));
+    return static_cast<PowerClient>(s_clientCount++);
+}
+
+void PowerManager::setNeeds(PowerClient client, uint8_t ridingNeeds, uint8_t parkedNeeds)
+{
+    LockGuard lock(mutex());
+    if (client < 0 || static_cast<std::size_t>(client) >= s_clientCount)
+    {
+        return;
+    }
+    Client& entry        = s_clients[client];
+    entry.needs[kRiding] = ridingNeeds;
+    entry.needs[kParked] = parkedNeeds;
+    apply(entry, s_state.load(std::memory_order_relaxed));
+}
+
+void PowerManager::reportActivity()
+{
+    s_lastActivityMs.store(now_ms(), std::memory_order_relaxed);
+    if (s_state.load(std::memory_order_relaxed) == PowerState::Parked && s_task != nullptr)
+    {
+        xTaskNotifyGive(s_task);
+    }
+}
+
+esp_err_t PowerManager::subscribe(Listener listener, void* context)
+{
+    LockGuard         lock(mutex());
+    const std::size_t count = s_listenerCount.load(std::memory_order_relaxed);
+    if (count >= kMaxListeners)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+    s_listeners[count] = ListenerEntry{listener, context};
+    s_listenerCount.store(count + 1, std::memory_order_release);
+    return ESP_OK;
+}
+
+PowerState PowerManager::state()
+{
+    return s_state.load(std::memory_order_acquire);
+}
+
+PowerManager::Stats PowerManager::stats()
+{
+    LockGuard lock(mutex());
+    Stats     stats;
+    stats.state       = s_state.load(std::memory_order_relaxed);
+    stats.transitions = s_transitions;
+    stats.pmEnabled   = s_pmEnabled;
+    stats.maxFreqMhz  = s_maxFreqMhz;
+    stats.minFreqMhz  = s_minFreqMhz;
+    stats.lightSleep  = s_lightSleep;
+
+    const uint64_t inStateUs = s_stateSinceUs > 0 ? static_cast<uint64_t>(esp_timer_get_time() - s_stateSinceUs) : 0;
+    stats.inStateMs          = static_cast<uint32_t>(inStateUs / 1000);
+    for (std::size_t i = 0; i < kStateCount; ++i)
+    {
+        uint64_t totalUs = s_totalUs[i];
+        if (i == static_cast<std::size_t>(stats.state))
+        {
+            totalUs += inStateUs;
+        }
+        stats.totalMs[i] = totalUs / 1000;
+    }
+    return stats;
+}
+
+std::size_t PowerManager::clients(ClientInfo* out, std::size_t capacity)
+{
+    LockGuard         lock(mutex());
+    const std::size_t count = s_clientCount < capacity ? s_clientCount : capacity;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        out[i].name        = s_clients[i].name;
+        out[i].ridingNeeds = needs_in(s_clients[i], PowerState::Riding);
+        out[i].parkedNeeds = needs_in(s_clients[i], PowerState::Parked);
+        out[i].held        = s_clients[i].held;
+    }
+    return count;
+}
+
+const char* PowerManager::stateName(PowerState state)
+{
+    switch (state)
+    {
+        case PowerState::Riding:
+            return "riding";
+        case PowerState::Parked:
+            return "parked";
+        default:
+            return "unknown";
+    }
+}
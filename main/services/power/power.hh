@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+/**
+ * @file power.hh
+ * @brief Riding/parked power states built on esp_pm locks.
+ *
+ * With CONFIG_PM_ENABLE the chip runs at the lowest configured CPU clock
+ * and light-sleeps whenever every task is blocked, unless some client holds
+ * a lock against it. Services register as clients and declare, per power
+ * state, which locks they need (PowerNeed); the manager holds exactly those
+ * locks for the current state and swaps them on every transition.
+ *
+ * The state follows the bike: any service that sees the bike in use (wheel
+ * turning, button pressed) calls reportActivity(), which switches to Riding
+ * at once. After CONFIG_JARVIS_POWER_PARK_TIMEOUT_S without activity the
+ * manager switches to Parked. The manager itself keeps the CPU at full
+ * clock and awake while riding, so decode latency is unchanged; parked,
+ * only what clients ask for is held.
+ *
+ * Time spent in each state is accumulated from esp_timer and reported by
+ * stats() (GET /api/power). Without CONFIG_PM_ENABLE the states and their
+ * timing still work; only the locks are no-ops.
+ */
+
+enum class PowerState : uint8_t
+{
+    Riding,
+    Parked,
+    Count,
+};
+
+/**
+ * @brief Locks a client can ask for; OR them together.
+ */
+enum PowerNeed : uint8_t
+{
+    kPowerNeedNone   = 0,
+    kPowerNeedCpuMax = 1 << 0, ///< ESP_PM_CPU_FREQ_MAX: CPU at the maximum clock
+    kPowerNeedApbMax = 1 << 1, ///< ESP_PM_APB_FREQ_MAX: 80 MHz APB for peripherals clocked from it
+    kPowerNeedAwake  = 1 << 2, ///< ESP_PM_NO_LIGHT_SLEEP
+};
+
+using PowerClient = int8_t;
+
+constexpr PowerClient kNoPowerClient = -1;
+
+class PowerManager
+{
+public:
+    /**
+     * Called from the manager's task after each transition. Must not block;
+     * typically it adjusts a duty cycle or notifies the owning task.
+     */
+    using Listener = void (*)(void* context, PowerState state);
+
+    static constexpr std::size_t kMaxClients   = 8;
+    static constexpr std::size_t kMaxListeners = 4;
+
+    struct Stats
+    {
+        PowerState state       = PowerState::Riding;
+        uint32_t   transitions = 0;
+        uint32_t   inStateMs   = 0; ///< Since the last transition
+        uint64_t   totalMs[static_cast<std::size_t>(PowerState::Count)]{};
+        bool       pmEnabled   = false; ///< esp_pm_configure succeeded
+        int        maxFreqMhz  = 0;
+        int        minFreqMhz  = 0;
+        bool       lightSleep  = false;
+    };
+
+    struct ClientInfo
+    {
+        const char* name        = nullptr;
+        uint8_t     ridingNeeds = kPowerNeedNone;
+        uint8_t     parkedNeeds = kPowerNeedNone;
+        uint8_t     held        = kPowerNeedNone; ///< Locks held right now
+    };
+
+    /**
+     * @brief Configures DFS and light sleep and starts the state task.
+     *        The system starts Riding.
+     */
+    static esp_err_t start();
+
+    /**
+     * @brief Registers a client that holds @p ridingNeeds while riding and
+     *        @p parkedNeeds while parked. May be called before start().
+     *        Clients stay registered for the rest of the run.
+     * @return The client, or kNoPowerClient when kMaxClients are registered.
+     */
+    static PowerClient registerClient(const char* name, uint8_t ridingNeeds, uint8_t parkedNeeds);
+
+    /**
+     * @brief Changes what @p client needs; locks are taken or released at once.
+     */
+    static void setNeeds(PowerClient client, uint8_t ridingNeeds, uint8_t parkedNeeds);
+
+    /**
+     * @brief Marks the bike as in use. Cheap enough for the frame path: one
+     *        atomic store, plus a task notification when parked. Not ISR safe.
+     */
+    static void reportActivity();
+
+    /**
+     * @brief Adds a listener for state changes.
+     * @return ESP_ERR_NO_MEM when kMaxListeners are registered.
+     */
+    static esp_err_t subscribe(Listener listener, void* context);
+
+    static PowerState  state();
+    static Stats       stats();
+    static const char* stateName(PowerState state);
+
+    /**
+     * @brief Copies up to @p capacity registered clients to @p out.
+     * @return Number copied.
+     */
+    static std::size_t clients(ClientInfo* out, std::size_t capacity);
+};
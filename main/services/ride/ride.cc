@@ -0,0 +1,547 @@
+#include "ride.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "nvs.h"
+
+#include "telemetry/motor/motor_controller.h"
+
+namespace
+{
+constexpr const char* kLogTag       = "RideService";
+constexpr uint32_t    kTickMs       = 1000;
+constexpr uint32_t    kTaskStack    = 3072;
+constexpr UBaseType_t kTaskPriority = 2;
+
+constexpr const char* kNamespace     = "rides";
+constexpr const char* kCheckpointKey = "open";
+constexpr const char* kUploadedKey   = "sent";
+constexpr uint8_t     kRecordVersion = 1;
+
+constexpr float   kMovingKph = 1.0f;      ///< Slower counts as standing for moving time
+constexpr int64_t kMaxGapUs  = 2'000'000; ///< Longer gaps between frames add no time or energy
+
+constexpr int32_t kPowerBandFloorW[RideSummary::kPowerBands] = {
+    INT32_MIN, 0, 1000, 2000, 4000, 6000, 8000, 12000,
+};
+
+// Fixed-point NVS fields in their units: 0.1 Wh is 3.6e8 W x us
+constexpr int64_t kWusPerDeciWh = 360'000'000;
+
+static_assert(RideService::kHistory <= 32, "unsaved history slots are tracked in a 32-bit mask");
+
+class LockGuard
+{
+public:
+    explicit LockGuard(SemaphoreHandle_t mutex) : mutex_(mutex) { xSemaphoreTake(mutex_, portMAX_DELAY); }
+    ~LockGuard() { xSemaphoreGive(mutex_); }
+
+    LockGuard(const LockGuard&)            = delete;
+    LockGuard& operator=(const LockGuard&) = delete;
+
+private:
+    SemaphoreHandle_t mutex_;
+};
+
+uint16_t saturateSeconds(uint64_t us)
+{
+    return static_cast<uint16_t>(std::min<uint64_t>(us / 1'000'000, UINT16_MAX));
+}
+
+std::size_t powerBand(int32_t watts)
+{
+    std::size_t band = 0;
+    while (band + 1 < RideSummary::kPowerBands && watts >= kPowerBandFloorW[band + 1])
+    {
+        ++band;
+    }
+    return band;
+}
+
+// Rides keep their NVS slot for as long as the ring does, so a finished
+// ride costs one record write
+void slotKey(uint32_t seq, char (&key)[8])
+{
+    std::snprintf(key, sizeof(key), "r%u", static_cast<unsigned>((seq - 1) % RideService::kHistory));
+}
+
+bool validRecord(const RideSummary& ride, std::size_t length)
+{
+    return length == sizeof(RideSummary) && ride.version == kRecordVersion && ride.seq != 0;
+}
+} // namespace
+
+RideService::RideService() : RideService(Config{}) {}
+
+RideService::RideService(const Config& config) : config_(config)
+{
+    mutex_ = xSemaphoreCreateMutex();
+}
+
+RideService::~RideService()
+{
+    stop();
+    if (mutex_ != nullptr)
+    {
+        vSemaphoreDelete(mutex_);
+    }
+    if (taskStopped_ != nullptr)
+    {
+        vSemaphoreDelete(taskStopped_);
+    }
+}
+
+esp_err_t RideService::start()
+{
+    if (running_)
+    {
+        return ESP_OK;
+    }
+    if (mutex_ == nullptr)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+    if (taskStopped_ == nullptr)
+    {
+        taskStopped_ = xSemaphoreCreateBinary();
+        if (taskStopped_ == nullptr)
+        {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    if (!loaded_)
+    {
+        load();
+    }
+
+    running_ = true;
+    if (xTaskCreate(&RideService::taskEntry, "rides", kTaskStack, this, kTaskPriority, &task_) != pdPASS)
+    {
+        running_ = false;
+        task_    = nullptr;
+        ESP_LOGE(kLogTag, "Failed to create ride task");
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(kLogTag,
+             "%u stored ride(s), next is #%u",
+             static_cast<unsigned>(historyCount_),
+             static_cast<unsigned>(nextSeq_));
+    return ESP_OK;
+}
+
+void RideService::stop()
+{
+    if (!running_)
+    {
+        return;
+    }
+
+    running_ = false;
+    if (task_ != nullptr)
+    {
+        xTaskNotifyGive(task_);
+        xSemaphoreTake(taskStopped_, portMAX_DELAY);
+        task_ = nullptr;
+    }
+}
+
+void RideService::update(const TelemetryState& state)
+{
+    const int64_t nowUs  = esp_timer_get_time();
+    const float   speed  = state.data.speedKph;
+    const bool    motion = speed >= kMovingKph || std::fabs(state.iqAmps) >= config_.startAmps;
+
+    uint32_t started  = 0;
+    bool     finished = false;
+    {
+        LockGuard lock(mutex_);
+        if (!loaded_)
+        {
+            return;
+        }
+
+        if (riding_ && nowUs - ride_.lastMotionUs > static_cast<int64_t>(config_.stopAfterMs) * 1000)
+        {
+            // Telemetry kept flowing while parked; the ride ended back then
+            finishLocked(RideSummary::End::Stopped);
+            finished = true;
+        }
+
+        if (!riding_)
+        {
+            const bool startMotion = speed >= config_.startKph || std::fabs(state.iqAmps) >= config_.startAmps;
+            if (!startMotion)
+            {
+                motionSinceUs_ = 0;
+            }
+            else if (motionSinceUs_ == 0)
+            {
+                motionSinceUs_ = nowUs;
+            }
+            if (motionSinceUs_ == 0 || nowUs - motionSinceUs_ < static_cast<int64_t>(config_.startHoldMs) * 1000)
+            {
+                return;
+            }
+
+            ride_              = Accumulator{};
+            ride_.seq          = nextSeq_++;
+            ride_.startUs      = motionSinceUs_;
+            ride_.lastUs       = nowUs;
+            ride_.lastMotionUs = nowUs;
+            ride_.startKm      = state.distanceKm;
+            lastCheckpointUs_  = nowUs;
+            motionSinceUs_     = 0;
+            riding_            = true;
+            started            = ride_.seq;
+        }
+
+        const int64_t gapUs = nowUs - ride_.lastUs;
+        ride_.lastUs        = nowUs;
+        ride_.lastKm        = state.distanceKm;
+        if (motion)
+        {
+            ride_.lastMotionUs = nowUs;
+        }
+
+        if (gapUs > 0 && gapUs <= kMaxGapUs)
+        {
+            const auto watts = static_cast<int32_t>(std::lround(state.data.powerKw * 1000.0f));
+            if (watts >= 0)
+            {
+                ride_.usedWus += static_cast<int64_t>(watts) * gapUs;
+            }
+            else
+            {
+                ride_.regenWus -= static_cast<int64_t>(watts) * gapUs;
+            }
+            if (speed >= kMovingKph)
+            {
+                ride_.movingUs += static_cast<uint64_t>(gapUs);
+            }
+            // Standing time, including the tail before the ride ends, would
+            // swamp the histograms
+            if (motion)
+            {
+                const std::size_t gear = std::min<std::size_t>(state.data.gear, RideSummary::kGears - 1);
+                ride_.gearUs[gear] += static_cast<uint64_t>(gapUs);
+                ride_.bandUs[powerBand(watts)] += static_cast<uint64_t>(gapUs);
+            }
+        }
+
+        const auto deciKph = static_cast<uint16_t>(std::clamp(std::lround(speed * 10.0f), 0L, long{UINT16_MAX}));
+        ride_.maxDeciKph   = std::max(ride_.maxDeciKph, deciKph);
+        ride_.peakMotorC   = std::max(ride_.peakMotorC, static_cast<int16_t>(std::lround(state.data.motorC)));
+        ride_.peakControlC = std::max(ride_.peakControlC, static_cast<int16_t>(std::lround(state.data.controllerC)));
+    }
+
+    if (started != 0)
+    {
+        ESP_LOGI(kLogTag, "Ride #%u started", static_cast<unsigned>(started));
+    }
+    if (finished && task_ != nullptr)
+    {
+        xTaskNotifyGive(task_);
+    }
+}
+
+bool RideService::current(RideSummary& out) const
+{
+    LockGuard lock(mutex_);
+    if (!riding_)
+    {
+        return false;
+    }
+    out = summarizeLocked(RideSummary::End::Open);
+    return true;
+}
+
+std::size_t RideService::history(RideSummary* out, std::size_t capacity) const
+{
+    LockGuard   lock(mutex_);
+    std::size_t count = 0;
+    for (; count < historyCount_ && count < capacity; ++count)
+    {
+        out[count] = history_[(historyHead_ + kHistory - 1 - count) % kHistory];
+    }
+    return count;
+}
+
+bool RideService::nextToUpload(RideSummary& out) const
+{
+    LockGuard lock(mutex_);
+    // Oldest first, so an interrupted sync resumes where it stopped
+    for (std::size_t age = historyCount_; age > 0; --age)
+    {
+        const RideSummary& ride = history_[(historyHead_ + kHistory - age) % kHistory];
+        if (ride.seq > uploadedSeq_)
+        {
+            out = ride;
+            return true;
+        }
+    }
+    return false;
+}
+
+void RideService::markUploaded(uint32_t seq)
+{
+    LockGuard lock(mutex_);
+    if (seq > uploadedSeq_)
+    {
+        uploadedSeq_     = seq;
+        uploadedUnsaved_ = true;
+    }
+}
+
+int32_t RideService::powerBandFloorW(std::size_t band)
+{
+    return band < RideSummary::kPowerBands ? kPowerBandFloorW[band] : INT32_MAX;
+}
+
+const char* RideService::endName(RideSummary::End end)
+{
+    switch (end)
+    {
+        case RideSummary::End::Open:
+            return "open";
+        case RideSummary::End::Stopped:
+            return "stopped";
+        case RideSummary::End::PowerLoss:
+            return "power_loss";
+    }
+    return "unknown";
+}
+
+RideSummary RideService::summarizeLocked(RideSummary::End end) const
+{
+    RideSummary summary;
+    summary.seq          = ride_.seq;
+    summary.durationMs   = static_cast<uint32_t>(std::max<int64_t>(ride_.lastMotionUs - ride_.startUs, 0) / 1000);
+    summary.movingMs     = static_cast<uint32_t>(ride_.movingUs / 1000);
+    summary.distanceM    = static_cast<uint32_t>(std::max(ride_.lastKm - ride_.startKm, 0.0f) * 1000.0f);
+    summary.usedDeciWh   = static_cast<uint32_t>(ride_.usedWus / kWusPerDeciWh);
+    summary.regenDeciWh  = static_cast<uint32_t>(ride_.regenWus / kWusPerDeciWh);
+    summary.maxDeciKph   = ride_.maxDeciKph;
+    summary.peakMotorC   = ride_.peakMotorC == INT16_MIN ? 0 : ride_.peakMotorC;
+    summary.peakControlC = ride_.peakControlC == INT16_MIN ? 0 : ride_.peakControlC;
+    summary.version      = kRecordVersion;
+    summary.end          = end;
+    for (std::size_t i = 0; i < RideSummary::kGears; ++i)
+    {
+        summary.gearS[i] = saturateSeconds(ride_.gearUs[i]);
+    }
+    for (std::size_t i = 0; i < RideSummary::kPowerBands; ++i)
+    {
+        summary.powerBandS[i] = saturateSeconds(ride_.bandUs[i]);
+    }
+    return summary;
+}
+
+void RideService::finishLocked(RideSummary::End end)
+{
+    pushLocked(summarizeLocked(end));
+    riding_          = false;
+    checkpointDue_   = false;
+    checkpointStale_ = true;
+}
+
+void RideService::pushLocked(const RideSummary& ride)
+{
+    history_[historyHead_] = ride;
+    unsaved_ |= 1U << historyHead_;
+    historyHead_  = (historyHead_ + 1) % kHistory;
+    historyCount_ = std::min(historyCount_ + 1, kHistory);
+}
+
+void RideService::load()
+{
+    // Records are read straight into the ring: at the maximum history a
+    // copy would not fit the boot worker's stack next to the NVS calls.
+    // Nothing else touches the ring before loaded_ is set.
+    LockGuard   lock(mutex_);
+    std::size_t count = 0;
+    RideSummary open;
+    bool        haveOpen = false;
+    uint32_t    uploaded = 0;
+
+    nvs_handle_t handle;
+    if (nvs_open(kNamespace, NVS_READONLY, &handle) == ESP_OK)
+    {
+        for (uint32_t slot = 0; slot < kHistory; ++slot)
+        {
+            char key[8];
+            slotKey(slot + 1, key);
+            std::size_t length = sizeof(RideSummary);
+            if (nvs_get_blob(handle, key, &history_[count], &length) == ESP_OK && validRecord(history_[count], length))
+            {
+                ++count;
+            }
+        }
+        std::size_t length = sizeof(open);
+        haveOpen = nvs_get_blob(handle, kCheckpointKey, &open, &length) == ESP_OK && validRecord(open, length);
+        nvs_get_u32(handle, kUploadedKey, &uploaded);
+        nvs_close(handle);
+    }
+
+    std::sort(history_, history_ + count, [](const RideSummary& a, const RideSummary& b) { return a.seq < b.seq; });
+    historyCount_ = count;
+    historyHead_  = count % kHistory;
+    if (count > 0)
+    {
+        nextSeq_ = std::max(nextSeq_, history_[count - 1].seq + 1);
+    }
+    unsaved_     = 0;
+    uploadedSeq_ = uploaded;
+
+    if (haveOpen && open.seq >= nextSeq_)
+    {
+        ESP_LOGW(kLogTag, "Ride #%u was cut short, closing it", static_cast<unsigned>(open.seq));
+        open.end = RideSummary::End::PowerLoss;
+        pushLocked(open);
+        nextSeq_ = open.seq + 1;
+    }
+    checkpointStale_ = haveOpen;
+    loaded_          = true;
+}
+
+void RideService::persist()
+{
+    uint32_t    saving = 0;
+    RideSummary checkpoint;
+    bool        writeOpen = false;
+    bool        eraseOpen = false;
+    uint32_t    uploaded  = 0;
+    bool        writeSent = false;
+    {
+        LockGuard lock(mutex_);
+        saving = unsaved_;
+        if (checkpointDue_ && riding_)
+        {
+            checkpoint        = summarizeLocked(RideSummary::End::Open);
+            writeOpen         = true;
+            checkpointDue_    = false;
+            lastCheckpointUs_ = ride_.lastUs;
+        }
+        eraseOpen = checkpointStale_ && !writeOpen;
+        uploaded  = uploadedSeq_;
+        writeSent = uploadedUnsaved_;
+    }
+    if (saving == 0 && !writeOpen && !eraseOpen && !writeSent)
+    {
+        return;
+    }
+
+    nvs_handle_t handle;
+    if (nvs_open(kNamespace, NVS_READWRITE, &handle) != ESP_OK)
+    {
+        ESP_LOGW(kLogTag, "Rides not saved: NVS unavailable");
+        return;
+    }
+
+    // One record at a time: the ride task's stack has no room for a copy of
+    // the ring. A slot refilled meanwhile holds the newer ride, which is the
+    // one to store.
+    esp_err_t err = ESP_OK;
+    for (std::size_t slot = 0; slot < kHistory && err == ESP_OK; ++slot)
+    {
+        if ((saving & (1U << slot)) == 0)
+        {
+            continue;
+        }
+        RideSummary ride;
+        {
+            LockGuard lock(mutex_);
+            ride = history_[slot];
+        }
+
+        char key[8];
+        slotKey(ride.seq, key);
+        err = nvs_set_blob(handle, key, &ride, sizeof(ride));
+        if (err == ESP_OK)
+        {
+            ESP_LOGI(kLogTag,
+                     "Ride #%u: %u m in %u s, %u.%u Wh",
+                     static_cast<unsigned>(ride.seq),
+                     static_cast<unsigned>(ride.distanceM),
+                     static_cast<unsigned>(ride.durationMs / 1000),
+                     static_cast<unsigned>(ride.usedDeciWh / 10),
+                     static_cast<unsigned>(ride.usedDeciWh % 10));
+        }
+    }
+    if (err == ESP_OK && writeOpen)
+    {
+        err = nvs_set_blob(handle, kCheckpointKey, &checkpoint, sizeof(checkpoint));
+    }
+    else if (err == ESP_OK && eraseOpen)
+    {
+        const esp_err_t eraseErr = nvs_erase_key(handle, kCheckpointKey);
+        err                      = eraseErr == ESP_ERR_NVS_NOT_FOUND ? ESP_OK : eraseErr;
+    }
+    if (err == ESP_OK && writeSent)
+    {
+        err = nvs_set_u32(handle, kUploadedKey, uploaded);
+    }
+    if (err == ESP_OK)
+    {
+        err = nvs_commit(handle);
+    }
+    nvs_close(handle);
+
+    if (err != ESP_OK)
+    {
+        ESP_LOGW(kLogTag, "Rides not saved: %d", err);
+        return;
+    }
+
+    // A checkpoint of a ride that finished meanwhile is harmless: load()
+    // ignores one older than the newest stored ride
+    LockGuard lock(mutex_);
+    unsaved_ &= ~saving;
+    checkpointStale_ = false;
+    uploadedUnsaved_ = uploadedSeq_ != uploaded;
+}
+
+void RideService::tick(int64_t nowUs)
+{
+    LockGuard lock(mutex_);
+    if (!riding_)
+    {
+        return;
+    }
+    if (nowUs - ride_.lastMotionUs > static_cast<int64_t>(config_.stopAfterMs) * 1000)
+    {
+        // No frames at all, e.g. the controller was switched off
+        finishLocked(RideSummary::End::Stopped);
+    }
+    else if (nowUs - lastCheckpointUs_ >= static_cast<int64_t>(config_.checkpointMs) * 1000)
+    {
+        checkpointDue_ = true;
+    }
+}
+
+void RideService::taskEntry(void* arg)
+{
+    auto* self = static_cast<RideService*>(arg);
+
+    while (self->running_)
+    {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(kTickMs));
+        self->tick(esp_timer_get_time());
+        self->persist();
+    }
+
+    // Keep the open ride across a stop or restart
+    {
+        LockGuard lock(self->mutex_);
+        self->checkpointDue_ = self->riding_;
+    }
+    self->persist();
+
+    xSemaphoreGive(self->taskStopped_);
+    vTaskDelete(nullptr);
+}
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+struct TelemetryState;
+
+/**
+ * @file ride.hh
+ * @brief Declares RideService, which detects rides from the controller
+ *        telemetry and keeps a summary of each.
+ *
+ * A ride starts once the wheel has turned or the motor drawn current for a
+ * moment, and ends after CONFIG_JARVIS_RIDE_STOP_S without either, so a red
+ * light does not split it. While it lasts, every telemetry frame folds into
+ * a running summary of fixed size: duration and moving time, distance,
+ * energy drawn and regenerated, speeds, peak temperatures and time spent in
+ * each gear and power band. Nothing per frame is kept, so memory and the
+ * cost of an update do not grow with the length of the ride.
+ *
+ * Finished rides go into a ring of the last CONFIG_JARVIS_RIDE_HISTORY
+ * summaries held in RAM and mirrored to NVS, one 56-byte record per ride,
+ * so GET /api/rides answers from memory. The open ride is checkpointed
+ * every minute; after a power loss it is recovered at the next start()
+ * and closed as of its last checkpoint. HomeSyncService uploads each
+ * finished ride once, through nextToUpload() and markUploaded().
+ */
+
+/**
+ * Summary of one ride, also its NVS record. Integer fixed-point throughout.
+ */
+struct RideSummary
+{
+    static constexpr std::size_t kGears      = 4; ///< Index 0: no gear reported
+    static constexpr std::size_t kPowerBands = 8; ///< See RideService::powerBandFloorW()
+
+    enum class End : uint8_t
+    {
+        Open,      ///< Still riding
+        Stopped,   ///< No motion for the stop timeout
+        PowerLoss, ///< Recovered from the last checkpoint
+    };
+
+    uint32_t seq          = 0; ///< Ride number, counting up across boots
+    uint32_t durationMs   = 0; ///< First to last motion
+    uint32_t movingMs     = 0;
+    uint32_t distanceM    = 0;
+    uint32_t usedDeciWh   = 0; ///< Energy drawn, 0.1 Wh
+    uint32_t regenDeciWh  = 0; ///< Energy recovered, 0.1 Wh
+    uint16_t maxDeciKph   = 0;
+    int16_t  peakMotorC   = 0;
+    int16_t  peakControlC = 0;
+    uint8_t  version      = 1;
+    End      end          = End::Open;
+    uint16_t gearS[kGears]{};           ///< Seconds in motion in each gear, saturating
+    uint16_t powerBandS[kPowerBands]{}; ///< Seconds in motion in each power band, saturating
+
+    /**
+     * @return Average speed over moving time, in 0.1 km/h.
+     */
+    uint32_t avgDeciKph() const
+    {
+        return movingMs == 0 ? 0 : static_cast<uint32_t>(static_cast<uint64_t>(distanceM) * 36000 / movingMs);
+    }
+};
+static_assert(sizeof(RideSummary) == 56, "RideSummary is the NVS record; keep it compact");
+
+class RideService
+{
+public:
+    static constexpr std::size_t kHistory = CONFIG_JARVIS_RIDE_HISTORY;
+
+    struct Config
+    {
+        float    startKph     = CONFIG_JARVIS_RIDE_START_KPH;
+        float    startAmps    = CONFIG_JARVIS_RIDE_START_AMPS; ///< |Iq| that counts as riding at standstill
+        uint32_t startHoldMs  = 2000;                          ///< Motion needed before a ride starts
+        uint32_t stopAfterMs  = CONFIG_JARVIS_RIDE_STOP_S * 1000;
+        uint32_t checkpointMs = 60 * 1000;
+    };
+
+    RideService();
+    explicit RideService(const Config& config);
+    ~RideService();
+
+    RideService(const RideService&)            = delete;
+    RideService& operator=(const RideService&) = delete;
+
+    /**
+     * @brief Loads the stored rides, closes a ride cut short by power loss
+     *        and starts the task that persists rides and ends them when the
+     *        telemetry stops. NVS must be initialised.
+     */
+    esp_err_t start();
+    void      stop();
+
+    /**
+     * @brief Folds one telemetry frame into the ride. Constant time, no
+     *        allocation; call it from the telemetry callback. Ignored until
+     *        start() has loaded the stored rides.
+     */
+    void update(const TelemetryState& state);
+
+    /**
+     * @brief Copies the ride in progress.
+     * @return false when not riding.
+     */
+    bool current(RideSummary& out) const;
+
+    /**
+     * @brief Copies up to @p capacity finished rides, newest first.
+     * @return Number copied.
+     */
+    std::size_t history(RideSummary* out, std::size_t capacity) const;
+
+    /**
+     * @brief Copies the oldest finished ride not yet passed to
+     *        markUploaded().
+     * @return false when every ride in the history has been uploaded.
+     */
+    bool nextToUpload(RideSummary& out) const;
+
+    /**
+     * @brief Records that every finished ride up to @p seq has been
+     *        uploaded. Kept in NVS with the rides, so a ride is sent once.
+     */
+    void markUploaded(uint32_t seq);
+
+    /**
+     * @return Lower bound of power band @p band in W. Band 0 is regeneration
+     *         (below 0 W) and reports INT32_MIN.
+     */
+    static int32_t powerBandFloorW(std::size_t band);
+
+    static const char* endName(RideSummary::End end);
+
+private:
+    // Exact totals behind the open ride; its RideSummary is derived on demand
+    struct Accumulator
+    {
+        uint32_t seq          = 0;
+        int64_t  startUs      = 0;
+        int64_t  lastUs       = 0; ///< Last frame
+        int64_t  lastMotionUs = 0;
+        float    startKm      = 0.0f;
+        float    lastKm       = 0.0f;
+        uint64_t movingUs     = 0;
+        int64_t  usedWus      = 0; ///< Energy as W x us
+        int64_t  regenWus     = 0;
+        uint16_t maxDeciKph   = 0;
+        int16_t  peakMotorC   = INT16_MIN;
+        int16_t  peakControlC = INT16_MIN;
+        uint64_t gearUs[RideSummary::kGears]{};
+        uint64_t bandUs[RideSummary::kPowerBands]{};
+    };
+
+    static void taskEntry(void* arg);
+    void        tick(int64_t nowUs);
+    RideSummary summarizeLocked(RideSummary::End end) const;
+    void        finishLocked(RideSummary::End end);
+    void        pushLocked(const RideSummary& ride);
+    void        load();
+    void        persist();
+
+    Config            config_{};
+    SemaphoreHandle_t mutex_       = nullptr;
+    SemaphoreHandle_t taskStopped_ = nullptr;
+    TaskHandle_t      task_        = nullptr;
+    volatile bool     running_     = false;
+    bool              loaded_      = false;
+
+    bool        riding_        = false;
+    int64_t     motionSinceUs_ = 0; ///< Start of the current motion while not riding
+    Accumulator ride_{};
+    uint32_t    nextSeq_ = 1;
+
+    RideSummary history_[kHistory]{};
+    std::size_t historyCount_     = 0;
+    std::size_t historyHead_      = 0; ///< Slot the next finished ride goes to
+    uint32_t    unsaved_          = 0; ///< Bitmask of history slots not yet in NVS
+    uint32_t    uploadedSeq_      = 0; ///< Newest ride passed to markUploaded()
+    bool        uploadedUnsaved_  = false;
+    bool        checkpointDue_    = false;
+    bool        checkpointStale_  = false; ///< The stored open ride has finished
+    int64_t     lastCheckpointUs_ = 0;
+};
@@ -0,0 +1,246 @@
+#include "motor_sim.hh"
+
+#if CONFIG_JARVIS_SIMULATOR
+
+#include <algorithm>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "services/mem/mem.hh"
+
+namespace
+{
+constexpr const char* kLogTag       = "MotorSim";
+constexpr uint32_t    kTaskStack    = 4096;
+constexpr UBaseType_t kTaskPriority = 5;
+constexpr uint32_t    kMaxBurst     = 256; ///< Frames per wake-up before yielding to other tasks
+
+class LockGuard
+{
+public:
+    explicit LockGuard(SemaphoreHandle_t mutex) : mutex_(mutex) { xSemaphoreTake(mutex_, portMAX_DELAY); }
+    ~LockGuard() { xSemaphoreGive(mutex_); }
+
+    LockGuard(const LockGuard&)            = delete;
+    LockGuard& operator=(const LockGuard&) = delete;
+
+private:
+    SemaphoreHandle_t mutex_;
+};
+
+MotorSimService::LatencySummary summarize(const LatencyHistogram& histogram, uint32_t maxUs)
+{
+    MotorSimService::LatencySummary summary;
+    summary.p50Us = std::min(histogram.quantile(0.5f), maxUs);
+    summary.p99Us = std::min(histogram.quantile(0.99f), maxUs);
+    summary.maxUs = maxUs;
+    return summary;
+}
+} // namespace
+
+MotorSimService::MotorSimService()
+{
+    mutex_       = xSemaphoreCreateMutex();
+    taskStopped_ = xSemaphoreCreateBinary();
+    powerClient_ = PowerManager::registerClient("sim", kPowerNeedNone, kPowerNeedNone);
+}
+
+MotorSimService::~MotorSimService()
+{
+    stop();
+    if (mutex_ != nullptr)
+    {
+        vSemaphoreDelete(mutex_);
+    }
+    if (taskStopped_ != nullptr)
+    {
+        vSemaphoreDelete(taskStopped_);
+    }
+}
+
+void MotorSimService::setSink(FrameSink sink, void* context)
+{
+    sink_        = sink;
+    sinkContext_ = context;
+}
+
+esp_err_t MotorSimService::start(const RunConfig& config)
+{
+    if (mutex_ == nullptr || taskStopped_ == nullptr)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+    if (running_ || sink_ == nullptr)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!(config.rateMultiplier > 0.0f && config.rateMultiplier <= kMaxRateMultiplier))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // A run that ended on its own still has to be reaped.
+    join();
+
+    config_ = config;
+    handlerUs_.reset();
+    endToEndUs_.reset();
+    {
+        LockGuard lock(mutex_);
+        stats_                = Stats{};
+        stats_.running        = true;
+        stats_.profile        = config.simulator.profile;
+        stats_.rateMultiplier = config.rateMultiplier;
+        handlerMaxUs_         = 0;
+        endToEndMaxUs_        = 0;
+        startUs_              = esp_timer_get_time();
+    }
+
+    running_ = true;
+    if (xTaskCreate(&MotorSimService::taskEntry, "motor_sim", kTaskStack, this, kTaskPriority, &task_) != pdPASS)
+    {
+        running_ = false;
+        task_    = nullptr;
+        LockGuard lock(mutex_);
+        stats_.running = false;
+        ESP_LOGE(kLogTag, "Failed to create simulator task");
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(kLogTag,
+             "Simulating '%s' at %.1fx for %u ms",
+             MotorSimulator::profileName(config.simulator.profile),
+             static_cast<double>(config.rateMultiplier),
+             static_cast<unsigned>(config.durationMs));
+    return ESP_OK;
+}
+
+void MotorSimService::stop()
+{
+    running_ = false;
+    join();
+}
+
+void MotorSimService::join()
+{
+    if (task_ != nullptr)
+    {
+        xSemaphoreTake(taskStopped_, portMAX_DELAY);
+        task_ = nullptr;
+    }
+}
+
+MotorSimService::Stats MotorSimService::stats() const
+{
+    LockGuard lock(mutex_);
+    Stats     stats = stats_;
+    if (stats.running)
+    {
+        stats.elapsedMs = static_cast<uint32_t>((esp_timer_get_time() - startUs_) / 1000);
+    }
+    if (stats.elapsedMs > 0)
+    {
+        stats.framesPerSecond = static_cast<float>(stats.framesDelivered) * 1000.0f / static_cast<float>(stats.elapsedMs);
+    }
+    stats.handler  = summarize(handlerUs_, handlerMaxUs_);
+    stats.endToEnd = summarize(endToEndUs_, endToEndMaxUs_);
+    return stats;
+}
+
+void MotorSimService::taskEntry(void* arg)
+{
+    auto* self = static_cast<MotorSimService*>(arg);
+    MemAccounting::setTaskTag(MemTag::Telemetry);
+    self->run();
+    xSemaphoreGive(self->taskStopped_);
+    vTaskDelete(nullptr);
+}
+
+void MotorSimService::run()
+{
+    MotorSimulator        simulator(config_.simulator);
+    MotorSimulator::Frame frame;
+
+    const double  periodUs   = static_cast<double>(MotorSimulator::kFramePeriodUs) / config_.rateMultiplier;
+    const int64_t durationUs = static_cast<int64_t>(config_.durationMs) * 1000;
+    const int64_t startUs    = startUs_;
+    uint64_t      sent       = 0;
+
+    // Runs are benchmarks: pin the clock and keep the chip awake whatever
+    // the power state, so latencies compare across runs.
+    constexpr uint8_t kRunNeeds = kPowerNeedCpuMax | kPowerNeedAwake;
+    PowerManager::setNeeds(powerClient_, kRunNeeds, kRunNeeds);
+
+    while (running_)
+    {
+        int64_t nowUs = esp_timer_get_time();
+        if (durationUs > 0 && nowUs - startUs >= durationUs)
+        {
+            break;
+        }
+
+        // Send every frame whose slot has passed, up to a burst limit so an
+        // overloaded pipeline cannot starve the rest of the system.
+        for (uint32_t burst = 0; burst < kMaxBurst && running_; ++burst)
+        {
+            const int64_t dueUs = startUs + static_cast<int64_t>(static_cast<double>(sent) * periodUs);
+            if (dueUs > nowUs)
+            {
+                break;
+            }
+            const auto backlog = static_cast<uint32_t>(static_cast<double>(nowUs - dueUs) / periodUs);
+
+            simulator.next(frame);
+            ++sent;
+
+            uint32_t handlerUs  = 0;
+            uint32_t endToEndUs = 0;
+            if (frame.fate != MotorSimulator::FrameFate::Dropped)
+            {
+                const int64_t handOffUs = esp_timer_get_time();
+                sink_(sinkContext_, frame.bytes, frame.length);
+                nowUs      = esp_timer_get_time();
+                handlerUs  = static_cast<uint32_t>(nowUs - handOffUs);
+                endToEndUs = static_cast<uint32_t>(nowUs - dueUs);
+                handlerUs_.record(handlerUs);
+                endToEndUs_.record(endToEndUs);
+            }
+
+            LockGuard lock(mutex_);
+            ++stats_.framesGenerated;
+            switch (frame.fate)
+            {
+                case MotorSimulator::FrameFate::Dropped:
+                    ++stats_.framesDropped;
+                    break;
+                case MotorSimulator::FrameFate::Corrupted:
+                    ++stats_.framesCorrupted;
+                    ++stats_.framesDelivered;
+                    break;
+                case MotorSimulator::FrameFate::Intact:
+                    ++stats_.framesDelivered;
+                    break;
+            }
+            stats_.maxBacklog = std::max(stats_.maxBacklog, backlog);
+            handlerMaxUs_     = std::max(handlerMaxUs_, handlerUs);
+            endToEndMaxUs_    = std::max(endToEndMaxUs_, endToEndUs);
+            stats_.ride       = simulator.ride();
+        }
+
+        vTaskDelay(1);
+    }
+
+    PowerManager::setNeeds(powerClient_, kPowerNeedNone, kPowerNeedNone);
+
+    LockGuard lock(mutex_);
+    stats_.running   = false;
+    stats_.elapsedMs = static_cast<uint32_t>((esp_timer_get_time() - startUs) / 1000);
+    running_         = false;
+    ESP_LOGI(kLogTag,
+             "Run finished: %u frames delivered in %u ms",
+             static_cast<unsigned>(stats_.framesDelivered),
+             static_cast<unsigned>(stats_.elapsedMs));
+}
+
+#endif // CONFIG_JARVIS_SIMULATOR
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#include "services/metrics/metrics.hh"
+#include "services/power/power.hh"
+#include "telemetry/motor/motor_simulator.h"
+
+/**
+ * @file motor_sim.hh
+ * @brief Declares MotorSimService, a fake BLE transport that plays
+ *        MotorSimulator frames into the telemetry ingestion path.
+ *
+ * A task paces frames at the controller's cadence times a rate multiplier
+ * and hands each one to the sink, the same call a BLE notify target makes
+ * (MotorController::handleNotification). Dropped frames are never handed
+ * over; corrupted ones are, so the decoder's rejection paths see load too.
+ *
+ * Timers tick at the FreeRTOS rate, so frames due within one tick are sent
+ * back to back, much like notifications batched into one connection event.
+ * Two latencies are recorded per delivered frame: handler time (sink call
+ * to return) and end-to-end time (scheduled arrival to return, which also
+ * grows when the pipeline falls behind).
+ */
+class MotorSimService
+{
+public:
+    using FrameSink = void (*)(void* context, const uint8_t* data, std::size_t length);
+
+    static constexpr float kMaxRateMultiplier = 10.0f;
+
+    struct RunConfig
+    {
+        MotorSimulator::Config simulator{};
+        float                  rateMultiplier = 1.0f;      ///< Playback speed, 1 = real time
+        uint32_t               durationMs     = 60 * 1000; ///< 0 runs until stop()
+    };
+
+    struct LatencySummary
+    {
+        uint32_t p50Us = 0;
+        uint32_t p99Us = 0;
+        uint32_t maxUs = 0;
+    };
+
+    struct Stats
+    {
+        bool                      running         = false;
+        MotorSimulator::Profile   profile         = MotorSimulator::Profile::Idle;
+        float                     rateMultiplier  = 0.0f;
+        uint32_t                  elapsedMs       = 0;
+        uint32_t                  framesGenerated = 0;
+        uint32_t                  framesDelivered = 0;
+        uint32_t                  framesDropped   = 0;
+        uint32_t                  framesCorrupted = 0;
+        uint32_t                  maxBacklog      = 0; ///< Most frames overdue at once
+        float                     framesPerSecond = 0.0f;
+        LatencySummary            handler{};
+        LatencySummary            endToEnd{};
+        MotorSimulator::RideState ride{};
+    };
+
+    MotorSimService();
+    ~MotorSimService();
+
+    MotorSimService(const MotorSimService&)            = delete;
+    MotorSimService& operator=(const MotorSimService&) = delete;
+
+    /**
+     * @brief Sets where frames go. Call before start().
+     */
+    void setSink(FrameSink sink, void* context);
+
+    /**
+     * @brief Starts a run, resetting the statistics.
+     * @return ESP_ERR_INVALID_STATE while a run is in progress or no sink is
+     *         set, ESP_ERR_INVALID_ARG for a rate outside (0, 10].
+     */
+    esp_err_t start(const RunConfig& config);
+    void      stop();
+
+    Stats stats() const;
+
+private:
+    static void taskEntry(void* arg);
+    void        run();
+    void        join();
+
+    FrameSink        sink_        = nullptr;
+    void*            sinkContext_ = nullptr;
+    RunConfig        config_{};
+    LatencyHistogram handlerUs_{};
+    LatencyHistogram endToEndUs_{};
+
+    Stats    stats_{};
+    int64_t  startUs_       = 0;
+    uint32_t handlerMaxUs_  = 0;
+    uint32_t endToEndMaxUs_ = 0;
+
+    mutable SemaphoreHandle_t mutex_       = nullptr;
+    SemaphoreHandle_t         taskStopped_ = nullptr;
+    TaskHandle_t              task_        = nullptr;
+    volatile bool             running_     = false;
+    PowerClient               powerClient_ = kNoPowerClient;
+};
@@ -0,0 +1,334 @@
+#include "asset_store.hh"
+
+#include <cstring>
+
+#include "esp_log.h"
+#include "esp_rom_crc.h"
+
+namespace
+{
+constexpr const char* kLogTag          = "WebAssets";
+constexpr std::size_t kFlashSectorSize = 4096;
+constexpr std::size_t kSlotCount       = 2;
+
+uint32_t readU32(const uint8_t* p)
+{
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16) |
+           (static_cast<uint32_t>(p[3]) << 24);
+}
+
+uint16_t readU16(const uint8_t* p)
+{
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+/**
+ * True when a NUL-terminated string starts at @p offset and ends inside the
+ * image.
+ */
+bool stringInImage(const uint8_t* base, std::size_t imageSize, uint32_t offset)
+{
+    return offset < imageSize && std::memchr(base + offset, '\0', imageSize - offset) != nullptr;
+}
+} // namespace
+
+esp_err_t WebAssetStore::mount()
+{
+    if (mounted())
+    {
+        return ESP_OK;
+    }
+
+    esp_err_t err = findPartition();
+    if (err != ESP_OK)
+    {
+        return err;
+    }
+
+    // Slot 0 first: it is what a fresh flash writes
+    esp_err_t first = ESP_OK;
+    for (std::size_t slot = 0; slot < kSlotCount; ++slot)
+    {
+        Mapping mapping;
+        err = mapSlot(slot, mapping);
+        if (err == ESP_OK)
+        {
+            mapping_ = mapping;
+            slot_    = slot;
+            ESP_LOGI(kLogTag,
+                     "Mounted %u assets (%u bytes) from '%s' slot %u",
+                     mapping_.count,
+                     static_cast<unsigned>(mapping_.imageSize),
+                     partition_->label,
+                     static_cast<unsigned>(slot));
+            return ESP_OK;
+        }
+        if (slot == 0)
+        {
+            first = err;
+        }
+    }
+
+    ESP_LOGW(kLogTag, "No valid asset bundle installed");
+    return first;
+}
+
+esp_err_t WebAssetStore::mapSlot(std::size_t slot, Mapping& out) const
+{
+    const std::size_t offset = slot * slotSize_;
+
+    uint8_t   header[kHeaderSize];
+    esp_err_t err = esp_partition_read(partition_, offset, header, sizeof(header));
+    if (err != ESP_OK)
+    {
+        return err;
+    }
+
+    const uint32_t magic     = readU32(header);
+    const uint16_t version   = readU16(header + 4);
+    const uint16_t count     = readU16(header + 6);
+    const uint32_t imageSize = readU32(header + 8);
+    const uint32_t crc       = readU32(header + 12);
+
+    if (magic != kMagic)
+    {
+        ESP_LOGD(kLogTag, "Slot %u is empty", static_cast<unsigned>(slot));
+        return ESP_ERR_INVALID_CRC;
+    }
+    if (version != kVersion)
+    {
+        ESP_LOGW(kLogTag, "Slot %u: unsupported bundle version %u", static_cast<unsigned>(slot), static_cast<unsigned>(version));
+        return ESP_ERR_INVALID_VERSION;
+    }
+    if (imageSize < kHeaderSize + count * sizeof(Entry) || imageSize > slotSize_)
+    {
+        ESP_LOGW(kLogTag,
+                 "Slot %u: bundle size %u does not fit a %u byte slot",
+                 static_cast<unsigned>(slot),
+                 static_cast<unsigned>(imageSize),
+                 static_cast<unsigned>(slotSize_));
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    const void* mapped = nullptr;
+    err = esp_partition_mmap(partition_, offset, imageSize, ESP_PARTITION_MMAP_DATA, &mapped, &out.handle);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(kLogTag, "esp_partition_mmap failed: %d", err);
+        return err;
+    }
+
+    out.base      = static_cast<const uint8_t*>(mapped);
+    out.entries   = reinterpret_cast<const Entry*>(out.base + kHeaderSize);
+    out.imageSize = imageSize;
+    out.count     = count;
+
+    if (esp_rom_crc32_le(0, out.base + kHeaderSize, imageSize - kHeaderSize) != crc)
+    {
+        ESP_LOGW(kLogTag, "Slot %u: bundle CRC mismatch", static_cast<unsigned>(slot));
+        err = ESP_ERR_INVALID_CRC;
+    }
+    else if (!entriesValid(out))
+    {
+        ESP_LOGW(kLogTag, "Slot %u: bundle entries point outside the image", static_cast<unsigned>(slot));
+        err = ESP_ERR_INVALID_SIZE;
+    }
+    if (err != ESP_OK)
+    {
+        esp_partition_munmap(out.handle);
+        out = Mapping{};
+    }
+    return err;
+}
+
+bool WebAssetStore::entriesValid(const Mapping& mapping)
+{
+    // The CRC only says the bytes arrived as built; a bundle built wrong
+    // must not make find() read past the mapping.
+    for (std::size_t i = 0; i < mapping.count; ++i)
+    {
+        const Entry& entry = mapping.entries[i];
+        if (!stringInImage(mapping.base, mapping.imageSize, entry.pathOffset) ||
+            !stringInImage(mapping.base, mapping.imageSize, entry.mimeOffset) ||
+            !stringInImage(mapping.base, mapping.imageSize, entry.etagOffset))
+        {
+            return false;
+        }
+        if (entry.dataOffset > mapping.imageSize || entry.length > mapping.imageSize - entry.dataOffset)
+        {
+            return false;
+        }
+        // find() binary-searches by hash
+        if (i > 0 && entry.pathHash < mapping.entries[i - 1].pathHash)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void WebAssetStore::unmount()
+{
+    if (!mounted())
+    {
+        return;
+    }
+    esp_partition_munmap(mapping_.handle);
+    mapping_ = Mapping{};
+}
+
+esp_err_t WebAssetStore::findPartition()
+{
+    if (partition_ != nullptr)
+    {
+        return ESP_OK;
+    }
+    partition_ = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, CONFIG_JARVIS_WEBUI_PARTITION_LABEL);
+    if (partition_ == nullptr)
+    {
+        ESP_LOGW(kLogTag, "No '%s' partition", CONFIG_JARVIS_WEBUI_PARTITION_LABEL);
+        return ESP_ERR_NOT_FOUND;
+    }
+    slotSize_ = partition_->size / kSlotCount / kFlashSectorSize * kFlashSectorSize;
+    return ESP_OK;
+}
+
+uint32_t WebAssetStore::hashPath(const char* path, std::size_t length)
+{
+    uint32_t hash = 2166136261u;
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        hash ^= static_cast<uint8_t>(path[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+bool WebAssetStore::find(const char* path, std::size_t length, WebAsset& out) const
+{
+    if (!mounted())
+    {
+        return false;
+    }
+
+    const uint32_t hash    = hashPath(path, length);
+    const Entry*   entries = mapping_.entries;
+
+    std::size_t first = 0;
+    std::size_t last  = mapping_.count;
+    while (first < last)
+    {
+        const std::size_t mid = first + (last - first) / 2;
+        if (entries[mid].pathHash < hash)
+        {
+            first = mid + 1;
+        }
+        else
+        {
+            last = mid;
+        }
+    }
+
+    for (std::size_t i = first; i < mapping_.count && entries[i].pathHash == hash; ++i)
+    {
+        // Strings were checked to end inside the image at mount
+        const Entry& entry     = entries[i];
+        const char*  entryPath = reinterpret_cast<const char*>(mapping_.base + entry.pathOffset);
+        if (std::strlen(entryPath) != length || std::memcmp(entryPath, path, length) != 0)
+        {
+            continue;
+        }
+
+        out.path      = entryPath;
+        out.mimeType  = reinterpret_cast<const char*>(mapping_.base + entry.mimeOffset);
+        out.etag      = reinterpret_cast<const char*>(mapping_.base + entry.etagOffset);
+        out.data      = mapping_.base + entry.dataOffset;
+        out.length    = entry.length;
+        out.gzip      = (entry.flags & kFlagGzip) != 0;
+        out.immutable = (entry.flags & kFlagImmutable) != 0;
+        return true;
+    }
+    return false;
+}
+
+esp_err_t WebAssetStore::beginUpdate(std::size_t imageSize)
+{
+    esp_err_t err = findPartition();
+    if (err != ESP_OK)
+    {
+        return err;
+    }
+    if (imageSize < kHeaderSize || imageSize > slotSize_)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    updateSlot_                 = mounted() ? (slot_ + 1) % kSlotCount : 0;
+    const std::size_t eraseSize = (imageSize + kFlashSectorSize - 1) / kFlashSectorSize * kFlashSectorSize;
+    err                         = esp_partition_erase_range(partition_, updateSlot_ * slotSize_, eraseSize);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(kLogTag, "Erase failed: %d", err);
+        return err;
+    }
+
+    updateSize_    = imageSize;
+    updateWritten_ = 0;
+    return ESP_OK;
+}
+
+esp_err_t WebAssetStore::writeUpdate(const uint8_t* data, std::size_t length)
+{
+    if (updateSize_ == 0 || updateWritten_ + length > updateSize_)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    const esp_err_t err = esp_partition_write(partition_, updateSlot_ * slotSize_ + updateWritten_, data, length);
+    if (err == ESP_OK)
+    {
+        updateWritten_ += length;
+    }
+    return err;
+}
+
+esp_err_t WebAssetStore::finishUpdate()
+{
+    const bool complete = updateSize_ != 0 && updateWritten_ == updateSize_;
+    updateSize_         = 0;
+    updateWritten_      = 0;
+    if (!complete)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    Mapping         mapping;
+    const esp_err_t err = mapSlot(updateSlot_, mapping);
+    if (err != ESP_OK)
+    {
+        return err;
+    }
+
+    unmount();
+    mapping_ = mapping;
+    slot_    = updateSlot_;
+
+    // Only now may the old bundle go: with two valid slots, slot 0 wins
+    const std::size_t other = (updateSlot_ + 1) % kSlotCount;
+    if (esp_partition_erase_range(partition_, other * slotSize_, kFlashSectorSize) != ESP_OK)
+    {
+        ESP_LOGW(kLogTag, "Failed to retire slot %u", static_cast<unsigned>(other));
+    }
+
+    ESP_LOGI(kLogTag,
+             "Mounted %u uploaded assets (%u bytes) from slot %u",
+             mapping_.count,
+             static_cast<unsigned>(mapping_.imageSize),
+             static_cast<unsigned>(slot_));
+    return ESP_OK;
+}
+
+void WebAssetStore::abortUpdate()
+{
+    updateSize_    = 0;
+    updateWritten_ = 0;
+}
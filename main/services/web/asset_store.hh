@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "esp_err.h"
+#include "esp_partition.h"
+#include "sdkconfig.h"
+
+/**
+ * @file asset_store.hh
+ * @brief Web UI assets served from a memory-mapped flash partition.
+ *
+ * The UI lives in its own data partition as a packed bundle built by
+ * `tools/web_assets.py bundle`, so it can be reflashed (or uploaded through
+ * `/api/webui`) without touching the app image. The whole bundle is mapped
+ * into the data address space once; lookups return pointers straight into
+ * the mapping, which the HTTP server hands to the socket without copying.
+ *
+ * Bundle format (little-endian):
+ *
+ *     header    magic u32 'JWUI', version u16, count u16,
+ *               imageSize u32 (whole bundle), crc32 u32 (bytes after header)
+ *     entries   count x { pathHash u32, pathOffset u32, mimeOffset u32,
+ *               etagOffset u32, dataOffset u32, length u32, flags u32 },
+ *               sorted by pathHash (FNV-1a)
+ *     strings   NUL-terminated paths, MIME types and ETags
+ *     data      asset bodies, 4-byte aligned
+ *
+ * Offsets are relative to the start of the bundle. mount() checks every
+ * entry against the image (strings NUL-terminated inside it, bodies within
+ * it, hashes sorted) once, so lookups can trust them.
+ *
+ * The partition is split into two slots. `idf.py flash` writes slot 0;
+ * uploads go to whichever slot is not mounted, and only once the new bundle
+ * has mounted is the old slot's header erased. A failed or interrupted
+ * upload leaves the old bundle mounted and bootable. When both slots hold a
+ * valid bundle, slot 0 wins, so a fresh flash replaces an uploaded UI.
+ */
+
+/**
+ * @brief One servable file; all pointers stay valid while the source is
+ *        mounted.
+ */
+struct WebAsset
+{
+    const char*    path;
+    const char*    mimeType;
+    const char*    etag;
+    const uint8_t* data;
+    std::size_t    length;
+    bool           gzip;
+    bool           immutable;
+};
+
+class WebAssetStore
+{
+public:
+    static constexpr uint32_t kMagic   = 0x4955574A; ///< 'JWUI'
+    static constexpr uint16_t kVersion = 1;
+
+    WebAssetStore() = default;
+    ~WebAssetStore() { unmount(); }
+
+    WebAssetStore(const WebAssetStore&)            = delete;
+    WebAssetStore& operator=(const WebAssetStore&) = delete;
+
+    /**
+     * @brief Maps and validates the bundle in slot 0, else slot 1.
+     * @return ESP_ERR_NOT_FOUND without a partition, ESP_ERR_INVALID_CRC,
+     *         ESP_ERR_INVALID_VERSION or ESP_ERR_INVALID_SIZE for a missing
+     *         or damaged bundle.
+     */
+    esp_err_t mount();
+    void      unmount();
+    bool      mounted() const { return mapping_.base != nullptr; }
+
+    /**
+     * @param path   Request path, not necessarily NUL-terminated.
+     * @param length Length of @p path.
+     */
+    bool find(const char* path, std::size_t length, WebAsset& out) const;
+
+    /**
+     * @brief Writes a new bundle into the slot that is not mounted. The
+     *        current bundle stays mounted and servable throughout.
+     * @return ESP_ERR_INVALID_SIZE when @p imageSize exceeds a slot.
+     */
+    esp_err_t beginUpdate(std::size_t imageSize);
+    esp_err_t writeUpdate(const uint8_t* data, std::size_t length);
+
+    /**
+     * @brief Mounts the written bundle in place of the current one. Pointers
+     *        from find() die with the old mapping, so the caller must keep
+     *        readers out for the duration of this call. On failure the
+     *        current bundle stays mounted.
+     */
+    esp_err_t finishUpdate();
+
+    /**
+     * @brief Abandons an update; the current bundle stays mounted.
+     */
+    void abortUpdate();
+
+    std::size_t imageSize() const { return mapping_.imageSize; }
+    uint16_t    count() const { return mapping_.count; }
+    std::size_t slotSize() const { return slotSize_; }
+    int         mountedSlot() const { return mounted() ? static_cast<int>(slot_) : -1; }
+
+private:
+    struct Entry
+    {
+        uint32_t pathHash;
+        uint32_t pathOffset;
+        uint32_t mimeOffset;
+        uint32_t etagOffset;
+        uint32_t dataOffset;
+        uint32_t length;
+        uint32_t flags;
+    };
+
+    struct Mapping
+    {
+        esp_partition_mmap_handle_t handle    = 0;
+        const uint8_t*              base      = nullptr;
+        const Entry*                entries   = nullptr;
+        std::size_t                 imageSize = 0;
+        uint16_t                    count     = 0;
+    };
+
+    static constexpr std::size_t kHeaderSize    = 16;
+    static constexpr uint32_t    kFlagGzip      = 1u << 0;
+    static constexpr uint32_t    kFlagImmutable = 1u << 1;
+
+    esp_err_t       findPartition();
+    esp_err_t       mapSlot(std::size_t slot, Mapping& out) const;
+    static bool     entriesValid(const Mapping& mapping);
+    static uint32_t hashPath(const char* path, std::size_t length);
+
+    const esp_partition_t* partition_     = nullptr;
+    std::size_t            slotSize_      = 0;
+    Mapping                mapping_{};
+    std::size_t            slot_          = 0;
+    std::size_t            updateSlot_    = 0;
+    std::size_t            updateSize_    = 0;
+    std::size_t            updateWritten_ = 0;
+};
@@ -1,77 +1,1333 @@
 #include "http_server.hh"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <string>
 
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
 #include "esp_check.h"
 #include "esp_err.h"
+#include "esp_http_client.h"
 #include "esp_log.h"
 #include "esp_http_server.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
+
+#include "services/boot/boot.hh"
+#include "services/config/config_store.hh"
+#include "services/history/history.hh"
+#include "services/log/deferred_log.hh"
+#include "services/mem/mem.hh"
+#include "services/metrics/metrics.hh"
+#include "services/ota/ota.hh"
+#include "services/ota/ota_delta.hh"
+#include "services/power/power.hh"
+#include "services/ride/ride.hh"
+#include "services/sim/motor_sim.hh"
+#include "services/web/asset_store.hh"
+#include "services/web/http_workers.hh"
+#include "services/web/live_broadcast.hh"
+#include "services/wifi/wifi.hh"
+
+#if CONFIG_JARVIS_WEBUI_EMBEDDED
+#include "web_assets.h"
+#endif
+
+namespace
+{
+constexpr const char* kLogTag              = "WebServer";
+constexpr std::size_t kMaxPostBodyBytes    = 512;
+constexpr std::size_t kMaxUriHandlers      = 24;
+constexpr std::size_t kMaxIfNoneMatchBytes = 256;
+constexpr const char* kCacheImmutable      = "public, max-age=31536000, immutable";
+constexpr const char* kCacheRevalidate     = "no-cache";
+constexpr std::size_t kUploadChunkBytes    = 1024;
+constexpr int         kUploadRecvRetries   = 5; ///< Consecutive socket timeouts tolerated mid-upload
+constexpr std::size_t kInlineAssetBytes    = 4 * 1024; ///< Larger bodies are sent from a worker
+constexpr uint32_t    kMaxHistoryPoints    = 2000;     ///< Wider than any chart the UI draws
+constexpr uint64_t    kRestartDelayUs      = 1000 * 1000;
+httpd_handle_t        s_httpd              = nullptr;
+uint16_t              s_port               = 0;
+WebAssetStore         s_assets;
+HttpWorkerPool        s_workers;
+OtaUpdater            s_ota;
+ConfigStore*          s_settings           = nullptr;
+MotorSimService*      s_simulator          = nullptr;
+WifiService*          s_wifi               = nullptr;
+RideService*          s_rides              = nullptr;
+RideSummary           s_rideScratch[RideService::kHistory]; ///< rides_get_handler() only; it runs on the httpd task
+TelemetryHistory*     s_history            = nullptr;
+LiveBroadcast*        s_live               = nullptr;
+
+// Assets may be read from several workers at once. An upload writes the
+// other slot while they do; readers only back off with 503 while the new
+// bundle's mapping replaces the old one.
+std::atomic<int>  s_assetReaders{0};
+std::atomic<bool> s_assetsUpdating{false};
+
+class AssetReadGuard
+{
+public:
+    AssetReadGuard() : acquired_(true)
+    {
+        ++s_assetReaders;
+        if (s_assetsUpdating)
+        {
+            --s_assetReaders;
+            acquired_ = false;
+        }
+    }
+    ~AssetReadGuard()
+    {
+        if (acquired_)
+        {
+            --s_assetReaders;
+        }
+    }
+
+    AssetReadGuard(const AssetReadGuard&)            = delete;
+    AssetReadGuard& operator=(const AssetReadGuard&) = delete;
+
+    bool acquired() const { return acquired_; }
+
+private:
+    bool acquired_;
+};
+
+class AssetUpdateGuard
+{
+public:
+    AssetUpdateGuard()
+    {
+        s_assetsUpdating = true;
+        while (s_assetReaders > 0)
+        {
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
+    }
+    ~AssetUpdateGuard() { s_assetsUpdating = false; }
+
+    AssetUpdateGuard(const AssetUpdateGuard&)            = delete;
+    AssetUpdateGuard& operator=(const AssetUpdateGuard&) = delete;
+};
+
+esp_err_t send_json(httpd_req_t* req, const char* payload)
+{
+    JARVIS_PROBE(HttpSend);
+    JARVIS_COUNT(HttpResponses);
+    httpd_resp_set_type(req, "application/json");
+    return httpd_resp_send(req, payload, HTTPD_RESP_USE_STRLEN);
+}
+
+/**
+ * Example GET handler that returns a minimal JSON payload describing device
+ * status. The response body illustrates how REST endpoints can respond with
+ * JSON.
+ */
+esp_err_t status_get_handler(httpd_req_t* req)
+{
+    static constexpr const char* kPayload = R"({"status":"ok","message":"Jarvis web server ready"})";
+    ESP_LOGI(kLogTag, "GET %s", req->uri);
+    return send_json(req, kPayload);
+}
+
+/**
+ * Current power state, time spent in each state and the locks each client
+ * holds (bitmask of PowerNeed).
+ */
+esp_err_t power_get_handler(httpd_req_t* req)
+{
+    const PowerManager::Stats stats = PowerManager::stats();
+
+    PowerManager::ClientInfo clients[PowerManager::kMaxClients];
+    const std::size_t        clientCount = PowerManager::clients(clients, PowerManager::kMaxClients);
+
+    std::string body;
+    body.reserve(256 + clientCount * 64);
+
+    char text[256];
+    std::snprintf(text,
+                  sizeof(text),
+                  R"({"state":"%s","inStateMs":%u,"transitions":%u,"ridingMs":%llu,"parkedMs":%llu,)"
+                  R"("pm":{"enabled":%s,"maxMhz":%d,"minMhz":%d,"lightSleep":%s},"clients":[)",
+                  PowerManager::stateName(stats.state),
+                  static_cast<unsigned>(stats.inStateMs),
+                  static_cast<unsigned>(stats.transitions),
+                  static_cast<unsigned long long>(stats.totalMs[static_cast<std::size_t>(PowerState::Riding)]),
+                  static_cast<unsigned long long>(stats.totalMs[static_cast<std::size_t>(PowerState::Parked)]),
+                  stats.pmEnabled ? "true" : "false",
+                  stats.maxFreqMhz,
+                  stats.minFreqMhz,
+                  stats.lightSleep ? "true" : "false");
+    body += text;
+
+    for (std::size_t i = 0; i < clientCount; ++i)
+    {
+        std::snprintf(text,
+                      sizeof(text),
+                      R"(%s{"name":"%s","riding":%u,"parked":%u,"held":%u})",
+                      i > 0 ? "," : "",
+                      clients[i].name,
+                      static_cast<unsigned>(clients[i].ridingNeeds),
+                      static_cast<unsigned>(clients[i].parkedNeeds),
+                      static_cast<unsigned>(clients[i].held));
+        body += text;
+    }
+    body += "]}";
+    return send_json(req, body.c_str());
+}
+
+/**
+ * Boot timeline: when each startup stage ran and finished, and when the
+ * first telemetry frame arrived against its target. Times are esp_timer
+ * microseconds since boot.
+ */
+esp_err_t boot_get_handler(httpd_req_t* req)
+{
+    const BootSequencer::Timeline timeline = BootSequencer::timeline();
+
+    BootSequencer::StageInfo stages[BootSequencer::kMaxStages];
+    const std::size_t        stageCount = BootSequencer::stages(stages, BootSequencer::kMaxStages);
+
+    std::string body;
+    body.reserve(192 + stageCount * 128);
+
+    char text[192];
+    std::snprintf(text,
+                  sizeof(text),
+                  R"({"runStartUs":%lld,"releaseUs":%lld,"finishUs":%lld,"telemetryUs":%lld,"targetMs":%u,)"
+                  R"("targetMet":%s,"stages":[)",
+                  static_cast<long long>(timeline.runStartUs),
+                  static_cast<long long>(timeline.releaseUs),
+                  static_cast<long long>(timeline.finishUs),
+                  static_cast<long long>(timeline.telemetryUs),
+                  static_cast<unsigned>(timeline.targetMs),
+                  timeline.targetMet ? "true" : "false");
+    body += text;
+
+    for (std::size_t i = 0; i < stageCount; ++i)
+    {
+        const BootSequencer::StageInfo& stage = stages[i];
+        std::snprintf(text,
+                      sizeof(text),
+                      R"(%s{"name":"%s","kind":"%s","state":"%s","error":%d,"after":%u,"startUs":%lld,"endUs":%lld})",
+                      i > 0 ? "," : "",
+                      stage.name,
+                      BootSequencer::kindName(stage.kind),
+                      BootSequencer::stateName(stage.state),
+                      stage.result,
+                      static_cast<unsigned>(stage.after),
+                      static_cast<long long>(stage.startUs),
+                      static_cast<long long>(stage.endUs));
+        body += text;
+    }
+    body += "]}";
+    return send_json(req, body.c_str());
+}
+
+/**
+ * Heap use per subsystem, static pool headroom when pools are configured,
+ * and allocations made on hot paths since boot finished. All zero without
+ * CONFIG_JARVIS_MEM_ACCOUNTING.
+ */
+esp_err_t mem_get_handler(httpd_req_t* req)
+{
+    const MemAccounting::HotPathStats hot = MemAccounting::hotPath();
+
+    std::string body;
+    body.reserve(256 + MemAccounting::kTagCount * 192);
+
+    char text[224];
+    std::snprintf(text,
+                  sizeof(text),
+                  R"({"accounting":%s,"staticBudget":%s,"sealed":%s,"heapFree":%u,"heapMinFree":%u,)"
+                  R"("hotPath":{"allocations":%u,"lastSite":"%s","lastTag":"%s"},"tags":[)",
+#if CONFIG_JARVIS_MEM_ACCOUNTING
+                  "true",
+#else
+                  "false",
+#endif
+#if CONFIG_JARVIS_MEM_STATIC_BUDGET
+                  "true",
+#else
+                  "false",
+#endif
+                  MemAccounting::sealed() ? "true" : "false",
+                  static_cast<unsigned>(esp_get_free_heap_size()),
+                  static_cast<unsigned>(esp_get_minimum_free_heap_size()),
+                  static_cast<unsigned>(hot.allocations),
+                  hot.lastSite != nullptr ? hot.lastSite : "",
+                  MemAccounting::tagName(hot.lastTag));
+    body += text;
+
+    for (std::size_t i = 0; i < MemAccounting::kTagCount; ++i)
+    {
+        const MemTag                  tag   = static_cast<MemTag>(i);
+        const MemAccounting::TagStats stats = MemAccounting::stats(tag);
+        std::snprintf(text,
+                      sizeof(text),
+                      R"(%s{"tag":"%s","liveBytes":%u,"peakBytes":%u,"liveBlocks":%u,"allocations":%u,)"
+                      R"("poolBytes":%u,"poolFree":%u,"poolMinFree":%u,"overflows":%u})",
+                      i > 0 ? "," : "",
+                      MemAccounting::tagName(tag),
+                      static_cast<unsigned>(stats.liveBytes),
+                      static_cast<unsigned>(stats.peakBytes),
+                      static_cast<unsigned>(stats.liveBlocks),
+                      static_cast<unsigned>(stats.allocations),
+                      static_cast<unsigned>(stats.poolBytes),
+                      static_cast<unsigned>(stats.poolFreeBytes),
+                      static_cast<unsigned>(stats.poolMinFree),
+                      static_cast<unsigned>(stats.overflows));
+        body += text;
+    }
+    body += "]}";
+    return send_json(req, body.c_str());
+}
+
+void append_ride(std::string& body, const RideSummary& ride)
+{
+    char text[320];
+    std::snprintf(text,
+                  sizeof(text),
+                  R"({"seq":%u,"end":"%s","durationS":%u,"movingS":%u,"distanceKm":%u.%03u,"usedWh":%u.%u,)"
+                  R"("regenWh":%u.%u,"maxKph":%u.%u,"avgKph":%u.%u,"peakMotorC":%d,"peakControllerC":%d,"gearS":[)",
+                  static_cast<unsigned>(ride.seq),
+                  RideService::endName(ride.end),
+                  static_cast<unsigned>(ride.durationMs / 1000),
+                  static_cast<unsigned>(ride.movingMs / 1000),
+                  static_cast<unsigned>(ride.distanceM / 1000),
+                  static_cast<unsigned>(ride.distanceM % 1000),
+                  static_cast<unsigned>(ride.usedDeciWh / 10),
+                  static_cast<unsigned>(ride.usedDeciWh % 10),
+                  static_cast<unsigned>(ride.regenDeciWh / 10),
+                  static_cast<unsigned>(ride.regenDeciWh % 10),
+                  static_cast<unsigned>(ride.maxDeciKph / 10),
+                  static_cast<unsigned>(ride.maxDeciKph % 10),
+                  static_cast<unsigned>(ride.avgDeciKph() / 10),
+                  static_cast<unsigned>(ride.avgDeciKph() % 10),
+                  ride.peakMotorC,
+                  ride.peakControlC);
+    body += text;
+
+    for (std::size_t i = 0; i < RideSummary::kGears; ++i)
+    {
+        std::snprintf(text, sizeof(text), "%s%u", i > 0 ? "," : "", static_cast<unsigned>(ride.gearS[i]));
+        body += text;
+    }
+    body += R"(],"powerBandS":[)";
+    for (std::size_t i = 0; i < RideSummary::kPowerBands; ++i)
+    {
+        std::snprintf(text, sizeof(text), "%s%u", i > 0 ? "," : "", static_cast<unsigned>(ride.powerBandS[i]));
+        body += text;
+    }
+    body += "]}";
+}
+
+/**
+ * Ride summaries: the ride in progress, if any, and the last finished
+ * rides, newest first (`?limit=N` for fewer). Served from RAM.
+ */
+esp_err_t rides_get_handler(httpd_req_t* req)
+{
+    std::size_t limit     = RideService::kHistory;
+    char        query[32] = {};
+    char        text[8];
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+        httpd_query_key_value(query, "limit", text, sizeof(text)) == ESP_OK)
+    {
+        limit = std::min<std::size_t>(std::strtoul(text, nullptr, 10), RideService::kHistory);
+    }
+
+    RideSummary*      rides = s_rideScratch;
+    const std::size_t count = s_rides->history(rides, limit);
+    RideSummary       current;
+    const bool        riding = s_rides->current(current);
+
+    std::string body;
+    body.reserve(160 + (count + 1) * 400);
+    body += R"({"powerBandFloorsW":[null)";
+    for (std::size_t i = 1; i < RideSummary::kPowerBands; ++i)
+    {
+        body += ',';
+        body += std::to_string(RideService::powerBandFloorW(i));
+    }
+    body += R"(],"current":)";
+    if (riding)
+    {
+        append_ride(body, current);
+    }
+    else
+    {
+        body += "null";
+    }
+    body += R"(,"rides":[)";
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (i > 0)
+        {
+            body += ',';
+        }
+        append_ride(body, rides[i]);
+    }
+    body += "]}";
+    return send_json(req, body.c_str());
+}
+
+// Streams history points as a JSON array in chunks of kUploadChunkBytes
+struct HistoryStream
+{
+    httpd_req_t* req = nullptr;
+    std::string  out;
+    const char*  format = nullptr; ///< Point format; decimals follow the series' resolution
+    bool         first  = true;
+    esp_err_t    err    = ESP_OK;
+};
+
+esp_err_t flush_history(HistoryStream& stream)
+{
+    if (stream.err == ESP_OK && !stream.out.empty())
+    {
+        stream.err = httpd_resp_send_chunk(stream.req, stream.out.data(), static_cast<ssize_t>(stream.out.size()));
+        stream.out.clear();
+    }
+    return stream.err;
+}
+
+bool append_history_point(void* context, const TelemetryHistory::Point& point)
+{
+    auto* stream = static_cast<HistoryStream*>(context);
+    char  text[32];
+    std::snprintf(text, sizeof(text), stream->format, stream->first ? "" : ",", static_cast<unsigned>(point.uptimeMs),
+                  static_cast<double>(point.value));
+    stream->first = false;
+    stream->out += text;
+    if (stream->out.size() >= kUploadChunkBytes)
+    {
+        flush_history(*stream);
+    }
+    return stream->err == ESP_OK;
+}
+
+bool query_uint(const char* query, const char* key, uint32_t& value)
+{
+    char text[16];
+    if (httpd_query_key_value(query, key, text, sizeof(text)) != ESP_OK)
+    {
+        return false;
+    }
+    char*               end    = nullptr;
+    const unsigned long parsed = std::strtoul(text, &end, 10);
+    if (end == text || *end != '\0')
+    {
+        return false;
+    }
+    value = static_cast<uint32_t>(std::min<unsigned long>(parsed, UINT32_MAX));
+    return true;
+}
+
+/**
+ * Recent telemetry for charts, downsampled on the device:
+ * `?series=speed|power|voltage|motorTemp|controllerTemp&mode=lttb|minmax|raw
+ * &points=N&from=ms&to=ms` (uptime), or `&seconds=N` for the last N
+ * seconds. Points are `[uptimeMs, value]`; lttb and minmax return at most
+ * `points` of them, raw every stored sample. Streamed in chunks, so the
+ * response size does not depend on the history length.
+ */
+esp_err_t serve_history(httpd_req_t* req)
+{
+    TelemetryHistory::Query query;
+    char                    text[96] = {};
+    char                    value[16];
+    if (httpd_req_get_url_query_str(req, text, sizeof(text)) == ESP_OK)
+    {
+        if (httpd_query_key_value(text, "series", value, sizeof(value)) == ESP_OK &&
+            !TelemetryHistory::parseSeries(value, query.series))
+        {
+            return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Unknown series");
+        }
+        if (httpd_query_key_value(text, "mode", value, sizeof(value)) == ESP_OK &&
+            !TelemetryHistory::parseMode(value, query.mode))
+        {
+            return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Unknown mode");
+        }
+        uint32_t number = 0;
+        if (query_uint(text, "points", number))
+        {
+            query.points = std::min<uint32_t>(number, kMaxHistoryPoints);
+        }
+        query_uint(text, "from", query.fromMs);
+        query_uint(text, "to", query.toMs);
+        if (query_uint(text, "seconds", number))
+        {
+            // Clamped first: more seconds than fit in ms means everything
+            const uint32_t windowMs = std::min<uint32_t>(number, UINT32_MAX / 1000) * 1000;
+            const uint32_t nowMs    = static_cast<uint32_t>(esp_timer_get_time() / 1000);
+            query.fromMs            = nowMs - std::min<uint32_t>(nowMs, windowMs);
+        }
+    }
+
+    HistoryStream stream;
+    stream.req    = req;
+    stream.format = query.series == HistorySeries::Power ? "%s[%u,%.2f]" : "%s[%u,%.1f]";
+    stream.out.reserve(kUploadChunkBytes + 64);
+
+    char head[128];
+    std::snprintf(head,
+                  sizeof(head),
+                  R"({"series":"%s","unit":"%s","mode":"%s","periodMs":%u,"points":[)",
+                  TelemetryHistory::seriesName(query.series),
+                  TelemetryHistory::seriesUnit(query.series),
+                  TelemetryHistory::modeName(query.mode),
+                  static_cast<unsigned>(TelemetryHistory::kPeriodMs));
+    stream.out += head;
+    httpd_resp_set_type(req, "application/json");
+
+    const int64_t                startUs = esp_timer_get_time();
+    TelemetryHistory::QueryStats stats;
+    const esp_err_t              err = s_history->query(query, &append_history_point, &stream, &stats);
+    if (err != ESP_OK && err != ESP_ERR_NOT_FOUND)
+    {
+        ESP_LOGW(kLogTag, "History query failed: %s", esp_err_to_name(stream.err != ESP_OK ? stream.err : err));
+        return stream.err != ESP_OK ? stream.err : err;
+    }
+
+    char tail[160];
+    std::snprintf(tail,
+                  sizeof(tail),
+                  R"(],"fromMs":%u,"toMs":%u,"scanned":%u,"returned":%u,"elapsedUs":%u})",
+                  static_cast<unsigned>(stats.fromMs),
+                  static_cast<unsigned>(stats.toMs),
+                  static_cast<unsigned>(stats.scanned),
+                  static_cast<unsigned>(stats.points),
+                  static_cast<unsigned>(esp_timer_get_time() - startUs));
+    stream.out += tail;
+    if (flush_history(stream) != ESP_OK)
+    {
+        return stream.err;
+    }
+    return httpd_resp_send_chunk(req, nullptr, 0);
+}
+
+HttpWorkerPool::Route s_rawHistoryRoute{serve_history, 1};
+
+/**
+ * Downsampled answers are bounded by `points` and stay on the server task;
+ * a raw query may stream the whole ring and is moved to a worker.
+ */
+esp_err_t history_get_handler(httpd_req_t* req)
+{
+    char       text[96] = {};
+    char       value[16];
+    Downsample mode = Downsample::Lttb;
+    const bool raw  = httpd_req_get_url_query_str(req, text, sizeof(text)) == ESP_OK &&
+                      httpd_query_key_value(text, "mode", value, sizeof(value)) == ESP_OK &&
+                      TelemetryHistory::parseMode(value, mode) && mode == Downsample::Raw;
+    return raw ? s_workers.submit(req, s_rawHistoryRoute) : serve_history(req);
+}
+
+/**
+ * Live telemetry as Server-Sent Events (`text/event-stream`), one `data:`
+ * event per CONFIG_JARVIS_LIVE_HZ tick with news. Every client receives the
+ * same encoded frame; see LiveBroadcast.
+ */
+esp_err_t live_get_handler(httpd_req_t* req)
+{
+    return s_live->subscribe(req);
+}
+
+/**
+ * Broadcast cost and delivery: clients, frames encoded (once per tick) and
+ * sent (per client), frames slow clients skipped, and CPU time per tick.
+ */
+esp_err_t live_stats_get_handler(httpd_req_t* req)
+{
+    const LiveBroadcast::Stats stats = s_live->stats();
+
+    char response[384];
+    std::snprintf(response,
+                  sizeof(response),
+                  R"({"clients":%u,"maxClients":%u,"hz":%u,"ticks":%u,"encoded":%u,"sent":%u,"dropped":%u,)"
+                  R"("evicted":%u,"rejected":%u,"lastEncodeUs":%u,"lastFanoutUs":%u,"maxTickUs":%u,"busyUs":%llu})",
+                  static_cast<unsigned>(stats.clients),
+                  static_cast<unsigned>(LiveBroadcast::kMaxClients),
+                  static_cast<unsigned>(CONFIG_JARVIS_LIVE_HZ),
+                  static_cast<unsigned>(stats.ticks),
+                  static_cast<unsigned>(stats.encoded),
+                  static_cast<unsigned>(stats.sent),
+                  static_cast<unsigned>(stats.dropped),
+                  static_cast<unsigned>(stats.evicted),
+                  static_cast<unsigned>(stats.rejected),
+                  static_cast<unsigned>(stats.lastEncodeUs),
+                  static_cast<unsigned>(stats.lastFanoutUs),
+                  static_cast<unsigned>(stats.maxTickUs),
+                  static_cast<unsigned long long>(stats.busyUs));
+    return send_json(req, response);
+}
+
+/**
+ * On-demand SoftAP: whether it is up, how long the last trigger took to
+ * bring it up and to serve the UI, and the internal RAM the Wi-Fi driver
+ * took and gave back.
+ */
+esp_err_t wifi_get_handler(httpd_req_t* req)
+{
+    const WifiService::OnDemandStats stats   = s_wifi->onDemandStats();
+    const WifiService::StationStats  station = s_wifi->stationStats();
+
+    char response[512];
+    std::snprintf(response,
+                  sizeof(response),
+                  R"({"active":%s,"stations":%u,"starts":%u,"idleStops":%u,"triggerToApMs":%u,"triggerToUiMs":%u,)"
+                  R"("startCostBytes":%u,"reclaimedBytes":%u,"freeInternalHeap":%u,)"
+                  R"("station":{"connected":%s,"lastFast":%s,"lastConnectMs":%u,"fastJoins":%u,"fullJoins":%u,)"
+                  R"("fastFallbacks":%u,"addressConflicts":%u,"failures":%u}})",
+                  stats.active ? "true" : "false",
+                  static_cast<unsigned>(stats.stations),
+                  static_cast<unsigned>(stats.starts),
+                  static_cast<unsigned>(stats.idleStops),
+                  static_cast<unsigned>(stats.triggerToApMs),
+                  static_cast<unsigned>(stats.triggerToUiMs),
+                  static_cast<unsigned>(stats.startCostBytes),
+                  static_cast<unsigned>(stats.reclaimedBytes),
+                  static_cast<unsigned>(stats.freeInternalHeap),
+                  station.connected ? "true" : "false",
+                  station.lastFast ? "true" : "false",
+                  static_cast<unsigned>(station.lastConnectMs),
+                  static_cast<unsigned>(station.fastJoins),
+                  static_cast<unsigned>(station.fullJoins),
+                  static_cast<unsigned>(station.fastFallbacks),
+                  static_cast<unsigned>(station.addressConflicts),
+                  static_cast<unsigned>(station.failures));
+    return send_json(req, response);
+}
+
+#if CONFIG_JARVIS_METRICS
+/**
+ * Prometheus scrape target: stage latency histograms, frame counters, heap
+ * watermarks and the HTTP worker pool's counters.
+ */
+esp_err_t metrics_get_handler(httpd_req_t* req)
+{
+    std::string body = Metrics::renderPrometheus();
+
+    const HttpWorkerPool::Stats workers = s_workers.stats();
+    char                        line[192];
+    std::snprintf(line,
+                  sizeof(line),
+                  "# HELP jarvis_http_worker_rejected_total Requests refused with 503 because the worker queue was full.\n"
+                  "# TYPE jarvis_http_worker_rejected_total counter\n"
+                  "jarvis_http_worker_rejected_total %u\n",
+                  static_cast<unsigned>(workers.rejected));
+    body += line;
+
+    httpd_resp_set_type(req, "text/plain; version=0.0.4");
+    return httpd_resp_send(req, body.data(), static_cast<ssize_t>(body.size()));
+}
+#endif
+
+#if !CONFIG_JARVIS_DLOG_CONSOLE
+/**
+ * Drains the deferred log as a binary dump for tools/log_dump.py:
+ *
+ *   header  <IHHIIII  magic 'JLOG', version, format count, now (us),
+ *                     written, dropped, suppressed
+ *   formats <HH       min interval (ms), length, then the format string
+ *   records <IHBB     timestamp (us), format, arg count, suppressed, then
+ *                     arg count little-endian words, until end of body
+ *
+ * Records are consumed: each one is returned by exactly one request.
+ */
+esp_err_t log_get_handler(httpd_req_t* req)
+{
+    static constexpr uint32_t kMagic   = 0x474F4C4A; // "JLOG"
+    static constexpr uint16_t kVersion = 1;
+
+    std::size_t                    formatCount = 0;
+    const DeferredLog::FormatInfo* formats     = DeferredLog::formats(formatCount);
+    const DeferredLog::Stats       stats       = DeferredLog::stats();
+
+    std::string out;
+    out.reserve(kUploadChunkBytes + sizeof(LogRecord));
+    auto put = [&out](const void* data, std::size_t size) { out.append(static_cast<const char*>(data), size); };
+
+    const uint16_t count = static_cast<uint16_t>(formatCount);
+    const uint32_t now   = static_cast<uint32_t>(esp_timer_get_time());
+    put(&kMagic, sizeof(kMagic));
+    put(&kVersion, sizeof(kVersion));
+    put(&count, sizeof(count));
+    put(&now, sizeof(now));
+    put(&stats.written, sizeof(stats.written));
+    put(&stats.dropped, sizeof(stats.dropped));
+    put(&stats.suppressed, sizeof(stats.suppressed));
+    for (std::size_t i = 0; i < formatCount; ++i)
+    {
+        const uint16_t length = static_cast<uint16_t>(std::strlen(formats[i].format));
+        put(&formats[i].minIntervalMs, sizeof(formats[i].minIntervalMs));
+        put(&length, sizeof(length));
+        put(formats[i].format, length);
+    }
+
+    httpd_resp_set_type(req, "application/octet-stream");
+
+    // Bounded so producers that keep writing cannot hold the request open.
+    LogRecord record{};
+    for (std::size_t taken = 0; taken < CONFIG_JARVIS_DLOG_RECORDS && DeferredLog::pop(record); ++taken)
+    {
+        put(&record.timestampUs, sizeof(record.timestampUs));
+        put(&record.format, sizeof(record.format));
+        put(&record.argCount, sizeof(record.argCount));
+        put(&record.suppressed, sizeof(record.suppressed));
+        put(record.args, record.argCount * sizeof(uint32_t));
+        if (out.size() >= kUploadChunkBytes)
+        {
+            const esp_err_t err = httpd_resp_send_chunk(req, out.data(), static_cast<ssize_t>(out.size()));
+            if (err != ESP_OK)
+            {
+                ESP_LOGW(kLogTag, "Log dump send failed: %s", esp_err_to_name(err));
+                return err;
+            }
+            out.clear();
+        }
+    }
+
+    if (!out.empty())
+    {
+        const esp_err_t err = httpd_resp_send_chunk(req, out.data(), static_cast<ssize_t>(out.size()));
+        if (err != ESP_OK)
+        {
+            ESP_LOGW(kLogTag, "Log dump send failed: %s", esp_err_to_name(err));
+            return err;
+        }
+    }
+    return httpd_resp_send_chunk(req, nullptr, 0);
+}
+#endif
+
+#if CONFIG_JARVIS_SIMULATOR
+esp_err_t send_sim_stats(httpd_req_t* req)
+{
+    const MotorSimService::Stats stats = s_simulator->stats();
+
+    char response[512];
+    std::snprintf(response,
+                  sizeof(response),
+                  R"({"running":%s,"profile":"%s","rate":%.1f,"elapsedMs":%u,)"
+                  R"("frames":{"generated":%u,"delivered":%u,"dropped":%u,"corrupted":%u,"perSecond":%.1f,"maxBacklog":%u},)"
+                  R"("handlerUs":{"p50":%u,"p99":%u,"max":%u},"endToEndUs":{"p50":%u,"p99":%u,"max":%u},)"
+                  R"("ride":{"seconds":%.1f,"speedKph":%.1f,"batteryAmps":%.1f,"voltage":%.1f}})",
+                  stats.running ? "true" : "false",
+                  MotorSimulator::profileName(stats.profile),
+                  static_cast<double>(stats.rateMultiplier),
+                  static_cast<unsigned>(stats.elapsedMs),
+                  static_cast<unsigned>(stats.framesGenerated),
+                  static_cast<unsigned>(stats.framesDelivered),
+                  static_cast<unsigned>(stats.framesDropped),
+                  static_cast<unsigned>(stats.framesCorrupted),
+                  static_cast<double>(stats.framesPerSecond),
+                  static_cast<unsigned>(stats.maxBacklog),
+                  static_cast<unsigned>(stats.handler.p50Us),
+                  static_cast<unsigned>(stats.handler.p99Us),
+                  static_cast<unsigned>(stats.handler.maxUs),
+                  static_cast<unsigned>(stats.endToEnd.p50Us),
+                  static_cast<unsigned>(stats.endToEnd.p99Us),
+                  static_cast<unsigned>(stats.endToEnd.maxUs),
+                  static_cast<double>(stats.ride.seconds),
+                  static_cast<double>(stats.ride.speedKph),
+                  static_cast<double>(stats.ride.batteryAmps),
+                  static_cast<double>(stats.ride.voltage));
+    return send_json(req, response);
+}
+
+bool query_float(const char* query, const char* key, float& value)
+{
+    char text[16];
+    if (httpd_query_key_value(query, key, text, sizeof(text)) != ESP_OK)
+    {
+        return false;
+    }
+    char*       end    = nullptr;
+    const float parsed = std::strtof(text, &end);
+    if (end == text || *end != '\0')
+    {
+        return false;
+    }
+    value = parsed;
+    return true;
+}
+
+/**
+ * Progress of the current (or last) simulator run.
+ */
+esp_err_t sim_get_handler(httpd_req_t* req)
+{
+    return send_sim_stats(req);
+}
+
+/**
+ * Starts a simulator run. Query parameters, all optional: profile
+ * (idle|commute|hill|sprint), rate (1-10), noise, drop and corrupt
+ * (fractions), seconds (0 = until stopped) and seed.
+ */
+esp_err_t sim_post_handler(httpd_req_t* req)
+{
+    MotorSimService::RunConfig config{};
+    if (s_settings != nullptr)
+    {
+        const MotorController::Config motor       = s_settings->snapshot().motorConfig();
+        config.simulator.wheelCircumferenceMeters = motor.wheelCircumferenceMeters;
+        config.simulator.reductionRatio           = motor.reductionRatio;
+    }
+
+    char query[160] = {};
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK)
+    {
+        char profile[16];
+        if (httpd_query_key_value(query, "profile", profile, sizeof(profile)) == ESP_OK &&
+            !MotorSimulator::parseProfile(profile, config.simulator.profile))
+        {
+            return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Unknown profile");
+        }
+
+        float seconds = static_cast<float>(config.durationMs) / 1000.0f;
+        float seed    = static_cast<float>(config.simulator.seed);
+        query_float(query, "rate", config.rateMultiplier);
+        query_float(query, "noise", config.simulator.noise);
+        query_float(query, "drop", config.simulator.dropRate);
+        query_float(query, "corrupt", config.simulator.corruptRate);
+        if (query_float(query, "seconds", seconds))
+        {
+            config.durationMs = static_cast<uint32_t>(std::max(seconds, 0.0f) * 1000.0f);
+        }
+        if (query_float(query, "seed", seed))
+        {
+            config.simulator.seed = static_cast<uint32_t>(std::max(seed, 0.0f));
+        }
+    }
+
+    const esp_err_t err = s_simulator->start(config);
+    if (err == ESP_ERR_INVALID_ARG)
+    {
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Rate must be in (0, 10]");
+    }
+    if (err == ESP_ERR_INVALID_STATE)
+    {
+        httpd_resp_set_status(req, "409 Conflict");
+        return send_json(req, R"({"result":"error","message":"Simulation already running"})");
+    }
+    if (err != ESP_OK)
+    {
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to start simulator");
+    }
+    return send_sim_stats(req);
+}
+
+/**
+ * Stops the current run and reports its final figures.
+ */
+esp_err_t sim_delete_handler(httpd_req_t* req)
+{
+    s_simulator->stop();
+    return send_sim_stats(req);
+}
+#endif
+
+/**
+ * Returns the current settings (secrets omitted) as JSON.
+ */
+esp_err_t settings_get_handler(httpd_req_t* req)
+{
+    if (s_settings == nullptr)
+    {
+        return httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "Settings unavailable");
+    }
+    const std::string payload = s_settings->toJson();
+    return send_json(req, payload.c_str());
+}
+
+/**
+ * Applies a flat JSON object of settings (up to kMaxPostBodyBytes). Values
+ * are validated together and applied live; persistence happens in the
+ * background once edits settle. Responds with the resulting settings.
+ */
+esp_err_t settings_post_handler(httpd_req_t* req)
+{
+    ESP_LOGI(kLogTag, "POST %s len=%zu", req->uri, req->content_len);
+
+    if (s_settings == nullptr)
+    {
+        return httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "Settings unavailable");
+    }
+    if (req->content_len > kMaxPostBodyBytes)
+    {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Body too large");
+        return ESP_FAIL;
+    }
+
+    std::string body;
+    body.resize(req->content_len);
+
+    size_t readTotal = 0;
+    while (readTotal < body.size())
+    {
+        const size_t remaining = body.size() - readTotal;
+        const int    received  = httpd_req_recv(req, &body[readTotal], remaining);
+        if (received <= 0)
+        {
+            ESP_LOGW(kLogTag, "Failed to read POST body, received=%d", received);
+            httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to read body");
+            return ESP_FAIL;
+        }
+        readTotal += static_cast<std::size_t>(received);
+    }
+
+    const char*     invalidField = nullptr;
+    const esp_err_t err          = s_settings->updateFromJson(body.data(), body.size(), &invalidField);
+    if (err != ESP_OK)
+    {
+        ESP_LOGW(kLogTag, "Rejected settings (%s)", invalidField != nullptr ? invalidField : "malformed");
+        std::string response = R"({"result":"error","field":")";
+        response += invalidField != nullptr ? invalidField : "";
+        response += R"("})";
+        httpd_resp_set_status(req, "400 Bad Request");
+        return send_json(req, response.c_str());
+    }
+
+    const std::string response = s_settings->toJson();
+    return send_json(req, response.c_str());
+}
+
+#if CONFIG_JARVIS_WEBUI_EMBEDDED
+/**
+ * Binary search over the path-sorted table compiled into the app.
+ */
+const WebAsset* find_embedded_asset(const char* path, std::size_t length)
+{
+    const WebAsset* first = kWebAssets;
+    const WebAsset* last  = kWebAssets + kWebAssetCount;
+    while (first < last)
+    {
+        const WebAsset* mid = first + (last - first) / 2;
+        int             cmp = std::strncmp(mid->path, path, length);
+        if (cmp == 0 && mid->path[length] != '\0')
+        {
+            cmp = 1;
+        }
+        if (cmp == 0)
+        {
+            return mid;
+        }
+        if (cmp < 0)
+        {
+            first = mid + 1;
+        }
+        else
+        {
+            last = mid;
+        }
+    }
+    return nullptr;
+}
+#endif
 
-#include "svelteesp32.h"
+/**
+ * Resolves a request URI (query string ignored) against the assets
+ * partition, falling back to the embedded table when one is compiled in.
+ */
+bool find_asset(const char* uri, WebAsset& out)
+{
+    const char* path   = uri;
+    std::size_t length = std::strcspn(uri, "?#");
+    if (length == 1 && uri[0] == '/')
+    {
+        path   = "/index.html";
+        length = std::strlen(path);
+    }
 
-namespace
+    if (s_assets.find(path, length, out))
+    {
+        return true;
+    }
+#if CONFIG_JARVIS_WEBUI_EMBEDDED
+    if (const WebAsset* asset = find_embedded_asset(path, length))
+    {
+        out = *asset;
+        return true;
+    }
+#endif
+    return false;
+}
+
+/**
+ * True when the client already holds this exact asset version, i.e. its
+ * If-None-Match list contains the asset's ETag (or `*`).
+ */
+bool client_has_current(httpd_req_t* req, const WebAsset& asset)
 {
-constexpr const char* kLogTag              = "WebServer";
-constexpr std::size_t kMaxPostBodyBytes    = 512;
-httpd_handle_t        s_httpd              = nullptr;
+    const std::size_t length = httpd_req_get_hdr_value_len(req, "If-None-Match");
+    if (length == 0 || length >= kMaxIfNoneMatchBytes)
+    {
+        return false;
+    }
 
-esp_err_t send_json(httpd_req_t* req, const char* payload)
+    char value[kMaxIfNoneMatchBytes];
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", value, sizeof(value)) != ESP_OK)
+    {
+        return false;
+    }
+    return std::strstr(value, asset.etag) != nullptr || std::strcmp(value, "*") == 0;
+}
+
+esp_err_t send_unavailable(httpd_req_t* req)
 {
-    httpd_resp_set_type(req, "application/json");
-    return httpd_resp_send(req, payload, HTTPD_RESP_USE_STRLEN);
+    httpd_resp_set_status(req, "503 Service Unavailable");
+    httpd_resp_set_hdr(req, "Retry-After", "1");
+    return httpd_resp_sendstr(req, "Web UI is being updated");
 }
 
 /**
- * Example GET handler that returns a minimal JSON payload describing device
- * status. The response body illustrates how REST endpoints can respond with
- * JSON.
+ * Sends a static file from the asset table. Answers 304 without a body
+ * when the client's copy is current; content-hashed assets are marked
+ * immutable so browsers do not even revalidate them.
  */
-esp_err_t status_get_handler(httpd_req_t* req)
+esp_err_t serve_asset(httpd_req_t* req)
 {
-    static constexpr const char* kPayload = R"({"status":"ok","message":"Jarvis web server ready"})";
-    ESP_LOGI(kLogTag, "GET %s", req->uri);
-    return send_json(req, kPayload);
+    AssetReadGuard guard;
+    if (!guard.acquired())
+    {
+        return send_unavailable(req);
+    }
+
+    WebAsset asset{};
+    if (!find_asset(req->uri, asset))
+    {
+        return httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "Not found");
+    }
+    if (s_wifi != nullptr)
+    {
+        s_wifi->noteUiServed();
+    }
+
+    httpd_resp_set_hdr(req, "ETag", asset.etag);
+    httpd_resp_set_hdr(req, "Cache-Control", asset.immutable ? kCacheImmutable : kCacheRevalidate);
+
+    if (client_has_current(req, asset))
+    {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, nullptr, 0);
+    }
+
+    httpd_resp_set_type(req, asset.mimeType);
+    if (asset.gzip)
+    {
+        httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+    }
+    // Partition assets point into the flash mapping; they are sent without
+    // an intermediate copy.
+    return httpd_resp_send(req, reinterpret_cast<const char*>(asset.data), static_cast<ssize_t>(asset.length));
 }
 
+HttpWorkerPool::Route s_largeAssetRoute{serve_asset, 2};
+
 /**
- * Example POST handler that reads a small JSON payload (up to
- * kMaxPostBodyBytes) and echoes part of the result back to the caller. This
- * shows how to consume request bodies and form responses.
+ * Small files and 304s are answered on the server task; draining a large
+ * body over the SoftAP takes long enough to be moved to a worker.
  */
-esp_err_t settings_post_handler(httpd_req_t* req)
+esp_err_t asset_get_handler(httpd_req_t* req)
 {
-    ESP_LOGI(kLogTag, "POST %s len=%zu", req->uri, req->content_len);
-
-    const size_t toRead = std::min<std::size_t>(req->content_len, kMaxPostBodyBytes);
-    std::string  body;
-    body.resize(toRead);
+    bool large = false;
+    {
+        AssetReadGuard guard;
+        WebAsset       asset{};
+        large = guard.acquired() && find_asset(req->uri, asset) && asset.length > kInlineAssetBytes &&
+                !client_has_current(req, asset);
+    }
+    return large ? s_workers.submit(req, s_largeAssetRoute) : serve_asset(req);
+}
 
-    size_t readTotal = 0;
-    while (readTotal < toRead)
+/**
+ * Receives the request body in kUploadChunkBytes pieces and hands each to
+ * @p sink. A socket timeout is retried, as a slow link stalls mid-upload;
+ * only kUploadRecvRetries in a row give up. Responds with an error itself
+ * when the body cannot be read or the sink fails: 400 with @p invalidBody
+ * when the sink rejects the content (ESP_ERR_INVALID_ARG, _CRC or _SIZE),
+ * 500 for anything else.
+ */
+template <typename Sink>
+esp_err_t receive_upload(httpd_req_t* req, const char* invalidBody, Sink&& sink)
+{
+    uint8_t     chunk[kUploadChunkBytes];
+    std::size_t remaining = req->content_len;
+    int         timeouts  = 0;
+    while (remaining > 0)
     {
-        const size_t remaining = toRead - readTotal;
-        const int    received  = httpd_req_recv(req, &body[readTotal], remaining);
+        const int received = httpd_req_recv(req, reinterpret_cast<char*>(chunk), std::min(remaining, sizeof(chunk)));
+        if (received == HTTPD_SOCK_ERR_TIMEOUT && ++timeouts <= kUploadRecvRetries)
+        {
+            continue;
+        }
         if (received <= 0)
         {
-            ESP_LOGW(kLogTag, "Failed to read POST body, received=%d", received);
+            ESP_LOGW(kLogTag, "Upload to %s aborted, received=%d", req->uri, received);
             httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to read body");
             return ESP_FAIL;
         }
-        readTotal += static_cast<std::size_t>(received);
+        const esp_err_t err = sink(chunk, static_cast<std::size_t>(received));
+        if (err == ESP_ERR_INVALID_VERSION)
+        {
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Patch does not match the running image");
+            return err;
+        }
+        if (err == ESP_ERR_INVALID_ARG || err == ESP_ERR_INVALID_CRC || err == ESP_ERR_INVALID_SIZE)
+        {
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, invalidBody);
+            return err;
+        }
+        if (err != ESP_OK)
+        {
+            httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Flash write failed");
+            return err;
+        }
+        remaining -= static_cast<std::size_t>(received);
+        timeouts = 0;
     }
+    return ESP_OK;
+}
 
-    if (req->content_len > kMaxPostBodyBytes)
+/**
+ * Replaces the web UI bundle in the assets partition with the request body
+ * (built by `tools/web_assets.py bundle`). The app image is untouched.
+ * Runs on a worker. The current bundle keeps being served, and survives a
+ * failed upload; asset requests only get 503 while the new one is mounted.
+ */
+esp_err_t webui_upload_handler(httpd_req_t* req)
+{
+    ESP_LOGI(kLogTag, "POST %s len=%zu", req->uri, req->content_len);
+
+    esp_err_t err = s_assets.beginUpdate(req->content_len);
+    if (err != ESP_OK)
+    {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Bundle does not fit the assets partition");
+        return ESP_FAIL;
+    }
+
+    err = receive_upload(req, "Invalid bundle", [](const uint8_t* data, std::size_t length) {
+        return s_assets.writeUpdate(data, length);
+    });
+    if (err != ESP_OK)
     {
-        ESP_LOGW(kLogTag, "POST body truncated from %zu to %zu bytes", req->content_len, toRead);
+        s_assets.abortUpdate();
+        return ESP_FAIL;
     }
 
-    ESP_LOGI(kLogTag, "Received settings payload: %.*s", static_cast<int>(body.size()), body.data());
+    {
+        AssetUpdateGuard guard;
+        err = s_assets.finishUpdate();
+    }
+    if (err != ESP_OK)
+    {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid bundle");
+        return ESP_FAIL;
+    }
 
-    const std::string response = R"({"result":"ok","applied":true})";
-    return send_json(req, response.c_str());
+    return send_json(req, R"({"result":"ok"})");
+}
+
+HttpWorkerPool::Route s_webuiUploadRoute{webui_upload_handler, 1};
+
+/**
+ * Parses the optional `X-Image-SHA256` header (64 hex digits).
+ *
+ * @return false when the header is present but malformed.
+ */
+bool read_expected_sha256(httpd_req_t* req, uint8_t* digest, bool& present)
+{
+    present                  = false;
+    const std::size_t length = httpd_req_get_hdr_value_len(req, "X-Image-SHA256");
+    if (length == 0)
+    {
+        return true;
+    }
+
+    char hex[2 * OtaUpdater::kHashBytes + 1];
+    if (length != 2 * OtaUpdater::kHashBytes || httpd_req_get_hdr_value_str(req, "X-Image-SHA256", hex, sizeof(hex)) != ESP_OK)
+    {
+        return false;
+    }
+    for (std::size_t i = 0; i < OtaUpdater::kHashBytes; ++i)
+    {
+        unsigned int byte = 0;
+        if (std::sscanf(hex + 2 * i, "%2x", &byte) != 1)
+        {
+            return false;
+        }
+        digest[i] = static_cast<uint8_t>(byte);
+    }
+    present = true;
+    return true;
+}
+
+void restart_callback(void*)
+{
+    esp_restart();
+}
+
+/**
+ * Restarts shortly after the response has gone out so the client sees the
+ * result of the update.
+ */
+void schedule_restart()
+{
+    esp_timer_create_args_t timerArgs{};
+    timerArgs.callback = &restart_callback;
+    timerArgs.name     = "ota_restart";
+
+    esp_timer_handle_t timer = nullptr;
+    if (esp_timer_create(&timerArgs, &timer) != ESP_OK || esp_timer_start_once(timer, kRestartDelayUs) != ESP_OK)
+    {
+        esp_restart();
+    }
+}
+
+esp_err_t send_ota_result(httpd_req_t* req, const OtaUpdater::Result& result)
+{
+    char digest[2 * OtaUpdater::kHashBytes + 1];
+    for (std::size_t i = 0; i < OtaUpdater::kHashBytes; ++i)
+    {
+        std::snprintf(digest + 2 * i, 3, "%02x", result.sha256[i]);
+    }
+
+    char response[288];
+    std::snprintf(response,
+                  sizeof(response),
+                  R"({"result":"ok","bytes":%u,"uploadBytes":%u,"elapsedMs":%u,"writeMs":%u,"kibPerSecond":%.1f,"sha256":"%s"})",
+                  static_cast<unsigned>(result.bytes),
+                  static_cast<unsigned>(req->content_len),
+                  static_cast<unsigned>(result.elapsedMs),
+                  static_cast<unsigned>(result.writeMs),
+                  static_cast<double>(result.kibPerSecond()),
+                  digest);
+    return send_json(req, response);
+}
+
+/**
+ * Streams a firmware image (the app `.bin`) into the inactive OTA slot and
+ * reboots into it.
+ */
+esp_err_t ota_image_upload(httpd_req_t* req)
+{
+    uint8_t expected[OtaUpdater::kHashBytes];
+    bool    haveExpected = false;
+    if (!read_expected_sha256(req, expected, haveExpected))
+    {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Malformed X-Image-SHA256");
+        return ESP_FAIL;
+    }
+
+    esp_err_t err = s_ota.begin(req->content_len);
+    if (err != ESP_OK)
+    {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Image does not fit the OTA slot");
+        return ESP_FAIL;
+    }
+
+    err = receive_upload(req, "Invalid firmware image", [](const uint8_t* data, std::size_t length) {
+        return s_ota.write(data, length);
+    });
+    if (err != ESP_OK)
+    {
+        s_ota.abort();
+        return ESP_FAIL;
+    }
+
+    OtaUpdater::Result result;
+    err = s_ota.finish(haveExpected ? expected : nullptr, result);
+    if (err != ESP_OK)
+    {
+        httpd_resp_send_err(req,
+                            HTTPD_400_BAD_REQUEST,
+                            err == ESP_ERR_INVALID_CRC ? "SHA-256 mismatch" : "Invalid firmware image");
+        return ESP_FAIL;
+    }
+
+    err = send_ota_result(req, result);
+    schedule_restart();
+    return err;
+}
+
+/**
+ * Rebuilds the new image from the running one and a patch made by
+ * `tools/ota_delta.py diff`, writing it into the inactive OTA slot, and
+ * reboots into it. The patch carries the expected digest of the result.
+ */
+esp_err_t ota_delta_upload(httpd_req_t* req)
+{
+    OtaDeltaPatcher patcher(s_ota);
+    esp_err_t       err = patcher.begin(req->content_len);
+    if (err != ESP_OK)
+    {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid patch");
+        return ESP_FAIL;
+    }
+
+    err = receive_upload(req, "Invalid patch", [&patcher](const uint8_t* data, std::size_t length) {
+        return patcher.write(data, length);
+    });
+    if (err != ESP_OK)
+    {
+        patcher.abort();
+        return ESP_FAIL;
+    }
+
+    OtaUpdater::Result result;
+    err = patcher.finish(result);
+    if (err != ESP_OK)
+    {
+        httpd_resp_send_err(req,
+                            HTTPD_400_BAD_REQUEST,
+                            err == ESP_ERR_INVALID_CRC ? "Patched image does not match" : "Invalid patch");
+        return ESP_FAIL;
+    }
+
+    err = send_ota_result(req, result);
+    schedule_restart();
+    return err;
+}
+
+/**
+ * Both OTA routes share one worker route so only one update runs at a time.
+ */
+esp_err_t ota_upload_handler(httpd_req_t* req)
+{
+    ESP_LOGI(kLogTag, "POST %s len=%zu", req->uri, req->content_len);
+
+    const bool delta = std::strncmp(req->uri, "/api/ota/delta", std::strlen("/api/ota/delta")) == 0;
+    return delta ? ota_delta_upload(req) : ota_image_upload(req);
+}
+
+HttpWorkerPool::Route s_otaUploadRoute{ota_upload_handler, 1};
+
+esp_err_t offload_handler(httpd_req_t* req)
+{
+    return HttpWorkerPool::offload(s_workers, req);
+}
+
+void register_static_assets(httpd_handle_t server)
+{
+    // Registered last: the wildcard would otherwise shadow the API routes.
+    const httpd_uri_t assetRoute{
+        .uri      = "/*",
+        .method   = HTTP_GET,
+        .handler  = asset_get_handler,
+        .user_ctx = nullptr,
+    };
+
+    ESP_ERROR_CHECK_WITHOUT_ABORT(httpd_register_uri_handler(server, &assetRoute));
 }
 
 void register_rest_endpoints(httpd_handle_t server)
@@ -83,6 +1339,13 @@ void register_rest_endpoints(httpd_handle_t server)
         .user_ctx = nullptr,
     };
 
+    const httpd_uri_t settingsGetRoute{
+        .uri      = "/api/settings",
+        .method   = HTTP_GET,
+        .handler  = settings_get_handler,
+        .user_ctx = nullptr,
+    };
+
     const httpd_uri_t settingsRoute{
         .uri      = "/api/settings",
         .method   = HTTP_POST,
@@ -90,12 +1353,170 @@ void register_rest_endpoints(httpd_handle_t server)
         .user_ctx = nullptr,
     };
 
+    const httpd_uri_t webuiRoute{
+        .uri      = "/api/webui",
+        .method   = HTTP_POST,
+        .handler  = offload_handler,
+        .user_ctx = &s_webuiUploadRoute,
+    };
+
+    const httpd_uri_t otaRoute{
+        .uri      = "/api/ota",
+        .method   = HTTP_POST,
+        .handler  = offload_handler,
+        .user_ctx = &s_otaUploadRoute,
+    };
+
+    const httpd_uri_t otaDeltaRoute{
+        .uri      = "/api/ota/delta",
+        .method   = HTTP_POST,
+        .handler  = offload_handler,
+        .user_ctx = &s_otaUploadRoute,
+    };
+
+    const httpd_uri_t powerRoute{
+        .uri      = "/api/power",
+        .method   = HTTP_GET,
+        .handler  = power_get_handler,
+        .user_ctx = nullptr,
+    };
+
+    const httpd_uri_t bootRoute{
+        .uri      = "/api/boot",
+        .method   = HTTP_GET,
+        .handler  = boot_get_handler,
+        .user_ctx = nullptr,
+    };
+
+    const httpd_uri_t memRoute{
+        .uri      = "/api/mem",
+        .method   = HTTP_GET,
+        .handler  = mem_get_handler,
+        .user_ctx = nullptr,
+    };
+
     ESP_ERROR_CHECK_WITHOUT_ABORT(httpd_register_uri_handler(server, &statusRoute));
+    ESP_ERROR_CHECK_WITHOUT_ABORT(httpd_register_uri_handler(server, &powerRoute));
+    ESP_ERROR_CHECK_WITHOUT_ABORT(httpd_register_uri_handler(server, &bootRoute));
+    ESP_ERROR_CHECK_WITHOUT_ABORT(httpd_register_uri_handler(server, &memRoute));
+    ESP_ERROR_CHECK_WITHOUT_ABORT(httpd_register_uri_handler(server, &settingsGetRoute));
     ESP_ERROR_CHECK_WITHOUT_ABORT(httpd_register_uri_handler(server, &settingsRoute));
+    ESP_ERROR_CHECK_WITHOUT_ABORT(httpd_register_uri_handler(server, &webuiRoute));
+    ESP_ERROR_CHECK_WITHOUT_ABORT(httpd_register_uri_handler(server, &otaRoute));
+    ESP_ERROR_CHECK_WITHOUT_ABORT(httpd_register_uri_handler(server, &otaDeltaRoute));
+
+    if (s_rides != nullptr)
+    {
+        const httpd_uri_t ridesRoute{
+            .uri      = "/api/rides",
+            .method   = HTTP_GET,
+            .handler  = rides_get_handler,
+            .user_ctx = nullptr,
+        };
+        ESP_ERROR_CHECK_WITHOUT_ABORT(httpd_register_uri_handler(server, &ridesRoute));
+    }
+
+    if (s_history != nullptr)
+    {
+        const httpd_uri_t historyRoute{
+            .uri      = "/api/history",
+            .method   = HTTP_GET,
+            .handler  = history_get_handler,
+            .user_ctx = nullptr,
+        };
+        ESP_ERROR_CHECK_WITHOUT_ABORT(httpd_register_uri_handler(server, &historyRoute));
+    }
+
+    if (s_live != nullptr)
+    {
+        const httpd_uri_t liveRoute{
+            .uri      = "/api/live",
+            .method   = HTTP_GET,
+            .handler  = live_get_handler,
+            .user_ctx = nullptr,
+        };
+        const httpd_uri_t liveStatsRoute{
+            .uri      = "/api/live/stats",
+            .method   = HTTP_GET,
+            .handler  = live_stats_get_handler,
+            .user_ctx = nullptr,
+        };
+        ESP_ERROR_CHECK_WITHOUT_ABORT(httpd_register_uri_handler(server, &liveRoute));
+        ESP_ERROR_CHECK_WITHOUT_ABORT(httpd_register_uri_handler(server, &liveStatsRoute));
+    }
+
+    if (s_wifi != nullptr)
+    {
+        const httpd_uri_t wifiRoute{
+            .uri      = "/api/wifi",
+            .method   = HTTP_GET,
+            .handler  = wifi_get_handler,
+            .user_ctx = nullptr,
+        };
+        ESP_ERROR_CHECK_WITHOUT_ABORT(httpd_register_uri_handler(server, &wifiRoute));
+    }
+
+#if CONFIG_JARVIS_METRICS
+    const httpd_uri_t metricsRoute{
+        .uri      = "/api/metrics",
+        .method   = HTTP_GET,
+        .handler  = metrics_get_handler,
+        .user_ctx = nullptr,
+    };
+    ESP_ERROR_CHECK_WITHOUT_ABORT(httpd_register_uri_handler(server, &metricsRoute));
+#endif
+
+#if CONFIG_JARVIS_SIMULATOR
+    if (s_simulator != nullptr)
+    {
+        const httpd_uri_t simGetRoute{
+            .uri      = "/api/sim",
+            .method   = HTTP_GET,
+            .handler  = sim_get_handler,
+            .user_ctx = nullptr,
+        };
+        const httpd_uri_t simPostRoute{
+            .uri      = "/api/sim",
+            .method   = HTTP_POST,
+            .handler  = sim_post_handler,
+            .user_ctx = nullptr,
+        };
+        const httpd_uri_t simDeleteRoute{
+            .uri      = "/api/sim",
+            .method   = HTTP_DELETE,
+            .handler  = sim_delete_handler,
+            .user_ctx = nullptr,
+        };
+        ESP_ERROR_CHECK_WITHOUT_ABORT(httpd_register_uri_handler(server, &simGetRoute));
+        ESP_ERROR_CHECK_WITHOUT_ABORT(httpd_register_uri_handler(server, &simPostRoute));
+        ESP_ERROR_CHECK_WITHOUT_ABORT(httpd_register_uri_handler(server, &simDeleteRoute));
+    }
+#endif
+
+#if !CONFIG_JARVIS_DLOG_CONSOLE
+    const httpd_uri_t logRoute{
+        .uri      = "/api/log",
+        .method   = HTTP_GET,
+        .handler  = log_get_handler,
+        .user_ctx = nullptr,
+    };
+    ESP_ERROR_CHECK_WITHOUT_ABORT(httpd_register_uri_handler(server, &logRoute));
+#endif
+}
+
+esp_err_t on_session_open(httpd_handle_t, int)
+{
+    MemAccounting::setTaskTag(MemTag::Http);
+    return ESP_OK;
 }
 } // namespace
 
-httpd_handle_t start_http_server()
+httpd_handle_t start_http_server(ConfigStore*      settings,
+                                 MotorSimService*  simulator,
+                                 WifiService*      wifi,
+                                 RideService*      rides,
+                                 TelemetryHistory* history,
+                                 LiveBroadcast*    live)
 {
     if (s_httpd != nullptr)
     {
@@ -103,9 +1524,21 @@ httpd_handle_t start_http_server()
         return s_httpd;
     }
 
+    s_settings  = settings;
+    s_simulator = simulator;
+    s_wifi      = wifi;
+    s_rides     = rides;
+    s_history   = history;
+    s_live      = live;
+
     httpd_config_t config          = HTTPD_DEFAULT_CONFIG();
-    config.max_uri_handlers        = SVELTEESP32_COUNT + 99;
+    config.max_uri_handlers        = kMaxUriHandlers;
     config.uri_match_fn            = httpd_uri_match_wildcard;
+    // Requests parked on workers keep their sockets open; let new clients
+    // evict idle keep-alive connections instead of being refused.
+    config.lru_purge_enable        = true;
+    // Runs on the server task; charges its allocations to HTTP
+    config.open_fn                 = &on_session_open;
 
     ESP_LOGI(kLogTag, "Starting server on port: %d", config.server_port);
 
@@ -117,13 +1550,77 @@ httpd_handle_t start_http_server()
         return nullptr;
     }
 
-    initSvelteStaticFiles(server);
+    if (s_workers.start() != ESP_OK)
+    {
+        ESP_LOGW(kLogTag, "No HTTP workers, long-running handlers will run inline");
+    }
+
+    if (s_live != nullptr && s_live->start() != ESP_OK)
+    {
+        ESP_LOGW(kLogTag, "Live broadcast unavailable, /api/live will refuse clients");
+    }
+
+    if (s_assets.mount() != ESP_OK)
+    {
+#if CONFIG_JARVIS_WEBUI_EMBEDDED
+        ESP_LOGW(kLogTag, "Web UI bundle unavailable, serving embedded copy");
+#else
+        ESP_LOGW(kLogTag, "Web UI bundle unavailable, upload one to /api/webui");
+#endif
+    }
+
     register_rest_endpoints(server);
+    register_static_assets(server);
 
     s_httpd = server;
+    s_port  = config.server_port;
     return s_httpd;
 }
 
+bool http_server_self_check(uint32_t timeoutMs)
+{
+    if (s_httpd == nullptr)
+    {
+        return false;
+    }
+
+    // Over loopback, through the same accept, parse and dispatch path a
+    // phone takes
+    char url[48];
+    std::snprintf(url, sizeof(url), "http://127.0.0.1:%u/api/status", static_cast<unsigned>(s_port));
+
+    esp_http_client_config_t config{};
+    config.url        = url;
+    config.method     = HTTP_METHOD_GET;
+    config.timeout_ms = static_cast<int>(timeoutMs);
+    esp_http_client_handle_t client = esp_http_client_init(&config);
+    if (client == nullptr)
+    {
+        return false;
+    }
+
+    bool      healthy = false;
+    esp_err_t err     = esp_http_client_open(client, 0);
+    if (err == ESP_OK && esp_http_client_fetch_headers(client) >= 0)
+    {
+        char      body[96] = {};
+        const int status   = esp_http_client_get_status_code(client);
+        const int length   = esp_http_client_read_response(client, body, sizeof(body) - 1);
+        healthy            = status == 200 && length > 0 && std::strstr(body, R"("status":"ok")") != nullptr;
+        if (!healthy)
+        {
+            ESP_LOGE(kLogTag, "Self-check: GET /api/status answered %d", status);
+        }
+    }
+    else
+    {
+        ESP_LOGE(kLogTag, "Self-check: GET /api/status failed: %d", err);
+    }
+    esp_http_client_close(client);
+    esp_http_client_cleanup(client);
+    return healthy;
+}
+
 void stop_http_server()
 {
     if (s_httpd == nullptr)
@@ -131,6 +1628,11 @@ void stop_http_server()
         return;
     }
 
+    if (s_live != nullptr)
+    {
+        s_live->stop();
+    }
+    s_workers.stop();
     httpd_stop(s_httpd);
     s_httpd = nullptr;
     ESP_LOGI(kLogTag, "HTTP server stopped");
@@ -1,17 +1,56 @@
 #pragma once
 
+#include <cstdint>
+
 #include "esp_http_server.h"
 
+class ConfigStore;
+class LiveBroadcast;
+class MotorSimService;
+class RideService;
+class TelemetryHistory;
+class WifiService;
+
 /**
  * Starts the HTTP server responsible for serving the Svelte front-end and
  * exposing REST-style API endpoints.
  *
- * The server registers the static routes generated in `svelteesp32.h` and
- * example REST handlers for GET/POST requests.
+ * The server registers the REST handlers and a single wildcard route
+ * serving the web UI assets (conditional GET, immutable caching for hashed
+ * assets).
  *
+ * @param settings Backs `/api/settings` (GET/POST); the endpoint answers
+ *                 404 when nullptr. Must outlive the server.
+ * @param simulator Controlled through `/api/sim` (GET/POST/DELETE) when
+ *                  CONFIG_JARVIS_SIMULATOR is set; not registered when
+ *                  nullptr. Must outlive the server.
+ * @param wifi Reports the on-demand SoftAP at `/api/wifi` and is told when
+ *             the UI is served; not registered when nullptr. Must outlive
+ *             the server.
+ * @param rides Serves ride summaries at `/api/rides`; not registered when
+ *              nullptr. Must outlive the server.
+ * @param history Answers downsampled chart queries at `/api/history`; not
+ *                registered when nullptr. Must outlive the server.
+ * @param live Streams telemetry to dashboards at `/api/live`, with its cost
+ *             at `/api/live/stats`; started and stopped with the server, not
+ *             registered when nullptr. Must outlive the server.
  * @return Handle to the running server on success, nullptr otherwise.
  */
-httpd_handle_t start_http_server();
+httpd_handle_t start_http_server(ConfigStore*      settings  = nullptr,
+                                 MotorSimService*  simulator = nullptr,
+                                 WifiService*      wifi      = nullptr,
+                                 RideService*      rides     = nullptr,
+                                 TelemetryHistory* history   = nullptr,
+                                 LiveBroadcast*    live      = nullptr);
+
+/**
+ * Requests `/api/status` from the running server over loopback and checks
+ * the answer. Blocks for up to @p timeoutMs; do not call it from a handler.
+ *
+ * @return false when the server is not running or does not answer 200 with
+ *         the expected body.
+ */
+bool http_server_self_check(uint32_t timeoutMs = 3000);
 
 /**
  * Stops a previously started HTTP server. Safe to call if the server is not
@@ -0,0 +1,156 @@
+#include "http_workers.hh"
+
+#include <cstdio>
+
+#include "freertos/task.h"
+
+#include "esp_log.h"
+
+#include "services/mem/mem.hh"
+
+namespace
+{
+constexpr const char* kLogTag = "HttpWorkers";
+} // namespace
+
+esp_err_t HttpWorkerPool::start(const Config& config)
+{
+    if (running())
+    {
+        return ESP_OK;
+    }
+
+    workersStopped_ = xSemaphoreCreateCounting(config.workers, 0);
+    queue_          = xQueueCreate(config.queueDepth, sizeof(Job));
+    if (workersStopped_ == nullptr || queue_ == nullptr)
+    {
+        stop();
+        return ESP_ERR_NO_MEM;
+    }
+
+    workers_ = 0;
+    for (std::size_t i = 0; i < config.workers; ++i)
+    {
+        char name[configMAX_TASK_NAME_LEN];
+        snprintf(name, sizeof(name), "httpd_wk%u", static_cast<unsigned>(i));
+        if (xTaskCreate(&HttpWorkerPool::taskEntry, name, config.stackSize, this, config.priority, nullptr) != pdPASS)
+        {
+            ESP_LOGE(kLogTag, "Failed to create worker %u", static_cast<unsigned>(i));
+            stop();
+            return ESP_ERR_NO_MEM;
+        }
+        ++workers_;
+    }
+
+    ESP_LOGI(kLogTag,
+             "%u worker(s), queue depth %u",
+             static_cast<unsigned>(config.workers),
+             static_cast<unsigned>(config.queueDepth));
+    return ESP_OK;
+}
+
+void HttpWorkerPool::stop()
+{
+    if (queue_ != nullptr)
+    {
+        // One sentinel per worker, queued behind any pending requests so
+        // those are still answered.
+        const Job sentinel{nullptr, nullptr};
+        for (std::size_t i = 0; i < workers_; ++i)
+        {
+            xQueueSend(queue_, &sentinel, portMAX_DELAY);
+        }
+        for (std::size_t i = 0; i < workers_; ++i)
+        {
+            xSemaphoreTake(workersStopped_, portMAX_DELAY);
+        }
+        vQueueDelete(queue_);
+        queue_ = nullptr;
+    }
+    if (workersStopped_ != nullptr)
+    {
+        vSemaphoreDelete(workersStopped_);
+        workersStopped_ = nullptr;
+    }
+    workers_ = 0;
+}
+
+esp_err_t HttpWorkerPool::submit(httpd_req_t* req, Route& route)
+{
+    if (!running())
+    {
+        return route.handler(req);
+    }
+
+    if (route.inFlight.fetch_add(1) >= route.maxInFlight)
+    {
+        --route.inFlight;
+        ++rejected_;
+        return reject(req);
+    }
+
+    httpd_req_t* detached = nullptr;
+    esp_err_t    err      = httpd_req_async_handler_begin(req, &detached);
+    if (err != ESP_OK)
+    {
+        --route.inFlight;
+        ESP_LOGE(kLogTag, "httpd_req_async_handler_begin failed: %d", err);
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to start request");
+    }
+
+    const Job job{detached, &route};
+    if (xQueueSend(queue_, &job, 0) != pdTRUE)
+    {
+        --route.inFlight;
+        ++rejected_;
+        reject(detached);
+        httpd_req_async_handler_complete(detached);
+        return ESP_OK;
+    }
+
+    ++dispatched_;
+    return ESP_OK;
+}
+
+esp_err_t HttpWorkerPool::offload(HttpWorkerPool& pool, httpd_req_t* req)
+{
+    return pool.submit(req, *static_cast<Route*>(req->user_ctx));
+}
+
+esp_err_t HttpWorkerPool::reject(httpd_req_t* req)
+{
+    httpd_resp_set_status(req, "503 Service Unavailable");
+    httpd_resp_set_hdr(req, "Retry-After", "1");
+    return httpd_resp_sendstr(req, "Busy");
+}
+
+HttpWorkerPool::Stats HttpWorkerPool::stats() const
+{
+    Stats stats{};
+    stats.dispatched = dispatched_.load();
+    stats.completed  = completed_.load();
+    stats.rejected   = rejected_.load();
+    return stats;
+}
+
+void HttpWorkerPool::taskEntry(void* arg)
+{
+    auto* self = static_cast<HttpWorkerPool*>(arg);
+    MemAccounting::setTaskTag(MemTag::Http);
+
+    Job job{};
+    while (xQueueReceive(self->queue_, &job, portMAX_DELAY) == pdTRUE && job.req != nullptr)
+    {
+        const esp_err_t err = job.route->handler(job.req);
+        if (err != ESP_OK)
+        {
+            ESP_LOGW(kLogTag, "Handler for %s failed: %d", job.req->uri, err);
+        }
+        httpd_req_async_handler_complete(job.req);
+        --job.route->inFlight;
+        ++self->completed_;
+    }
+
+    xSemaphoreGive(self->workersStopped_);
+    vTaskDelete(nullptr);
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "sdkconfig.h"
+
+/**
+ * @file http_workers.hh
+ * @brief Worker tasks for HTTP handlers that would otherwise stall the
+ *        server task.
+ *
+ * esp_http_server runs every handler on its one server task, so a slow
+ * upload or a large response being drained over the SoftAP holds up every
+ * other client. Routes classified as long-running are detached with
+ * `httpd_req_async_handler_begin()` and run on a small pool of workers while
+ * the server task goes back to accepting requests. Each such route has its
+ * own in-flight limit and the pool has a bounded queue; excess requests are
+ * answered with 503 and `Retry-After` instead of piling up.
+ */
+class HttpWorkerPool
+{
+public:
+    using Handler = esp_err_t (*)(httpd_req_t* req);
+
+    struct Config
+    {
+        std::size_t workers    = CONFIG_JARVIS_HTTP_WORKERS;
+        std::size_t queueDepth = CONFIG_JARVIS_HTTP_WORKER_QUEUE;
+        uint32_t    stackSize  = 4096;
+        UBaseType_t priority   = 5;
+    };
+
+    /**
+     * @brief A long-running route and its admission limit. Must outlive the
+     *        server (routes are normally static).
+     */
+    struct Route
+    {
+        Route(Handler routeHandler, uint8_t limit) : handler(routeHandler), maxInFlight(limit) {}
+
+        Handler              handler;
+        uint8_t              maxInFlight;
+        std::atomic<uint8_t> inFlight{0};
+    };
+
+    struct Stats
+    {
+        uint32_t dispatched = 0;
+        uint32_t completed  = 0;
+        uint32_t rejected   = 0;
+    };
+
+    HttpWorkerPool() = default;
+    ~HttpWorkerPool() { stop(); }
+
+    HttpWorkerPool(const HttpWorkerPool&)            = delete;
+    HttpWorkerPool& operator=(const HttpWorkerPool&) = delete;
+
+    esp_err_t start() { return start(Config{}); }
+    esp_err_t start(const Config& config);
+
+    /**
+     * @brief Lets queued requests finish, then stops the workers. Call
+     *        before `httpd_stop()`.
+     */
+    void stop();
+    bool running() const { return queue_ != nullptr; }
+
+    /**
+     * @brief Runs @p route's handler for @p req on a worker.
+     *
+     * When the route or the queue is saturated the request is answered with
+     * 503 here. Without running workers the handler runs inline. Either
+     * way the caller returns the result without touching @p req again.
+     */
+    esp_err_t submit(httpd_req_t* req, Route& route);
+
+    /**
+     * @brief httpd handler for routes registered with a `Route*` as
+     *        `user_ctx`; offloads them to @p pool.
+     */
+    static esp_err_t offload(HttpWorkerPool& pool, httpd_req_t* req);
+
+    Stats stats() const;
+
+private:
+    struct Job
+    {
+        httpd_req_t* req;
+        Route*       route;
+    };
+
+    static void      taskEntry(void* arg);
+    static esp_err_t reject(httpd_req_t* req);
+
+    QueueHandle_t     queue_          = nullptr;
+    SemaphoreHandle_t workersStopped_ = nullptr;
+    std::size_t       workers_        = 0;
+
+    std::atomic<uint32_t> dispatched_{0};
+    std::atomic<uint32_t> completed_{0};
+    std::atomic<uint32_t> rejected_{0};
+};
@@ -0,0 +1,446 @@
+#include "live_broadcast.hh"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#include "lwip/sockets.h"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "services/mem/mem.hh"
+
+namespace
+{
+constexpr const char* kLogTag       = "LiveBroadcast";
+constexpr uint32_t    kTaskStack    = 3072;
+constexpr UBaseType_t kTaskPriority = 4; ///< Below the HTTP server
+
+// Frames are complete HTTP chunks: "XXX\r\n" <event> "\r\n"
+constexpr std::size_t kChunkHead = 5;
+constexpr std::size_t kChunkTail = 2;
+static_assert(LiveBroadcast::kFrameBytes - kChunkHead - kChunkTail <= 0xFFF, "chunk size must fit three hex digits");
+
+class LockGuard
+{
+public:
+    explicit LockGuard(SemaphoreHandle_t mutex) : mutex_(mutex) { xSemaphoreTake(mutex_, portMAX_DELAY); }
+    ~LockGuard() { xSemaphoreGive(mutex_); }
+
+    LockGuard(const LockGuard&)            = delete;
+    LockGuard& operator=(const LockGuard&) = delete;
+
+private:
+    SemaphoreHandle_t mutex_;
+};
+
+esp_err_t reject(httpd_req_t* req)
+{
+    httpd_resp_set_status(req, "503 Service Unavailable");
+    httpd_resp_set_hdr(req, "Retry-After", "5");
+    return httpd_resp_sendstr(req, "Too many live clients");
+}
+} // namespace
+
+LiveBroadcast::LiveBroadcast()
+{
+    mutex_ = xSemaphoreCreateMutex();
+}
+
+LiveBroadcast::~LiveBroadcast()
+{
+    stop();
+    if (mutex_ != nullptr)
+    {
+        vSemaphoreDelete(mutex_);
+    }
+    if (taskStopped_ != nullptr)
+    {
+        vSemaphoreDelete(taskStopped_);
+    }
+}
+
+esp_err_t LiveBroadcast::start()
+{
+    if (running_)
+    {
+        return ESP_OK;
+    }
+    if (mutex_ == nullptr)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+    if (taskStopped_ == nullptr)
+    {
+        taskStopped_ = xSemaphoreCreateBinary();
+        if (taskStopped_ == nullptr)
+        {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    running_ = true;
+    if (xTaskCreate(&LiveBroadcast::taskEntry, "live", kTaskStack, this, kTaskPriority, &task_) != pdPASS)
+    {
+        running_ = false;
+        task_    = nullptr;
+        ESP_LOGE(kLogTag, "Failed to create broadcast task");
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(kLogTag,
+             "Up to %u client(s) at %u Hz",
+             static_cast<unsigned>(kMaxClients),
+             static_cast<unsigned>(CONFIG_JARVIS_LIVE_HZ));
+    return ESP_OK;
+}
+
+void LiveBroadcast::stop()
+{
+    if (!running_)
+    {
+        return;
+    }
+    running_ = false;
+    xTaskNotifyGive(task_);
+    xSemaphoreTake(taskStopped_, portMAX_DELAY);
+    task_ = nullptr;
+
+    LockGuard lock(mutex_);
+    for (Client& client : clients_)
+    {
+        if (client.req != nullptr)
+        {
+            disconnectLocked(client);
+        }
+    }
+}
+
+void LiveBroadcast::publish(const TelemetryState& state)
+{
+    taskENTER_CRITICAL(&stateLock_);
+    latest_    = state;
+    fresh_     = true;
+    haveState_ = true;
+    taskEXIT_CRITICAL(&stateLock_);
+}
+
+esp_err_t LiveBroadcast::subscribe(httpd_req_t* req)
+{
+    // Only the server task subscribes, so a slot found free stays free
+    Client* slot = nullptr;
+    {
+        LockGuard lock(mutex_);
+        for (Client& client : clients_)
+        {
+            if (client.req == nullptr)
+            {
+                slot = &client;
+                break;
+            }
+        }
+        if (slot == nullptr || !running_)
+        {
+            ++stats_.rejected;
+        }
+    }
+    if (slot == nullptr || !running_)
+    {
+        return reject(req);
+    }
+
+    httpd_req_t* detached = nullptr;
+    esp_err_t    err      = httpd_req_async_handler_begin(req, &detached);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(kLogTag, "httpd_req_async_handler_begin failed: %d", err);
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to start stream");
+    }
+
+    // Headers and the reconnect delay go out the normal way; events are
+    // written to the socket directly from then on
+    httpd_resp_set_type(detached, "text/event-stream");
+    httpd_resp_set_hdr(detached, "Cache-Control", "no-cache");
+    err = httpd_resp_send_chunk(detached, "retry: 2000\n\n", HTTPD_RESP_USE_STRLEN);
+    if (err != ESP_OK)
+    {
+        httpd_req_async_handler_complete(detached);
+        return err;
+    }
+
+    {
+        LockGuard lock(mutex_);
+        *slot     = Client{};
+        slot->req = detached;
+        slot->fd  = httpd_req_to_sockfd(detached);
+        ++clientCount_;
+    }
+    // The newcomer gets the current state on the next tick, news or not
+    taskENTER_CRITICAL(&stateLock_);
+    fresh_ = fresh_ || haveState_;
+    taskEXIT_CRITICAL(&stateLock_);
+    xTaskNotifyGive(task_);
+    return ESP_OK;
+}
+
+LiveBroadcast::Stats LiveBroadcast::stats() const
+{
+    LockGuard lock(mutex_);
+    Stats     stats = stats_;
+    stats.clients   = clientCount_;
+    return stats;
+}
+
+void LiveBroadcast::taskEntry(void* arg)
+{
+    auto* self = static_cast<LiveBroadcast*>(arg);
+    MemAccounting::setTaskTag(MemTag::Http);
+
+    // Sleeps without a timeout while nobody listens; subscribe() wakes it
+    bool idle = true;
+    while (self->running_)
+    {
+        ulTaskNotifyTake(pdTRUE, idle ? portMAX_DELAY : pdMS_TO_TICKS(kPeriodMs));
+        if (!self->running_)
+        {
+            break;
+        }
+        idle = !self->tick();
+    }
+
+    xSemaphoreGive(self->taskStopped_);
+    vTaskDelete(nullptr);
+}
+
+bool LiveBroadcast::tick()
+{
+    JARVIS_NO_ALLOC("live_broadcast");
+    const int64_t startUs = esp_timer_get_time();
+
+    TelemetryState state;
+    bool           fresh = false;
+    taskENTER_CRITICAL(&stateLock_);
+    state  = latest_;
+    fresh  = fresh_;
+    fresh_ = false;
+    taskEXIT_CRITICAL(&stateLock_);
+
+    LockGuard lock(mutex_);
+    if (clientCount_ == 0)
+    {
+        return false;
+    }
+
+    const uint32_t nowMs = static_cast<uint32_t>(startUs / 1000);
+    Frame*         frame = nullptr;
+    if (fresh)
+    {
+        frame = encode(&state, nowMs);
+    }
+    else if (startUs - lastFrameUs_ >= int64_t{kKeepAliveMs} * 1000)
+    {
+        // Keeps proxies and the browser from timing the stream out
+        frame = encode(nullptr, nowMs);
+    }
+    const int64_t encodedUs = esp_timer_get_time();
+    if (frame != nullptr)
+    {
+        ++stats_.encoded;
+        lastFrameUs_ = encodedUs;
+    }
+
+    fanOut(frame, encodedUs);
+    release(frame);
+
+    const int64_t  endUs  = esp_timer_get_time();
+    const uint32_t tickUs = static_cast<uint32_t>(endUs - startUs);
+    ++stats_.ticks;
+    stats_.lastEncodeUs = static_cast<uint32_t>(encodedUs - startUs);
+    stats_.lastFanoutUs = static_cast<uint32_t>(endUs - encodedUs);
+    stats_.maxTickUs    = std::max(stats_.maxTickUs, tickUs);
+    stats_.busyUs += tickUs;
+    return clientCount_ > 0;
+}
+
+LiveBroadcast::Frame* LiveBroadcast::encode(const TelemetryState* state, uint32_t nowMs)
+{
+    // Every frame not held by a client is free: one pending per client at
+    // most, and the previous tick's frame has been released
+    Frame* frame = nullptr;
+    for (Frame& candidate : frames_)
+    {
+        if (candidate.refs == 0)
+        {
+            frame = &candidate;
+            break;
+        }
+    }
+    if (frame == nullptr)
+    {
+        return nullptr;
+    }
+
+    char* const       event    = frame->data + kChunkHead;
+    const std::size_t capacity = kFrameBytes - kChunkHead - kChunkTail;
+    int               length   = 0;
+    if (state == nullptr)
+    {
+        length = std::snprintf(event, capacity, ": keep-alive %u\n\n", static_cast<unsigned>(nowMs));
+    }
+    else
+    {
+        const ControllerData& data = state->data;
+        length = std::snprintf(event,
+                               capacity,
+                               R"(data: {"t":%u,"speedKph":%.1f,"rpm":%u,"powerKw":%.2f,"voltage":%.1f,)"
+                               R"("motorC":%.0f,"controllerC":%.0f,"gear":%u,"throttle":%u,"distanceKm":%.3f})"
+                               "\n\n",
+                               static_cast<unsigned>(nowMs),
+                               static_cast<double>(data.speedKph),
+                               static_cast<unsigned>(data.rpm),
+                               static_cast<double>(data.powerKw),
+                               static_cast<double>(data.voltage),
+                               static_cast<double>(data.motorC),
+                               static_cast<double>(data.controllerC),
+                               static_cast<unsigned>(data.gear),
+                               static_cast<unsigned>(data.throttle),
+                               static_cast<double>(state->distanceKm));
+    }
+    if (length <= 0 || static_cast<std::size_t>(length) >= capacity)
+    {
+        return nullptr;
+    }
+
+    char head[kChunkHead + 1];
+    std::snprintf(head, sizeof(head), "%03X\r\n", static_cast<unsigned>(length));
+    std::memcpy(frame->data, head, kChunkHead);
+    event[length]     = '\r';
+    event[length + 1] = '\n';
+    frame->length     = static_cast<uint16_t>(kChunkHead + length + kChunkTail);
+    frame->refs       = 1;
+    return frame;
+}
+
+LiveBroadcast::Write LiveBroadcast::write(Client& client, Frame& frame, std::size_t offset, std::size_t& written)
+{
+    written = 0;
+    const ssize_t sent = send(client.fd, frame.data + offset, frame.length - offset, MSG_DONTWAIT);
+    if (sent < 0)
+    {
+        return errno == EAGAIN || errno == EWOULDBLOCK ? Write::Partial : Write::Failed;
+    }
+    written = static_cast<std::size_t>(sent);
+    return offset + written == frame.length ? Write::Done : Write::Partial;
+}
+
+// Clients busy with an earlier frame finish that one and skip @p frame;
+// a nullptr frame only moves the pending writes along
+void LiveBroadcast::fanOut(Frame* frame, int64_t nowUs)
+{
+    for (Client& client : clients_)
+    {
+        if (client.req == nullptr)
+        {
+            continue;
+        }
+
+        std::size_t written = 0;
+        if (client.pending != nullptr)
+        {
+            const Write result = write(client, *client.pending, client.offset, written);
+            if (result == Write::Failed)
+            {
+                disconnectLocked(client);
+                continue;
+            }
+            if (result == Write::Partial)
+            {
+                client.offset = static_cast<uint16_t>(client.offset + written);
+                if (frame != nullptr)
+                {
+                    ++stats_.dropped;
+                }
+                if (stalled(client, written, nowUs))
+                {
+                    disconnectLocked(client);
+                }
+                continue;
+            }
+            release(client.pending);
+            client.blockedUs = 0;
+            ++stats_.sent;
+        }
+
+        if (frame == nullptr)
+        {
+            continue;
+        }
+        const Write result = write(client, *frame, 0, written);
+        if (result == Write::Failed)
+        {
+            disconnectLocked(client);
+        }
+        else if (result == Write::Done)
+        {
+            client.blockedUs = 0;
+            ++stats_.sent;
+        }
+        else if (written == 0)
+        {
+            // Nothing of it went out: skip it whole, newer state follows
+            ++stats_.dropped;
+            if (stalled(client, written, nowUs))
+            {
+                disconnectLocked(client);
+            }
+        }
+        else
+        {
+            retain(*frame);
+            client.pending   = frame;
+            client.offset    = static_cast<uint16_t>(written);
+            client.blockedUs = nowUs;
+        }
+    }
+}
+
+// Called when a write could not finish. True once the client has taken no
+// bytes for kStallMs.
+bool LiveBroadcast::stalled(Client& client, std::size_t written, int64_t nowUs)
+{
+    if (written != 0 || client.blockedUs == 0)
+    {
+        client.blockedUs = nowUs;
+        return false;
+    }
+    if (nowUs - client.blockedUs < int64_t{kStallMs} * 1000)
+    {
+        return false;
+    }
+    ESP_LOGW(kLogTag, "Client on socket %d stalled, disconnecting", client.fd);
+    ++stats_.evicted;
+    return true;
+}
+
+void LiveBroadcast::disconnectLocked(Client& client)
+{
+    release(client.pending);
+    const httpd_handle_t server = client.req->handle;
+    const int            fd     = client.fd;
+    httpd_req_async_handler_complete(client.req);
+    // A half-written chunk leaves the response unusable; close the socket
+    httpd_sess_trigger_close(server, fd);
+    client = Client{};
+    --clientCount_;
+}
+
+void LiveBroadcast::release(Frame*& frame)
+{
+    if (frame != nullptr)
+    {
+        --frame->refs;
+        frame = nullptr;
+    }
+}
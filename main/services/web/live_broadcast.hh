@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "sdkconfig.h"
+
+#include "telemetry/motor/motor_controller.h"
+
+/**
+ * @file live_broadcast.hh
+ * @brief Live telemetry for dashboard clients as Server-Sent Events, encoded
+ *        once per tick however many clients listen.
+ *
+ * The telemetry callback only stores the latest state. At
+ * CONFIG_JARVIS_LIVE_HZ a broadcast task encodes it into one frame: the SSE
+ * event already wrapped in its HTTP chunk, so every subscriber gets the
+ * same bytes. Frames come from a fixed pool and are reference counted; a
+ * subscriber holds a reference only while a write to it is half done.
+ *
+ * Subscriber sockets are written without blocking. A client that cannot
+ * take a whole frame keeps the part it has to finish later and skips the
+ * frames produced meanwhile, so a slow phone sees fewer updates but never
+ * older ones, never costs RAM beyond its one frame and never delays the
+ * others. A client that makes no progress for kStallMs is disconnected.
+ *
+ * Requests are detached with `httpd_req_async_handler_begin()` and held
+ * until the client goes away, so each subscriber keeps one of the server's
+ * sockets (see CONFIG_JARVIS_LIVE_CLIENTS).
+ */
+class LiveBroadcast
+{
+public:
+    static constexpr std::size_t kMaxClients  = CONFIG_JARVIS_LIVE_CLIENTS;
+    static constexpr uint32_t    kPeriodMs    = 1000 / CONFIG_JARVIS_LIVE_HZ;
+    static constexpr std::size_t kFrameBytes  = 256;
+    static constexpr uint32_t    kKeepAliveMs = 15 * 1000; ///< Comment line while no telemetry arrives
+    static constexpr uint32_t    kStallMs     = 10 * 1000;
+
+    struct Stats
+    {
+        uint8_t  clients      = 0;
+        uint32_t ticks        = 0; ///< Ticks with at least one client
+        uint32_t encoded      = 0; ///< Frames encoded, once per tick with news
+        uint32_t sent         = 0; ///< Frames written in full, summed over clients
+        uint32_t dropped      = 0; ///< Frames a busy client skipped
+        uint32_t evicted      = 0; ///< Clients disconnected after stalling
+        uint32_t rejected     = 0; ///< Subscriptions refused, all slots taken
+        uint32_t lastEncodeUs = 0;
+        uint32_t lastFanoutUs = 0; ///< Writing one frame to every client
+        uint32_t maxTickUs    = 0;
+        uint64_t busyUs       = 0; ///< Encode plus fan-out, all ticks
+    };
+
+    LiveBroadcast();
+    ~LiveBroadcast();
+
+    LiveBroadcast(const LiveBroadcast&)            = delete;
+    LiveBroadcast& operator=(const LiveBroadcast&) = delete;
+
+    /**
+     * @brief Starts the broadcast task. It sleeps while nobody subscribes.
+     */
+    esp_err_t start();
+
+    /**
+     * @brief Disconnects every client and stops the task. Call before
+     *        `httpd_stop()`.
+     */
+    void stop();
+
+    /**
+     * @brief Keeps @p state for the next tick. Constant time, no allocation;
+     *        call it from the telemetry callback.
+     */
+    void publish(const TelemetryState& state);
+
+    /**
+     * @brief Handler body for the event-stream route: sends the response
+     *        headers and keeps the request as a subscriber. Answers 503
+     *        when all CONFIG_JARVIS_LIVE_CLIENTS slots are taken.
+     */
+    esp_err_t subscribe(httpd_req_t* req);
+
+    Stats stats() const;
+
+private:
+    struct Frame
+    {
+        uint8_t  refs   = 0; ///< Touched by the broadcast task only
+        uint16_t length = 0;
+        char     data[kFrameBytes];
+    };
+
+    struct Client
+    {
+        httpd_req_t* req       = nullptr; ///< Detached request; nullptr marks a free slot
+        int          fd        = -1;
+        Frame*       pending   = nullptr; ///< Frame partly written
+        uint16_t     offset    = 0;
+        int64_t      blockedUs = 0; ///< Last progress while behind; 0 when caught up
+    };
+
+    enum class Write : uint8_t
+    {
+        Done,
+        Partial,
+        Failed,
+    };
+
+    static void taskEntry(void* arg);
+    bool        tick(); ///< @return Whether clients remain
+    Frame*      encode(const TelemetryState* state, uint32_t nowMs);
+    Write       write(Client& client, Frame& frame, std::size_t offset, std::size_t& written);
+    void        fanOut(Frame* frame, int64_t nowUs);
+    bool        stalled(Client& client, std::size_t written, int64_t nowUs);
+    void        disconnectLocked(Client& client);
+    void        retain(Frame& frame) { ++frame.refs; }
+    void        release(Frame*& frame);
+
+    SemaphoreHandle_t mutex_       = nullptr; ///< Guards clients_ and stats_
+    SemaphoreHandle_t taskStopped_ = nullptr;
+    TaskHandle_t      task_        = nullptr;
+    volatile bool     running_     = false;
+
+    portMUX_TYPE   stateLock_ = portMUX_INITIALIZER_UNLOCKED;
+    TelemetryState latest_{};
+    bool           fresh_     = false; ///< latest_ not sent yet, or a client just joined
+    bool           haveState_ = false;
+
+    Client  clients_[kMaxClients]{};
+    uint8_t clientCount_ = 0;
+    Frame   frames_[kMaxClients + 1]{}; ///< One pending per client plus the one being sent
+    int64_t lastFrameUs_ = 0;
+    Stats   stats_{};
+};
@@ -0,0 +1,371 @@
+#include "home_sync.hh"
+
+#include <algorithm>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "services/mem/mem.hh"
+
+namespace
+{
+constexpr const char* kLogTag       = "HomeSync";
+constexpr uint32_t    kTaskStack    = 4096;
+constexpr UBaseType_t kTaskPriority = 3;
+
+constexpr const char* kBundleContentType = "application/octet-stream";
+constexpr const char* kRideContentType   = "application/x-jarvis-ride";
+
+// Held for the length of a session so the upload runs at full clock and
+// the chip does not light-sleep between bundles
+constexpr uint8_t kSessionNeeds = kPowerNeedCpuMax | kPowerNeedAwake;
+
+class LockGuard
+{
+public:
+    explicit LockGuard(SemaphoreHandle_t mutex) : mutex_(mutex) { xSemaphoreTake(mutex_, portMAX_DELAY); }
+    ~LockGuard() { xSemaphoreGive(mutex_); }
+
+    LockGuard(const LockGuard&)            = delete;
+    LockGuard& operator=(const LockGuard&) = delete;
+
+private:
+    SemaphoreHandle_t mutex_;
+};
+
+// Hands LteService a session that is already up, so its queue goes out
+// on the connection the rides used
+class OpenSession : public UplinkTransport
+{
+public:
+    explicit OpenSession(UplinkTransport& transport) : transport_(transport) {}
+
+    esp_err_t connect(uint32_t) override { return ESP_OK; }
+    void      disconnect() override {}
+    esp_err_t send(const uint8_t* data, std::size_t length) override { return transport_.send(data, length); }
+
+private:
+    UplinkTransport& transport_;
+};
+} // namespace
+
+HomeSyncTransport::HomeSyncTransport(WifiService& wifi, const Config& config) : wifi_(wifi), config_(config)
+{
+    mutex_ = xSemaphoreCreateMutex();
+}
+
+HomeSyncTransport::~HomeSyncTransport()
+{
+    disconnect();
+    if (mutex_ != nullptr)
+    {
+        vSemaphoreDelete(mutex_);
+    }
+}
+
+esp_err_t HomeSyncTransport::connect(uint32_t timeoutMs)
+{
+    if (!configured())
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    const esp_err_t err = wifi_.connectStation(config_.network, std::min(timeoutMs, config_.connectTimeoutMs));
+    if (err != ESP_OK)
+    {
+        LockGuard lock(mutex_);
+        ++stats_.failedConnects;
+        return err;
+    }
+
+    esp_http_client_config_t http{};
+    http.url               = config_.url.c_str();
+    http.method            = HTTP_METHOD_POST;
+    http.timeout_ms        = static_cast<int>(config_.requestTimeoutMs);
+    http.keep_alive_enable = true;
+
+    client_ = esp_http_client_init(&http);
+    if (client_ == nullptr)
+    {
+        wifi_.disconnectStation();
+        return ESP_ERR_NO_MEM;
+    }
+
+    delivered_ = false;
+    sendUs_    = 0;
+    bytes_     = 0;
+
+    const WifiService::StationStats station = wifi_.stationStats();
+    LockGuard                       lock(mutex_);
+    ++stats_.sessions;
+    stats_.lastConnectMs = station.lastConnectMs;
+    stats_.lastFast      = station.lastFast;
+    return ESP_OK;
+}
+
+void HomeSyncTransport::disconnect()
+{
+    if (client_ == nullptr)
+    {
+        return;
+    }
+
+    esp_http_client_cleanup(client_);
+    client_ = nullptr;
+    wifi_.disconnectStation();
+
+    const uint32_t sendMs = static_cast<uint32_t>(sendUs_ / 1000);
+    LockGuard      lock(mutex_);
+    stats_.lastBytes       = static_cast<uint32_t>(bytes_);
+    stats_.lastSendMs      = sendMs;
+    stats_.lastBytesPerSec = sendUs_ == 0 ? 0 : static_cast<uint32_t>(bytes_ * 1000000 / static_cast<uint64_t>(sendUs_));
+    stats_.bytesSent += bytes_;
+
+    ESP_LOGI(kLogTag,
+             "Session: joined in %u ms (%s), %u B in %u ms, %u B/s",
+             static_cast<unsigned>(stats_.lastConnectMs),
+             stats_.lastFast ? "cached" : "full",
+             static_cast<unsigned>(stats_.lastBytes),
+             static_cast<unsigned>(sendMs),
+             static_cast<unsigned>(stats_.lastBytesPerSec));
+}
+
+esp_err_t HomeSyncTransport::send(const uint8_t* data, std::size_t length)
+{
+    return post(config_.url, kBundleContentType, data, length);
+}
+
+esp_err_t HomeSyncTransport::sendRide(const RideSummary& ride)
+{
+    return post(config_.ridesUrl, kRideContentType, &ride, sizeof(ride));
+}
+
+esp_err_t HomeSyncTransport::post(const std::string& url, const char* contentType, const void* data, std::size_t length)
+{
+    if (client_ == nullptr)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Same host and port keeps the connection; the rides URL usually is
+    const int64_t startUs = esp_timer_get_time();
+    esp_err_t     err     = esp_http_client_set_url(client_, url.c_str());
+    if (err == ESP_OK)
+    {
+        esp_http_client_set_header(client_, "Content-Type", contentType);
+        esp_http_client_set_post_field(client_, static_cast<const char*>(data), static_cast<int>(length));
+        err = esp_http_client_perform(client_);
+    }
+    if (err == ESP_OK)
+    {
+        const int status = esp_http_client_get_status_code(client_);
+        if (status < 200 || status >= 300)
+        {
+            ESP_LOGW(kLogTag, "Upload to %s rejected: HTTP %d", url.c_str(), status);
+            err = ESP_FAIL;
+        }
+    }
+    sendUs_ += esp_timer_get_time() - startUs;
+
+    if (err != ESP_OK)
+    {
+        // Nothing got through on a cached address: it may have been leased
+        // to another host meanwhile, so join with DHCP next time
+        if (!delivered_ && wifi_.stationStats().lastFast)
+        {
+            wifi_.forgetStationCache();
+        }
+        LockGuard lock(mutex_);
+        ++stats_.failedSends;
+        return err;
+    }
+
+    delivered_ = true;
+    bytes_ += length;
+    return ESP_OK;
+}
+
+HomeSyncTransport::Stats HomeSyncTransport::stats() const
+{
+    LockGuard lock(mutex_);
+    return stats_;
+}
+
+HomeSyncService::HomeSyncService(RideService& rides, LteService* uplink, HomeSyncTransport& transport)
+    : rides_(rides), uplink_(uplink), transport_(transport)
+{
+    mutex_ = xSemaphoreCreateMutex();
+}
+
+HomeSyncService::~HomeSyncService()
+{
+    stop();
+    if (mutex_ != nullptr)
+    {
+        vSemaphoreDelete(mutex_);
+    }
+    if (taskStopped_ != nullptr)
+    {
+        vSemaphoreDelete(taskStopped_);
+    }
+}
+
+esp_err_t HomeSyncService::start()
+{
+    if (running_)
+    {
+        return ESP_OK;
+    }
+    if (!transport_.configured())
+    {
+        ESP_LOGI(kLogTag, "No home network configured");
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (mutex_ == nullptr)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+    if (taskStopped_ == nullptr)
+    {
+        taskStopped_ = xSemaphoreCreateBinary();
+        if (taskStopped_ == nullptr)
+        {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    if (powerClient_ == kNoPowerClient)
+    {
+        powerClient_ = PowerManager::registerClient("home_sync", kPowerNeedNone, kPowerNeedNone);
+    }
+
+    running_ = true;
+    if (xTaskCreate(&HomeSyncService::taskEntry, "home_sync", kTaskStack, this, kTaskPriority, &task_) != pdPASS)
+    {
+        running_ = false;
+        task_    = nullptr;
+        ESP_LOGE(kLogTag, "Failed to create sync task");
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Listeners cannot be removed; stop() leaves this one idle
+    if (!subscribed_)
+    {
+        subscribed_ = PowerManager::subscribe(&HomeSyncService::onPowerState, this) == ESP_OK;
+        if (!subscribed_)
+        {
+            ESP_LOGW(kLogTag, "No power listener slot; syncs run on request only");
+        }
+    }
+    return ESP_OK;
+}
+
+void HomeSyncService::stop()
+{
+    if (!running_)
+    {
+        return;
+    }
+
+    running_ = false;
+    if (task_ != nullptr)
+    {
+        xTaskNotifyGive(task_);
+        xSemaphoreTake(taskStopped_, portMAX_DELAY);
+        task_ = nullptr;
+    }
+}
+
+void HomeSyncService::syncNow()
+{
+    if (running_ && task_ != nullptr)
+    {
+        xTaskNotifyGive(task_);
+    }
+}
+
+HomeSyncService::Stats HomeSyncService::stats() const
+{
+    Stats stats;
+    stats.transport = transport_.stats();
+
+    LockGuard lock(mutex_);
+    stats.syncs         = syncs_;
+    stats.failedSyncs   = failedSyncs_;
+    stats.ridesUploaded = ridesUploaded_;
+    return stats;
+}
+
+void HomeSyncService::onPowerState(void* context, PowerState state)
+{
+    // Parking is when the bike is likely at home and the queue is complete
+    if (state == PowerState::Parked)
+    {
+        static_cast<HomeSyncService*>(context)->syncNow();
+    }
+}
+
+esp_err_t HomeSyncService::sync()
+{
+    // One join for both: the transport caps the timeout at its own
+    esp_err_t err = transport_.connect(UINT32_MAX);
+    if (err == ESP_OK)
+    {
+        err = uploadRides();
+    }
+    if (err == ESP_OK && uplink_ != nullptr)
+    {
+        OpenSession session(transport_);
+        err = uplink_->uploadVia(session);
+    }
+    transport_.disconnect();
+    return err;
+}
+
+esp_err_t HomeSyncService::uploadRides()
+{
+    // One record at a time; a ride is marked only once the server took it
+    RideSummary ride;
+    while (rides_.nextToUpload(ride))
+    {
+        const esp_err_t err = transport_.sendRide(ride);
+        if (err != ESP_OK)
+        {
+            return err;
+        }
+        rides_.markUploaded(ride.seq);
+
+        LockGuard lock(mutex_);
+        ++ridesUploaded_;
+    }
+    return ESP_OK;
+}
+
+void HomeSyncService::taskEntry(void* arg)
+{
+    auto* self = static_cast<HomeSyncService*>(arg);
+    MemAccounting::setTaskTag(MemTag::Wifi);
+
+    while (self->running_)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (!self->running_)
+        {
+            break;
+        }
+
+        PowerManager::setNeeds(self->powerClient_, kSessionNeeds, kSessionNeeds);
+        const esp_err_t err = self->sync();
+        PowerManager::setNeeds(self->powerClient_, kPowerNeedNone, kPowerNeedNone);
+
+        LockGuard lock(self->mutex_);
+        ++self->syncs_;
+        if (err != ESP_OK)
+        {
+            ++self->failedSyncs_;
+            ESP_LOGW(kLogTag, "Home sync failed: %d", err);
+        }
+    }
+
+    xSemaphoreGive(self->taskStopped_);
+    vTaskDelete(nullptr);
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "esp_err.h"
+#include "esp_http_client.h"
+#include "sdkconfig.h"
+
+#include "services/lte/lte.hh"
+#include "services/lte/modem.hh"
+#include "services/power/power.hh"
+#include "services/ride/ride.hh"
+#include "services/wifi/wifi.hh"
+
+/**
+ * @file home_sync.hh
+ * @brief Declares the home Wi-Fi path for queued ride data.
+ *
+ * HomeSyncTransport is an UplinkTransport over the home network: connect()
+ * joins it in station mode (cached BSSID, channel and address, see
+ * WifiService::connectStation()) and send() posts each bundle to a local
+ * endpoint over one keep-alive HTTP connection. HomeSyncService uses it
+ * whenever the bike parks: it uploads the summary of every ride finished
+ * since the last sync and, with LTE built in, drains the LteService queue,
+ * so the bulk of a ride goes out at Wi-Fi speed and the modem only carries
+ * what is recorded away from home.
+ */
+class HomeSyncTransport : public UplinkTransport
+{
+public:
+    struct Config
+    {
+        WifiService::StationConfig network{CONFIG_JARVIS_HOME_SYNC_SSID, CONFIG_JARVIS_HOME_SYNC_PASSWORD};
+        std::string                url              = CONFIG_JARVIS_HOME_SYNC_URL;
+        std::string                ridesUrl         = CONFIG_JARVIS_HOME_SYNC_RIDES_URL;
+        uint32_t                   connectTimeoutMs = CONFIG_JARVIS_HOME_SYNC_CONNECT_TIMEOUT_MS;
+        uint32_t                   requestTimeoutMs = 5000;
+    };
+
+    struct Stats
+    {
+        uint32_t sessions        = 0;
+        uint32_t failedConnects  = 0;
+        uint32_t failedSends     = 0;
+        uint32_t lastConnectMs   = 0;     ///< Join to IP ready
+        bool     lastFast        = false; ///< The last join used the cached BSSID and address
+        uint32_t lastBytes       = 0;     ///< Sent in the last session
+        uint32_t lastSendMs      = 0;     ///< Time spent in send() in the last session
+        uint32_t lastBytesPerSec = 0;     ///< lastBytes over lastSendMs
+        uint64_t bytesSent       = 0;
+    };
+
+    explicit HomeSyncTransport(WifiService& wifi) : HomeSyncTransport(wifi, Config{}) {}
+    HomeSyncTransport(WifiService& wifi, const Config& config);
+    ~HomeSyncTransport() override;
+
+    HomeSyncTransport(const HomeSyncTransport&)            = delete;
+    HomeSyncTransport& operator=(const HomeSyncTransport&) = delete;
+
+    /**
+     * @brief Joins the home network; @p timeoutMs is capped at the
+     *        configured join timeout.
+     */
+    esp_err_t connect(uint32_t timeoutMs) override;
+    void      disconnect() override;
+    esp_err_t send(const uint8_t* data, std::size_t length) override;
+
+    /**
+     * @brief Posts one ride summary, its 56-byte NVS record, to the rides
+     *        URL on the open connection.
+     */
+    esp_err_t sendRide(const RideSummary& ride);
+
+    bool  configured() const { return !config_.network.ssid.empty() && !config_.url.empty(); }
+    Stats stats() const;
+
+private:
+    esp_err_t post(const std::string& url, const char* contentType, const void* data, std::size_t length);
+
+    WifiService&             wifi_;
+    Config                   config_{};
+    esp_http_client_handle_t client_    = nullptr;
+    bool                     delivered_ = false; ///< A bundle went through in this session
+    int64_t                  sendUs_    = 0;     ///< Session totals
+    uint64_t                 bytes_     = 0;
+
+    mutable SemaphoreHandle_t mutex_ = nullptr;
+    Stats                     stats_{};
+};
+
+/**
+ * @brief Uploads finished rides and the LTE queue over home Wi-Fi each time
+ *        the bike parks, or on syncNow(), in one station session.
+ */
+class HomeSyncService
+{
+public:
+    struct Stats
+    {
+        uint32_t                 syncs         = 0;
+        uint32_t                 failedSyncs   = 0;
+        uint32_t                 ridesUploaded = 0;
+        HomeSyncTransport::Stats transport{};
+    };
+
+    /**
+     * @param uplink LTE queue to drain as well; nullptr without LTE.
+     */
+    HomeSyncService(RideService& rides, LteService* uplink, HomeSyncTransport& transport);
+    ~HomeSyncService();
+
+    HomeSyncService(const HomeSyncService&)            = delete;
+    HomeSyncService& operator=(const HomeSyncService&) = delete;
+
+    /**
+     * @brief Starts the sync task and subscribes to PowerManager.
+     * @return ESP_ERR_INVALID_STATE when no home network is configured.
+     */
+    esp_err_t start();
+    void      stop();
+
+    /**
+     * @brief Wakes the task for a sync, regardless of the power state.
+     */
+    void syncNow();
+
+    Stats stats() const;
+
+private:
+    static void taskEntry(void* arg);
+    static void onPowerState(void* context, PowerState state);
+    esp_err_t   sync();
+    esp_err_t   uploadRides();
+
+    RideService&       rides_;
+    LteService*        uplink_;
+    HomeSyncTransport& transport_;
+
+    mutable SemaphoreHandle_t mutex_         = nullptr;
+    SemaphoreHandle_t         taskStopped_   = nullptr;
+    TaskHandle_t              task_          = nullptr;
+    volatile bool             running_       = false;
+    bool                      subscribed_    = false;
+    PowerClient               powerClient_   = kNoPowerClient;
+    uint32_t                  syncs_         = 0;
+    uint32_t                  failedSyncs_   = 0;
+    uint32_t                  ridesUploaded_ = 0;
+};
@@ -4,20 +4,130 @@
 #include <cstring>
 #include <utility>
 
+#include "driver/gpio.h"
 #include "esp_event.h"
+#include "esp_heap_caps.h"
 #include "esp_log.h"
 #include "esp_netif.h"
+#include "esp_netif_net_stack.h"
+#include "esp_rom_crc.h"
+#include "esp_timer.h"
 #include "esp_wifi.h"
 #include "esp_wifi_types.h"
-#include "nvs_flash.h"
+#include "lwip/etharp.h"
+#include "nvs.h"
+
+#include "services/config/config_store.hh"
+#include "services/mem/mem.hh"
 
 namespace
 {
     constexpr const char *kLogTag = "WifiService";
+
+    constexpr uint32_t    kTaskStack    = 4096;
+    constexpr UBaseType_t kTaskPriority = 4;
+
+    // Task notification bits
+    constexpr uint32_t kRequestBit     = 1U << 0;
+    constexpr uint32_t kReconfigureBit = 1U << 1;
+    constexpr uint32_t kStationBit     = 1U << 2;
+    constexpr uint32_t kStopBit        = 1U << 3;
+
+    // Give the HTTP response that changed the AP settings time to reach the
+    // client before the AP is reconfigured underneath it.
+    constexpr TickType_t kReconfigureDelay = pdMS_TO_TICKS(500);
+
+    // Station event group bits
+    constexpr EventBits_t kStaGotIpBit  = 1U << 0;
+    constexpr EventBits_t kStaFailedBit = 1U << 1;
+
+    // Upper bound for the disconnect event of a previous attempt to arrive,
+    // so it is not taken for the failure of the next one
+    constexpr TickType_t kStaDisconnectSettle = pdMS_TO_TICKS(100);
+
+    constexpr const char *kStaCacheNamespace = "wifi_sta";
+    constexpr const char *kStaCacheKey       = "join";
+
+    // ARP requests for the cached address before it is used; two, in case
+    // one is lost, each followed by the time a LAN host takes to answer
+    constexpr int        kStaArpProbes    = 2;
+    constexpr TickType_t kStaArpProbeWait = pdMS_TO_TICKS(100);
+
+    class RecursiveLockGuard
+    {
+    public:
+        explicit RecursiveLockGuard(SemaphoreHandle_t mutex) : mutex_(mutex) { xSemaphoreTakeRecursive(mutex_, portMAX_DELAY); }
+        ~RecursiveLockGuard() { xSemaphoreGiveRecursive(mutex_); }
+
+        RecursiveLockGuard(const RecursiveLockGuard &)            = delete;
+        RecursiveLockGuard &operator=(const RecursiveLockGuard &) = delete;
+
+    private:
+        SemaphoreHandle_t mutex_;
+    };
+
+    // lwIP state is only touched on the TCP/IP task, see esp_netif_tcpip_exec()
+    struct ArpProbe
+    {
+        esp_netif_t *netif    = nullptr;
+        ip4_addr_t   ip       = {};
+        bool         answered = false;
+    };
+
+    esp_err_t sendArpRequest(void *context)
+    {
+        auto *probe = static_cast<ArpProbe *>(context);
+        auto *netif = static_cast<struct netif *>(esp_netif_get_netif_impl(probe->netif));
+        return netif != nullptr && etharp_request(netif, &probe->ip) == ERR_OK ? ESP_OK : ESP_FAIL;
+    }
+
+    esp_err_t findArpEntry(void *context)
+    {
+        auto             *probe = static_cast<ArpProbe *>(context);
+        auto             *netif = static_cast<struct netif *>(esp_netif_get_netif_impl(probe->netif));
+        struct eth_addr  *mac   = nullptr;
+        const ip4_addr_t *ip    = nullptr;
+        probe->answered         = netif != nullptr && etharp_find_addr(netif, &probe->ip, &mac, &ip) >= 0;
+        return ESP_OK;
+    }
+
+    /**
+     * True when another host answers an ARP request for @p ip, our own
+     * address on @p netif: its lease lapsed and went elsewhere.
+     */
+    bool addressTaken(esp_netif_t *netif, uint32_t ip)
+    {
+        ArpProbe probe;
+        probe.netif   = netif;
+        probe.ip.addr = ip;
+        for (int attempt = 0; attempt < kStaArpProbes && !probe.answered; ++attempt)
+        {
+            if (esp_netif_tcpip_exec(&sendArpRequest, &probe) != ESP_OK)
+            {
+                return false;
+            }
+            vTaskDelay(kStaArpProbeWait);
+            esp_netif_tcpip_exec(&findArpEntry, &probe);
+        }
+        return probe.answered;
+    }
+
     std::size_t clampLength(std::size_t value, std::size_t maxLen)
     {
         return value > maxLen ? maxLen : value;
     }
+
+    // Milliseconds since boot, never 0 so that 0 can mean "no timestamp".
+    uint32_t nowMs()
+    {
+        const auto ms = static_cast<uint32_t>(esp_timer_get_time() / 1000);
+        return ms != 0 ? ms : 1;
+    }
+
+    uint32_t freeInternalHeap()
+    {
+        return static_cast<uint32_t>(heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+    }
 } // namespace
 
 #ifndef WIFI_SSID_MAX_LEN
@@ -28,11 +138,45 @@ namespace
 #define WIFI_PASSWD_MAX_LEN MAX_PASSPHRASE_LEN
 #endif
 
+WifiService::WifiService()
+{
+    mutex_     = xSemaphoreCreateRecursiveMutex();
+    staEvents_ = xEventGroupCreate();
+}
+
 // WifiService deconstructor 
 WifiService::~WifiService()
 {
-    // Stop & de-initialize the soft AP, if active
-    if (apActive_)
+    // Stop the on-demand task first; it owns the AP while it runs
+    if (task_ != nullptr)
+    {
+        if (onDemand_.buttonGpio >= 0)
+        {
+            gpio_isr_handler_remove(static_cast<gpio_num_t>(onDemand_.buttonGpio));
+        }
+        notifyTask(kStopBit);
+        xSemaphoreTake(taskStopped_, portMAX_DELAY);
+        task_ = nullptr;
+    }
+    if (taskStopped_ != nullptr)
+    {
+        vSemaphoreDelete(taskStopped_);
+    }
+    if (staActive_)
+    {
+        esp_wifi_disconnect();
+    }
+    if (eventHandler_ != nullptr)
+    {
+        esp_event_handler_instance_unregister(WIFI_EVENT, ESP_EVENT_ANY_ID, eventHandler_);
+    }
+    if (ipHandler_ != nullptr)
+    {
+        esp_event_handler_instance_unregister(IP_EVENT, IP_EVENT_STA_GOT_IP, ipHandler_);
+    }
+
+    // Stop & de-initialize the soft AP and station, if active
+    if (apActive_ || staActive_)
     {
         const esp_err_t stopErr = esp_wifi_stop();
         if (stopErr != ESP_OK)
@@ -51,6 +195,15 @@ WifiService::~WifiService()
         }
     }
 
+    if (staEvents_ != nullptr)
+    {
+        vEventGroupDelete(staEvents_);
+    }
+    if (mutex_ != nullptr)
+    {
+        vSemaphoreDelete(mutex_);
+    }
+
     // Teardown complete
 }
 
@@ -65,28 +218,21 @@ esp_err_t WifiService::ensureInitialized()
 
 esp_err_t WifiService::init()
 {
-    if (initialized_)
+    if (mutex_ == nullptr || staEvents_ == nullptr)
     {
-        return ESP_OK;
+        return ESP_ERR_NO_MEM;
     }
 
-    // Initialize NVS (Non-Volatile Storage)
-    esp_err_t err = nvs_flash_init();
-    if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND)
+    RecursiveLockGuard lock(mutex_);
+    if (initialized_)
     {
-        ESP_LOGW(kLogTag, "NVS init failed (%d), erasing", err);
-        const esp_err_t eraseErr = nvs_flash_erase();
-        if (eraseErr != ESP_OK)
-        {
-            ESP_LOGE(kLogTag, "Failed to erase NVS partition: %d", eraseErr);
-            return eraseErr;
-        }
-        err = nvs_flash_init();
+        return ESP_OK;
     }
-    // Error checking for NVS initialization
+
+    // Initialize NVS (Non-Volatile Storage); a no-op if settings got there first
+    esp_err_t err = NvsConfigBackend::initFlash();
     if (err != ESP_OK)
     {
-        ESP_LOGE(kLogTag, "Failed to initialise NVS: %d", err);
         return err;
     }
 
@@ -106,6 +252,27 @@ esp_err_t WifiService::init()
         return err;
     }
 
+    // Station and AP events drive the idle timer; registered once and kept
+    // across deinit() so a restarted driver reports to the same handler
+    if (eventHandler_ == nullptr)
+    {
+        err = esp_event_handler_instance_register(WIFI_EVENT, ESP_EVENT_ANY_ID, &WifiService::onWifiEvent, this, &eventHandler_);
+        if (err != ESP_OK)
+        {
+            ESP_LOGE(kLogTag, "Failed to register Wi-Fi event handler: %d", err);
+            return err;
+        }
+    }
+    if (ipHandler_ == nullptr)
+    {
+        err = esp_event_handler_instance_register(IP_EVENT, IP_EVENT_STA_GOT_IP, &WifiService::onIpEvent, this, &ipHandler_);
+        if (err != ESP_OK)
+        {
+            ESP_LOGE(kLogTag, "Failed to register IP event handler: %d", err);
+            return err;
+        }
+    }
+
     if (apNetif_ == nullptr)
     {
         // Create an access point network interface if it DNE
@@ -136,6 +303,8 @@ esp_err_t WifiService::startSoftAp(const SoftApConfig &config)
     SoftApConfig cfg = config;
     cfg.applySecurityDefaults();
 
+    RecursiveLockGuard lock(mutex_);
+
     // Check if AP interface is initialized yet
     esp_err_t err = ensureInitialized();
     if (err != ESP_OK)
@@ -211,8 +380,8 @@ esp_err_t WifiService::startSoftAp(const SoftApConfig &config)
     apConfig.ap.pmf_cfg.capable = (authMode >= WIFI_AUTH_WPA2_PSK);                             // AP security level
     apConfig.ap.pmf_cfg.required = (authMode == WIFI_AUTH_WPA3_PSK || authMode == WIFI_AUTH_WPA2_WPA3_PSK);
 
-    // Attempt to set the configs
-    err = esp_wifi_set_mode(WIFI_MODE_AP);
+    // Attempt to set the configs; a joined home network stays up beside the AP
+    err = esp_wifi_set_mode(staActive_ ? WIFI_MODE_APSTA : WIFI_MODE_AP);
     if (err != ESP_OK)
     {
         ESP_LOGE(kLogTag, "Failed to set Wi-Fi mode: %d", err);
@@ -229,13 +398,15 @@ esp_err_t WifiService::startSoftAp(const SoftApConfig &config)
     // Attempt to start the soft AP service
     if (!apActive_)
     {
-        err = esp_wifi_start();
+        // Already running for the station; the mode change started the AP
+        err = staActive_ ? ESP_OK : esp_wifi_start();
         if (err != ESP_OK)
         {
             ESP_LOGE(kLogTag, "Failed to start SoftAP: %d", err);
             return err;
         }
         apActive_ = true;
+        active_.store(true, std::memory_order_release);
     }
 
     // Successfully configured & started soft AP
@@ -251,15 +422,19 @@ esp_err_t WifiService::startSoftAp(const SoftApConfig &config)
 
 esp_err_t WifiService::stopSoftAp()
 {
+    RecursiveLockGuard lock(mutex_);
     if (!apActive_)
     {
         return ESP_OK;
     }
 
-    const esp_err_t err = esp_wifi_stop();
+    // Keep the driver running while a home network is joined
+    const esp_err_t err = staActive_ ? esp_wifi_set_mode(WIFI_MODE_STA) : esp_wifi_stop();
     if (err == ESP_OK)
     {
         apActive_ = false;
+        active_.store(false, std::memory_order_release);
+        stations_.store(0, std::memory_order_relaxed);
         ESP_LOGI(kLogTag, "SoftAP stopped");
     }
     else
@@ -268,3 +443,576 @@ esp_err_t WifiService::stopSoftAp()
     }
     return err;
 }
+
+esp_err_t WifiService::deinit()
+{
+    RecursiveLockGuard lock(mutex_);
+    if (!initialized_ || staActive_)
+    {
+        return ESP_OK;
+    }
+
+    // NVS, the netif and the event loop stay; only the driver and its
+    // buffers are released
+    const esp_err_t err = esp_wifi_deinit();
+    if (err != ESP_OK && err != ESP_ERR_WIFI_NOT_INIT)
+    {
+        ESP_LOGE(kLogTag, "esp_wifi_deinit failed: %d", err);
+        return err;
+    }
+    initialized_ = false;
+    return ESP_OK;
+}
+
+esp_err_t WifiService::startOnDemand(const OnDemandConfig &config)
+{
+    if (task_ != nullptr)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (taskStopped_ == nullptr)
+    {
+        taskStopped_ = xSemaphoreCreateBinary();
+        if (taskStopped_ == nullptr)
+        {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    onDemand_ = config;
+    if (xTaskCreate(&WifiService::onDemandTask, "wifi_ap", kTaskStack, this, kTaskPriority, &task_) != pdPASS)
+    {
+        task_ = nullptr;
+        ESP_LOGE(kLogTag, "Failed to create on-demand AP task");
+        return ESP_ERR_NO_MEM;
+    }
+
+    bool buttonReady = false;
+    if (onDemand_.buttonGpio >= 0)
+    {
+        const gpio_num_t pin = static_cast<gpio_num_t>(onDemand_.buttonGpio);
+
+        gpio_config_t io{};
+        io.pin_bit_mask = 1ULL << onDemand_.buttonGpio;
+        io.mode         = GPIO_MODE_INPUT;
+        io.pull_up_en   = GPIO_PULLUP_ENABLE;
+        io.intr_type    = GPIO_INTR_NEGEDGE;
+
+        // Another driver may have installed the shared GPIO ISR service already
+        esp_err_t err = gpio_install_isr_service(0);
+        if (err == ESP_ERR_INVALID_STATE)
+        {
+            err = ESP_OK;
+        }
+        if (err == ESP_OK)
+        {
+            err = gpio_config(&io);
+        }
+        if (err == ESP_OK)
+        {
+            err = gpio_isr_handler_add(pin, &WifiService::onButton, this);
+        }
+        if (err != ESP_OK)
+        {
+            // The AP can still be requested in software
+            ESP_LOGE(kLogTag, "Failed to set up AP button on GPIO %d: %d", onDemand_.buttonGpio, err);
+        }
+        buttonReady = err == ESP_OK;
+    }
+
+    if (onDemand_.idleTimeoutMs != 0 && !buttonReady && !onDemand_.remoteTrigger)
+    {
+        // An idle shutdown would cut off the web UI and OTA until a reboot
+        ESP_LOGW(kLogTag, "No SoftAP trigger; the AP will not be shut down when idle");
+        keepUp_.store(true, std::memory_order_relaxed);
+    }
+
+    ESP_LOGI(kLogTag,
+             "SoftAP on demand, idle timeout %u s",
+             keepUp_.load(std::memory_order_relaxed) ? 0U : static_cast<unsigned>(onDemand_.idleTimeoutMs / 1000));
+    return ESP_OK;
+}
+
+void WifiService::requestSoftAp()
+{
+    // Only a trigger that finds the AP down starts a measurement
+    uint32_t none = 0;
+    if (!active_.load(std::memory_order_acquire))
+    {
+        triggerMs_.compare_exchange_strong(none, nowMs(), std::memory_order_relaxed);
+    }
+    notifyTask(kRequestBit);
+}
+
+void WifiService::keepSoftApUp()
+{
+    keepUp_.store(true, std::memory_order_relaxed);
+    requestSoftAp();
+}
+
+void WifiService::requestSoftApFromIsr()
+{
+    uint32_t none = 0;
+    if (!active_.load(std::memory_order_acquire))
+    {
+        triggerMs_.compare_exchange_strong(none, nowMs(), std::memory_order_relaxed);
+    }
+    if (task_ != nullptr)
+    {
+        BaseType_t woken = pdFALSE;
+        xTaskNotifyFromISR(task_, kRequestBit, eSetBits, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+}
+
+void WifiService::requestReconfigure()
+{
+    notifyTask(kReconfigureBit);
+}
+
+void WifiService::noteUiServed()
+{
+    if (uiPendingMs_.load(std::memory_order_relaxed) == 0)
+    {
+        return;
+    }
+    const uint32_t triggerMs = uiPendingMs_.exchange(0, std::memory_order_relaxed);
+    if (triggerMs != 0)
+    {
+        triggerToUiMs_.store(nowMs() - triggerMs, std::memory_order_relaxed);
+    }
+}
+
+WifiService::OnDemandStats WifiService::onDemandStats() const
+{
+    OnDemandStats stats;
+    stats.active           = active_.load(std::memory_order_acquire);
+    stats.stations         = stations_.load(std::memory_order_relaxed);
+    stats.starts           = starts_.load(std::memory_order_relaxed);
+    stats.idleStops        = idleStops_.load(std::memory_order_relaxed);
+    stats.triggerToApMs    = triggerToApMs_.load(std::memory_order_relaxed);
+    stats.triggerToUiMs    = triggerToUiMs_.load(std::memory_order_relaxed);
+    stats.startCostBytes   = startCostBytes_.load(std::memory_order_relaxed);
+    stats.reclaimedBytes   = reclaimedBytes_.load(std::memory_order_relaxed);
+    stats.freeInternalHeap = freeInternalHeap();
+    return stats;
+}
+
+void WifiService::notifyTask(uint32_t bits)
+{
+    if (task_ != nullptr)
+    {
+        xTaskNotify(task_, bits, eSetBits);
+    }
+}
+
+void WifiService::onDemandTask(void *arg)
+{
+    auto *self = static_cast<WifiService *>(arg);
+    MemAccounting::setTaskTag(MemTag::Wifi);
+    self->runOnDemand();
+    xSemaphoreGive(self->taskStopped_);
+    vTaskDelete(nullptr);
+}
+
+void WifiService::onButton(void *arg)
+{
+    static_cast<WifiService *>(arg)->requestSoftApFromIsr();
+}
+
+void WifiService::onWifiEvent(void *arg, esp_event_base_t, int32_t id, void *)
+{
+    auto *self = static_cast<WifiService *>(arg);
+    switch (id)
+    {
+        case WIFI_EVENT_AP_START:
+        {
+            const uint32_t triggerMs = self->triggerMs_.exchange(0, std::memory_order_relaxed);
+            if (triggerMs != 0)
+            {
+                self->triggerToApMs_.store(nowMs() - triggerMs, std::memory_order_relaxed);
+                self->uiPendingMs_.store(triggerMs, std::memory_order_relaxed);
+            }
+            break;
+        }
+        case WIFI_EVENT_AP_STACONNECTED:
+            self->stations_.fetch_add(1, std::memory_order_relaxed);
+            self->notifyTask(kStationBit);
+            break;
+        case WIFI_EVENT_STA_DISCONNECTED:
+            xEventGroupClearBits(self->staEvents_, kStaGotIpBit);
+            xEventGroupSetBits(self->staEvents_, kStaFailedBit);
+            break;
+        case WIFI_EVENT_AP_STADISCONNECTED:
+        {
+            uint8_t stations = self->stations_.load(std::memory_order_relaxed);
+            while (stations > 0 &&
+                   !self->stations_.compare_exchange_weak(stations, static_cast<uint8_t>(stations - 1), std::memory_order_relaxed))
+            {
+            }
+            self->notifyTask(kStationBit);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void WifiService::onIpEvent(void *arg, esp_event_base_t, int32_t id, void *)
+{
+    // Also raised for a static address once the association completes
+    if (id == IP_EVENT_STA_GOT_IP)
+    {
+        xEventGroupSetBits(static_cast<WifiService *>(arg)->staEvents_, kStaGotIpBit);
+    }
+}
+
+void WifiService::runOnDemand()
+{
+    // init() ran for NVS; until someone asks, the driver is not needed
+    if (onDemand_.startNow)
+    {
+        bringUp();
+    }
+    else if (!apActive_)
+    {
+        deinit();
+    }
+
+    const int64_t timeoutUs = static_cast<int64_t>(onDemand_.idleTimeoutMs) * 1000;
+    for (;;)
+    {
+        TickType_t wait = portMAX_DELAY;
+        if (apActive_ && timeoutUs > 0 && !keepUp_.load(std::memory_order_relaxed) &&
+            stations_.load(std::memory_order_relaxed) == 0)
+        {
+            const int64_t idleUs = esp_timer_get_time() - idleSinceUs_;
+            if (idleUs >= timeoutUs)
+            {
+                tearDown();
+                continue;
+            }
+            wait = pdMS_TO_TICKS(static_cast<uint32_t>((timeoutUs - idleUs) / 1000)) + 1;
+        }
+
+        uint32_t bits = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &bits, wait);
+        if ((bits & kStopBit) != 0)
+        {
+            break;
+        }
+        if ((bits & kRequestBit) != 0)
+        {
+            if (!apActive_)
+            {
+                bringUp();
+            }
+            // A request also restarts the idle period of a running AP
+            idleSinceUs_ = esp_timer_get_time();
+        }
+        if ((bits & kReconfigureBit) != 0 && apActive_)
+        {
+            vTaskDelay(kReconfigureDelay);
+            const esp_err_t err = startSoftAp(onDemand_.source != nullptr ? onDemand_.source(onDemand_.context) : softApConfig_);
+            if (err != ESP_OK)
+            {
+                ESP_LOGE(kLogTag, "Failed to apply SoftAP settings: %d", err);
+            }
+        }
+        if ((bits & kStationBit) != 0 && stations_.load(std::memory_order_relaxed) == 0)
+        {
+            idleSinceUs_ = esp_timer_get_time();
+        }
+    }
+}
+
+esp_err_t WifiService::bringUp()
+{
+    const uint32_t  freeBefore = freeInternalHeap();
+    const esp_err_t err = startSoftAp(onDemand_.source != nullptr ? onDemand_.source(onDemand_.context) : softApConfig_);
+    if (err != ESP_OK)
+    {
+        triggerMs_.store(0, std::memory_order_relaxed);
+        return err;
+    }
+
+    const uint32_t freeAfter = freeInternalHeap();
+    startCostBytes_.store(freeBefore > freeAfter ? freeBefore - freeAfter : 0, std::memory_order_relaxed);
+    starts_.fetch_add(1, std::memory_order_relaxed);
+    idleSinceUs_ = esp_timer_get_time();
+    return ESP_OK;
+}
+
+void WifiService::tearDown()
+{
+    RecursiveLockGuard lock(mutex_);
+    if (staActive_)
+    {
+        // The driver stays for the home network; only the AP goes
+        stopSoftAp();
+        return;
+    }
+
+    const uint32_t freeBefore = freeInternalHeap();
+    if (stopSoftAp() != ESP_OK || deinit() != ESP_OK)
+    {
+        // Try again after another idle period rather than spinning
+        idleSinceUs_ = esp_timer_get_time();
+        return;
+    }
+
+    const uint32_t freeAfter = freeInternalHeap();
+    const uint32_t reclaimed = freeAfter > freeBefore ? freeAfter - freeBefore : 0;
+    reclaimedBytes_.store(reclaimed, std::memory_order_relaxed);
+    idleStops_.fetch_add(1, std::memory_order_relaxed);
+    uiPendingMs_.store(0, std::memory_order_relaxed);
+    ESP_LOGI(kLogTag,
+             "SoftAP idle for %u s; Wi-Fi off, %u bytes of internal RAM reclaimed",
+             static_cast<unsigned>(onDemand_.idleTimeoutMs / 1000),
+             static_cast<unsigned>(reclaimed));
+}
+
+esp_err_t WifiService::connectStation(const StationConfig &config, uint32_t timeoutMs)
+{
+    if (config.ssid.empty() || config.ssid.size() > WIFI_SSID_MAX_LEN || config.password.size() > WIFI_PASSWD_MAX_LEN)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    RecursiveLockGuard lock(mutex_);
+    const int64_t      startUs = esp_timer_get_time();
+
+    esp_err_t err = ensureInitialized();
+    if (err != ESP_OK)
+    {
+        return err;
+    }
+    if (staNetif_ == nullptr)
+    {
+        staNetif_ = esp_netif_create_default_wifi_sta();
+        if (staNetif_ == nullptr)
+        {
+            ESP_LOGE(kLogTag, "Failed to create default Wi-Fi STA interface");
+            return ESP_FAIL;
+        }
+    }
+
+    if (!staActive_)
+    {
+        err = esp_wifi_set_mode(apActive_ ? WIFI_MODE_APSTA : WIFI_MODE_STA);
+        if (err == ESP_OK && !apActive_)
+        {
+            err = esp_wifi_start();
+        }
+        if (err != ESP_OK)
+        {
+            ESP_LOGE(kLogTag, "Failed to start station mode: %d", err);
+            return err;
+        }
+        staActive_ = true;
+    }
+    else if (esp_wifi_disconnect() == ESP_OK)
+    {
+        xEventGroupWaitBits(staEvents_, kStaFailedBit, pdTRUE, pdFALSE, kStaDisconnectSettle);
+    }
+
+    uint32_t key = esp_rom_crc32_le(0, reinterpret_cast<const uint8_t *>(config.ssid.data()), config.ssid.size());
+    key          = esp_rom_crc32_le(key, reinterpret_cast<const uint8_t *>(config.password.data()), config.password.size());
+
+    const TickType_t deadline = xTaskGetTickCount() + pdMS_TO_TICKS(timeoutMs);
+    StationCache     cache;
+    bool             fast = loadStationCache(key, cache);
+    err                   = fast ? joinStation(config, &cache, pdMS_TO_TICKS(timeoutMs)) : ESP_FAIL;
+    if (fast && err == ESP_OK && addressTaken(staNetif_, cache.ip))
+    {
+        ESP_LOGW(kLogTag, "Cached address on '%s' is held by another host", config.ssid.c_str());
+        ++staStats_.addressConflicts;
+        err = ESP_ERR_INVALID_STATE;
+    }
+    if (fast && err != ESP_OK)
+    {
+        // Moved to another channel, new router or the lease went elsewhere
+        ESP_LOGW(kLogTag, "Cached join to '%s' failed (%d), scanning", config.ssid.c_str(), err);
+        ++staStats_.fastFallbacks;
+        forgetStationCache();
+        if (esp_wifi_disconnect() == ESP_OK)
+        {
+            xEventGroupWaitBits(staEvents_, kStaFailedBit, pdTRUE, pdFALSE, kStaDisconnectSettle);
+        }
+        fast = false;
+    }
+    if (!fast)
+    {
+        const TickType_t now = xTaskGetTickCount();
+        err = static_cast<int32_t>(deadline - now) > 0 ? joinStation(config, nullptr, deadline - now) : ESP_ERR_TIMEOUT;
+    }
+
+    if (err != ESP_OK)
+    {
+        ++staStats_.failures;
+        ESP_LOGW(kLogTag, "Failed to join '%s': %d", config.ssid.c_str(), err);
+        disconnectStation();
+        return err;
+    }
+
+    if (fast)
+    {
+        ++staStats_.fastJoins;
+    }
+    else
+    {
+        ++staStats_.fullJoins;
+        saveStationCache(key);
+    }
+    staStats_.connected     = true;
+    staStats_.lastFast      = fast;
+    staStats_.lastConnectMs = static_cast<uint32_t>((esp_timer_get_time() - startUs) / 1000);
+    ESP_LOGI(kLogTag,
+             "Joined '%s' in %u ms (%s)",
+             config.ssid.c_str(),
+             static_cast<unsigned>(staStats_.lastConnectMs),
+             fast ? "cached" : "scan + DHCP");
+    return ESP_OK;
+}
+
+esp_err_t WifiService::joinStation(const StationConfig &config, const StationCache *cache, TickType_t timeout)
+{
+    wifi_config_t staConfig{};
+    std::memcpy(staConfig.sta.ssid, config.ssid.data(), config.ssid.size());
+    std::memcpy(staConfig.sta.password, config.password.data(), config.password.size());
+    staConfig.sta.scan_method        = WIFI_FAST_SCAN;
+    staConfig.sta.threshold.authmode = config.password.empty() ? WIFI_AUTH_OPEN : WIFI_AUTH_WPA2_PSK;
+    staConfig.sta.pmf_cfg.capable    = true;
+
+    if (cache != nullptr)
+    {
+        // Probe one channel for one BSSID and bring the link up on the last
+        // lease without DHCP
+        staConfig.sta.bssid_set = true;
+        std::memcpy(staConfig.sta.bssid, cache->bssid, sizeof(cache->bssid));
+        staConfig.sta.channel = cache->channel;
+
+        esp_netif_dhcpc_stop(staNetif_);
+        esp_netif_ip_info_t ipInfo{};
+        ipInfo.ip.addr      = cache->ip;
+        ipInfo.netmask.addr = cache->netmask;
+        ipInfo.gw.addr      = cache->gateway;
+        esp_netif_set_ip_info(staNetif_, &ipInfo);
+
+        esp_netif_dns_info_t dns{};
+        dns.ip.type            = ESP_IPADDR_TYPE_V4;
+        dns.ip.u_addr.ip4.addr = cache->dns;
+        esp_netif_set_dns_info(staNetif_, ESP_NETIF_DNS_MAIN, &dns);
+    }
+    else
+    {
+        esp_netif_dhcpc_start(staNetif_);
+    }
+
+    esp_err_t err = esp_wifi_set_config(WIFI_IF_STA, &staConfig);
+    if (err != ESP_OK)
+    {
+        return err;
+    }
+
+    xEventGroupClearBits(staEvents_, kStaGotIpBit | kStaFailedBit);
+    err = esp_wifi_connect();
+    if (err != ESP_OK)
+    {
+        return err;
+    }
+
+    const EventBits_t bits = xEventGroupWaitBits(staEvents_, kStaGotIpBit | kStaFailedBit, pdTRUE, pdFALSE, timeout);
+    if ((bits & kStaGotIpBit) != 0)
+    {
+        return ESP_OK;
+    }
+    return (bits & kStaFailedBit) != 0 ? ESP_FAIL : ESP_ERR_TIMEOUT;
+}
+
+void WifiService::disconnectStation()
+{
+    RecursiveLockGuard lock(mutex_);
+    if (!staActive_)
+    {
+        return;
+    }
+
+    esp_wifi_disconnect();
+    staActive_          = false;
+    staStats_.connected = false;
+    if (apActive_)
+    {
+        esp_wifi_set_mode(WIFI_MODE_AP);
+    }
+    else
+    {
+        esp_wifi_stop();
+        deinit();
+    }
+}
+
+void WifiService::forgetStationCache()
+{
+    nvs_handle_t handle;
+    if (nvs_open(kStaCacheNamespace, NVS_READWRITE, &handle) != ESP_OK)
+    {
+        return;
+    }
+    if (nvs_erase_key(handle, kStaCacheKey) == ESP_OK)
+    {
+        nvs_commit(handle);
+    }
+    nvs_close(handle);
+}
+
+WifiService::StationStats WifiService::stationStats() const
+{
+    RecursiveLockGuard lock(mutex_);
+    return staStats_;
+}
+
+bool WifiService::loadStationCache(uint32_t key, StationCache &cache) const
+{
+    nvs_handle_t handle;
+    if (nvs_open(kStaCacheNamespace, NVS_READONLY, &handle) != ESP_OK)
+    {
+        return false;
+    }
+    std::size_t     length = sizeof(cache);
+    const esp_err_t err    = nvs_get_blob(handle, kStaCacheKey, &cache, &length);
+    nvs_close(handle);
+    return err == ESP_OK && length == sizeof(cache) && cache.key == key && cache.ip != 0;
+}
+
+void WifiService::saveStationCache(uint32_t key)
+{
+    wifi_ap_record_t     ap{};
+    esp_netif_ip_info_t  ipInfo{};
+    esp_netif_dns_info_t dns{};
+    if (esp_wifi_sta_get_ap_info(&ap) != ESP_OK || esp_netif_get_ip_info(staNetif_, &ipInfo) != ESP_OK)
+    {
+        return;
+    }
+    esp_netif_get_dns_info(staNetif_, ESP_NETIF_DNS_MAIN, &dns);
+
+    StationCache cache;
+    cache.key = key;
+    std::memcpy(cache.bssid, ap.bssid, sizeof(cache.bssid));
+    cache.channel = ap.primary;
+    cache.ip      = ipInfo.ip.addr;
+    cache.netmask = ipInfo.netmask.addr;
+    cache.gateway = ipInfo.gw.addr;
+    cache.dns     = dns.ip.u_addr.ip4.addr;
+
+    nvs_handle_t handle;
+    if (nvs_open(kStaCacheNamespace, NVS_READWRITE, &handle) != ESP_OK)
+    {
+        return;
+    }
+    if (nvs_set_blob(handle, kStaCacheKey, &cache, sizeof(cache)) == ESP_OK)
+    {
+        nvs_commit(handle);
+    }
+    nvs_close(handle);
+}
@@ -1,12 +1,20 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <string>
 
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
 #include "esp_err.h"
+#include "esp_event.h"
 #include "esp_netif.h"
 #include "esp_wifi_types.h"
+#include "sdkconfig.h"
 
 /**
  * @file wifi.hh
@@ -18,6 +26,20 @@
  * configuration necessary to keep the AP running. No application data is saved
  * in NVS; the storage layer is touched solely to meet ESP-IDF Wi-Fi driver
  * expectations.
+ *
+ * With startOnDemand() the AP is brought up only when asked for (a button,
+ * a BLE command) and the Wi-Fi driver is deinitialised again once no
+ * station has been associated for the idle timeout, which returns the
+ * driver's internal RAM and lets the chip light-sleep. A task owns the AP
+ * from then on; other tasks go through requestSoftAp() and
+ * requestReconfigure().
+ *
+ * connectStation() joins a home network as well, in AP+STA mode while the
+ * AP is up. The BSSID, channel and address of the last successful join are
+ * kept in NVS, so a rejoin skips the scan and DHCP and is limited by the
+ * association handshake alone. The lease may have lapsed meanwhile, so the
+ * cached address is ARP-probed before use; if another host answers, the
+ * join falls back to a scan and DHCP.
  */
 class WifiService
 {
@@ -65,7 +87,53 @@ public:
         }
     };
 
-    WifiService()  = default;
+    /**
+     * @brief Supplies the AP configuration each time the AP comes up.
+     */
+    using ConfigSource = SoftApConfig (*)(void* context);
+
+    struct OnDemandConfig
+    {
+        ConfigSource source        = nullptr;
+        void*        context       = nullptr;
+        uint32_t     idleTimeoutMs = CONFIG_JARVIS_WIFI_AP_IDLE_TIMEOUT_S * 1000U; ///< 0 keeps the AP up
+        int          buttonGpio    = CONFIG_JARVIS_WIFI_AP_BUTTON_GPIO;           ///< Active-low trigger, -1 for none
+        bool         startNow      = false;                                        ///< Bring the AP up at once
+        bool         remoteTrigger = false;                                        ///< Something calls requestSoftAp(), e.g. a BLE command
+    };
+
+    struct OnDemandStats
+    {
+        bool     active           = false;
+        uint8_t  stations         = 0;
+        uint32_t starts           = 0;
+        uint32_t idleStops        = 0;
+        uint32_t triggerToApMs    = 0; ///< Last trigger to AP beaconing
+        uint32_t triggerToUiMs    = 0; ///< Last trigger to the first UI request served; 0 until one is
+        uint32_t startCostBytes   = 0; ///< Internal heap taken by the last bring-up
+        uint32_t reclaimedBytes   = 0; ///< Internal heap returned by the last teardown
+        uint32_t freeInternalHeap = 0;
+    };
+
+    struct StationConfig
+    {
+        std::string ssid     = {};
+        std::string password = {};
+    };
+
+    struct StationStats
+    {
+        bool     connected        = false;
+        bool     lastFast         = false; ///< The last join used the cache
+        uint32_t fastJoins        = 0;
+        uint32_t fullJoins        = 0;     ///< Scan and DHCP
+        uint32_t fastFallbacks    = 0;     ///< Cached joins that failed and fell back to a full join
+        uint32_t addressConflicts = 0;     ///< Fallbacks because another host held the cached address
+        uint32_t failures         = 0;
+        uint32_t lastConnectMs    = 0;     ///< connectStation() call to IP ready
+    };
+
+    WifiService();
     ~WifiService();
 
     /**
@@ -101,7 +169,92 @@ public:
      */
     const SoftApConfig& currentSoftApConfig() const { return softApConfig_; }
 
+    /**
+     * @brief Starts the task that brings the AP up on request and tears the
+     *        Wi-Fi driver down when it has been idle.
+     *
+     * Without a working button and without remoteTrigger nothing could bring
+     * the AP back, so it is then kept up regardless of idleTimeoutMs.
+     */
+    esp_err_t startOnDemand(const OnDemandConfig& config);
+
+    /**
+     * @brief Asks for the AP; it stays up for at least the idle timeout.
+     *        Safe from any task; requestSoftApFromIsr() from interrupts.
+     */
+    void requestSoftAp();
+    void requestSoftApFromIsr();
+
+    /**
+     * @brief Brings the AP up if needed and never idles it out again; for
+     *        when its remote trigger failed to start.
+     */
+    void keepSoftApUp();
+
+    /**
+     * @brief Re-reads the configuration source and applies it if the AP is up.
+     */
+    void requestReconfigure();
+
+    /**
+     * @brief Called by the HTTP server when it serves the UI; completes the
+     *        trigger-to-UI measurement.
+     */
+    void noteUiServed();
+
+    OnDemandStats onDemandStats() const;
+
+    /**
+     * @brief Joins @p config's network and waits until the link has an IP
+     *        address, for at most @p timeoutMs.
+     *
+     * A network joined before is rejoined on the cached BSSID and channel
+     * with the cached static address. If that fails the cache is dropped
+     * and a full join (scan, DHCP) follows within the same timeout; a
+     * successful full join refreshes the cache.
+     */
+    esp_err_t connectStation(const StationConfig& config, uint32_t timeoutMs);
+
+    /**
+     * @brief Leaves the network. The driver is released as well when the
+     *        AP is not up.
+     */
+    void disconnectStation();
+
+    /**
+     * @brief Drops the cached join, e.g. when traffic fails on a cached
+     *        address that may have been handed to another host.
+     */
+    void forgetStationCache();
+
+    StationStats stationStats() const;
+
 private:
+    struct StationCache
+    {
+        uint32_t key = 0; ///< CRC of SSID and password; a change invalidates the cache
+        uint8_t  bssid[6]{};
+        uint8_t  channel = 0;
+        uint32_t ip      = 0;
+        uint32_t netmask = 0;
+        uint32_t gateway = 0;
+        uint32_t dns     = 0;
+    };
+
+    static void onDemandTask(void* arg);
+    static void onButton(void* arg);
+    static void onWifiEvent(void* arg, esp_event_base_t base, int32_t id, void* data);
+    static void onIpEvent(void* arg, esp_event_base_t base, int32_t id, void* data);
+
+    void      runOnDemand();
+    esp_err_t bringUp();
+    void      tearDown();
+    esp_err_t deinit();
+    void      notifyTask(uint32_t bits);
+    esp_err_t joinStation(const StationConfig& config, const StationCache* cache, TickType_t timeout);
+    bool      loadStationCache(uint32_t key, StationCache& cache) const;
+    void      saveStationCache(uint32_t key);
+
     /**
      * @brief Lazily initialises Wi-Fi if needed before performing operations.
      */
@@ -111,4 +264,29 @@ private:
     bool          apActive_    = false;
     SoftApConfig  softApConfig_{};
     esp_netif_t*  apNetif_     = nullptr;
+
+    SemaphoreHandle_t            mutex_        = nullptr; ///< Recursive; serialises driver and mode changes
+    esp_event_handler_instance_t eventHandler_ = nullptr;
+    esp_event_handler_instance_t ipHandler_    = nullptr;
+    OnDemandConfig               onDemand_{};
+    TaskHandle_t                 task_         = nullptr;
+    SemaphoreHandle_t            taskStopped_  = nullptr;
+    int64_t                      idleSinceUs_  = 0; ///< Task only
+
+    std::atomic<bool>     active_{false}; ///< apActive_ for other tasks
+    std::atomic<bool>     keepUp_{false}; ///< No trigger could restart the AP
+    std::atomic<uint8_t>  stations_{0};
+    std::atomic<uint32_t> triggerMs_{0};   ///< Pending trigger-to-AP measurement, 0 for none
+    std::atomic<uint32_t> uiPendingMs_{0}; ///< Pending trigger-to-UI measurement, 0 for none
+    std::atomic<uint32_t> starts_{0};
+    std::atomic<uint32_t> idleStops_{0};
+    std::atomic<uint32_t> triggerToApMs_{0};
+    std::atomic<uint32_t> triggerToUiMs_{0};
+    std::atomic<uint32_t> startCostBytes_{0};
+    std::atomic<uint32_t> reclaimedBytes_{0};
+
+    esp_netif_t*       staNetif_  = nullptr;
+    EventGroupHandle_t staEvents_ = nullptr;
+    bool               staActive_ = false;
+    StationStats       staStats_{}; ///< Guarded by mutex_
 };
@@ -0,0 +1,172 @@
+#include "bms_controller.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+
+#include "esp_timer.h"
+
+#include "services/log/deferred_log.hh"
+
+namespace {
+// AntBMS status frame layout (all multi-byte fields are big-endian).
+constexpr uint8_t     kHeader[]             = {0xAA, 0x55, 0xAA, 0xFF};
+constexpr std::size_t kOffsetTotalVoltage   = 4;   ///< uint16, 0.1 V
+constexpr std::size_t kOffsetCells          = 6;   ///< 32 x uint16, mV
+constexpr std::size_t kOffsetCurrent        = 70;  ///< int32, 0.1 A
+constexpr std::size_t kOffsetSoc            = 74;  ///< uint8, %
+constexpr std::size_t kOffsetTemperatures   = 91;  ///< 6 x int16, °C
+constexpr std::size_t kOffsetPower          = 111; ///< int32, W
+constexpr std::size_t kOffsetCellCount      = 123; ///< uint8
+constexpr std::size_t kOffsetChecksum       = 138; ///< uint16, sum of bytes [4, 138)
+constexpr std::size_t kChecksumStart        = 4;
+} // namespace
+
+BmsController::BmsController() : BmsController(Config{}) {}
+
+BmsController::BmsController(const Config& config) : config_(config) {}
+
+void BmsController::setTelemetryCallback(TelemetryCallback callback) {
+    telemetryCallback_ = std::move(callback);
+}
+
+void BmsController::handleNotification(const uint8_t* data, std::size_t length) {
+    if (data == nullptr || length == 0) {
+        return;
+    }
+
+    // Fast path: the whole frame arrived in one notification, decode in place.
+    if (reassemblyLength_ == 0 && length >= kFrameLength && hasHeader(data)) {
+        handleFrame(data);
+        return;
+    }
+
+    // A header always starts a new frame, discarding any partial one.
+    if (length >= sizeof(kHeader) && hasHeader(data)) {
+        reassemblyLength_ = 0;
+    } else if (reassemblyLength_ == 0) {
+        ++telemetry_.framesRejected;
+        return;
+    }
+
+    const std::size_t toCopy = std::min(length, kFrameLength - reassemblyLength_);
+    std::memcpy(reassembly_.data() + reassemblyLength_, data, toCopy);
+    reassemblyLength_ += toCopy;
+
+    if (reassemblyLength_ == kFrameLength) {
+        reassemblyLength_ = 0;
+        handleFrame(reassembly_.data());
+    }
+}
+
+bool BmsController::handleFrame(const uint8_t* frame) {
+    if (!checksumValid(frame)) {
+        ++telemetry_.framesRejected;
+        return false;
+    }
+
+    const std::size_t cellCount = std::min<std::size_t>(frame[kOffsetCellCount], BmsData::kMaxCells);
+
+    BmsData& data    = telemetry_.data;
+    data.packVoltage = static_cast<float>(readUint16BE(&frame[kOffsetTotalVoltage])) / 10.0f;
+    data.currentAmps = static_cast<float>(readInt32BE(&frame[kOffsetCurrent])) / 10.0f;
+    data.powerW      = static_cast<float>(readInt32BE(&frame[kOffsetPower]));
+    data.socPercent  = frame[kOffsetSoc];
+    data.cellCount   = static_cast<uint8_t>(cellCount);
+
+    for (std::size_t i = 0; i < BmsData::kMaxTemperatures; ++i) {
+        data.temperaturesC[i] = readInt16BE(&frame[kOffsetTemperatures + i * 2]);
+    }
+
+    data.cells = computeCellStats(&frame[kOffsetCells], cellCount, data.cellMv.data());
+    std::fill(data.cellMv.begin() + cellCount, data.cellMv.end(), 0);
+
+    ++telemetry_.framesDecoded;
+    telemetry_.lastFrameUs = static_cast<uint64_t>(esp_timer_get_time());
+
+    logSnapshot();
+    return true;
+}
+
+BmsCellStats BmsController::computeCellStats(const uint8_t* cellsBe, std::size_t cellCount, uint16_t* cellMvOut) {
+    BmsCellStats stats{};
+    if (cellsBe == nullptr || cellCount == 0) {
+        return stats;
+    }
+
+    uint16_t minMv   = UINT16_MAX;
+    uint16_t maxMv   = 0;
+    uint32_t sumMv   = 0;
+    uint8_t  weakest = 0;
+
+    for (std::size_t i = 0; i < cellCount; ++i) {
+        const uint16_t mv = readUint16BE(&cellsBe[i * 2]);
+        if (cellMvOut != nullptr) {
+            cellMvOut[i] = mv;
+        }
+        sumMv += mv;
+        if (mv < minMv) {
+            minMv   = mv;
+            weakest = static_cast<uint8_t>(i);
+        }
+        if (mv > maxMv) {
+            maxMv = mv;
+        }
+    }
+
+    stats.minMv       = minMv;
+    stats.maxMv       = maxMv;
+    stats.deltaMv     = static_cast<uint16_t>(maxMv - minMv);
+    stats.meanMv      = static_cast<uint16_t>(sumMv / cellCount);
+    stats.weakestCell = weakest;
+    return stats;
+}
+
+void BmsController::logSnapshot() const {
+    if (telemetryCallback_) {
+        telemetryCallback_(telemetry_);
+    }
+
+    if (!config_.logSnapshots) {
+        return;
+    }
+
+    // Recorded in binary and formatted off this task; see deferred_log.hh.
+    const BmsData& data = telemetry_.data;
+    JARVIS_DLOG(BmsSnapshot,
+                data.packVoltage,
+                data.currentAmps,
+                data.socPercent,
+                data.cellCount,
+                data.cells.minMv,
+                data.cells.maxMv,
+                data.cells.deltaMv,
+                data.cells.meanMv,
+                data.cells.weakestCell + 1U);
+}
+
+bool BmsController::hasHeader(const uint8_t* data) {
+    return std::memcmp(data, kHeader, sizeof(kHeader)) == 0;
+}
+
+bool BmsController::checksumValid(const uint8_t* frame) {
+    uint16_t sum = 0;
+    for (std::size_t i = kChecksumStart; i < kOffsetChecksum; ++i) {
+        sum = static_cast<uint16_t>(sum + frame[i]);
+    }
+    return sum == readUint16BE(&frame[kOffsetChecksum]);
+}
+
+uint16_t BmsController::readUint16BE(const uint8_t* data) {
+    return static_cast<uint16_t>((static_cast<uint16_t>(data[0]) << 8) | static_cast<uint16_t>(data[1]));
+}
+
+int16_t BmsController::readInt16BE(const uint8_t* data) {
+    return static_cast<int16_t>(readUint16BE(data));
+}
+
+int32_t BmsController::readInt32BE(const uint8_t* data) {
+    return static_cast<int32_t>((static_cast<uint32_t>(data[0]) << 24) | (static_cast<uint32_t>(data[1]) << 16) |
+                                (static_cast<uint32_t>(data[2]) << 8) | static_cast<uint32_t>(data[3]));
+}
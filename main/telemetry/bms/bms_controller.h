@@ -0,0 +1,105 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+/**
+ * Aggregate statistics over the per-cell voltage array, computed in a single
+ * pass while the frame is decoded.
+ */
+struct BmsCellStats
+{
+    uint16_t minMv = 0;      ///< Lowest cell voltage (mV)
+    uint16_t maxMv = 0;      ///< Highest cell voltage (mV)
+    uint16_t deltaMv = 0;    ///< maxMv - minMv (mV)
+    uint16_t meanMv = 0;     ///< Mean cell voltage (mV)
+    uint8_t weakestCell = 0; ///< Zero-based index of the lowest cell
+};
+
+/**
+ * Snapshot of the parsed AntBMS status frame.
+ */
+struct BmsData
+{
+    static constexpr std::size_t kMaxCells = 32;
+    static constexpr std::size_t kMaxTemperatures = 6;
+
+    float packVoltage = 0.0f; ///< Total pack voltage (V)
+    float currentAmps = 0.0f; ///< Pack current (A), positive while charging
+    float powerW = 0.0f;      ///< Reported power (W)
+    uint8_t socPercent = 0;   ///< State of charge (%)
+    uint8_t cellCount = 0;    ///< Number of populated entries in cellMv
+    std::array<int16_t, kMaxTemperatures> temperaturesC{}; ///< MOS, balancer, T1..T4 (°C)
+    std::array<uint16_t, kMaxCells> cellMv{};              ///< Per-cell voltages (mV)
+    BmsCellStats cells{};
+};
+
+/**
+ * BMS telemetry state including decode bookkeeping.
+ */
+struct BmsState
+{
+    BmsData data{};
+    uint32_t framesDecoded = 0;
+    uint32_t framesRejected = 0;
+    uint64_t lastFrameUs = 0;
+};
+
+/**
+ * AntBMS telemetry processor. Consumes BLE notifications carrying the
+ * 140-byte status frame, decodes it in place and keeps the latest state.
+ *
+ * app_main hooks it up to BleService the same way as MotorController when
+ * CONFIG_JARVIS_BLE_BMS_SERVICE_UUID is set:
+ *
+ *     target.onNotify = [&bms](const BleService::NotificationEvent& event) {
+ *         bms.handleNotification(event.payload.data(), event.payload.size());
+ *     };
+ *
+ * Complete frames are decoded straight from the notification buffer. Frames
+ * split across several notifications (small MTU) are reassembled into a fixed
+ * internal buffer first.
+ */
+class BmsController
+{
+public:
+    struct Config
+    {
+        bool logSnapshots = false;
+    };
+
+    static constexpr std::size_t kFrameLength = 140;
+
+    using TelemetryCallback = std::function<void(const BmsState &)>;
+
+    BmsController();
+    explicit BmsController(const Config &config);
+
+    void handleNotification(const uint8_t *data, std::size_t length);
+    const BmsState &telemetry() const { return telemetry_; }
+    void setTelemetryCallback(TelemetryCallback callback);
+    const BmsController::Config &config() const { return config_; }
+
+    /**
+     * Computes min/max/delta/mean and the weakest cell in one pass over a
+     * big-endian cell voltage array as laid out in the status frame.
+     */
+    static BmsCellStats computeCellStats(const uint8_t *cellsBe, std::size_t cellCount, uint16_t *cellMvOut);
+
+private:
+    bool handleFrame(const uint8_t *frame);
+    void logSnapshot() const;
+    static bool hasHeader(const uint8_t *data);
+    static bool checksumValid(const uint8_t *frame);
+    static uint16_t readUint16BE(const uint8_t *data);
+    static int16_t readInt16BE(const uint8_t *data);
+    static int32_t readInt32BE(const uint8_t *data);
+
+    Config config_{};
+    BmsState telemetry_{};
+    TelemetryCallback telemetryCallback_{};
+    std::array<uint8_t, kFrameLength> reassembly_{};
+    std::size_t reassemblyLength_ = 0;
+};
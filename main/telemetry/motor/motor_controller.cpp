@@ -2,155 +2,189 @@
 
 #include <algorithm>
 #include <cstddef>
-#include <cmath>
-#include <cstdio>
 #include <utility>
 
+#include "freertos/task.h"
+
 #include "esp_timer.h"
 
+#include "services/log/deferred_log.hh"
+#include "services/mem/mem.hh"
+#include "services/metrics/metrics.hh"
+
 namespace {
-constexpr std::size_t kExpectedNotificationLength = 16;
+constexpr uint64_t kMaxDistanceGapUs = 5'000'000; ///< Longer gaps between index 0 frames add no distance
 } // namespace
 
-MotorController::MotorController() : MotorController(Config{}) {}
+template <typename Protocol, typename Numeric>
+BasicMotorController<Protocol, Numeric>::BasicMotorController() : BasicMotorController(Config{}) {}
+
+template <typename Protocol, typename Numeric>
+BasicMotorController<Protocol, Numeric>::BasicMotorController(const Config& config) {
+    applyConfig(config);
+}
+
+template <typename Protocol, typename Numeric>
+void BasicMotorController<Protocol, Numeric>::setConfig(const Config& config) {
+    taskENTER_CRITICAL(&configLock_);
+    pendingConfig_ = config;
+    configPending_.store(true, std::memory_order_release);
+    taskEXIT_CRITICAL(&configLock_);
+}
+
+template <typename Protocol, typename Numeric>
+void BasicMotorController<Protocol, Numeric>::takePendingConfig() {
+    taskENTER_CRITICAL(&configLock_);
+    const Config config = pendingConfig_;
+    configPending_.store(false, std::memory_order_relaxed);
+    taskEXIT_CRITICAL(&configLock_);
+    applyConfig(config);
+}
 
-MotorController::MotorController(const Config& config) : config_(config) {
+template <typename Protocol, typename Numeric>
+void BasicMotorController<Protocol, Numeric>::applyConfig(const Config& config) {
+    config_ = config;
     if (config_.reductionRatio <= 0.0f) {
         config_.reductionRatio = 1.0f;
     }
     if (config_.wheelCircumferenceMeters <= 0.0f) {
         config_.wheelCircumferenceMeters = 1.0f;
     }
+
+    // motor rpm / ratio / 60 s x circumference (m) x 3.6 = km/h
+    const double kphPerRpm = static_cast<double>(config_.wheelCircumferenceMeters) * 3.6 /
+                             (60.0 * static_cast<double>(config_.reductionRatio));
+    kphPerRpm_ = Numeric::scale(kphPerRpm);
 }
 
-void MotorController::setTelemetryCallback(TelemetryCallback callback) {
+template <typename Protocol, typename Numeric>
+void BasicMotorController<Protocol, Numeric>::setTelemetryCallback(TelemetryCallback callback) {
     telemetryCallback_ = std::move(callback);
 }
 
-void MotorController::handleNotification(const uint8_t* data, std::size_t length) {
-    if (data == nullptr || length != kExpectedNotificationLength) {
+template <typename Protocol, typename Numeric>
+void BasicMotorController<Protocol, Numeric>::handleNotification(const uint8_t* data, std::size_t length) {
+    if (data == nullptr || length != Protocol::kFrameLength) {
+        JARVIS_COUNT(MotorFramesDropped);
         return;
     }
-    handleMessage(data, length);
-}
 
-void MotorController::handleMessage(const uint8_t* data, std::size_t length) {
-    if (data == nullptr || length < 2) {
-        return;
+    // One flag load per frame; the lock is only taken after a change
+    if (configPending_.load(std::memory_order_acquire)) {
+        takePendingConfig();
     }
 
-    const uint8_t header = data[0];
-    if (header != 0xAA) {
-        std::printf("[telemetry] unexpected header 0x%02X\n", header);
-        return;
+    const char* tag = nullptr;
+    {
+        JARVIS_PROBE(MotorDecode);
+        JARVIS_NO_ALLOC("motor_decode");
+        tag = handleMessage(data, length);
+    }
+    if (tag != nullptr) {
+        logSnapshot(tag, Protocol::frameId(data));
     }
+}
 
-    const uint8_t indexByte = data[1];
-    const uint8_t id        = static_cast<uint8_t>(indexByte & 0x3F);
+template <typename Protocol, typename Numeric>
+const char* BasicMotorController<Protocol, Numeric>::handleMessage(const uint8_t* data, std::size_t length) {
+    if (data == nullptr || length < Protocol::kFrameLength) {
+        return nullptr;
+    }
 
-    if (id > 29 || length < kExpectedNotificationLength) {
-        return;
+    if (!Protocol::validHeader(data)) {
+        JARVIS_COUNT(MotorFramesDropped);
+        JARVIS_DLOG(MotorBadHeader, data[0]);
+        return nullptr;
     }
 
-    const uint8_t* cursor = data + 2;
-
-    switch (id) {
-        case 0: {
-            telemetry_.data.rpm      = readUint16LE(&cursor[4]);
-            telemetry_.data.speedKph = rpmToSpeedKph(telemetry_.data.rpm);
-
-            const uint64_t nowUs = static_cast<uint64_t>(esp_timer_get_time());
-            float          deltaSeconds;
-            if (telemetry_.lastIndex0Us == 0) {
-                deltaSeconds = 0.0f;
-            } else {
-                deltaSeconds = static_cast<float>(nowUs - telemetry_.lastIndex0Us) / 1'000'000.0f;
-                if (deltaSeconds < 0.0f || deltaSeconds > 5.0f) {
-                    deltaSeconds = 0.0f;
-                }
-            }
-            telemetry_.lastIndex0Us = nowUs;
-
-            const float distanceKm = telemetry_.data.speedKph * (deltaSeconds / 3600.0f);
-            if (distanceKm > 0.0f) {
-                telemetry_.distanceKm += distanceKm;
-            }
-
-            telemetry_.data.gear = decodeGear(cursor[2]);
-
-            const int16_t iqRaw = readInt16LE(&cursor[8]);
-            const int16_t idRaw = readInt16LE(&cursor[10]);
-            telemetry_.iqAmps   = static_cast<float>(iqRaw) / 100.0f;
-            telemetry_.idAmps   = static_cast<float>(idRaw) / 100.0f;
-
-            const float magnitude = std::sqrt(telemetry_.iqAmps * telemetry_.iqAmps + telemetry_.idAmps * telemetry_.idAmps);
-            telemetry_.data.powerKw = -magnitude * telemetry_.data.voltage / 1000.0f;
-            if (iqRaw < 0 || idRaw < 0) {
-                telemetry_.data.powerKw = -telemetry_.data.powerKw;
-            }
-
-            logSnapshot("idx0");
-            break;
-        }
-        case 1: {
-            const uint16_t rawVoltage = readUint16LE(cursor);
-            telemetry_.data.voltage   = static_cast<float>(rawVoltage) / 10.0f;
-            logSnapshot("idx1");
-            break;
-        }
-        case 4: {
-            telemetry_.data.controllerC = static_cast<float>(cursor[2]);
-            logSnapshot("idx4");
-            break;
-        }
-        case 13: {
-            telemetry_.data.motorC   = static_cast<float>(cursor[0]);
-            telemetry_.data.throttle = readUint16LE(&cursor[2]);
-            logSnapshot("idx13");
-            break;
-        }
-        default:
-            break;
+    const uint8_t id = Protocol::frameId(data);
+    if (!Protocol::validFrameId(id)) {
+        JARVIS_COUNT(MotorFramesDropped);
+        return nullptr;
     }
+    JARVIS_COUNT(MotorFrames);
+
+    return Protocol::decode(id, data, *this);
 }
 
-void MotorController::logSnapshot(const char* tag) const {
-    if (telemetryCallback_) {
-        telemetryCallback_(telemetry_, tag);
+template <typename Protocol, typename Numeric>
+void BasicMotorController<Protocol, Numeric>::onMotion(uint16_t rpm, uint8_t gear, int16_t iqRaw, int16_t idRaw) {
+    static constexpr Scale kAmpScale = Numeric::scale(Protocol::kAmpsPerCount);
+    static constexpr Scale kPowerScale = Numeric::scale(Protocol::kAmpsPerCount * Protocol::kVoltsPerCount / 1000.0);
+
+    const Value speedKph = Numeric::fromRaw(rpm, kphPerRpm_);
+    telemetry_.data.rpm      = rpm;
+    telemetry_.data.speedKph = Numeric::toFloat(speedKph);
+
+    const uint64_t nowUs = static_cast<uint64_t>(esp_timer_get_time());
+    if (telemetry_.lastIndex0Us != 0) {
+        // A clock step backwards wraps to a huge gap and is skipped too.
+        const uint64_t deltaUs = nowUs - telemetry_.lastIndex0Us;
+        if (deltaUs <= kMaxDistanceGapUs) {
+            Numeric::addDistance(distance_, speedKph, static_cast<uint32_t>(deltaUs));
+            telemetry_.distanceKm = Numeric::toKm(distance_);
+        }
     }
+    telemetry_.lastIndex0Us = nowUs;
 
-    if (!config_.logSnapshots) {
-        return;
-    }
+    telemetry_.data.gear = gear;
+    telemetry_.iqAmps    = Numeric::toFloat(Numeric::fromRaw(iqRaw, kAmpScale));
+    telemetry_.idAmps    = Numeric::toFloat(Numeric::fromRaw(idRaw, kAmpScale));
 
-    std::printf(
-        "[telemetry:%s] rpm=%u speed=%.2f km/h gear=%u voltage=%.2f V power=%.2f kW iq=%.2f A id=%.2f A distance=%.3f km\n",
-        tag,
-        telemetry_.data.rpm,
-        telemetry_.data.speedKph,
-        telemetry_.data.gear,
-        telemetry_.data.voltage,
-        telemetry_.data.powerKw,
-        telemetry_.iqAmps,
-        telemetry_.idAmps,
-        telemetry_.distanceKm);
+    // |I| x V in kW, negative unless either axis current is negative.
+    const Value magnitudeKw = Numeric::fromWide(Numeric::hypot(iqRaw, idRaw) * rawVoltage_, kPowerScale);
+    const float powerKw     = Numeric::toFloat(magnitudeKw);
+    telemetry_.data.powerKw = (iqRaw < 0 || idRaw < 0) ? powerKw : -powerKw;
 }
 
-float MotorController::rpmToSpeedKph(uint16_t rpm) const {
-    const float wheelRpm = static_cast<float>(rpm) / config_.reductionRatio;
-    const float wheelRps = wheelRpm / 60.0f;
-    const float speedMps = wheelRps * config_.wheelCircumferenceMeters;
-    return speedMps * 3.6f;
+template <typename Protocol, typename Numeric>
+void BasicMotorController<Protocol, Numeric>::onBatteryVoltage(uint16_t raw) {
+    static constexpr Scale kVoltScale = Numeric::scale(Protocol::kVoltsPerCount);
+
+    rawVoltage_             = raw;
+    telemetry_.data.voltage = Numeric::toFloat(Numeric::fromRaw(raw, kVoltScale));
 }
 
-uint8_t MotorController::decodeGear(uint8_t rawGear) {
-    return static_cast<uint8_t>(rawGear & 0x03U);
+template <typename Protocol, typename Numeric>
+void BasicMotorController<Protocol, Numeric>::onControllerTemperature(int32_t celsius) {
+    telemetry_.data.controllerC = static_cast<float>(celsius);
 }
 
-uint16_t MotorController::readUint16LE(const uint8_t* data) {
-    return static_cast<uint16_t>(static_cast<uint16_t>(data[0]) | (static_cast<uint16_t>(data[1]) << 8));
+template <typename Protocol, typename Numeric>
+void BasicMotorController<Protocol, Numeric>::onMotorTemperature(int32_t celsius) {
+    telemetry_.data.motorC = static_cast<float>(celsius);
 }
 
-int16_t MotorController::readInt16LE(const uint8_t* data) {
-    return static_cast<int16_t>(static_cast<uint16_t>(data[0]) | (static_cast<uint16_t>(data[1]) << 8));
+template <typename Protocol, typename Numeric>
+void BasicMotorController<Protocol, Numeric>::onThrottle(uint16_t raw) {
+    telemetry_.data.throttle = raw;
 }
+
+template <typename Protocol, typename Numeric>
+void BasicMotorController<Protocol, Numeric>::logSnapshot(const char* tag, uint8_t frameId) const {
+    if (telemetryCallback_) {
+        JARVIS_PROBE(TelemetryPublish);
+        JARVIS_NO_ALLOC("telemetry_publish");
+        JARVIS_COUNT(TelemetryPublished);
+        telemetryCallback_(telemetry_, tag);
+    }
+
+    if (!config_.logSnapshots) {
+        return;
+    }
+
+    // Recorded in binary and formatted off this task; see deferred_log.hh.
+    JARVIS_DLOG(MotorSnapshot,
+                frameId,
+                telemetry_.data.rpm,
+                telemetry_.data.speedKph,
+                telemetry_.data.gear,
+                telemetry_.data.voltage,
+                telemetry_.data.powerKw,
+                telemetry_.iqAmps,
+                telemetry_.idAmps,
+                telemetry_.distanceKm);
+}
+
+template class BasicMotorController<FarDriverProtocol, FloatNumeric>;
+template class BasicMotorController<FarDriverProtocol, FixedNumeric<16>>;
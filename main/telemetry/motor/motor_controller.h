@@ -1,9 +1,15 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 
+#include "freertos/FreeRTOS.h"
+
+#include "motor_numeric.h"
+#include "motor_protocol.h"
+
 /**
  * Snapshot of the parsed controller telemetry shared between callbacks.
  */
@@ -31,39 +37,87 @@ struct TelemetryState
     uint64_t lastIndex0Us = 0;
 };
 
+struct MotorControllerConfig
+{
+    float wheelCircumferenceMeters = 2.1f; ///< Default 27.5" MTB tyre
+    float reductionRatio = 1.0f;           ///< Motor RPM to wheel RPM ratio
+    bool logSnapshots = false;
+};
+
 /**
  * Motor controller telemetry processor. Consumes BLE notifications,
  * parses binary payloads, and keeps the rolling telemetry state.
+ *
+ * The frame format comes from the Protocol policy (motor_protocol.h) and
+ * derived values (speed, currents, power, distance) are computed with the
+ * Numeric policy (motor_numeric.h). The supported combinations are
+ * instantiated in motor_controller.cpp; MotorController is the one the
+ * build selects.
  */
-class MotorController
+template <typename Protocol, typename Numeric>
+class BasicMotorController
 {
 public:
-    struct Config
-    {
-        float wheelCircumferenceMeters = 2.1f; ///< Default 27.5" MTB tyre
-        float reductionRatio = 1.0f;           ///< Motor RPM to wheel RPM ratio
-        bool logSnapshots = false;
-    };
-
+    using Config = MotorControllerConfig;
     using TelemetryCallback = std::function<void(const TelemetryState &, const char *tag)>;
 
-    MotorController();
-    explicit MotorController(const Config &config);
+    BasicMotorController();
+    explicit BasicMotorController(const Config &config);
 
     void handleNotification(const uint8_t *data, std::size_t length);
     const TelemetryState &telemetry() const { return telemetry_; }
     void setTelemetryCallback(TelemetryCallback callback);
-    const MotorController::Config &config() const { return config_; }
+
+    /**
+     * Parameters the frame path decodes with. Only read it from that task;
+     * a setConfig() shows here from the next frame on.
+     */
+    const Config &config() const { return config_; }
+
+    /**
+     * Replaces the wheel/gearing parameters at runtime, e.g. after a
+     * settings change. Safe from any task: the values are staged and the
+     * frame path takes them over before decoding its next frame, so no
+     * frame sees half of them. Invalid values fall back as in the
+     * constructor.
+     */
+    void setConfig(const Config &config);
 
 private:
-    void handleMessage(const uint8_t *data, std::size_t length);
-    void logSnapshot(const char *tag) const;
-    float rpmToSpeedKph(uint16_t rpm) const;
-    static uint8_t decodeGear(uint8_t rawGear);
-    static uint16_t readUint16LE(const uint8_t *data);
-    static int16_t readInt16LE(const uint8_t *data);
+    friend Protocol; // Calls the on*() field sinks from Protocol::decode()
+
+    using Value = typename Numeric::Value;
+    using Scale = typename Numeric::Scale;
+
+    /**
+     * Decodes one frame into the telemetry state.
+     * @return Snapshot tag of the frame when it changed the state, else nullptr.
+     */
+    const char *handleMessage(const uint8_t *data, std::size_t length);
+    void applyConfig(const Config &config);
+    void takePendingConfig();
+    void logSnapshot(const char *tag, uint8_t frameId) const;
+
+    // Raw fields decoded by the protocol, in its counts.
+    void onMotion(uint16_t rpm, uint8_t gear, int16_t iqRaw, int16_t idRaw);
+    void onBatteryVoltage(uint16_t raw);
+    void onControllerTemperature(int32_t celsius);
+    void onMotorTemperature(int32_t celsius);
+    void onThrottle(uint16_t raw);
 
     Config config_{};
+    Scale kphPerRpm_{};            ///< From wheel circumference and reduction ratio
+    uint16_t rawVoltage_ = 0;      ///< Last battery voltage reading, protocol counts
+    typename Numeric::Distance distance_{};
     TelemetryState telemetry_{};
     TelemetryCallback telemetryCallback_{};
+
+    portMUX_TYPE configLock_ = portMUX_INITIALIZER_UNLOCKED; ///< Guards pendingConfig_
+    Config pendingConfig_{};
+    std::atomic<bool> configPending_{false};
 };
+
+extern template class BasicMotorController<FarDriverProtocol, FloatNumeric>;
+extern template class BasicMotorController<FarDriverProtocol, FixedNumeric<16>>;
+
+using MotorController = BasicMotorController<MotorProtocol, MotorNumeric>;
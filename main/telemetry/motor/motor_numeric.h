@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+#include "sdkconfig.h"
+
+/**
+ * Numeric policies for the motor telemetry decoder.
+ *
+ * Every input is a 16-bit integer with a fixed scale (0.1 V, 0.01 A, rpm),
+ * so the decoder needs only a few operations: scaling a raw reading (or a
+ * product of raw readings) by a constant, the magnitude of two raw currents
+ * and a distance accumulator. Scales are made once per configuration
+ * change with scale(), never per frame.
+ *
+ * FloatNumeric computes in single-precision floats; the S3 has an FPU, but
+ * divides and sqrt are multi-cycle sequences. FixedNumeric computes in
+ * Q(FracBits) integers. Its scales are Q32 so that small factors such as
+ * 1e-6 keep their precision, raw products are carried in 64 bits, and the
+ * frame path has no division.
+ *
+ * Decoded values are published as floats either way (TelemetryState); the
+ * policy only changes how they are computed.
+ */
+struct FloatNumeric
+{
+    using Value    = float;
+    using Wide     = float; ///< Unscaled raw quantity or product of raw quantities
+    using Scale    = float;
+    using Distance = float; ///< km
+
+    static constexpr const char *kName = "float";
+
+    static constexpr Scale scale(double factor) { return static_cast<Scale>(factor); }
+    static Value fromRaw(int32_t raw, Scale scale) { return static_cast<float>(raw) * scale; }
+    static Value fromWide(Wide wide, Scale scale) { return wide * scale; }
+    static Wide hypot(int32_t a, int32_t b)
+    {
+        const float fa = static_cast<float>(a);
+        const float fb = static_cast<float>(b);
+        return std::sqrt(fa * fa + fb * fb);
+    }
+    static void addDistance(Distance &km, Value kph, uint32_t deltaUs)
+    {
+        constexpr float kHoursPerUs = 1.0f / 3'600'000'000.0f;
+        km += kph * (static_cast<float>(deltaUs) * kHoursPerUs);
+    }
+
+    static float toFloat(Value value) { return value; }
+    static float toKm(Distance km) { return km; }
+};
+
+template <unsigned FracBits>
+struct FixedNumeric
+{
+    static_assert(FracBits >= 8 && FracBits <= 24, "FracBits out of range");
+
+    using Value    = int32_t; ///< Q(FracBits)
+    using Wide     = int64_t;
+    using Scale    = int64_t; ///< Q32
+    using Distance = int64_t; ///< Sum of Q(FracBits) kph x microseconds
+
+    static constexpr const char *kName = "fixed";
+    static constexpr Value kOne = Value{1} << FracBits;
+
+    static constexpr Scale scale(double factor)
+    {
+        return static_cast<Scale>(factor * 4294967296.0 + (factor >= 0.0 ? 0.5 : -0.5));
+    }
+    static Value fromRaw(int32_t raw, Scale scale) { return fromWide(raw, scale); }
+    static Value fromWide(Wide wide, Scale scale) { return static_cast<Value>((wide * scale) >> (32 - FracBits)); }
+
+    /**
+     * Magnitude of two 16-bit readings, rounded to the nearest raw unit. The
+     * sum of squares fits in 32 bits, so the square root is a 16-step loop.
+     */
+    static Wide hypot(int32_t a, int32_t b)
+    {
+        const uint32_t sumSquares = static_cast<uint32_t>(a * a) + static_cast<uint32_t>(b * b);
+        return isqrt(sumSquares);
+    }
+
+    static void addDistance(Distance &acc, Value kph, uint32_t deltaUs)
+    {
+        // Converted to km only when read, so the frame path has no divide.
+        acc += static_cast<int64_t>(kph) * deltaUs;
+    }
+
+    static float toFloat(Value value) { return static_cast<float>(value) * (1.0f / kOne); }
+    static float toKm(Distance acc)
+    {
+        constexpr double kKmPerUnit = 1.0 / (static_cast<double>(kOne) * 3'600'000'000.0);
+        return static_cast<float>(static_cast<double>(acc) * kKmPerUnit);
+    }
+
+    /**
+     * Rounded integer square root (bit-by-bit).
+     */
+    static uint32_t isqrt(uint32_t value)
+    {
+        uint32_t root = 0;
+        uint32_t bit  = uint32_t{1} << 30;
+        while (bit > value)
+        {
+            bit >>= 2;
+        }
+        while (bit != 0)
+        {
+            if (value >= root + bit)
+            {
+                value -= root + bit;
+                root = (root >> 1) + bit;
+            }
+            else
+            {
+                root >>= 1;
+            }
+            bit >>= 2;
+        }
+        return value > root ? root + 1 : root;
+    }
+};
+
+#if CONFIG_JARVIS_MOTOR_FIXED_POINT
+using MotorNumeric = FixedNumeric<16>;
+#else
+using MotorNumeric = FloatNumeric;
+#endif
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Protocol policies for the motor telemetry decoder.
+ *
+ * A policy describes one controller vendor's notification format: framing,
+ * which frame indices carry which fields, and the scale of the raw fields.
+ * BasicMotorController takes it as a template parameter, so the frame path
+ * is resolved at compile time and a second vendor costs no virtual call or
+ * runtime protocol switch. A policy provides:
+ *
+ *   kName, kFrameLength         Identification and exact notification length
+ *   kVoltsPerCount              Scale of the raw battery voltage
+ *   kAmpsPerCount               Scale of the raw phase currents
+ *   validHeader(frame)          Framing check on a kFrameLength frame
+ *   frameId(frame)              Index of the frame, for logging
+ *   validFrameId(id)
+ *   decode(id, frame, sink)     Calls the sink for each group of fields the
+ *                               frame carries and returns its snapshot tag,
+ *                               or nullptr for frames with nothing to decode
+ *
+ * The sink receives raw integer fields (see BasicMotorController); all
+ * scaling to engineering units stays with the Numeric policy.
+ */
+struct FarDriverProtocol
+{
+    static constexpr const char *kName = "far-driver";
+    static constexpr std::size_t kFrameLength = 16;
+    static constexpr uint8_t kHeader = 0xAA;
+    static constexpr uint8_t kIndexCount = 30; ///< Indices 0-29, cycled by the controller
+    static constexpr uint8_t kIndexMask = 0x3F;
+
+    static constexpr double kVoltsPerCount = 0.1;
+    static constexpr double kAmpsPerCount = 0.01;
+
+    static bool validHeader(const uint8_t *frame) { return frame[0] == kHeader; }
+    static uint8_t frameId(const uint8_t *frame) { return static_cast<uint8_t>(frame[1] & kIndexMask); }
+    static bool validFrameId(uint8_t id) { return id < kIndexCount; }
+
+    template <typename Sink>
+    static const char *decode(uint8_t id, const uint8_t *frame, Sink &sink)
+    {
+        const uint8_t *payload = frame + 2;
+        switch (id)
+        {
+            case 0:
+                sink.onMotion(readUint16LE(&payload[4]),
+                              static_cast<uint8_t>(payload[2] & 0x03U),
+                              readInt16LE(&payload[8]),
+                              readInt16LE(&payload[10]));
+                return "idx0";
+            case 1:
+                sink.onBatteryVoltage(readUint16LE(payload));
+                return "idx1";
+            case 4:
+                sink.onControllerTemperature(payload[2]);
+                return "idx4";
+            case 13:
+                sink.onMotorTemperature(payload[0]);
+                sink.onThrottle(readUint16LE(&payload[2]));
+                return "idx13";
+            default:
+                return nullptr;
+        }
+    }
+
+    static uint16_t readUint16LE(const uint8_t *data)
+    {
+        return static_cast<uint16_t>(static_cast<uint16_t>(data[0]) | (static_cast<uint16_t>(data[1]) << 8));
+    }
+
+    static int16_t readInt16LE(const uint8_t *data) { return static_cast<int16_t>(readUint16LE(data)); }
+};
+
+using MotorProtocol = FarDriverProtocol;
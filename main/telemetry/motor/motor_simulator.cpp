@@ -0,0 +1,285 @@
+#include "motor_simulator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <limits>
+
+namespace {
+constexpr uint8_t kHeader = FarDriverProtocol::kHeader;
+
+struct Segment {
+    float seconds;
+    float targetKph;
+    float grade;
+    uint8_t gear;
+};
+
+constexpr Segment kIdle[] = {
+    {60.0f, 0.0f, 0.0f, 1},
+};
+
+constexpr Segment kCommute[] = {
+    {15.0f, 0.0f, 0.0f, 2},
+    {60.0f, 32.0f, 0.0f, 2},
+    {25.0f, 25.0f, 0.03f, 2},
+    {40.0f, 40.0f, 0.0f, 2},
+    {15.0f, 0.0f, 0.0f, 2},
+};
+
+constexpr Segment kHill[] = {
+    {10.0f, 0.0f, 0.0f, 1},
+    {120.0f, 20.0f, 0.08f, 1},
+    {30.0f, 30.0f, -0.05f, 1},
+    {20.0f, 0.0f, 0.0f, 1},
+};
+
+constexpr Segment kSprint[] = {
+    {8.0f, 0.0f, 0.0f, 3},
+    {15.0f, 65.0f, 0.0f, 3},
+    {10.0f, 0.0f, 0.0f, 3},
+};
+
+struct ProfileInfo {
+    const char *name;
+    const Segment *segments;
+    std::size_t count;
+    float accelLimit; ///< m/s^2
+};
+
+constexpr ProfileInfo kProfiles[] = {
+    {"idle", kIdle, std::size(kIdle), 0.0f},
+    {"commute", kCommute, std::size(kCommute), 1.5f},
+    {"hill", kHill, std::size(kHill), 1.0f},
+    {"sprint", kSprint, std::size(kSprint), 4.0f},
+};
+
+// Ride model: rider and bike, rolling and air resistance, pack behaviour.
+constexpr float kMassKg = 120.0f;
+constexpr float kGravity = 9.81f;
+constexpr float kRollingCoeff = 0.015f;
+constexpr float kDragArea = 0.6f; ///< Cd * A, m^2
+constexpr float kAirDensity = 1.2f;
+constexpr float kBrakeDecel = 3.0f;
+constexpr float kDriveEfficiency = 0.85f;
+constexpr float kMaxBatteryAmps = 150.0f;
+constexpr float kMaxRegenAmps = 10.0f;
+constexpr float kPackFullVolts = 84.0f;
+constexpr float kPackEmptyVolts = 66.0f;
+constexpr float kPackCapacityWh = 2000.0f;
+constexpr float kPackResistanceOhm = 0.08f;
+constexpr float kAmbientC = 25.0f;
+constexpr uint16_t kThrottleIdleRaw = 850;
+constexpr uint16_t kThrottleFullRaw = 3500;
+
+void writeUint16LE(uint8_t *out, uint16_t value) {
+    out[0] = static_cast<uint8_t>(value & 0xFF);
+    out[1] = static_cast<uint8_t>(value >> 8);
+}
+
+template <typename T>
+T clampTo(float value) {
+    const float lo = static_cast<float>(std::numeric_limits<T>::min());
+    const float hi = static_cast<float>(std::numeric_limits<T>::max());
+    return static_cast<T>(std::lround(std::clamp(value, lo, hi)));
+}
+} // namespace
+
+MotorSimulator::MotorSimulator(const Config &config) : config_(config) {
+    if (config_.wheelCircumferenceMeters <= 0.0f) {
+        config_.wheelCircumferenceMeters = 1.0f;
+    }
+    if (config_.reductionRatio <= 0.0f) {
+        config_.reductionRatio = 1.0f;
+    }
+    config_.dropRate = std::clamp(config_.dropRate, 0.0f, 1.0f);
+    config_.corruptRate = std::clamp(config_.corruptRate, 0.0f, 1.0f);
+    rng_ = config_.seed != 0 ? config_.seed : 1;
+
+    ride_.voltage = kPackFullVolts;
+    ride_.controllerC = kAmbientC;
+    ride_.motorC = kAmbientC;
+}
+
+void MotorSimulator::next(Frame &frame) {
+    step(static_cast<float>(kFramePeriodUs) / 1'000'000.0f);
+
+    const uint8_t index = index_;
+    index_ = static_cast<uint8_t>((index_ + 1) % kIndexCount);
+
+    frame.length = kFrameLength;
+    frame.fate = FrameFate::Intact;
+    frame.bytes[0] = kHeader;
+    frame.bytes[1] = index;
+    std::memset(&frame.bytes[2], 0, kFrameLength - 2);
+    encode(index, &frame.bytes[2]);
+
+    // Trailer byte holds a byte sum; the decoder does not check it.
+    uint8_t sum = 0;
+    for (std::size_t i = 0; i + 1 < kFrameLength; ++i) {
+        sum = static_cast<uint8_t>(sum + frame.bytes[i]);
+    }
+    frame.bytes[kFrameLength - 1] = sum;
+
+    if (uniform() < config_.dropRate) {
+        frame.fate = FrameFate::Dropped;
+    } else if (uniform() < config_.corruptRate) {
+        corrupt(frame);
+    }
+}
+
+void MotorSimulator::step(float dtSeconds) {
+    const ProfileInfo &profile = kProfiles[static_cast<std::size_t>(config_.profile)];
+
+    float period = 0.0f;
+    for (std::size_t i = 0; i < profile.count; ++i) {
+        period += profile.segments[i].seconds;
+    }
+    profileClock_ = std::fmod(profileClock_ + dtSeconds, period);
+
+    const Segment *segment = &profile.segments[0];
+    float elapsed = 0.0f;
+    for (std::size_t i = 0; i < profile.count; ++i) {
+        elapsed += profile.segments[i].seconds;
+        if (profileClock_ < elapsed) {
+            segment = &profile.segments[i];
+            break;
+        }
+    }
+
+    // Follow the target speed under the profile's acceleration limit.
+    const float targetMps = segment->targetKph / 3.6f;
+    const float error = targetMps - speedMps_;
+    float accel;
+    if (error >= 0.0f) {
+        accel = std::min(error / dtSeconds, profile.accelLimit);
+    } else {
+        accel = std::max(error / dtSeconds, -kBrakeDecel);
+    }
+    speedMps_ = std::max(0.0f, speedMps_ + accel * dtSeconds);
+
+    const float moving = speedMps_ > 0.1f ? 1.0f : 0.0f;
+    const float force = kMassKg * accel + moving * kRollingCoeff * kMassKg * kGravity +
+                        0.5f * kAirDensity * kDragArea * speedMps_ * speedMps_ +
+                        moving * kMassKg * kGravity * segment->grade;
+    const float mechanicalW = force * speedMps_;
+
+    float batteryAmps;
+    if (mechanicalW >= 0.0f) {
+        batteryAmps = std::min(mechanicalW / (kDriveEfficiency * ride_.voltage), kMaxBatteryAmps);
+        throttle_ = std::min(1.0f, batteryAmps / kMaxBatteryAmps + (moving > 0.0f ? 0.15f : 0.0f));
+    } else {
+        batteryAmps = std::max(mechanicalW * kDriveEfficiency / ride_.voltage, -kMaxRegenAmps);
+        throttle_ = 0.0f;
+    }
+
+    energyWh_ += batteryAmps * ride_.voltage * dtSeconds / 3600.0f;
+    const float charge = std::clamp(1.0f - energyWh_ / kPackCapacityWh, 0.0f, 1.0f);
+    const float openCircuit = kPackEmptyVolts + (kPackFullVolts - kPackEmptyVolts) * charge;
+
+    // First-order heating with losses proportional to I^2.
+    const float losses = batteryAmps * batteryAmps;
+    ride_.controllerC += dtSeconds * (losses * 0.0004f - (ride_.controllerC - kAmbientC) * 0.01f);
+    ride_.motorC += dtSeconds * (losses * 0.0004f - (ride_.motorC - kAmbientC) * 0.008f);
+
+    ride_.seconds += dtSeconds;
+    ride_.speedKph = speedMps_ * 3.6f;
+    ride_.batteryAmps = batteryAmps;
+    ride_.voltage = openCircuit - batteryAmps * kPackResistanceOhm;
+    gear_ = segment->gear;
+}
+
+void MotorSimulator::encode(uint8_t index, uint8_t *payload) {
+    switch (index) {
+        case 0: {
+            const float wheelRpm = speedMps_ / config_.wheelCircumferenceMeters * 60.0f;
+            const float motorRpm = jitter(wheelRpm * config_.reductionRatio);
+            // The decoder reports |(iq, id)| x voltage as power and reads a
+            // negative d-axis current as positive (driving) power.
+            const float iq = jitter(ride_.batteryAmps);
+            const float id = -0.1f * std::fabs(iq) - 0.5f;
+            payload[2] = gear_;
+            writeUint16LE(&payload[4], clampTo<uint16_t>(motorRpm));
+            writeUint16LE(&payload[8], static_cast<uint16_t>(clampTo<int16_t>(iq * 100.0f)));
+            writeUint16LE(&payload[10], static_cast<uint16_t>(clampTo<int16_t>(id * 100.0f)));
+            break;
+        }
+        case 1:
+            writeUint16LE(payload, clampTo<uint16_t>(jitter(ride_.voltage) * 10.0f));
+            break;
+        case 4:
+            payload[2] = clampTo<uint8_t>(ride_.controllerC);
+            break;
+        case 13: {
+            const float raw = kThrottleIdleRaw + throttle_ * (kThrottleFullRaw - kThrottleIdleRaw);
+            payload[0] = clampTo<uint8_t>(ride_.motorC);
+            writeUint16LE(&payload[2], clampTo<uint16_t>(jitter(raw)));
+            break;
+        }
+        default:
+            // Fields the decoder ignores; stable per index like a parked controller.
+            for (std::size_t i = 0; i < kFrameLength - 3; ++i) {
+                payload[i] = static_cast<uint8_t>(index * 7 + i);
+            }
+            break;
+    }
+}
+
+void MotorSimulator::corrupt(Frame &frame) {
+    frame.fate = FrameFate::Corrupted;
+    const uint32_t draw = random();
+    switch (draw % 4) {
+        case 0:
+            frame.bytes[0] = static_cast<uint8_t>(kHeader ^ (1U << ((draw >> 8) % 8)));
+            break;
+        case 1:
+            frame.bytes[1] = static_cast<uint8_t>(kIndexCount + (draw >> 8) % (64 - kIndexCount));
+            break;
+        case 2:
+            frame.length = 2 + (draw >> 8) % (kFrameLength - 2);
+            break;
+        default:
+            // A payload bit flip gets through the decoder, as on air.
+            frame.bytes[2 + (draw >> 8) % (kFrameLength - 3)] ^= static_cast<uint8_t>(1U << ((draw >> 16) % 8));
+            break;
+    }
+}
+
+float MotorSimulator::jitter(float value) {
+    if (config_.noise <= 0.0f) {
+        return value;
+    }
+    // Sum of two uniforms: cheap, centred and bounded.
+    const float spread = uniform() + uniform() - 1.0f;
+    return value * (1.0f + config_.noise * spread);
+}
+
+float MotorSimulator::uniform() {
+    return static_cast<float>(random() >> 8) / static_cast<float>(1U << 24);
+}
+
+uint32_t MotorSimulator::random() {
+    // xorshift32
+    rng_ ^= rng_ << 13;
+    rng_ ^= rng_ >> 17;
+    rng_ ^= rng_ << 5;
+    return rng_;
+}
+
+const char *MotorSimulator::profileName(Profile profile) {
+    return kProfiles[static_cast<std::size_t>(profile)].name;
+}
+
+bool MotorSimulator::parseProfile(const char *name, Profile &profile) {
+    if (name == nullptr) {
+        return false;
+    }
+    for (std::size_t i = 0; i < std::size(kProfiles); ++i) {
+        if (std::strcmp(name, kProfiles[i].name) == 0) {
+            profile = static_cast<Profile>(i);
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "motor_protocol.h"
+
+/**
+ * Synthetic Far-driver controller that produces the same 16-byte
+ * notification frames MotorController decodes, for load testing without the
+ * bike on a stand.
+ *
+ * Frames cycle through all 30 indices as the controller does. Indices the
+ * decoder understands (0, 1, 4, 13) carry values from a small ride model:
+ * a profile of speed targets and grades is followed under an acceleration
+ * limit, and battery current, sag, temperatures and throttle are derived
+ * from the resulting load. The remaining indices carry fixed filler.
+ *
+ * Each call to next() advances simulated time by one controller frame
+ * period; how fast frames are played back is up to the caller. Noise,
+ * dropped frames and corrupted frames are drawn from a seeded generator, so
+ * a run is reproducible. No ESP-IDF dependencies.
+ */
+class MotorSimulator
+{
+public:
+    enum class Profile : uint8_t
+    {
+        Idle,    ///< Parked, controller awake
+        Commute, ///< Stop-and-go at 25-40 km/h with a short climb
+        Hill,    ///< Long 8% climb in low gear, then a descent
+        Sprint,  ///< Repeated full-throttle starts to 65 km/h
+    };
+
+    enum class FrameFate : uint8_t
+    {
+        Intact,
+        Dropped,   ///< Lost in transit; do not deliver
+        Corrupted, ///< Delivered damaged (header, index, length or payload)
+    };
+
+    struct Config
+    {
+        Profile profile = Profile::Commute;
+        float noise = 0.01f;       ///< Relative jitter on analogue readings
+        float dropRate = 0.0f;     ///< Fraction of frames lost
+        float corruptRate = 0.0f;  ///< Fraction of frames damaged
+        float wheelCircumferenceMeters = 2.1f;
+        float reductionRatio = 1.0f;
+        uint32_t seed = 1;
+    };
+
+    static constexpr std::size_t kFrameLength = FarDriverProtocol::kFrameLength;
+    static constexpr uint8_t kIndexCount = FarDriverProtocol::kIndexCount;
+    static constexpr uint32_t kFramePeriodUs = 10'000; ///< Controller cadence at 1x, ~3 full cycles per second
+
+    struct Frame
+    {
+        uint8_t bytes[kFrameLength] = {};
+        std::size_t length = kFrameLength;
+        FrameFate fate = FrameFate::Intact;
+    };
+
+    /**
+     * State of the ride model after the last frame.
+     */
+    struct RideState
+    {
+        float seconds = 0.0f;
+        float speedKph = 0.0f;
+        float batteryAmps = 0.0f;
+        float voltage = 0.0f;
+        float controllerC = 0.0f;
+        float motorC = 0.0f;
+    };
+
+    explicit MotorSimulator(const Config &config);
+
+    void next(Frame &frame);
+
+    const RideState &ride() const { return ride_; }
+    static const char *profileName(Profile profile);
+    static bool parseProfile(const char *name, Profile &profile);
+
+private:
+    void step(float dtSeconds);
+    void encode(uint8_t index, uint8_t *payload);
+    void corrupt(Frame &frame);
+    float jitter(float value);
+    float uniform();
+    uint32_t random();
+
+    Config config_{};
+    RideState ride_{};
+    float speedMps_ = 0.0f;
+    float throttle_ = 0.0f;
+    float energyWh_ = 0.0f;
+    float profileClock_ = 0.0f;
+    uint8_t gear_ = 1;
+    uint8_t index_ = 0;
+    uint32_t rng_ = 1;
+};
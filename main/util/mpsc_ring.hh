@@ -0,0 +1,104 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file mpsc_ring.hh
+ * @brief Lock-free bounded multi-producer/single-consumer ring buffer.
+ *
+ * Any number of tasks may push concurrently; one task pops. Every slot
+ * carries a sequence number (Vyukov's bounded queue), so a producer claims
+ * a slot with one compare-and-swap and publishes it with one release store
+ * without ever waiting on another producer. Pushing into a full ring fails
+ * instead of blocking. The capacity must be a power of two.
+ */
+template <typename T, std::size_t Capacity>
+class MpscRing
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    MpscRing()
+    {
+        for (std::size_t i = 0; i < Capacity; ++i)
+        {
+            slots_[i].sequence.store(static_cast<uint32_t>(i), std::memory_order_relaxed);
+        }
+    }
+
+    MpscRing(const MpscRing&)            = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    /**
+     * @brief Claims a slot and lets @p fill write the element in place.
+     *        Any task.
+     * @return false when the ring is full and nothing was written.
+     */
+    template <typename Fill>
+    bool emplace(Fill&& fill)
+    {
+        uint32_t position = head_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Slot&          slot     = slots_[position & kMask];
+            const uint32_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const int32_t  lag      = static_cast<int32_t>(sequence - position);
+            if (lag == 0)
+            {
+                if (head_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    fill(slot.value);
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (lag < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool push(const T& value)
+    {
+        return emplace([&value](T& slot) { slot = value; });
+    }
+
+    /**
+     * @brief Removes the oldest published element. Consumer side only.
+     */
+    bool pop(T& out)
+    {
+        Slot&          slot     = slots_[tail_ & kMask];
+        const uint32_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence != tail_ + 1)
+        {
+            return false;
+        }
+        out = slot.value;
+        slot.sequence.store(tail_ + static_cast<uint32_t>(Capacity), std::memory_order_release);
+        ++tail_;
+        return true;
+    }
+
+    static constexpr std::size_t capacity() { return Capacity; }
+
+private:
+    static constexpr uint32_t kMask = Capacity - 1;
+
+    struct Slot
+    {
+        std::atomic<uint32_t> sequence{0};
+        T                     value{};
+    };
+
+    Slot                  slots_[Capacity];
+    std::atomic<uint32_t> head_{0};
+    uint32_t              tail_ = 0; ///< Consumer-owned
+};
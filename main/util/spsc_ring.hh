@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file spsc_ring.hh
+ * @brief Lock-free single-producer/single-consumer ring buffer.
+ *
+ * Safe to push from an ISR and pop from a task (or vice versa) as long as
+ * there is exactly one producer and one consumer. The capacity must be a
+ * power of two; every slot is usable because the free-running indices wrap.
+ */
+template <typename T, std::size_t Capacity>
+class SpscRing
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    /**
+     * @brief Appends an element. Producer side only.
+     * @return false when the ring is full and the element was dropped.
+     */
+    bool push(const T& value)
+    {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        const std::size_t tail = tail_.load(std::memory_order_acquire);
+        if (head - tail >= Capacity)
+        {
+            return false;
+        }
+        slots_[head & kMask] = value;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Removes the oldest element. Consumer side only.
+     */
+    bool pop(T& out)
+    {
+        return popBatch(&out, 1) == 1;
+    }
+
+    /**
+     * @brief Removes up to `maxCount` elements in FIFO order. Consumer side
+     *        only.
+     * @return Number of elements written to `out`.
+     */
+    std::size_t popBatch(T* out, std::size_t maxCount)
+    {
+        const std::size_t tail      = tail_.load(std::memory_order_relaxed);
+        const std::size_t head      = head_.load(std::memory_order_acquire);
+        std::size_t       available = head - tail;
+        if (available > maxCount)
+        {
+            available = maxCount;
+        }
+        for (std::size_t i = 0; i < available; ++i)
+        {
+            out[i] = slots_[(tail + i) & kMask];
+        }
+        tail_.store(tail + available, std::memory_order_release);
+        return available;
+    }
+
+    /**
+     * @return Number of queued elements. Approximate when called from a
+     *         third context.
+     */
+    std::size_t size() const
+    {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+
+    bool empty() const { return size() == 0; }
+
+    static constexpr std::size_t capacity() { return Capacity; }
+
+private:
+    static constexpr std::size_t kMask = Capacity - 1;
+
+    T                        slots_[Capacity]{};
+    std::atomic<std::size_t> head_{0};
+    std::atomic<std::size_t> tail_{0};
+};
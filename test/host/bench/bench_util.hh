@@ -0,0 +1,42 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+/**
+ * @brief Shared helpers for the host benchmarks. Each benchmark takes an
+ *        optional iteration count as its first argument so ctest can run it
+ *        briefly as a smoke test.
+ */
+namespace bench
+{
+inline long iterations(int argc, char** argv, long fallback)
+{
+    if (argc > 1)
+    {
+        const long value = std::strtol(argv[1], nullptr, 10);
+        if (value > 0)
+        {
+            return value;
+        }
+    }
+    return fallback;
+}
+
+/** @brief Seconds taken by @p body. */
+template <typename Body>
+double seconds(Body&& body)
+{
+    const auto start = std::chrono::steady_clock::now();
+    body();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/** @brief Keeps the optimiser from discarding a result. */
+template <typename T>
+inline void keep(const T& value)
+{
+    asm volatile("" : : "g"(&value) : "memory");
+}
+} // namespace bench
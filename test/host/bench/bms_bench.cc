@@ -0,0 +1,69 @@
+// Frames/s through BmsController for whole-frame notifications (decoded in
+// place) and for frames split over 20-byte notifications (reassembled).
+//
+//   bms_bench [frames]
+
+#include <cstdio>
+#include <vector>
+
+#include "bench_util.hh"
+#include "bms_frames.hh"
+
+namespace
+{
+std::vector<std::array<uint8_t, BmsController::kFrameLength>> makeFrames(std::size_t cellCount)
+{
+    std::vector<std::array<uint8_t, BmsController::kFrameLength>> frames;
+    for (uint16_t variant = 0; variant < 64; ++variant)
+    {
+        BmsFrameBuilder frame;
+        frame.packDeciVolts(static_cast<uint16_t>(520 + variant % 16))
+            .currentDeciAmps(-100 - variant)
+            .soc(static_cast<uint8_t>(60 + variant % 40))
+            .cellCount(static_cast<uint8_t>(cellCount));
+        for (std::size_t i = 0; i < cellCount; ++i)
+        {
+            frame.cell(i, static_cast<uint16_t>(3300 + (i * 7 + variant * 3) % 60));
+        }
+        frames.push_back(frame.finish());
+    }
+    return frames;
+}
+
+void run(const char* label, std::size_t cellCount, std::size_t mtuPayload, long count)
+{
+    const auto    frames = makeFrames(cellCount);
+    BmsController bms;
+
+    const double elapsed = bench::seconds([&] {
+        for (long i = 0; i < count; ++i)
+        {
+            const auto& frame = frames[static_cast<std::size_t>(i) % frames.size()];
+            for (std::size_t offset = 0; offset < frame.size(); offset += mtuPayload)
+            {
+                const std::size_t length = std::min(mtuPayload, frame.size() - offset);
+                bms.handleNotification(frame.data() + offset, length);
+            }
+        }
+    });
+    bench::keep(bms.telemetry());
+
+    std::printf("%-22s %5zu %12.0f %10.1f %9u\n",
+                label,
+                cellCount,
+                count / elapsed,
+                elapsed * 1e9 / count,
+                bms.telemetry().framesRejected);
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const long count = bench::iterations(argc, argv, 2'000'000);
+    std::printf("%-22s %5s %12s %10s %9s\n", "path", "cells", "frames/s", "ns/frame", "rejected");
+    run("whole frame, in place", 16, BmsController::kFrameLength, count);
+    run("whole frame, in place", 32, BmsController::kFrameLength, count);
+    run("20-byte notifications", 16, 20, count);
+    run("20-byte notifications", 32, 20, count);
+    return 0;
+}
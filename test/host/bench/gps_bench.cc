@@ -0,0 +1,215 @@
+// Replays recorded NMEA logs through GpsStreamParser and TrackSimplifier.
+// Reports parse throughput next to a conventional line-buffered parser
+// (checksum, split on ',', atof) over the same bytes, and how many track
+// points survive simplification at a few error bounds. Fixes are filtered
+// as GpsService does: valid and moving.
+//
+// data/commute_1hz.nmea is synthetic (see data/make_ride_nmea.py); pass real
+// receiver logs to measure those instead.
+//
+//   gps_bench [passes] [log.nmea ...]
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "bench_util.hh"
+#include "services/gps/gps_parser.hh"
+#include "services/gps/track_simplifier.hh"
+
+namespace
+{
+constexpr uint32_t kMinSpeedMmps = 500;
+
+std::vector<uint8_t> readFile(const char* path)
+{
+    std::ifstream in(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+/** What a typical firmware does: buffer a line, then split and atof it. */
+class LineParser
+{
+public:
+    uint32_t fixes = 0;
+    double   sum   = 0;
+
+    void feed(const uint8_t* data, std::size_t length)
+    {
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            const char c = static_cast<char>(data[i]);
+            if (c == '$')
+            {
+                line_.clear();
+            }
+            else if (c == '\n')
+            {
+                finish();
+                line_.clear();
+            }
+            else if (c != '\r' && line_.size() < 120)
+            {
+                line_.push_back(c);
+            }
+        }
+    }
+
+private:
+    void finish()
+    {
+        const std::size_t star = line_.rfind('*');
+        if (star == std::string::npos || star + 3 > line_.size())
+        {
+            return;
+        }
+        uint8_t checksum = 0;
+        for (std::size_t i = 0; i < star; ++i)
+        {
+            checksum ^= static_cast<uint8_t>(line_[i]);
+        }
+        if (checksum != std::strtoul(line_.c_str() + star + 1, nullptr, 16))
+        {
+            return;
+        }
+        line_.resize(star);
+
+        const char* fields[20]{};
+        std::size_t count  = 0;
+        char*       cursor = line_.data();
+        while (cursor != nullptr && count < 20)
+        {
+            fields[count++] = cursor;
+            char* comma     = std::strchr(cursor, ',');
+            if (comma != nullptr)
+            {
+                *comma++ = '\0';
+            }
+            cursor = comma;
+        }
+
+        const bool rmc = std::strcmp(fields[0] + 2, "RMC") == 0;
+        if (rmc && count > 7 && fields[2][0] == 'A')
+        {
+            const double lat   = std::atof(fields[3]);
+            const double lon   = std::atof(fields[5]);
+            const double knots = std::atof(fields[7]);
+            sum += std::floor(lat / 100) + std::fmod(lat, 100) / 60 + std::floor(lon / 100) + knots;
+            ++fixes;
+        }
+        else if (!rmc && count > 9)
+        {
+            sum += std::atof(fields[8]) + std::atof(fields[9]);
+        }
+    }
+
+    std::string line_;
+};
+
+struct Replay
+{
+    TrackSimplifier simplifier;
+    uint32_t        fixes = 0;
+
+    explicit Replay(uint32_t toleranceCm) : simplifier(TrackSimplifier::Config{toleranceCm}) {}
+
+    static void onFix(void* context, const GpsFix& fix)
+    {
+        auto* self = static_cast<Replay*>(context);
+        ++self->fixes;
+        if (!fix.valid || fix.speedMmps < kMinSpeedMmps)
+        {
+            return;
+        }
+        TrackPoint point;
+        point.latE7     = fix.latE7;
+        point.lonE7     = fix.lonE7;
+        point.timeMs    = fix.timeOfDayMs;
+        point.speedMmps = fix.speedMmps;
+        self->simplifier.add(point);
+    }
+};
+
+void run(const char* path, long passes)
+{
+    const std::vector<uint8_t> log = readFile(path);
+    if (log.empty())
+    {
+        std::fprintf(stderr, "%s: empty or unreadable\n", path);
+        return;
+    }
+    const double megabytes = static_cast<double>(log.size()) * passes / 1e6;
+
+    GpsStreamParser streaming;
+    uint32_t        fixes = 0;
+    streaming.setFixCallback([](void* context, const GpsFix&) { ++*static_cast<uint32_t*>(context); }, &fixes);
+    const double streamingSeconds = bench::seconds([&] {
+        for (long pass = 0; pass < passes; ++pass)
+        {
+            streaming.feed(log.data(), log.size());
+        }
+    });
+
+    LineParser   lines;
+    const double lineSeconds = bench::seconds([&] {
+        for (long pass = 0; pass < passes; ++pass)
+        {
+            lines.feed(log.data(), log.size());
+        }
+    });
+    bench::keep(lines.sum);
+
+    const GpsStreamParser::Stats stats = streaming.stats();
+    std::printf("%s: %zu B, %u sentences, %u checksum errors per pass\n",
+                path,
+                log.size(),
+                static_cast<unsigned>(stats.sentences / passes),
+                static_cast<unsigned>(stats.checksumErrors / passes));
+    std::printf("  %-26s %9.1f MB/s %12.0f sentences/s\n",
+                "streaming parser",
+                megabytes / streamingSeconds,
+                stats.sentences / streamingSeconds);
+    std::printf("  %-26s %9.1f MB/s %12.0f sentences/s\n",
+                "line buffer + atof",
+                megabytes / lineSeconds,
+                stats.sentences / lineSeconds);
+
+    for (const uint32_t toleranceCm : {200u, 500u, 1000u})
+    {
+        Replay          replay(toleranceCm);
+        GpsStreamParser parser;
+        parser.setFixCallback(&Replay::onFix, &replay);
+        parser.feed(log.data(), log.size());
+        replay.simplifier.flush();
+
+        const TrackSimplifier::Stats track = replay.simplifier.stats();
+        std::printf("  track at %4.1f m tolerance   %6u moving fixes -> %5u points (%.1fx smaller)\n",
+                    toleranceCm / 100.0,
+                    track.input,
+                    track.output,
+                    track.output == 0 ? 0.0 : static_cast<double>(track.input) / track.output);
+    }
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const long passes = bench::iterations(argc, argv, 200);
+    if (argc > 2)
+    {
+        for (int i = 2; i < argc; ++i)
+        {
+            run(argv[i], passes);
+        }
+    }
+    else
+    {
+        run(JARVIS_HOST_DATA_DIR "/commute_1hz.nmea", passes);
+    }
+    return 0;
+}
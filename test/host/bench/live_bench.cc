@@ -0,0 +1,283 @@
+// Runs LiveBroadcast with 1, 4 and 10 subscribers on local sockets and
+// reports the CPU its task spends per tick, next to a conventional fan-out
+// that formats the event for each client and writes it. Both run as tasks
+// woken every period, so the thread stub's wake-up, most of the one-client
+// figure, weighs on both alike. A forked reader
+// drains the fast clients, so its CPU is not counted. The slow cases add a
+// client whose socket is full and never read: it must cost its slot only
+// until kStallMs, then be evicted.
+//
+// These are host CPU figures; tools/live_load.py measures the device.
+//
+//   live_bench [ticks]
+
+#include <poll.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <time.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "bench_util.hh"
+#include "host_clock.hh"
+#include "host_httpd.hh"
+#include "lwip/sockets.h"
+#include "services/web/live_broadcast.hh"
+
+namespace
+{
+constexpr std::size_t kEventBytes = 256;
+
+double cpuSeconds(clockid_t clock)
+{
+    timespec now{};
+    clock_gettime(clock, &now);
+    return static_cast<double>(now.tv_sec) + static_cast<double>(now.tv_nsec) / 1e9;
+}
+
+/** CPU used by every thread but the calling one. */
+double otherThreadsSeconds()
+{
+    return cpuSeconds(CLOCK_PROCESS_CPUTIME_ID) - cpuSeconds(CLOCK_THREAD_CPUTIME_ID);
+}
+
+TelemetryState sample(uint32_t tick)
+{
+    TelemetryState state;
+    state.data.speedKph    = 20.0f + static_cast<float>(tick % 50) * 0.3f;
+    state.data.rpm         = static_cast<uint16_t>(300 + tick % 200);
+    state.data.powerKw     = 0.4f + static_cast<float>(tick % 7) * 0.05f;
+    state.data.voltage     = 52.1f;
+    state.data.motorC      = 41.0f;
+    state.data.controllerC = 37.0f;
+    state.data.gear        = 2;
+    state.data.throttle    = static_cast<uint8_t>(tick % 100);
+    state.distanceKm       = static_cast<float>(tick) * 0.0006f;
+    return state;
+}
+
+/** Reads and discards everything on @p fds until each one closes. Never returns. */
+[[noreturn]] void drain(std::vector<int> fds)
+{
+    std::vector<pollfd> polled;
+    for (const int fd : fds)
+    {
+        polled.push_back(pollfd{fd, POLLIN, 0});
+    }
+    std::size_t open = polled.size();
+    char        buffer[4096];
+    while (open > 0 && poll(polled.data(), polled.size(), -1) >= 0)
+    {
+        for (pollfd& entry : polled)
+        {
+            if (entry.fd >= 0 && entry.revents != 0 && read(entry.fd, buffer, sizeof(buffer)) <= 0)
+            {
+                entry.fd = -1;
+                --open;
+            }
+        }
+    }
+    _exit(0);
+}
+
+/**
+ * What a typical firmware does: a task that wakes every period, formats the
+ * event for each client and writes it. Paced like LiveBroadcast, so both pay
+ * the same wake-ups.
+ */
+struct Conventional
+{
+    const std::vector<int>* fds   = nullptr;
+    long                    ticks = 0;
+    SemaphoreHandle_t       done  = nullptr;
+
+    static void taskEntry(void* arg)
+    {
+        auto* self = static_cast<Conventional*>(arg);
+        char  chunk[kEventBytes + 8];
+        for (long tick = 0; tick < self->ticks; ++tick)
+        {
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(LiveBroadcast::kPeriodMs));
+            const TelemetryState  state = sample(static_cast<uint32_t>(tick));
+            const ControllerData& data  = state.data;
+            for (const int fd : *self->fds)
+            {
+                const int length = std::snprintf(chunk + 5,
+                                                 kEventBytes,
+                                                 R"(data: {"t":%u,"speedKph":%.1f,"rpm":%u,"powerKw":%.2f,"voltage":%.1f,)"
+                                                 R"("motorC":%.0f,"controllerC":%.0f,"gear":%u,"throttle":%u,"distanceKm":%.3f})"
+                                                 "\n\n",
+                                                 static_cast<unsigned>(tick),
+                                                 static_cast<double>(data.speedKph),
+                                                 static_cast<unsigned>(data.rpm),
+                                                 static_cast<double>(data.powerKw),
+                                                 static_cast<double>(data.voltage),
+                                                 static_cast<double>(data.motorC),
+                                                 static_cast<double>(data.controllerC),
+                                                 static_cast<unsigned>(data.gear),
+                                                 static_cast<unsigned>(data.throttle),
+                                                 static_cast<double>(state.distanceKm));
+                char head[6];
+                std::snprintf(head, sizeof(head), "%03X\r\n", static_cast<unsigned>(length));
+                std::memcpy(chunk, head, 5);
+                chunk[5 + length]     = '\r';
+                chunk[5 + length + 1] = '\n';
+                send(fd, chunk, static_cast<std::size_t>(length) + 7, MSG_DONTWAIT);
+            }
+        }
+        xSemaphoreGive(self->done);
+        vTaskDelete(nullptr);
+    }
+};
+
+double conventionalSeconds(const std::vector<int>& fds, long ticks)
+{
+    Conventional conventional;
+    conventional.fds   = &fds;
+    conventional.ticks = ticks;
+    conventional.done  = xSemaphoreCreateBinary();
+
+    const double start = otherThreadsSeconds();
+    xTaskCreate(&Conventional::taskEntry, "conventional", 4096, &conventional, 4, nullptr);
+    xSemaphoreTake(conventional.done, portMAX_DELAY);
+    const double seconds = otherThreadsSeconds() - start;
+    vSemaphoreDelete(conventional.done);
+    return seconds;
+}
+
+/** Publishes at twice the tick rate until the task has ticked @p ticks more times. */
+void runTicks(LiveBroadcast& live, uint32_t& published, long ticks)
+{
+    const uint32_t target = live.stats().ticks + static_cast<uint32_t>(ticks);
+    while (live.stats().ticks < target)
+    {
+        live.publish(sample(published++));
+        std::this_thread::sleep_for(std::chrono::milliseconds(LiveBroadcast::kPeriodMs / 2));
+    }
+}
+
+/** @return false when a stalled client was not evicted. */
+bool run(std::size_t fast, std::size_t slow, long ticks)
+{
+    std::vector<int> server;
+    std::vector<int> peer;
+    for (std::size_t i = 0; i < fast + slow; ++i)
+    {
+        int pair[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, pair) != 0)
+        {
+            std::perror("socketpair");
+            return false;
+        }
+        server.push_back(pair[0]);
+        peer.push_back(pair[1]);
+    }
+    for (std::size_t i = fast; i < fast + slow; ++i)
+    {
+        const int small = 2048;
+        setsockopt(server[i], SOL_SOCKET, SO_SNDBUF, &small, sizeof(small));
+        setsockopt(peer[i], SOL_SOCKET, SO_RCVBUF, &small, sizeof(small));
+    }
+
+    const pid_t reader = fork();
+    if (reader == 0)
+    {
+        for (const int fd : server)
+        {
+            close(fd);
+        }
+        drain(std::vector<int>(peer.begin(), peer.begin() + static_cast<long>(fast)));
+    }
+    for (std::size_t i = 0; i < fast; ++i)
+    {
+        close(peer[i]);
+    }
+
+    const std::vector<int> fastFds(server.begin(), server.begin() + static_cast<long>(fast));
+    const double           conventional = conventionalSeconds(fastFds, ticks);
+
+    host_clock::set(1'000'000);
+    LiveBroadcast live;
+    live.start();
+    for (const int fd : server)
+    {
+        httpd_req_t* req = host_httpd::open(fd);
+        live.subscribe(req);
+        host_httpd::close(req);
+    }
+    // Fill the slow sockets so no event fits
+    for (std::size_t i = fast; i < fast + slow; ++i)
+    {
+        char junk[512]{};
+        while (send(server[i], junk, sizeof(junk), MSG_DONTWAIT) > 0)
+        {
+        }
+    }
+
+    uint32_t                   published = 0;
+    const LiveBroadcast::Stats before    = live.stats();
+    const double               start     = otherThreadsSeconds();
+    runTicks(live, published, ticks);
+    const double               broadcast = otherThreadsSeconds() - start;
+    const LiveBroadcast::Stats after     = live.stats();
+
+    // Past kStallMs the slow clients go, the others stay
+    host_clock::advance(int64_t{LiveBroadcast::kStallMs} * 1000 + 1'000'000);
+    runTicks(live, published, 2);
+    const LiveBroadcast::Stats evicted = live.stats();
+    live.stop();
+
+    for (std::size_t i = fast; i < fast + slow; ++i)
+    {
+        close(peer[i]);
+    }
+    waitpid(reader, nullptr, 0);
+
+    const long measured = static_cast<long>(after.ticks - before.ticks);
+    std::printf("%2zu fast + %zu stalled clients, %ld ticks\n", fast, slow, measured);
+    std::printf("  %-26s %9.1f us/tick %9.2f us/client\n",
+                "LiveBroadcast",
+                broadcast * 1e6 / measured,
+                broadcast * 1e6 / measured / static_cast<double>(fast + slow));
+    std::printf("  %-26s %9.1f us/tick %9.2f us/client\n",
+                "format + write per client",
+                conventional * 1e6 / ticks,
+                conventional * 1e6 / ticks / static_cast<double>(fast));
+    std::printf("  %u encoded, %u sent, %u dropped, %u evicted, %u clients left\n",
+                static_cast<unsigned>(after.encoded - before.encoded),
+                static_cast<unsigned>(after.sent - before.sent),
+                static_cast<unsigned>(after.dropped - before.dropped),
+                static_cast<unsigned>(evicted.evicted),
+                static_cast<unsigned>(evicted.clients));
+
+    const bool ok = evicted.evicted == slow && evicted.clients == fast;
+    if (!ok)
+    {
+        std::fprintf(stderr, "  expected %zu evicted and %zu clients left\n", slow, fast);
+    }
+    return ok;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const long ticks = bench::iterations(argc, argv, 100);
+    signal(SIGPIPE, SIG_IGN);
+
+    static_assert(LiveBroadcast::kMaxClients >= 10, "build the bench with CONFIG_JARVIS_LIVE_CLIENTS=10");
+    bool ok = true;
+    ok      = run(1, 0, ticks) && ok;
+    ok      = run(4, 0, ticks) && ok;
+    ok      = run(10, 0, ticks) && ok;
+    ok      = run(3, 1, ticks) && ok;
+    ok      = run(9, 1, ticks) && ok;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+// Per-frame cost of the motor telemetry decoder on replayed simulator
+// rides, against what it replaced:
+//
+//   original float     per-frame divides and a float sqrt (before the
+//                      numeric policies)
+//   hand-written       numeric policy, Far-driver framing hard-wired in a
+//                      switch (before the protocol policies)
+//   policy             BasicMotorController<FarDriverProtocol, Numeric>
+//
+// Matching "hand-written" and "policy" rows mean the protocol policy costs
+// nothing; motor_test checks that they also decode identically. Each row
+// is the best of several rounds. This measures the host CPU; on the S3,
+// compare the motor_decode stage in /api/metrics under tools/sim_load.py
+// with CONFIG_JARVIS_MOTOR_FIXED_POINT off and on.
+//
+//   motor_bench [passes]
+
+#include <cstdio>
+#include <vector>
+
+#include "bench_util.hh"
+#include "host_clock.hh"
+#include "motor_replay.hh"
+#include "reference_motor.hh"
+#include "telemetry/motor/motor_controller.h"
+
+namespace
+{
+constexpr int kRounds = 5;
+
+template <typename Decoder>
+double nsPerFrame(const std::vector<MotorSimulator::Frame>& frames, long passes)
+{
+    MotorControllerConfig config;
+    config.reductionRatio = 6.5f;
+
+    double best = 0;
+    for (int round = 0; round < kRounds; ++round)
+    {
+        Decoder      decoder(config);
+        const double seconds = bench::seconds([&] {
+            for (long pass = 0; pass < passes; ++pass)
+            {
+                // Moved once a pass: the clock is a stand-in, not under test
+                host_clock::advance(MotorSimulator::kFramePeriodUs);
+                for (const auto& frame : frames)
+                {
+                    decoder.handleNotification(frame.bytes, frame.length);
+                }
+            }
+        });
+        bench::keep(decoder.telemetry().distanceKm);
+        const double ns = seconds * 1e9 / (static_cast<double>(frames.size()) * passes);
+        best            = round == 0 ? ns : std::min(best, ns);
+    }
+    return best;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const long passes = bench::iterations(argc, argv, 20);
+    const auto frames = recordRides(100'000, 6.5f);
+    std::printf("%zu frames x %ld passes, best of %d\n", frames.size(), passes, kRounds);
+
+    const struct
+    {
+        const char* label;
+        double (*run)(const std::vector<MotorSimulator::Frame>&, long);
+    } rows[] = {
+        {"original float", &nsPerFrame<LegacyFloatDecoder>},
+        {"hand-written float", &nsPerFrame<HandWrittenDecoder<FloatNumeric>>},
+        {"policy float", &nsPerFrame<BasicMotorController<FarDriverProtocol, FloatNumeric>>},
+        {"hand-written fixed", &nsPerFrame<HandWrittenDecoder<FixedNumeric<16>>>},
+        {"policy fixed", &nsPerFrame<BasicMotorController<FarDriverProtocol, FixedNumeric<16>>>},
+    };
+    for (const auto& row : rows)
+    {
+        std::printf("  %-20s %6.2f ns/frame\n", row.label, row.run(frames, passes));
+    }
+    return 0;
+}
@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+"""Writes two synthetic app images for the OTA delta test.
+
+OLD is an ESP app image header, an app descriptor and 96 KiB of
+pseudo-random "code" with a literal pool of addresses into it. NEW is the
+next build: a function inserted a third of the way in shifts everything
+after it, so the pooled addresses beyond that point move too, a few
+instructions change, a table is appended and the descriptor carries a new
+ELF digest. That is the shape tools/ota_delta.py is built for, and the
+patch body inflates to more than the device's 32 KiB window.
+
+The output is deterministic.
+
+Usage:
+    make_ota_images.py old.bin new.bin
+"""
+
+import random
+import struct
+import sys
+
+IMAGE_MAGIC = 0xE9
+APP_DESC_MAGIC = 0xABCD5432
+LOAD_ADDRESS = 0x42000020
+CODE_WORDS = 24 * 1024
+POOL_EVERY = 16  # Every 16th word is a pooled address
+INSERT_AT = CODE_WORDS // 3
+INSERT_WORDS = 75
+
+
+def header(elf_sha256, length):
+    image = struct.pack("<BBBBI", IMAGE_MAGIC, 1, 2, 0x20, LOAD_ADDRESS) + bytes(16)
+    image += struct.pack("<II", LOAD_ADDRESS, length)
+    descriptor = struct.pack("<II8x32s32s16s16s32s", APP_DESC_MAGIC, 0, b"1.0", b"jarvis", b"00:00:00", b"Jan  1 2026", b"v6.0")
+    descriptor += elf_sha256
+    return image + descriptor.ljust(256, b"\0")
+
+
+def code(rng, words, shift_from=None, shift=0):
+    out = []
+    for i in range(words):
+        if i % POOL_EVERY == 0:
+            target = rng.randrange(words)
+            address = LOAD_ADDRESS + 4 * target
+            if shift_from is not None and target >= shift_from:
+                address += shift
+            out.append(address)
+        else:
+            out.append(rng.getrandbits(32))
+    return out
+
+
+def main():
+    old_words = code(random.Random(1), CODE_WORDS)
+    # Same stream with pooled addresses past the insertion moved along
+    new_words = code(random.Random(1), CODE_WORDS, INSERT_AT, 4 * INSERT_WORDS)
+    inserted = random.Random(2)
+    new_words[INSERT_AT:INSERT_AT] = [inserted.getrandbits(32) for _ in range(INSERT_WORDS)]
+    for i in range(5, len(new_words), 4099):
+        if i % POOL_EVERY != 0:
+            new_words[i] ^= 0x00FF0000
+    new_words += [0x3F400000 + 16 * i for i in range(512)]
+
+    old_body = struct.pack(f"<{len(old_words)}I", *old_words)
+    new_body = struct.pack(f"<{len(new_words)}I", *new_words)
+    old = header(bytes(range(32)), len(old_body)) + old_body
+    new = header(bytes(range(32, 64)), len(new_body)) + new_body
+
+    with open(sys.argv[1], "wb") as f:
+        f.write(old)
+    with open(sys.argv[2], "wb") as f:
+        f.write(new)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+"""Writes a synthetic 1 Hz NMEA ride log for the GPS benchmark.
+
+The route is a 20 minute urban ride: straight runs, 90 degree turns, a
+roundabout, two traffic-light stops and a short tunnel where the receiver
+loses its fix. Positions carry ~1.5 m of random-walk noise, as a phone-grade
+receiver does. Each second is a GNRMC and a GNGGA sentence with checksums,
+CRLF terminated. The output is deterministic, so the committed file can be
+regenerated byte for byte.
+
+Real receiver logs can be passed to gps_bench instead.
+
+Usage:
+    make_ride_nmea.py > commute_1hz.nmea
+"""
+
+import math
+import random
+import sys
+
+START_LAT = 48.137154
+START_LON = 11.576124
+EARTH_M = 6371000.0
+
+# (seconds, speed km/h, turn rate deg/s)
+SEGMENTS = [
+    (10, 0.0, 0.0),
+    (120, 24.0, 0.0),
+    (6, 14.0, 15.0),
+    (180, 27.0, 0.0),
+    (30, 0.0, 0.0),  # lights
+    (90, 22.0, 0.0),
+    (24, 16.0, -15.0),  # roundabout
+    (200, 28.0, 0.3),  # long gentle curve
+    (8, 12.0, -11.0),
+    (150, 25.0, 0.0),
+    (45, 0.0, 0.0),  # lights
+    (160, 26.0, -0.5),
+    (6, 14.0, 15.0),
+    (150, 23.0, 0.0),
+    (21, 0.0, 0.0),
+]
+TUNNEL = (700, 740)
+
+
+def checksum(body):
+    value = 0
+    for char in body:
+        value ^= ord(char)
+    return "%02X" % value
+
+
+def sentence(body):
+    return "$%s*%s\r\n" % (body, checksum(body))
+
+
+def coordinate(value, positive, negative, degree_digits):
+    hemisphere = positive if value >= 0 else negative
+    value = abs(value)
+    degrees = int(value)
+    minutes = (value - degrees) * 60.0
+    return "%0*d%07.4f" % (degree_digits, degrees, minutes), hemisphere
+
+
+def main():
+    rng = random.Random(29)
+    lat, lon = START_LAT, START_LON
+    heading = 35.0
+    noise_n = noise_e = 0.0
+    second = 0
+    out = sys.stdout
+
+    for duration, speed_kph, turn_rate in SEGMENTS:
+        for _ in range(duration):
+            heading = (heading + turn_rate) % 360.0
+            speed_ms = speed_kph / 3.6
+            lat += math.degrees(speed_ms * math.cos(math.radians(heading)) / EARTH_M)
+            lon += math.degrees(speed_ms * math.sin(math.radians(heading)) / (EARTH_M * math.cos(math.radians(lat))))
+
+            noise_n = 0.8 * noise_n + rng.gauss(0.0, 0.6)
+            noise_e = 0.8 * noise_e + rng.gauss(0.0, 0.6)
+            fix_lat = lat + math.degrees(noise_n / EARTH_M)
+            fix_lon = lon + math.degrees(noise_e / (EARTH_M * math.cos(math.radians(lat))))
+
+            hh, rem = divmod(7 * 3600 + 42 * 60 + second, 3600)
+            mm, ss = divmod(rem, 60)
+            utc = "%02d%02d%02d.00" % (hh, mm, ss)
+            valid = not (TUNNEL[0] <= second < TUNNEL[1])
+            lat_text, ns = coordinate(fix_lat, "N", "S", 2)
+            lon_text, ew = coordinate(fix_lon, "E", "W", 3)
+            knots = max(0.0, speed_ms + rng.gauss(0.0, 0.1)) * 1.943844
+            satellites = 11 + rng.randint(-2, 2) if valid else 0
+            hdop = 0.8 + rng.random() * 0.5 if valid else 99.99
+
+            if valid:
+                rmc = "GNRMC,%s,A,%s,%s,%s,%s,%.3f,%.2f,140326,,,A" % (utc, lat_text, ns, lon_text, ew, knots, heading)
+                gga = "GNGGA,%s,%s,%s,%s,%s,1,%02d,%.2f,%.1f,M,46.9,M,," % (
+                    utc, lat_text, ns, lon_text, ew, satellites, hdop, 519.0 + rng.gauss(0.0, 0.8))
+            else:
+                rmc = "GNRMC,%s,V,,,,,,,140326,,,N" % utc
+                gga = "GNGGA,%s,,,,,0,00,99.99,,,,,," % utc
+            out.write(sentence(rmc))
+            out.write(sentence(gga))
+            second += 1
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "esp_err.h"
+
+// Types only, for headers that register handlers; nothing dispatches on the host.
+
+typedef const char* esp_event_base_t;
+typedef void*       esp_event_handler_instance_t;
+typedef void (*esp_event_handler_t)(void* arg, esp_event_base_t base, int32_t id, void* data);
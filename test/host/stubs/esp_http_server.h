@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stddef.h>
+#include <sys/types.h>
+
+#include "esp_err.h"
+
+// Host stand-in for the request side of esp_http_server. A request is bound
+// to a socket with host_httpd::open(); responses are written to it as HTTP
+// chunks. There is no server loop and no routing.
+
+typedef void* httpd_handle_t;
+
+typedef struct httpd_req
+{
+    httpd_handle_t handle;
+    size_t         content_len;
+    void*          user_ctx;
+    void*          aux; ///< Host state: socket and whether headers went out
+} httpd_req_t;
+
+typedef enum
+{
+    HTTPD_400_BAD_REQUEST,
+    HTTPD_404_NOT_FOUND,
+    HTTPD_500_INTERNAL_SERVER_ERROR,
+} httpd_err_code_t;
+
+#define HTTPD_RESP_USE_STRLEN -1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+esp_err_t httpd_resp_set_status(httpd_req_t* r, const char* status);
+esp_err_t httpd_resp_set_type(httpd_req_t* r, const char* type);
+esp_err_t httpd_resp_set_hdr(httpd_req_t* r, const char* field, const char* value);
+esp_err_t httpd_resp_send(httpd_req_t* r, const char* buf, ssize_t buf_len);
+esp_err_t httpd_resp_sendstr(httpd_req_t* r, const char* str);
+esp_err_t httpd_resp_send_chunk(httpd_req_t* r, const char* buf, ssize_t buf_len);
+esp_err_t httpd_resp_send_err(httpd_req_t* req, httpd_err_code_t error, const char* msg);
+esp_err_t httpd_req_async_handler_begin(httpd_req_t* r, httpd_req_t** out);
+esp_err_t httpd_req_async_handler_complete(httpd_req_t* r);
+int       httpd_req_to_sockfd(httpd_req_t* r);
+esp_err_t httpd_sess_trigger_close(httpd_handle_t handle, int sockfd);
+
+#ifdef __cplusplus
+}
+#endif
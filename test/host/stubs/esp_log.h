@@ -0,0 +1,18 @@
+#pragma once
+
+#include <stdio.h>
+
+// Host builds print warnings and errors only; the rest is still type-checked
+#define ESP_LOGE(tag, format, ...) fprintf(stderr, "E (%s) " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) fprintf(stderr, "W (%s) " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOG_QUIET(tag, format, ...)                                                                                \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (0)                                                                                                         \
+        {                                                                                                              \
+            fprintf(stderr, "%s " format, tag, ##__VA_ARGS__);                                                         \
+        }                                                                                                              \
+    } while (0)
+#define ESP_LOGI(tag, format, ...) ESP_LOG_QUIET(tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) ESP_LOG_QUIET(tag, format, ##__VA_ARGS__)
+#define ESP_LOGV(tag, format, ...) ESP_LOG_QUIET(tag, format, ##__VA_ARGS__)
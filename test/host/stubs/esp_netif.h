@@ -0,0 +1,7 @@
+#pragma once
+
+#include "esp_err.h"
+
+// Types only, for headers that hold an interface handle.
+
+typedef struct esp_netif_obj esp_netif_t;
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Deterministic on the host: the same sequence every run. */
+uint32_t esp_random(void);
+void     esp_fill_random(void* buf, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,5 @@
+#pragma once
+
+#include <stdint.h>
+
+int esp_rom_printf(const char* format, ...);
@@ -0,0 +1,220 @@
+#include <atomic>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <set>
+
+#include "esp_err.h"
+#include "esp_random.h"
+#include "esp_rom_crc.h"
+#include "esp_rom_sys.h"
+#include "esp_timer.h"
+#include "host_clock.hh"
+
+namespace
+{
+std::atomic<int64_t>  g_nowUs{1'000'000};
+std::atomic<uint32_t> g_random{0x9E3779B9};
+
+std::mutex                   g_timerMutex;
+std::set<esp_timer_handle_t> g_timers;
+} // namespace
+
+struct esp_timer
+{
+    esp_timer_create_args_t args{};
+    int64_t                 deadlineUs = 0;
+    uint64_t                periodUs   = 0;
+    bool                    active     = false;
+};
+
+namespace
+{
+/** Runs every timer due at the current time, earliest first. */
+void fireDueTimers()
+{
+    for (;;)
+    {
+        esp_timer_handle_t      due = nullptr;
+        esp_timer_create_args_t args{};
+        {
+            std::lock_guard<std::mutex> lock(g_timerMutex);
+            for (esp_timer_handle_t timer : g_timers)
+            {
+                if (timer->active && timer->deadlineUs <= g_nowUs &&
+                    (due == nullptr || timer->deadlineUs < due->deadlineUs))
+                {
+                    due = timer;
+                }
+            }
+            if (due == nullptr)
+            {
+                return;
+            }
+            if (due->periodUs != 0)
+            {
+                due->deadlineUs += static_cast<int64_t>(due->periodUs);
+            }
+            else
+            {
+                due->active = false;
+            }
+            args = due->args;
+        }
+        args.callback(args.arg);
+    }
+}
+} // namespace
+
+void host_clock::set(int64_t us)
+{
+    g_nowUs = us;
+    fireDueTimers();
+}
+
+void host_clock::advance(int64_t us)
+{
+    g_nowUs += us;
+    fireDueTimers();
+}
+
+int64_t host_clock::now()
+{
+    return g_nowUs;
+}
+
+extern "C" int64_t esp_timer_get_time(void)
+{
+    return g_nowUs;
+}
+
+extern "C" esp_err_t esp_timer_create(const esp_timer_create_args_t* create_args, esp_timer_handle_t* out_handle)
+{
+    if (create_args == nullptr || create_args->callback == nullptr || out_handle == nullptr)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    auto* timer = new esp_timer;
+    timer->args = *create_args;
+    std::lock_guard<std::mutex> lock(g_timerMutex);
+    g_timers.insert(timer);
+    *out_handle = timer;
+    return ESP_OK;
+}
+
+namespace
+{
+esp_err_t startTimer(esp_timer_handle_t timer, uint64_t timeoutUs, uint64_t periodUs, bool restart)
+{
+    std::lock_guard<std::mutex> lock(g_timerMutex);
+    if (timer->active != restart)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->deadlineUs = g_nowUs + static_cast<int64_t>(timeoutUs);
+    timer->periodUs   = periodUs;
+    timer->active     = true;
+    return ESP_OK;
+}
+} // namespace
+
+extern "C" esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us)
+{
+    return startTimer(timer, timeout_us, 0, false);
+}
+
+extern "C" esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period)
+{
+    return startTimer(timer, period, period, false);
+}
+
+extern "C" esp_err_t esp_timer_restart(esp_timer_handle_t timer, uint64_t timeout_us)
+{
+    return startTimer(timer, timeout_us, timer->periodUs != 0 ? timeout_us : 0, true);
+}
+
+extern "C" esp_err_t esp_timer_stop(esp_timer_handle_t timer)
+{
+    std::lock_guard<std::mutex> lock(g_timerMutex);
+    if (!timer->active)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->active = false;
+    return ESP_OK;
+}
+
+extern "C" esp_err_t esp_timer_delete(esp_timer_handle_t timer)
+{
+    std::lock_guard<std::mutex> lock(g_timerMutex);
+    if (timer->active)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    g_timers.erase(timer);
+    delete timer;
+    return ESP_OK;
+}
+
+extern "C" bool esp_timer_is_active(esp_timer_handle_t timer)
+{
+    std::lock_guard<std::mutex> lock(g_timerMutex);
+    return timer->active;
+}
+
+const char* esp_err_to_name(esp_err_t code)
+{
+    return code == ESP_OK ? "ESP_OK" : "ESP_ERR";
+}
+
+extern "C" uint32_t esp_random(void)
+{
+    // xorshift32; lock-free so concurrent callers still get distinct values
+    uint32_t current = g_random.load();
+    uint32_t next    = 0;
+    do
+    {
+        next = current;
+        next ^= next << 13;
+        next ^= next >> 17;
+        next ^= next << 5;
+    } while (!g_random.compare_exchange_weak(current, next));
+    return next;
+}
+
+extern "C" void esp_fill_random(void* buf, size_t len)
+{
+    auto* out = static_cast<uint8_t*>(buf);
+    while (len > 0)
+    {
+        const uint32_t    value = esp_random();
+        const std::size_t n     = len < sizeof(value) ? len : sizeof(value);
+        std::memcpy(out, &value, n);
+        out += n;
+        len -= n;
+    }
+}
+
+extern "C" uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t* buf, uint32_t len)
+{
+    crc = ~crc;
+    for (uint32_t i = 0; i < len; ++i)
+    {
+        crc ^= buf[i];
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+int esp_rom_printf(const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    const int length = std::vfprintf(stderr, format, args);
+    va_end(args);
+    return length;
+}
@@ -0,0 +1,345 @@
+// FreeRTOS on threads: enough of tasks, notifications, queues and semaphores
+// for the services' own tasks to run unchanged in host tests.
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+struct tskTaskControlBlock
+{
+    std::mutex              mutex;
+    std::condition_variable changed;
+    uint32_t                value   = 0;
+    bool                    pending = false;
+};
+
+struct QueueDefinition
+{
+    std::mutex              mutex;
+    std::condition_variable changed;
+    UBaseType_t             count = 0;
+    UBaseType_t             max   = 1;
+
+    // Queues only; semaphores just count
+    std::size_t                      itemSize = 0;
+    std::deque<std::vector<uint8_t>> items;
+};
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+std::recursive_mutex                      s_critical;
+thread_local tskTaskControlBlock*         t_self = nullptr;
+const Clock::time_point                   s_boot = Clock::now();
+
+tskTaskControlBlock* self()
+{
+    if (t_self == nullptr)
+    {
+        // Threads the tests start get a control block on first use; never freed
+        t_self = new tskTaskControlBlock();
+    }
+    return t_self;
+}
+
+template <typename Lock, typename Ready>
+bool waitFor(std::condition_variable& changed, Lock& lock, TickType_t ticks, Ready ready)
+{
+    if (ticks == portMAX_DELAY)
+    {
+        changed.wait(lock, ready);
+        return true;
+    }
+    return changed.wait_for(lock, std::chrono::milliseconds(ticks), ready);
+}
+
+void notify(TaskHandle_t task, uint32_t value, eNotifyAction action)
+{
+    {
+        std::lock_guard<std::mutex> lock(task->mutex);
+        switch (action)
+        {
+        case eSetBits:
+            task->value |= value;
+            break;
+        case eIncrement:
+            ++task->value;
+            break;
+        case eSetValueWithOverwrite:
+            task->value = value;
+            break;
+        case eNoAction:
+            break;
+        }
+        task->pending = true;
+    }
+    task->changed.notify_all();
+}
+} // namespace
+
+void host_enter_critical(void)
+{
+    s_critical.lock();
+}
+
+void host_exit_critical(void)
+{
+    s_critical.unlock();
+}
+
+BaseType_t xPortInIsrContext(void)
+{
+    return pdFALSE;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t entry,
+                                   const char*,
+                                   uint32_t,
+                                   void*          arg,
+                                   UBaseType_t,
+                                   TaskHandle_t*  handle,
+                                   BaseType_t)
+{
+    // Tasks end by returning after vTaskDelete(nullptr); their blocks leak
+    auto* task = new tskTaskControlBlock();
+    if (handle != nullptr)
+    {
+        *handle = task;
+    }
+    std::thread([entry, arg, task] {
+        t_self = task;
+        entry(arg);
+    }).detach();
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t entry,
+                       const char*    name,
+                       uint32_t       stackDepth,
+                       void*          arg,
+                       UBaseType_t    priority,
+                       TaskHandle_t*  handle)
+{
+    return xTaskCreatePinnedToCore(entry, name, stackDepth, arg, priority, handle, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t)
+{
+}
+
+void vTaskSuspend(TaskHandle_t)
+{
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return static_cast<TickType_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - s_boot).count());
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return self();
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t)
+{
+    return 1024;
+}
+
+UBaseType_t uxTaskPriorityGet(TaskHandle_t)
+{
+    return tskIDLE_PRIORITY + 1;
+}
+
+BaseType_t xTaskGetSchedulerState(void)
+{
+    return taskSCHEDULER_RUNNING;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks)
+{
+    tskTaskControlBlock*         task = self();
+    std::unique_lock<std::mutex> lock(task->mutex);
+    if (!waitFor(task->changed, lock, ticks, [task] { return task->value > 0; }))
+    {
+        return 0;
+    }
+    const uint32_t value = task->value;
+    task->value          = clearOnExit ? 0 : value - 1;
+    task->pending        = false;
+    return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    notify(task, 0, eIncrement);
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* woken)
+{
+    notify(task, 0, eIncrement);
+    if (woken != nullptr)
+    {
+        *woken = pdFALSE;
+    }
+}
+
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action)
+{
+    notify(task, value, action);
+    return pdPASS;
+}
+
+BaseType_t xTaskNotifyFromISR(TaskHandle_t task, uint32_t value, eNotifyAction action, BaseType_t* woken)
+{
+    notify(task, value, action);
+    if (woken != nullptr)
+    {
+        *woken = pdFALSE;
+    }
+    return pdPASS;
+}
+
+BaseType_t xTaskNotifyWait(uint32_t clearOnEntry, uint32_t clearOnExit, uint32_t* value, TickType_t ticks)
+{
+    tskTaskControlBlock*         task = self();
+    std::unique_lock<std::mutex> lock(task->mutex);
+    if (!task->pending)
+    {
+        task->value &= ~clearOnEntry;
+    }
+    const bool notified = waitFor(task->changed, lock, ticks, [task] { return task->pending; });
+    if (value != nullptr)
+    {
+        *value = task->value;
+    }
+    if (!notified)
+    {
+        return pdFALSE;
+    }
+    task->value &= ~clearOnExit;
+    task->pending = false;
+    return pdTRUE;
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t maxCount, UBaseType_t initialCount)
+{
+    auto* semaphore  = new QueueDefinition();
+    semaphore->max   = maxCount;
+    semaphore->count = initialCount;
+    return semaphore;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return xSemaphoreCreateCounting(1, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return xSemaphoreCreateCounting(1, 1);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t*)
+{
+    return xSemaphoreCreateMutex();
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks)
+{
+    std::unique_lock<std::mutex> lock(semaphore->mutex);
+    if (!waitFor(semaphore->changed, lock, ticks, [semaphore] { return semaphore->count > 0; }))
+    {
+        return pdFALSE;
+    }
+    --semaphore->count;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    {
+        std::lock_guard<std::mutex> lock(semaphore->mutex);
+        if (semaphore->count >= semaphore->max)
+        {
+            return pdFALSE;
+        }
+        ++semaphore->count;
+    }
+    semaphore->changed.notify_one();
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t semaphore, BaseType_t* woken)
+{
+    if (woken != nullptr)
+    {
+        *woken = pdFALSE;
+    }
+    return xSemaphoreGive(semaphore);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore)
+{
+    delete semaphore;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize)
+{
+    auto* queue     = new QueueDefinition();
+    queue->max      = length;
+    queue->itemSize = itemSize;
+    return queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks)
+{
+    {
+        std::unique_lock<std::mutex> lock(queue->mutex);
+        if (!waitFor(queue->changed, lock, ticks, [queue] { return queue->items.size() < queue->max; }))
+        {
+            return pdFALSE;
+        }
+        const auto* bytes = static_cast<const uint8_t*>(item);
+        queue->items.emplace_back(bytes, bytes + queue->itemSize);
+    }
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticks)
+{
+    {
+        std::unique_lock<std::mutex> lock(queue->mutex);
+        if (!waitFor(queue->changed, lock, ticks, [queue] { return !queue->items.empty(); }))
+        {
+            return pdFALSE;
+        }
+        std::memcpy(item, queue->items.front().data(), queue->itemSize);
+        queue->items.pop_front();
+    }
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+
+void vQueueDelete(QueueHandle_t queue)
+{
+    delete queue;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Host stand-in: tasks are threads and the tick is one millisecond.
+
+typedef int          BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t     TickType_t;
+
+#define pdTRUE  1
+#define pdFALSE 0
+#define pdPASS  1
+#define pdFAIL  0
+
+#define portMAX_DELAY          0xFFFFFFFFu
+#define portTICK_PERIOD_MS     1
+#define pdMS_TO_TICKS(ms)      ((TickType_t)(ms))
+#define portYIELD_FROM_ISR(x)  ((void)(x))
+#define configMAX_PRIORITIES   25
+#define configMAX_TASK_NAME_LEN 16
+#define tskIDLE_PRIORITY       0
+#define tskNO_AFFINITY         0x7FFFFFFF
+
+typedef struct
+{
+    int unused;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED {0}
+#define portMUX_INITIALIZE(mux)      ((mux)->unused = 0)
+
+// Every critical section shares one recursive lock on the host
+void host_enter_critical(void);
+void host_exit_critical(void);
+
+#define portENTER_CRITICAL(mux)     host_enter_critical()
+#define portEXIT_CRITICAL(mux)      host_exit_critical()
+#define portENTER_CRITICAL_ISR(mux) host_enter_critical()
+#define portEXIT_CRITICAL_ISR(mux)  host_exit_critical()
+
+BaseType_t xPortInIsrContext(void);
@@ -0,0 +1,8 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+// Declared for headers that hold a handle; no host code waits on one yet.
+
+typedef struct EventGroupDef_t* EventGroupHandle_t;
+typedef TickType_t              EventBits_t;
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+typedef struct QueueDefinition* SemaphoreHandle_t;
+
+typedef struct
+{
+    void* storage[8];
+} StaticSemaphore_t;
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void);
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t* buffer);
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t maxCount, UBaseType_t initialCount);
+BaseType_t        xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks);
+BaseType_t        xSemaphoreGive(SemaphoreHandle_t semaphore);
+BaseType_t        xSemaphoreGiveFromISR(SemaphoreHandle_t semaphore, BaseType_t* woken);
+void              vSemaphoreDelete(SemaphoreHandle_t semaphore);
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+typedef struct tskTaskControlBlock* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+typedef enum
+{
+    eNoAction,
+    eSetBits,
+    eIncrement,
+    eSetValueWithOverwrite,
+} eNotifyAction;
+
+#define taskSCHEDULER_NOT_STARTED 1
+#define taskSCHEDULER_RUNNING     2
+
+#define taskENTER_CRITICAL(mux)     portENTER_CRITICAL(mux)
+#define taskEXIT_CRITICAL(mux)      portEXIT_CRITICAL(mux)
+#define taskENTER_CRITICAL_ISR(mux) portENTER_CRITICAL_ISR(mux)
+#define taskEXIT_CRITICAL_ISR(mux)  portEXIT_CRITICAL_ISR(mux)
+
+BaseType_t xTaskCreate(TaskFunction_t    entry,
+                       const char*       name,
+                       uint32_t          stackDepth,
+                       void*             arg,
+                       UBaseType_t       priority,
+                       TaskHandle_t*     handle);
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t entry,
+                                   const char*    name,
+                                   uint32_t       stackDepth,
+                                   void*          arg,
+                                   UBaseType_t    priority,
+                                   TaskHandle_t*  handle,
+                                   BaseType_t     core);
+void         vTaskDelete(TaskHandle_t task);
+void         vTaskDelay(TickType_t ticks);
+void         vTaskSuspend(TaskHandle_t task);
+TickType_t   xTaskGetTickCount(void);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+UBaseType_t  uxTaskGetStackHighWaterMark(TaskHandle_t task);
+UBaseType_t  uxTaskPriorityGet(TaskHandle_t task);
+BaseType_t   xTaskGetSchedulerState(void);
+
+uint32_t   ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void       vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* woken);
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action);
+BaseType_t xTaskNotifyFromISR(TaskHandle_t task, uint32_t value, eNotifyAction action, BaseType_t* woken);
+BaseType_t xTaskNotifyWait(uint32_t clearOnEntry, uint32_t clearOnExit, uint32_t* value, TickType_t ticks);
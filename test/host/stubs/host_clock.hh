@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Test control over the host `esp_timer_get_time()`. Time only moves
+ *        when a test moves it, so timeouts and rates are deterministic.
+ */
+namespace host_clock
+{
+void    set(int64_t us);
+void    advance(int64_t us);
+int64_t now();
+} // namespace host_clock
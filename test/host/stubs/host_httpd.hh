@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+#include "esp_http_server.h"
+
+/**
+ * @brief Test control over the host esp_http_server stand-in.
+ */
+namespace host_httpd
+{
+/** A request arriving on socket @p fd; free it with close(). */
+httpd_req_t* open(int fd);
+void         close(httpd_req_t* req);
+
+/** Detached requests not yet completed. */
+int openAsync();
+
+/** Sockets closed through httpd_sess_trigger_close(). */
+uint32_t sessionsClosed();
+} // namespace host_httpd
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Test control over the host NVS. Values become durable on
+ *        nvs_commit(); reboot() drops whatever was set but not committed.
+ */
+namespace host_nvs
+{
+/** Empties every namespace, like nvs_flash_erase(). */
+void erase();
+
+/** Drops uncommitted values and closes every handle. */
+void reboot();
+
+/** nvs_set_*() calls since the last reset(). */
+uint32_t writes();
+/** nvs_commit() calls since the last reset(). */
+uint32_t commits();
+void     resetCounters();
+
+/** The next @p count nvs_commit() calls fail. */
+void failCommits(uint32_t count);
+} // namespace host_nvs
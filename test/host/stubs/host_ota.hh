@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Test control over the host OTA slots. The test creates "ota_0" and
+ *        "ota_1" with host_partition::create(); "ota_0" runs, updates go to
+ *        the other one.
+ */
+namespace host_ota
+{
+/** Sets the app_elf_sha256 the running image reports. */
+void setAppElfSha256(const uint8_t* digest);
+
+/** Slot chosen by esp_ota_set_boot_partition(), empty when none was. */
+std::string bootLabel();
+
+/** Forgets the boot selection. */
+void reset();
+} // namespace host_ota
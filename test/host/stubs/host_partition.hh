@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Test control over the host flash partitions. Contents behave like
+ *        NOR flash: erase sets 4 KiB sectors to 0xFF, writes can only clear
+ *        bits.
+ */
+namespace host_partition
+{
+/** Creates (or recreates, erased) a data partition. */
+void create(const char* label, std::size_t size);
+void remove(const char* label);
+
+std::vector<uint8_t>& contents(const char* label);
+
+/** The next write fails once @p bytes more have been written; -1 disables. */
+void failWritesAfter(long bytes);
+
+/** Mappings not yet released with esp_partition_munmap(). */
+int openMappings();
+} // namespace host_partition
@@ -0,0 +1,198 @@
+// esp_http_server on plain sockets: a request writes its response to the
+// socket it was opened on, so subscribers can be driven through a socketpair.
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "esp_http_server.h"
+#include "host_httpd.hh"
+#include "lwip/sockets.h"
+
+namespace
+{
+struct HostRequest
+{
+    int         fd          = -1;
+    bool        headersSent = false;
+    std::string status      = "200 OK";
+    std::string headers;
+};
+
+std::atomic<int>      s_async{0};
+std::atomic<uint32_t> s_closed{0};
+
+HostRequest* state(httpd_req_t* r)
+{
+    return static_cast<HostRequest*>(r->aux);
+}
+
+httpd_req_t* make(int fd)
+{
+    auto* req   = new httpd_req_t{};
+    auto* host  = new HostRequest;
+    host->fd    = fd;
+    req->handle = reinterpret_cast<httpd_handle_t>(0x1);
+    req->aux    = host;
+    return req;
+}
+
+void destroy(httpd_req_t* req)
+{
+    delete state(req);
+    delete req;
+}
+
+bool writeAll(int fd, const char* data, std::size_t length)
+{
+    while (length > 0)
+    {
+        const ssize_t sent = send(fd, data, length, MSG_NOSIGNAL);
+        if (sent <= 0)
+        {
+            return false;
+        }
+        data += sent;
+        length -= static_cast<std::size_t>(sent);
+    }
+    return true;
+}
+
+esp_err_t sendHeaders(httpd_req_t* r, bool chunked)
+{
+    HostRequest* host = state(r);
+    if (host->headersSent)
+    {
+        return ESP_OK;
+    }
+    host->headersSent = true;
+    std::string head  = "HTTP/1.1 " + host->status + "\r\n" + host->headers;
+    if (chunked)
+    {
+        head += "Transfer-Encoding: chunked\r\n";
+    }
+    head += "\r\n";
+    return writeAll(host->fd, head.data(), head.size()) ? ESP_OK : ESP_FAIL;
+}
+} // namespace
+
+httpd_req_t* host_httpd::open(int fd)
+{
+    return make(fd);
+}
+
+void host_httpd::close(httpd_req_t* req)
+{
+    destroy(req);
+}
+
+int host_httpd::openAsync()
+{
+    return s_async.load();
+}
+
+uint32_t host_httpd::sessionsClosed()
+{
+    return s_closed.load();
+}
+
+esp_err_t httpd_resp_set_status(httpd_req_t* r, const char* status)
+{
+    state(r)->status = status;
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_type(httpd_req_t* r, const char* type)
+{
+    return httpd_resp_set_hdr(r, "Content-Type", type);
+}
+
+esp_err_t httpd_resp_set_hdr(httpd_req_t* r, const char* field, const char* value)
+{
+    state(r)->headers += std::string(field) + ": " + value + "\r\n";
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_send(httpd_req_t* r, const char* buf, ssize_t buf_len)
+{
+    const std::size_t length = buf_len == HTTPD_RESP_USE_STRLEN ? std::strlen(buf) : static_cast<std::size_t>(buf_len);
+    char              contentLength[48];
+    std::snprintf(contentLength, sizeof(contentLength), "%zu", length);
+    httpd_resp_set_hdr(r, "Content-Length", contentLength);
+    if (sendHeaders(r, false) != ESP_OK)
+    {
+        return ESP_FAIL;
+    }
+    return writeAll(state(r)->fd, buf, length) ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t httpd_resp_sendstr(httpd_req_t* r, const char* str)
+{
+    return httpd_resp_send(r, str, HTTPD_RESP_USE_STRLEN);
+}
+
+esp_err_t httpd_resp_send_chunk(httpd_req_t* r, const char* buf, ssize_t buf_len)
+{
+    if (sendHeaders(r, true) != ESP_OK)
+    {
+        return ESP_FAIL;
+    }
+    const std::size_t length = buf == nullptr ? 0
+                               : buf_len == HTTPD_RESP_USE_STRLEN ? std::strlen(buf)
+                                                                  : static_cast<std::size_t>(buf_len);
+    char              head[16];
+    const int         headLength = std::snprintf(head, sizeof(head), "%zX\r\n", length);
+    const int         fd         = state(r)->fd;
+    if (!writeAll(fd, head, static_cast<std::size_t>(headLength)) || !writeAll(fd, buf, length) ||
+        !writeAll(fd, "\r\n", 2))
+    {
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_send_err(httpd_req_t* req, httpd_err_code_t error, const char* msg)
+{
+    switch (error)
+    {
+    case HTTPD_400_BAD_REQUEST:
+        httpd_resp_set_status(req, "400 Bad Request");
+        break;
+    case HTTPD_404_NOT_FOUND:
+        httpd_resp_set_status(req, "404 Not Found");
+        break;
+    default:
+        httpd_resp_set_status(req, "500 Internal Server Error");
+        break;
+    }
+    return httpd_resp_sendstr(req, msg);
+}
+
+esp_err_t httpd_req_async_handler_begin(httpd_req_t* r, httpd_req_t** out)
+{
+    httpd_req_t* copy = make(state(r)->fd);
+    *state(copy)      = *state(r);
+    *out              = copy;
+    ++s_async;
+    return ESP_OK;
+}
+
+esp_err_t httpd_req_async_handler_complete(httpd_req_t* r)
+{
+    destroy(r);
+    --s_async;
+    return ESP_OK;
+}
+
+int httpd_req_to_sockfd(httpd_req_t* r)
+{
+    return state(r)->fd;
+}
+
+esp_err_t httpd_sess_trigger_close(httpd_handle_t, int sockfd)
+{
+    ::close(sockfd);
+    ++s_closed;
+    return ESP_OK;
+}
@@ -0,0 +1,5 @@
+#pragma once
+
+#include <stddef.h>
+
+typedef struct multi_heap_info* multi_heap_handle_t;
@@ -0,0 +1,289 @@
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "host_nvs.hh"
+#include "nvs.h"
+#include "nvs_flash.h"
+
+namespace
+{
+// Integers, strings and blobs live in one map per namespace, tagged by
+// type; an erase is pending until committed like any other write
+struct Value
+{
+    enum class Type
+    {
+        Number,
+        String,
+        Blob,
+        Erased,
+    };
+
+    Type        type   = Type::Number;
+    uint32_t    number = 0;
+    std::string text; ///< String or blob bytes
+};
+
+using Namespace = std::map<std::string, Value>;
+
+std::mutex                          s_mutex;
+std::map<std::string, Namespace>    s_durable;
+std::map<std::string, Namespace>    s_pending;
+std::map<nvs_handle_t, std::string> s_handles;
+nvs_handle_t                        s_nextHandle  = 1;
+uint32_t                            s_writes      = 0;
+uint32_t                            s_commits     = 0;
+uint32_t                            s_failCommits = 0;
+
+/** The namespace as this handle sees it: durable values under pending ones. */
+const Value* lookup(const std::string& space, const char* key)
+{
+    for (auto* store : {&s_pending, &s_durable})
+    {
+        const auto ns = store->find(space);
+        if (ns != store->end())
+        {
+            const auto it = ns->second.find(key);
+            if (it != ns->second.end())
+            {
+                return it->second.type == Value::Type::Erased ? nullptr : &it->second;
+            }
+        }
+    }
+    return nullptr;
+}
+
+esp_err_t set(nvs_handle_t handle, const char* key, const Value& value)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    const auto                  it = s_handles.find(handle);
+    if (it == s_handles.end())
+    {
+        return ESP_ERR_NVS_INVALID_HANDLE;
+    }
+    s_pending[it->second][key] = value;
+    ++s_writes;
+    return ESP_OK;
+}
+} // namespace
+
+void host_nvs::erase()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_durable.clear();
+    s_pending.clear();
+}
+
+void host_nvs::reboot()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_pending.clear();
+    s_handles.clear();
+}
+
+uint32_t host_nvs::writes()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return s_writes;
+}
+
+uint32_t host_nvs::commits()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return s_commits;
+}
+
+void host_nvs::resetCounters()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_writes  = 0;
+    s_commits = 0;
+}
+
+void host_nvs::failCommits(uint32_t count)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_failCommits = count;
+}
+
+extern "C" esp_err_t nvs_flash_init(void)
+{
+    return ESP_OK;
+}
+
+extern "C" esp_err_t nvs_flash_erase(void)
+{
+    host_nvs::erase();
+    return ESP_OK;
+}
+
+extern "C" esp_err_t nvs_open(const char* name, nvs_open_mode_t, nvs_handle_t* out_handle)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    *out_handle            = s_nextHandle++;
+    s_handles[*out_handle] = name;
+    return ESP_OK;
+}
+
+extern "C" void nvs_close(nvs_handle_t handle)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_handles.erase(handle);
+}
+
+extern "C" esp_err_t nvs_get_u32(nvs_handle_t handle, const char* key, uint32_t* out_value)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    const auto                  it = s_handles.find(handle);
+    if (it == s_handles.end())
+    {
+        return ESP_ERR_NVS_INVALID_HANDLE;
+    }
+    const Value* value = lookup(it->second, key);
+    if (value == nullptr)
+    {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    if (value->type != Value::Type::Number)
+    {
+        return ESP_ERR_NVS_TYPE_MISMATCH;
+    }
+    *out_value = value->number;
+    return ESP_OK;
+}
+
+extern "C" esp_err_t nvs_set_u32(nvs_handle_t handle, const char* key, uint32_t value)
+{
+    Value stored;
+    stored.number = value;
+    return set(handle, key, stored);
+}
+
+extern "C" esp_err_t nvs_get_str(nvs_handle_t handle, const char* key, char* out_value, size_t* length)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    const auto                  it = s_handles.find(handle);
+    if (it == s_handles.end())
+    {
+        return ESP_ERR_NVS_INVALID_HANDLE;
+    }
+    const Value* value = lookup(it->second, key);
+    if (value == nullptr)
+    {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    if (value->type != Value::Type::String)
+    {
+        return ESP_ERR_NVS_TYPE_MISMATCH;
+    }
+    const std::size_t needed = value->text.size() + 1;
+    if (out_value == nullptr)
+    {
+        *length = needed;
+        return ESP_OK;
+    }
+    if (*length < needed)
+    {
+        return ESP_ERR_NVS_INVALID_LENGTH;
+    }
+    std::memcpy(out_value, value->text.c_str(), needed);
+    *length = needed;
+    return ESP_OK;
+}
+
+extern "C" esp_err_t nvs_set_str(nvs_handle_t handle, const char* key, const char* value)
+{
+    Value stored;
+    stored.type = Value::Type::String;
+    stored.text = value;
+    return set(handle, key, stored);
+}
+
+extern "C" esp_err_t nvs_get_blob(nvs_handle_t handle, const char* key, void* out_value, size_t* length)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    const auto                  it = s_handles.find(handle);
+    if (it == s_handles.end())
+    {
+        return ESP_ERR_NVS_INVALID_HANDLE;
+    }
+    const Value* value = lookup(it->second, key);
+    if (value == nullptr)
+    {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    if (value->type != Value::Type::Blob)
+    {
+        return ESP_ERR_NVS_TYPE_MISMATCH;
+    }
+    if (out_value == nullptr)
+    {
+        *length = value->text.size();
+        return ESP_OK;
+    }
+    if (*length < value->text.size())
+    {
+        return ESP_ERR_NVS_INVALID_LENGTH;
+    }
+    std::memcpy(out_value, value->text.data(), value->text.size());
+    *length = value->text.size();
+    return ESP_OK;
+}
+
+extern "C" esp_err_t nvs_set_blob(nvs_handle_t handle, const char* key, const void* value, size_t length)
+{
+    Value stored;
+    stored.type = Value::Type::Blob;
+    stored.text.assign(static_cast<const char*>(value), length);
+    return set(handle, key, stored);
+}
+
+extern "C" esp_err_t nvs_erase_key(nvs_handle_t handle, const char* key)
+{
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        const auto                  it = s_handles.find(handle);
+        if (it == s_handles.end())
+        {
+            return ESP_ERR_NVS_INVALID_HANDLE;
+        }
+        if (lookup(it->second, key) == nullptr)
+        {
+            return ESP_ERR_NVS_NOT_FOUND;
+        }
+    }
+    Value erased;
+    erased.type = Value::Type::Erased;
+    return set(handle, key, erased);
+}
+
+extern "C" esp_err_t nvs_commit(nvs_handle_t handle)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    const auto                  it = s_handles.find(handle);
+    if (it == s_handles.end())
+    {
+        return ESP_ERR_NVS_INVALID_HANDLE;
+    }
+    ++s_commits;
+    if (s_failCommits > 0)
+    {
+        --s_failCommits;
+        return ESP_FAIL;
+    }
+    for (auto& [key, value] : s_pending[it->second])
+    {
+        if (value.type == Value::Type::Erased)
+        {
+            s_durable[it->second].erase(key);
+        }
+        else
+        {
+            s_durable[it->second][key] = value;
+        }
+    }
+    s_pending.erase(it->second);
+    return ESP_OK;
+}
@@ -0,0 +1,165 @@
+#include <cstring>
+#include <mutex>
+#include <string>
+
+#include "esp_app_desc.h"
+#include "esp_ota_ops.h"
+#include "host_ota.hh"
+
+namespace
+{
+constexpr const char* kRunningLabel = "ota_0";
+constexpr const char* kUpdateLabel  = "ota_1";
+constexpr std::size_t kSectorSize   = 4096;
+constexpr uint8_t     kImageMagic   = 0xE9;
+
+// One update at a time, which is all OtaUpdater opens
+struct Update
+{
+    const esp_partition_t* partition = nullptr;
+    std::size_t            written   = 0;
+    std::size_t            erased    = 0;
+};
+
+std::mutex       s_mutex;
+esp_app_desc_t   s_description{};
+std::string      s_bootLabel;
+esp_ota_handle_t s_nextHandle = 1;
+esp_ota_handle_t s_handle     = 0;
+Update           s_update;
+} // namespace
+
+void host_ota::setAppElfSha256(const uint8_t* digest)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    std::memcpy(s_description.app_elf_sha256, digest, sizeof(s_description.app_elf_sha256));
+}
+
+std::string host_ota::bootLabel()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return s_bootLabel;
+}
+
+void host_ota::reset()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_bootLabel.clear();
+}
+
+extern "C" const esp_app_desc_t* esp_app_get_description(void)
+{
+    return &s_description;
+}
+
+extern "C" const esp_partition_t* esp_ota_get_running_partition(void)
+{
+    return esp_partition_find_first(ESP_PARTITION_TYPE_ANY, ESP_PARTITION_SUBTYPE_ANY, kRunningLabel);
+}
+
+extern "C" const esp_partition_t* esp_ota_get_next_update_partition(const esp_partition_t*)
+{
+    return esp_partition_find_first(ESP_PARTITION_TYPE_ANY, ESP_PARTITION_SUBTYPE_ANY, kUpdateLabel);
+}
+
+extern "C" esp_err_t esp_ota_begin(const esp_partition_t* partition, size_t, esp_ota_handle_t* out_handle)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (partition == nullptr || out_handle == nullptr || s_handle != 0)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    s_update    = Update{partition};
+    s_handle    = s_nextHandle++;
+    *out_handle = s_handle;
+    return ESP_OK;
+}
+
+// Sequential writes: each sector is erased when the write first reaches it
+extern "C" esp_err_t esp_ota_write(esp_ota_handle_t handle, const void* data, size_t size)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (handle == 0 || handle != s_handle)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const std::size_t end = s_update.written + size;
+    if (end > s_update.partition->size)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    while (s_update.erased < end)
+    {
+        const esp_err_t err = esp_partition_erase_range(s_update.partition, s_update.erased, kSectorSize);
+        if (err != ESP_OK)
+        {
+            return err;
+        }
+        s_update.erased += kSectorSize;
+    }
+    const esp_err_t err = esp_partition_write(s_update.partition, s_update.written, data, size);
+    if (err == ESP_OK)
+    {
+        s_update.written = end;
+    }
+    return err;
+}
+
+// Stands in for image verification: an app image starts with its magic byte
+extern "C" esp_err_t esp_ota_end(esp_ota_handle_t handle)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (handle == 0 || handle != s_handle)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    s_handle      = 0;
+    uint8_t magic = 0;
+    if (s_update.written == 0 || esp_partition_read(s_update.partition, 0, &magic, 1) != ESP_OK || magic != kImageMagic)
+    {
+        return ESP_ERR_OTA_VALIDATE_FAILED;
+    }
+    return ESP_OK;
+}
+
+extern "C" esp_err_t esp_ota_abort(esp_ota_handle_t handle)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (handle == 0 || handle != s_handle)
+    {
+        return ESP_ERR_NOT_FOUND;
+    }
+    s_handle = 0;
+    return ESP_OK;
+}
+
+extern "C" esp_err_t esp_ota_set_boot_partition(const esp_partition_t* partition)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (partition == nullptr)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    s_bootLabel = partition->label;
+    return ESP_OK;
+}
+
+extern "C" esp_err_t esp_ota_get_state_partition(const esp_partition_t* partition, esp_ota_img_states_t* ota_state)
+{
+    if (partition == nullptr || ota_state == nullptr)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *ota_state = ESP_OTA_IMG_VALID;
+    return ESP_OK;
+}
+
+extern "C" esp_err_t esp_ota_mark_app_valid_cancel_rollback(void)
+{
+    return ESP_OK;
+}
+
+extern "C" esp_err_t esp_ota_mark_app_invalid_rollback_and_reboot(void)
+{
+    return ESP_FAIL;
+}
@@ -0,0 +1,164 @@
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "esp_partition.h"
+#include "host_partition.hh"
+
+namespace
+{
+constexpr std::size_t kSectorSize = 4096;
+
+struct HostPartition
+{
+    esp_partition_t      info{};
+    std::vector<uint8_t> data;
+};
+
+std::mutex                                            s_mutex;
+std::map<std::string, std::unique_ptr<HostPartition>> s_partitions;
+long                                                  s_writeBudget = -1;
+int                                                   s_mappings    = 0;
+esp_partition_mmap_handle_t                           s_nextHandle  = 1;
+
+HostPartition* lookup(const esp_partition_t* partition)
+{
+    if (partition == nullptr)
+    {
+        return nullptr;
+    }
+    const auto it = s_partitions.find(partition->label);
+    return it == s_partitions.end() ? nullptr : it->second.get();
+}
+
+bool inRange(const HostPartition& partition, std::size_t offset, std::size_t size)
+{
+    return offset <= partition.data.size() && size <= partition.data.size() - offset;
+}
+} // namespace
+
+void host_partition::create(const char* label, std::size_t size)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    auto                        partition = std::make_unique<HostPartition>();
+    partition->info.type                  = ESP_PARTITION_TYPE_DATA;
+    partition->info.subtype               = 0x40;
+    partition->info.size                  = static_cast<uint32_t>(size);
+    partition->info.erase_size            = kSectorSize;
+    std::strncpy(partition->info.label, label, sizeof(partition->info.label) - 1);
+    partition->data.assign(size, 0xFF);
+    s_partitions[label] = std::move(partition);
+}
+
+void host_partition::remove(const char* label)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_partitions.erase(label);
+}
+
+std::vector<uint8_t>& host_partition::contents(const char* label)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return s_partitions.at(label)->data;
+}
+
+void host_partition::failWritesAfter(long bytes)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_writeBudget = bytes;
+}
+
+int host_partition::openMappings()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return s_mappings;
+}
+
+extern "C" const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t,
+                                                           const char* label)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    for (const auto& [name, partition] : s_partitions)
+    {
+        if ((type == ESP_PARTITION_TYPE_ANY || partition->info.type == type) && (label == nullptr || name == label))
+        {
+            return &partition->info;
+        }
+    }
+    return nullptr;
+}
+
+extern "C" esp_err_t esp_partition_read(const esp_partition_t* partition, size_t src_offset, void* dst, size_t size)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    HostPartition*              host = lookup(partition);
+    if (host == nullptr || !inRange(*host, src_offset, size))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    std::memcpy(dst, host->data.data() + src_offset, size);
+    return ESP_OK;
+}
+
+extern "C" esp_err_t esp_partition_write(const esp_partition_t* partition, size_t dst_offset, const void* src,
+                                         size_t size)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    HostPartition*              host = lookup(partition);
+    if (host == nullptr || !inRange(*host, dst_offset, size))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_writeBudget >= 0)
+    {
+        if (static_cast<long>(size) > s_writeBudget)
+        {
+            s_writeBudget = -1;
+            return ESP_FAIL;
+        }
+        s_writeBudget -= static_cast<long>(size);
+    }
+    const auto* bytes = static_cast<const uint8_t*>(src);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        host->data[dst_offset + i] &= bytes[i];
+    }
+    return ESP_OK;
+}
+
+extern "C" esp_err_t esp_partition_erase_range(const esp_partition_t* partition, size_t offset, size_t size)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    HostPartition*              host = lookup(partition);
+    if (host == nullptr || !inRange(*host, offset, size) || offset % kSectorSize != 0 || size % kSectorSize != 0)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    std::memset(host->data.data() + offset, 0xFF, size);
+    return ESP_OK;
+}
+
+extern "C" esp_err_t esp_partition_mmap(const esp_partition_t* partition, size_t offset, size_t size,
+                                        esp_partition_mmap_memory_t, const void** out_ptr,
+                                        esp_partition_mmap_handle_t* out_handle)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    HostPartition*              host = lookup(partition);
+    if (host == nullptr || !inRange(*host, offset, size))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    // Like the flash cache: later writes show through the mapping
+    *out_ptr    = host->data.data() + offset;
+    *out_handle = s_nextHandle++;
+    ++s_mappings;
+    return ESP_OK;
+}
+
+extern "C" void esp_partition_munmap(esp_partition_mmap_handle_t)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    --s_mappings;
+}
@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <cstring>
+
+#include "psa/crypto.h"
+
+namespace
+{
+constexpr uint32_t kRound[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+constexpr uint32_t kInitial[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+};
+
+uint32_t rotr(uint32_t value, int bits)
+{
+    return (value >> bits) | (value << (32 - bits));
+}
+
+void compress(uint32_t* state, const uint8_t* block)
+{
+    uint32_t w[64];
+    for (int i = 0; i < 16; ++i)
+    {
+        w[i] = (uint32_t{block[4 * i]} << 24) | (uint32_t{block[4 * i + 1]} << 16) |
+               (uint32_t{block[4 * i + 2]} << 8) | uint32_t{block[4 * i + 3]};
+    }
+    for (int i = 16; i < 64; ++i)
+    {
+        const uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        const uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i]              = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t v[8];
+    std::memcpy(v, state, sizeof(v));
+    for (int i = 0; i < 64; ++i)
+    {
+        const uint32_t s1    = rotr(v[4], 6) ^ rotr(v[4], 11) ^ rotr(v[4], 25);
+        const uint32_t ch    = (v[4] & v[5]) ^ (~v[4] & v[6]);
+        const uint32_t temp1 = v[7] + s1 + ch + kRound[i] + w[i];
+        const uint32_t s0    = rotr(v[0], 2) ^ rotr(v[0], 13) ^ rotr(v[0], 22);
+        const uint32_t maj   = (v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]);
+        std::memmove(v + 1, v, 7 * sizeof(uint32_t));
+        v[4] += temp1;
+        v[0] = temp1 + s0 + maj;
+    }
+    for (int i = 0; i < 8; ++i)
+    {
+        state[i] += v[i];
+    }
+}
+} // namespace
+
+extern "C" psa_status_t psa_crypto_init(void)
+{
+    return PSA_SUCCESS;
+}
+
+extern "C" psa_status_t psa_hash_setup(psa_hash_operation_t* operation, psa_algorithm_t alg)
+{
+    if (alg != PSA_ALG_SHA_256)
+    {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+    if (operation->alg != 0)
+    {
+        return PSA_ERROR_BAD_STATE;
+    }
+    *operation     = psa_hash_operation_t PSA_HASH_OPERATION_INIT;
+    operation->alg = alg;
+    std::memcpy(operation->state, kInitial, sizeof(kInitial));
+    return PSA_SUCCESS;
+}
+
+extern "C" psa_status_t psa_hash_update(psa_hash_operation_t* operation, const uint8_t* input, size_t input_length)
+{
+    if (operation->alg != PSA_ALG_SHA_256)
+    {
+        return PSA_ERROR_BAD_STATE;
+    }
+    operation->length += input_length;
+    while (input_length > 0)
+    {
+        const size_t take = std::min(input_length, sizeof(operation->block) - operation->used);
+        std::memcpy(operation->block + operation->used, input, take);
+        operation->used += take;
+        input += take;
+        input_length -= take;
+        if (operation->used == sizeof(operation->block))
+        {
+            compress(operation->state, operation->block);
+            operation->used = 0;
+        }
+    }
+    return PSA_SUCCESS;
+}
+
+extern "C" psa_status_t psa_hash_finish(psa_hash_operation_t* operation, uint8_t* hash, size_t hash_size,
+                                        size_t* hash_length)
+{
+    if (operation->alg != PSA_ALG_SHA_256)
+    {
+        return PSA_ERROR_BAD_STATE;
+    }
+    if (hash_size < 32)
+    {
+        return PSA_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    const uint64_t bits = operation->length * 8;
+    operation->block[operation->used++] = 0x80;
+    if (operation->used > 56)
+    {
+        std::memset(operation->block + operation->used, 0, 64 - operation->used);
+        compress(operation->state, operation->block);
+        operation->used = 0;
+    }
+    std::memset(operation->block + operation->used, 0, 56 - operation->used);
+    for (int i = 0; i < 8; ++i)
+    {
+        operation->block[56 + i] = static_cast<uint8_t>(bits >> (56 - 8 * i));
+    }
+    compress(operation->state, operation->block);
+
+    for (int i = 0; i < 8; ++i)
+    {
+        for (int b = 0; b < 4; ++b)
+        {
+            hash[4 * i + b] = static_cast<uint8_t>(operation->state[i] >> (24 - 8 * b));
+        }
+    }
+    *hash_length = 32;
+    return psa_hash_abort(operation);
+}
+
+extern "C" psa_status_t psa_hash_abort(psa_hash_operation_t* operation)
+{
+    *operation = psa_hash_operation_t PSA_HASH_OPERATION_INIT;
+    return PSA_SUCCESS;
+}
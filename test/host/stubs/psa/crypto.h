@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// SHA-256 only, which is all the firmware hashes with PSA
+
+typedef int32_t  psa_status_t;
+typedef uint32_t psa_algorithm_t;
+
+#define PSA_SUCCESS                 ((psa_status_t)0)
+#define PSA_ERROR_NOT_SUPPORTED     ((psa_status_t)-134)
+#define PSA_ERROR_BAD_STATE         ((psa_status_t)-137)
+#define PSA_ERROR_BUFFER_TOO_SMALL  ((psa_status_t)-138)
+#define PSA_ALG_SHA_256             ((psa_algorithm_t)0x02000009)
+
+typedef struct
+{
+    psa_algorithm_t alg;
+    uint32_t        state[8];
+    uint64_t        length;
+    uint8_t         block[64];
+    size_t          used;
+} psa_hash_operation_t;
+
+#define PSA_HASH_OPERATION_INIT {0, {0}, 0, {0}, 0}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+psa_status_t psa_crypto_init(void);
+psa_status_t psa_hash_setup(psa_hash_operation_t* operation, psa_algorithm_t alg);
+psa_status_t psa_hash_update(psa_hash_operation_t* operation, const uint8_t* input, size_t input_length);
+psa_status_t psa_hash_finish(psa_hash_operation_t* operation, uint8_t* hash, size_t hash_size, size_t* hash_length);
+psa_status_t psa_hash_abort(psa_hash_operation_t* operation);
+
+#ifdef __cplusplus
+}
+#endif
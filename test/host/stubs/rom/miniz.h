@@ -0,0 +1,77 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zlib.h>
+
+// The ROM's tinfl API over zlib's raw inflate. Only the streaming use the
+// firmware makes is covered: the caller owns a TINFL_LZ_DICT_SIZE window
+// and decompresses into it, wrapping around; zlib keeps its own history, so
+// the window is just the output buffer here. Link with zlib.
+
+#define TINFL_LZ_DICT_SIZE        32768
+#define TINFL_FLAG_HAS_MORE_INPUT 2
+
+typedef enum
+{
+    TINFL_STATUS_BAD_PARAM        = -3,
+    TINFL_STATUS_ADLER32_MISMATCH = -2,
+    TINFL_STATUS_FAILED           = -1,
+    TINFL_STATUS_DONE             = 0,
+    TINFL_STATUS_NEEDS_MORE_INPUT = 1,
+    TINFL_STATUS_HAS_MORE_OUTPUT  = 2,
+} tinfl_status;
+
+struct tinfl_decompressor_tag
+{
+    z_stream stream{};
+    bool     open = false;
+
+    ~tinfl_decompressor_tag()
+    {
+        if (open)
+        {
+            inflateEnd(&stream);
+        }
+    }
+};
+typedef struct tinfl_decompressor_tag tinfl_decompressor;
+
+inline void tinfl_init(tinfl_decompressor* r)
+{
+    if (r->open)
+    {
+        inflateEnd(&r->stream);
+    }
+    r->stream = z_stream{};
+    r->open   = inflateInit2(&r->stream, -MAX_WBITS) == Z_OK;
+}
+
+inline tinfl_status tinfl_decompress(tinfl_decompressor* r, const uint8_t* pIn_buf_next, size_t* pIn_buf_size,
+                                     uint8_t* pOut_buf_start, uint8_t* pOut_buf_next, size_t* pOut_buf_size,
+                                     uint32_t decomp_flags)
+{
+    (void)pOut_buf_start;
+    (void)decomp_flags;
+    if (!r->open)
+    {
+        return TINFL_STATUS_BAD_PARAM;
+    }
+    r->stream.next_in   = const_cast<Bytef*>(pIn_buf_next);
+    r->stream.avail_in  = static_cast<uInt>(*pIn_buf_size);
+    r->stream.next_out  = pOut_buf_next;
+    r->stream.avail_out = static_cast<uInt>(*pOut_buf_size);
+    const int rc        = inflate(&r->stream, Z_NO_FLUSH);
+    *pIn_buf_size -= r->stream.avail_in;
+    *pOut_buf_size -= r->stream.avail_out;
+
+    if (rc == Z_STREAM_END)
+    {
+        return TINFL_STATUS_DONE;
+    }
+    if (rc != Z_OK && rc != Z_BUF_ERROR)
+    {
+        return TINFL_STATUS_FAILED;
+    }
+    return r->stream.avail_out == 0 ? TINFL_STATUS_HAS_MORE_OUTPUT : TINFL_STATUS_NEEDS_MORE_INPUT;
+}
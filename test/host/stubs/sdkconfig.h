@@ -0,0 +1,19 @@
+#pragma once
+
+// Kconfig defaults (main/Kconfig.projbuild) for the host build. Options a
+// test needs to vary are set per target in CMakeLists.txt instead.
+
+#define CONFIG_IDF_TARGET_LINUX 1
+
+#define CONFIG_JARVIS_LTE_STORE_KB 32
+#define CONFIG_JARVIS_WEBUI_PARTITION_LABEL "webui"
+
+#define CONFIG_JARVIS_WIFI_AP_IDLE_TIMEOUT_S 300
+#define CONFIG_JARVIS_WIFI_AP_BUTTON_GPIO -1
+
+#define CONFIG_JARVIS_DLOG_RECORDS 128
+
+#define CONFIG_JARVIS_RIDE_HISTORY 16
+#define CONFIG_JARVIS_RIDE_START_KPH 5
+#define CONFIG_JARVIS_RIDE_START_AMPS 10
+#define CONFIG_JARVIS_RIDE_STOP_S 120
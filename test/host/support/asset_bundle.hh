@@ -0,0 +1,143 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "esp_rom_crc.h"
+#include "services/web/asset_store.hh"
+
+/**
+ * @brief Builds web UI bundles the way `tools/web_assets.py bundle` does,
+ *        with hooks to damage them after the fact.
+ */
+class AssetBundleBuilder
+{
+public:
+    static constexpr std::size_t kHeaderSize = 16;
+    static constexpr std::size_t kEntrySize  = 28;
+
+    enum class Field : std::size_t
+    {
+        PathHash   = 0,
+        PathOffset = 4,
+        MimeOffset = 8,
+        EtagOffset = 12,
+        DataOffset = 16,
+        Length     = 20,
+    };
+
+    AssetBundleBuilder& add(std::string path, std::string body, std::string mime = "text/html")
+    {
+        assets_.push_back({std::move(path), std::move(body), std::move(mime)});
+        return *this;
+    }
+
+    std::vector<uint8_t> build() const
+    {
+        std::vector<Asset> ordered = assets_;
+        std::stable_sort(ordered.begin(), ordered.end(), [](const Asset& a, const Asset& b) {
+            return fnv1a(a.path) < fnv1a(b.path);
+        });
+
+        const std::size_t stringsStart = kHeaderSize + ordered.size() * kEntrySize;
+        std::vector<uint8_t> strings;
+        struct Refs
+        {
+            uint32_t path, mime, etag;
+        };
+        std::vector<Refs> refs;
+        for (std::size_t i = 0; i < ordered.size(); ++i)
+        {
+            char etag[16];
+            std::snprintf(etag, sizeof(etag), "\"%08x\"", static_cast<unsigned>(fnv1a(ordered[i].body)));
+            refs.push_back({intern(strings, ordered[i].path),
+                            intern(strings, ordered[i].mime),
+                            intern(strings, etag)});
+        }
+        const std::size_t dataStart = (stringsStart + strings.size() + 3) / 4 * 4;
+
+        std::vector<uint8_t> image(dataStart, 0);
+        std::copy(strings.begin(), strings.end(), image.begin() + stringsStart);
+        for (std::size_t i = 0; i < ordered.size(); ++i)
+        {
+            const std::size_t entry = kHeaderSize + i * kEntrySize;
+            put32(image, entry + 0, fnv1a(ordered[i].path));
+            put32(image, entry + 4, static_cast<uint32_t>(stringsStart + refs[i].path));
+            put32(image, entry + 8, static_cast<uint32_t>(stringsStart + refs[i].mime));
+            put32(image, entry + 12, static_cast<uint32_t>(stringsStart + refs[i].etag));
+            put32(image, entry + 16, static_cast<uint32_t>(image.size()));
+            put32(image, entry + 20, static_cast<uint32_t>(ordered[i].body.size()));
+            put32(image, entry + 24, 0);
+            image.insert(image.end(), ordered[i].body.begin(), ordered[i].body.end());
+            image.resize((image.size() + 3) / 4 * 4, 0);
+        }
+
+        put32(image, 0, WebAssetStore::kMagic);
+        image[4] = WebAssetStore::kVersion & 0xFF;
+        image[5] = WebAssetStore::kVersion >> 8;
+        image[6] = ordered.size() & 0xFF;
+        image[7] = static_cast<uint8_t>(ordered.size() >> 8);
+        put32(image, 8, static_cast<uint32_t>(image.size()));
+        reseal(image);
+        return image;
+    }
+
+    /** @brief Overwrites one entry field; reseal() afterwards to keep the CRC valid. */
+    static void setField(std::vector<uint8_t>& image, std::size_t entry, Field field, uint32_t value)
+    {
+        put32(image, kHeaderSize + entry * kEntrySize + static_cast<std::size_t>(field), value);
+    }
+
+    static uint32_t field(const std::vector<uint8_t>& image, std::size_t entry, Field field)
+    {
+        const std::size_t at = kHeaderSize + entry * kEntrySize + static_cast<std::size_t>(field);
+        return static_cast<uint32_t>(image[at]) | (static_cast<uint32_t>(image[at + 1]) << 8) |
+               (static_cast<uint32_t>(image[at + 2]) << 16) | (static_cast<uint32_t>(image[at + 3]) << 24);
+    }
+
+    static void reseal(std::vector<uint8_t>& image)
+    {
+        put32(image, 12, esp_rom_crc32_le(0, image.data() + kHeaderSize, static_cast<uint32_t>(image.size() - kHeaderSize)));
+    }
+
+    static uint32_t fnv1a(const std::string& text)
+    {
+        uint32_t hash = 2166136261u;
+        for (const char c : text)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+private:
+    struct Asset
+    {
+        std::string path;
+        std::string body;
+        std::string mime;
+    };
+
+    static uint32_t intern(std::vector<uint8_t>& strings, const std::string& text)
+    {
+        const auto offset = static_cast<uint32_t>(strings.size());
+        strings.insert(strings.end(), text.begin(), text.end());
+        strings.push_back('\0');
+        return offset;
+    }
+
+    static void put32(std::vector<uint8_t>& image, std::size_t offset, uint32_t value)
+    {
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            image[offset + i] = static_cast<uint8_t>(value >> (8 * i));
+        }
+    }
+
+    std::vector<Asset> assets_;
+};
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "telemetry/bms/bms_controller.h"
+
+/**
+ * @brief Builds AntBMS status frames with a valid checksum.
+ */
+struct BmsFrameBuilder
+{
+    std::array<uint8_t, BmsController::kFrameLength> bytes{};
+
+    BmsFrameBuilder()
+    {
+        bytes[0] = 0xAA;
+        bytes[1] = 0x55;
+        bytes[2] = 0xAA;
+        bytes[3] = 0xFF;
+    }
+
+    BmsFrameBuilder& packDeciVolts(uint16_t value) { return be16(4, value); }
+    BmsFrameBuilder& currentDeciAmps(int32_t value) { return be32(70, static_cast<uint32_t>(value)); }
+    BmsFrameBuilder& soc(uint8_t value) { return u8(74, value); }
+    BmsFrameBuilder& temperature(std::size_t index, int16_t value) { return be16(91 + index * 2, static_cast<uint16_t>(value)); }
+    BmsFrameBuilder& powerW(int32_t value) { return be32(111, static_cast<uint32_t>(value)); }
+    BmsFrameBuilder& cellCount(uint8_t value) { return u8(123, value); }
+    BmsFrameBuilder& cell(std::size_t index, uint16_t mv) { return be16(6 + index * 2, mv); }
+
+    /** @brief Seals the frame; call after the last field is set. */
+    const std::array<uint8_t, BmsController::kFrameLength>& finish()
+    {
+        uint16_t sum = 0;
+        for (std::size_t i = 4; i < 138; ++i)
+        {
+            sum = static_cast<uint16_t>(sum + bytes[i]);
+        }
+        be16(138, sum);
+        return bytes;
+    }
+
+private:
+    BmsFrameBuilder& u8(std::size_t offset, uint8_t value)
+    {
+        bytes[offset] = value;
+        return *this;
+    }
+
+    BmsFrameBuilder& be16(std::size_t offset, uint16_t value)
+    {
+        bytes[offset]     = static_cast<uint8_t>(value >> 8);
+        bytes[offset + 1] = static_cast<uint8_t>(value);
+        return *this;
+    }
+
+    BmsFrameBuilder& be32(std::size_t offset, uint32_t value)
+    {
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            bytes[offset + i] = static_cast<uint8_t>(value >> (24 - 8 * i));
+        }
+        return *this;
+    }
+};
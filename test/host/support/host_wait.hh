@@ -0,0 +1,23 @@
+#pragma once
+
+#include <chrono>
+#include <thread>
+
+/**
+ * @brief Polls @p ready until it holds or @p timeoutMs passes. For results a
+ *        service task produces asynchronously.
+ */
+template <typename Ready>
+bool waitUntil(Ready&& ready, int timeoutMs = 2000)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (!ready())
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    return true;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "telemetry/motor/motor_simulator.h"
+
+/**
+ * @brief Records simulator rides as the frames a controller link would
+ *        deliver: commute, hill and sprint, with noise and some corrupted
+ *        frames. Dropped frames are left out. Seeded, so every run replays
+ *        the same bytes.
+ */
+inline std::vector<MotorSimulator::Frame> recordRides(std::size_t framesPerProfile, float reductionRatio)
+{
+    std::vector<MotorSimulator::Frame> frames;
+    frames.reserve(framesPerProfile * 3);
+    for (const auto profile :
+         {MotorSimulator::Profile::Commute, MotorSimulator::Profile::Hill, MotorSimulator::Profile::Sprint})
+    {
+        MotorSimulator::Config config;
+        config.profile        = profile;
+        config.noise          = 0.02f;
+        config.dropRate       = 0.005f;
+        config.corruptRate    = 0.01f;
+        config.reductionRatio = reductionRatio;
+        MotorSimulator simulator(config);
+
+        MotorSimulator::Frame frame;
+        for (std::size_t i = 0; i < framesPerProfile; ++i)
+        {
+            simulator.next(frame);
+            if (frame.fate != MotorSimulator::FrameFate::Dropped)
+            {
+                frames.push_back(frame);
+            }
+        }
+    }
+    return frames;
+}
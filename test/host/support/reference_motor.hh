@@ -0,0 +1,259 @@
+#pragma once
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "esp_timer.h"
+
+#include "services/log/deferred_log.hh"
+#include "services/mem/mem.hh"
+#include "services/metrics/metrics.hh"
+#include "telemetry/motor/motor_controller.h"
+#include "telemetry/motor/motor_numeric.h"
+
+/**
+ * @file reference_motor.hh
+ * @brief The motor decoder as it was before the numeric and protocol
+ *        policies, kept as a yardstick for them.
+ *
+ * LegacyFloatDecoder is the original float code: per-frame divides and a
+ * float square root. HandWrittenDecoder already computes through a Numeric
+ * policy but has the Far-driver framing hard-wired in a switch, as before
+ * FarDriverProtocol existed. Both keep the controller's per-frame work (the
+ * out-of-line call, settings flag, probe, counters and logs) so a benchmark
+ * compares only the decode itself; callbacks are left out.
+ */
+
+namespace reference_motor
+{
+constexpr std::size_t kFrameLength      = 16;
+constexpr uint64_t    kMaxDistanceGapUs = 5'000'000;
+
+inline uint16_t readUint16LE(const uint8_t* data)
+{
+    return static_cast<uint16_t>(static_cast<uint16_t>(data[0]) | (static_cast<uint16_t>(data[1]) << 8));
+}
+
+inline int16_t readInt16LE(const uint8_t* data)
+{
+    return static_cast<int16_t>(readUint16LE(data));
+}
+} // namespace reference_motor
+
+class LegacyFloatDecoder
+{
+public:
+    explicit LegacyFloatDecoder(const MotorControllerConfig& config) : config_(config) {}
+
+    const TelemetryState& telemetry() const { return telemetry_; }
+
+    // Out of line, like the controller's in motor_controller.cpp
+    __attribute__((noinline)) void handleNotification(const uint8_t* data, std::size_t length)
+    {
+        using namespace reference_motor;
+        if (data == nullptr || length != kFrameLength)
+        {
+            JARVIS_COUNT(MotorFramesDropped);
+            return;
+        }
+        if (configPending_.load(std::memory_order_acquire))
+        {
+            configPending_.store(false, std::memory_order_relaxed);
+        }
+        JARVIS_PROBE(MotorDecode);
+        JARVIS_NO_ALLOC("motor_decode");
+
+        if (data[0] != 0xAA)
+        {
+            JARVIS_COUNT(MotorFramesDropped);
+            JARVIS_DLOG(MotorBadHeader, data[0]);
+            return;
+        }
+        const uint8_t id = static_cast<uint8_t>(data[1] & 0x3F);
+        if (id > 29)
+        {
+            JARVIS_COUNT(MotorFramesDropped);
+            return;
+        }
+        JARVIS_COUNT(MotorFrames);
+
+        const uint8_t* cursor = data + 2;
+        switch (id)
+        {
+            case 0:
+            {
+                telemetry_.data.rpm      = readUint16LE(&cursor[4]);
+                telemetry_.data.speedKph = rpmToSpeedKph(telemetry_.data.rpm);
+
+                const uint64_t nowUs        = static_cast<uint64_t>(esp_timer_get_time());
+                float          deltaSeconds = 0.0f;
+                if (telemetry_.lastIndex0Us != 0)
+                {
+                    deltaSeconds = static_cast<float>(nowUs - telemetry_.lastIndex0Us) / 1'000'000.0f;
+                    if (deltaSeconds < 0.0f || deltaSeconds > 5.0f)
+                    {
+                        deltaSeconds = 0.0f;
+                    }
+                }
+                telemetry_.lastIndex0Us = nowUs;
+
+                const float distanceKm = telemetry_.data.speedKph * (deltaSeconds / 3600.0f);
+                if (distanceKm > 0.0f)
+                {
+                    telemetry_.distanceKm += distanceKm;
+                }
+
+                telemetry_.data.gear = static_cast<uint8_t>(cursor[2] & 0x03U);
+
+                const int16_t iqRaw = readInt16LE(&cursor[8]);
+                const int16_t idRaw = readInt16LE(&cursor[10]);
+                telemetry_.iqAmps   = static_cast<float>(iqRaw) / 100.0f;
+                telemetry_.idAmps   = static_cast<float>(idRaw) / 100.0f;
+
+                const float magnitude =
+                    std::sqrt(telemetry_.iqAmps * telemetry_.iqAmps + telemetry_.idAmps * telemetry_.idAmps);
+                telemetry_.data.powerKw = -magnitude * telemetry_.data.voltage / 1000.0f;
+                if (iqRaw < 0 || idRaw < 0)
+                {
+                    telemetry_.data.powerKw = -telemetry_.data.powerKw;
+                }
+                break;
+            }
+            case 1:
+                telemetry_.data.voltage = static_cast<float>(readUint16LE(cursor)) / 10.0f;
+                break;
+            case 4:
+                telemetry_.data.controllerC = static_cast<float>(cursor[2]);
+                break;
+            case 13:
+                telemetry_.data.motorC   = static_cast<float>(cursor[0]);
+                telemetry_.data.throttle = readUint16LE(&cursor[2]);
+                break;
+            default:
+                break;
+        }
+    }
+
+private:
+    float rpmToSpeedKph(uint16_t rpm) const
+    {
+        const float wheelRpm = static_cast<float>(rpm) / config_.reductionRatio;
+        const float wheelRps = wheelRpm / 60.0f;
+        const float speedMps = wheelRps * config_.wheelCircumferenceMeters;
+        return speedMps * 3.6f;
+    }
+
+    MotorControllerConfig config_;
+    TelemetryState        telemetry_{};
+    std::atomic<bool>     configPending_{false};
+};
+
+template <typename Numeric>
+class HandWrittenDecoder
+{
+public:
+    explicit HandWrittenDecoder(const MotorControllerConfig& config)
+    {
+        const double kphPerRpm = static_cast<double>(config.wheelCircumferenceMeters) * 3.6 /
+                                 (60.0 * static_cast<double>(config.reductionRatio));
+        kphPerRpm_ = Numeric::scale(kphPerRpm);
+    }
+
+    const TelemetryState& telemetry() const { return telemetry_; }
+
+    // Out of line, like the controller's in motor_controller.cpp
+    __attribute__((noinline)) void handleNotification(const uint8_t* data, std::size_t length)
+    {
+        using namespace reference_motor;
+        static constexpr Scale kVoltScale  = Numeric::scale(0.1);
+        static constexpr Scale kAmpScale   = Numeric::scale(0.01);
+        static constexpr Scale kPowerScale = Numeric::scale(0.01 * 0.1 / 1000.0);
+
+        if (data == nullptr || length != kFrameLength)
+        {
+            JARVIS_COUNT(MotorFramesDropped);
+            return;
+        }
+        if (configPending_.load(std::memory_order_acquire))
+        {
+            configPending_.store(false, std::memory_order_relaxed);
+        }
+        JARVIS_PROBE(MotorDecode);
+        JARVIS_NO_ALLOC("motor_decode");
+
+        if (data[0] != 0xAA)
+        {
+            JARVIS_COUNT(MotorFramesDropped);
+            JARVIS_DLOG(MotorBadHeader, data[0]);
+            return;
+        }
+        const uint8_t id = static_cast<uint8_t>(data[1] & 0x3F);
+        if (id > 29)
+        {
+            JARVIS_COUNT(MotorFramesDropped);
+            return;
+        }
+        JARVIS_COUNT(MotorFrames);
+
+        const uint8_t* cursor = data + 2;
+        switch (id)
+        {
+            case 0:
+            {
+                const uint16_t rpm       = readUint16LE(&cursor[4]);
+                const Value    speedKph  = Numeric::fromRaw(rpm, kphPerRpm_);
+                telemetry_.data.rpm      = rpm;
+                telemetry_.data.speedKph = Numeric::toFloat(speedKph);
+
+                const uint64_t nowUs = static_cast<uint64_t>(esp_timer_get_time());
+                if (telemetry_.lastIndex0Us != 0)
+                {
+                    const uint64_t deltaUs = nowUs - telemetry_.lastIndex0Us;
+                    if (deltaUs <= kMaxDistanceGapUs)
+                    {
+                        Numeric::addDistance(distance_, speedKph, static_cast<uint32_t>(deltaUs));
+                        telemetry_.distanceKm = Numeric::toKm(distance_);
+                    }
+                }
+                telemetry_.lastIndex0Us = nowUs;
+
+                telemetry_.data.gear = static_cast<uint8_t>(cursor[2] & 0x03U);
+
+                const int16_t iqRaw = readInt16LE(&cursor[8]);
+                const int16_t idRaw = readInt16LE(&cursor[10]);
+                telemetry_.iqAmps   = Numeric::toFloat(Numeric::fromRaw(iqRaw, kAmpScale));
+                telemetry_.idAmps   = Numeric::toFloat(Numeric::fromRaw(idRaw, kAmpScale));
+
+                const Value magnitudeKw = Numeric::fromWide(Numeric::hypot(iqRaw, idRaw) * rawVoltage_, kPowerScale);
+                const float powerKw     = Numeric::toFloat(magnitudeKw);
+                telemetry_.data.powerKw = (iqRaw < 0 || idRaw < 0) ? powerKw : -powerKw;
+                break;
+            }
+            case 1:
+                rawVoltage_             = readUint16LE(cursor);
+                telemetry_.data.voltage = Numeric::toFloat(Numeric::fromRaw(rawVoltage_, kVoltScale));
+                break;
+            case 4:
+                telemetry_.data.controllerC = static_cast<float>(cursor[2]);
+                break;
+            case 13:
+                telemetry_.data.motorC   = static_cast<float>(cursor[0]);
+                telemetry_.data.throttle = readUint16LE(&cursor[2]);
+                break;
+            default:
+                break;
+        }
+    }
+
+private:
+    using Value = typename Numeric::Value;
+    using Scale = typename Numeric::Scale;
+
+    Scale                      kphPerRpm_{};
+    uint16_t                   rawVoltage_ = 0;
+    typename Numeric::Distance distance_{};
+    TelemetryState             telemetry_{};
+    std::atomic<bool>          configPending_{false};
+};
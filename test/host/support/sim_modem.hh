@@ -0,0 +1,258 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "host_clock.hh"
+#include "services/lte/modem.hh"
+
+/**
+ * @brief Upload endpoint the simulated modem posts to, standing in for the
+ *        telemetry server. Records every body and answers with the next
+ *        queued status, or `status` once the queue is empty.
+ */
+struct HttpStandIn
+{
+    std::vector<std::vector<uint8_t>> bodies;
+    std::string                       url;
+    std::deque<int>                   statuses;
+    int                               status = 200;
+
+    int respond(const std::vector<uint8_t>& body)
+    {
+        int code = status;
+        if (!statuses.empty())
+        {
+            code = statuses.front();
+            statuses.pop_front();
+        }
+        if (code >= 200 && code < 300)
+        {
+            bodies.push_back(body);
+        }
+        return code;
+    }
+};
+
+/**
+ * @brief SerialLink that behaves like a SIMCom modem speaking the AT subset
+ *        AtModemTransport uses, with its HTTP client wired to an
+ *        HttpStandIn.
+ *
+ * Replies are produced synchronously on write(), so one task drives it. The
+ * modem's own latency is charged to the host clock: attaching on AT+CFUN=1,
+ * every HTTP request, and each registration poll while out of coverage.
+ * read() on an empty buffer advances the clock by the whole timeout, as a
+ * silent modem would.
+ */
+class SimulatedModem : public SerialLink
+{
+public:
+    struct Timing
+    {
+        uint32_t commandMs    = 20;   ///< Any command
+        uint32_t attachMs     = 2000; ///< AT+CFUN=1 to registered
+        uint32_t searchStepMs = 1000; ///< Per AT+CEREG? poll without coverage
+        uint32_t requestMs    = 300;  ///< AT+HTTPACTION round trip
+        uint32_t bytesPerSec  = 20000;
+    };
+
+    explicit SimulatedModem(HttpStandIn& server) : SimulatedModem(server, Timing{}) {}
+    SimulatedModem(HttpStandIn& server, const Timing& timing) : server_(server), timing_(timing) {}
+
+    bool coverage   = true; ///< The network accepts registration
+    bool responsive = true; ///< The modem answers at all
+
+    esp_err_t open() override
+    {
+        open_ = true;
+        return ESP_OK;
+    }
+
+    void close() override { open_ = false; }
+
+    int write(const uint8_t* data, std::size_t length) override
+    {
+        if (!open_)
+        {
+            return -1;
+        }
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            if (dataRemaining_ > 0)
+            {
+                body_.push_back(data[i]);
+                if (--dataRemaining_ == 0)
+                {
+                    reply("OK");
+                }
+            }
+            else if (data[i] == '\r')
+            {
+                handle(line_);
+                line_.clear();
+            }
+            else
+            {
+                line_.push_back(static_cast<char>(data[i]));
+            }
+        }
+        return static_cast<int>(length);
+    }
+
+    int read(uint8_t* data, std::size_t capacity, uint32_t timeoutMs) override
+    {
+        if (!open_)
+        {
+            return -1;
+        }
+        if (rx_.empty())
+        {
+            host_clock::advance(static_cast<int64_t>(timeoutMs) * 1000);
+            return 0;
+        }
+        std::size_t count = 0;
+        while (count < capacity && !rx_.empty())
+        {
+            data[count++] = static_cast<uint8_t>(rx_.front());
+            rx_.pop_front();
+        }
+        return static_cast<int>(count);
+    }
+
+    bool     radioOn() const { return radioOn_; }
+    uint64_t radioOnMs() const
+    {
+        const int64_t total = radioOnUs_ + (radioOn_ ? host_clock::now() - radioOnSinceUs_ : 0);
+        return static_cast<uint64_t>(total / 1000);
+    }
+    uint32_t attaches() const { return attaches_; }
+    const std::vector<std::string>& commands() const { return commands_; }
+
+private:
+    void reply(const char* line)
+    {
+        rx_.insert(rx_.end(), {'\r', '\n'});
+        rx_.insert(rx_.end(), line, line + std::strlen(line));
+        rx_.insert(rx_.end(), {'\r', '\n'});
+    }
+
+    void elapse(uint32_t ms) { host_clock::advance(static_cast<int64_t>(ms) * 1000); }
+
+    void setRadio(bool on)
+    {
+        if (on == radioOn_)
+        {
+            return;
+        }
+        if (on)
+        {
+            radioOnSinceUs_ = host_clock::now();
+        }
+        else
+        {
+            radioOnUs_ += host_clock::now() - radioOnSinceUs_;
+        }
+        radioOn_ = on;
+    }
+
+    static bool startsWith(const std::string& line, const char* prefix)
+    {
+        return line.compare(0, std::strlen(prefix), prefix) == 0;
+    }
+
+    void handle(const std::string& command)
+    {
+        commands_.push_back(command);
+        if (!responsive)
+        {
+            return;
+        }
+        elapse(timing_.commandMs);
+
+        if (command == "AT" || command == "ATE0")
+        {
+            reply("OK");
+        }
+        else if (command == "AT+CFUN=1")
+        {
+            setRadio(true);
+            if (coverage)
+            {
+                elapse(timing_.attachMs);
+                ++attaches_;
+            }
+            reply("OK");
+        }
+        else if (command == "AT+CFUN=0")
+        {
+            setRadio(false);
+            reply("OK");
+        }
+        else if (command == "AT+CEREG?")
+        {
+            if (!coverage)
+            {
+                elapse(timing_.searchStepMs);
+            }
+            reply(coverage ? "+CEREG: 0,1" : "+CEREG: 0,2");
+            reply("OK");
+        }
+        else if (command == "AT+HTTPINIT")
+        {
+            reply(httpOpen_ ? "ERROR" : "OK");
+            httpOpen_ = true;
+        }
+        else if (command == "AT+HTTPTERM")
+        {
+            httpOpen_ = false;
+            reply("OK");
+        }
+        else if (startsWith(command, "AT+HTTPPARA=\"URL\",\""))
+        {
+            server_.url = command.substr(std::strlen("AT+HTTPPARA=\"URL\",\""));
+            server_.url.pop_back();
+            reply("OK");
+        }
+        else if (startsWith(command, "AT+HTTPPARA="))
+        {
+            reply("OK");
+        }
+        else if (startsWith(command, "AT+HTTPDATA="))
+        {
+            dataRemaining_ = static_cast<std::size_t>(std::atoi(command.c_str() + std::strlen("AT+HTTPDATA=")));
+            body_.clear();
+            reply("DOWNLOAD");
+        }
+        else if (command == "AT+HTTPACTION=1" && httpOpen_ && radioOn_ && coverage)
+        {
+            reply("OK");
+            elapse(timing_.requestMs + static_cast<uint32_t>(body_.size() * 1000 / timing_.bytesPerSec));
+            const int status = server_.respond(body_);
+            reply(("+HTTPACTION: 1," + std::to_string(status) + ",0").c_str());
+        }
+        else
+        {
+            reply("ERROR");
+        }
+    }
+
+    HttpStandIn&             server_;
+    Timing                   timing_{};
+    bool                     open_           = false;
+    bool                     radioOn_        = false;
+    bool                     httpOpen_       = false;
+    int64_t                  radioOnSinceUs_ = 0;
+    int64_t                  radioOnUs_      = 0;
+    uint32_t                 attaches_       = 0;
+    std::string              line_;
+    std::size_t              dataRemaining_ = 0;
+    std::vector<uint8_t>     body_;
+    std::deque<char>         rx_;
+    std::vector<std::string> commands_;
+};
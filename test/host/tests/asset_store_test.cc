@@ -0,0 +1,227 @@
+#include <catch2/catch.hpp>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "asset_bundle.hh"
+#include "host_partition.hh"
+#include "services/web/asset_store.hh"
+
+namespace
+{
+constexpr const char* kLabel         = CONFIG_JARVIS_WEBUI_PARTITION_LABEL;
+constexpr std::size_t kPartitionSize = 64 * 1024;
+
+using Field = AssetBundleBuilder::Field;
+
+std::vector<uint8_t> bundle(const std::string& version)
+{
+    return AssetBundleBuilder()
+        .add("/index.html", "<html>" + version + "</html>")
+        .add("/app.js", "console.log('" + version + "');", "application/javascript")
+        .add("/style.css", "body{}", "text/css")
+        .build();
+}
+
+/** What `idf.py flash` does: the image lands at the start of the partition. */
+void flash(const std::vector<uint8_t>& image)
+{
+    host_partition::create(kLabel, kPartitionSize);
+    std::copy(image.begin(), image.end(), host_partition::contents(kLabel).begin());
+}
+
+/** What /api/webui does, in 1 KiB chunks. */
+esp_err_t upload(WebAssetStore& store, const std::vector<uint8_t>& image)
+{
+    esp_err_t err = store.beginUpdate(image.size());
+    for (std::size_t offset = 0; err == ESP_OK && offset < image.size(); offset += 1024)
+    {
+        err = store.writeUpdate(image.data() + offset, std::min<std::size_t>(1024, image.size() - offset));
+    }
+    if (err == ESP_OK)
+    {
+        err = store.finishUpdate();
+    }
+    if (err != ESP_OK)
+    {
+        store.abortUpdate();
+    }
+    return err;
+}
+
+std::string body(const WebAssetStore& store, const char* path)
+{
+    WebAsset asset{};
+    if (!store.find(path, std::strlen(path), asset))
+    {
+        return "";
+    }
+    return std::string(reinterpret_cast<const char*>(asset.data), asset.length);
+}
+} // namespace
+
+TEST_CASE("A flashed bundle mounts and serves its assets", "[web]")
+{
+    flash(bundle("v1"));
+    WebAssetStore store;
+    REQUIRE(store.mount() == ESP_OK);
+    CHECK(store.mountedSlot() == 0);
+    CHECK(store.count() == 3);
+    CHECK(store.slotSize() == kPartitionSize / 2);
+
+    WebAsset asset{};
+    REQUIRE(store.find("/app.js", 7, asset));
+    CHECK(std::string(asset.mimeType) == "application/javascript");
+    CHECK(std::string(reinterpret_cast<const char*>(asset.data), asset.length) == "console.log('v1');");
+    CHECK(body(store, "/index.html") == "<html>v1</html>");
+    CHECK_FALSE(store.find("/index.htm", 10, asset));
+    CHECK_FALSE(store.find("/missing", 8, asset));
+
+    store.unmount();
+    CHECK(host_partition::openMappings() == 0);
+}
+
+TEST_CASE("A request path with an embedded NUL does not match", "[web]")
+{
+    flash(bundle("v1"));
+    WebAssetStore store;
+    REQUIRE(store.mount() == ESP_OK);
+
+    const char path[] = "/app.js\0x";
+    WebAsset   asset{};
+    CHECK_FALSE(store.find(path, sizeof(path) - 1, asset));
+}
+
+TEST_CASE("Entries that point outside the image are rejected at mount", "[web]")
+{
+    std::vector<uint8_t> image = bundle("v1");
+    const uint32_t       size  = static_cast<uint32_t>(image.size());
+
+    SECTION("path past the end")
+    {
+        AssetBundleBuilder::setField(image, 1, Field::PathOffset, size + 100);
+    }
+    SECTION("string not terminated inside the image")
+    {
+        // The last body fills the image to its end without a NUL
+        image = AssetBundleBuilder().add("/index.html", "<html>ok</html>!").build();
+        AssetBundleBuilder::setField(image, 0, Field::EtagOffset, AssetBundleBuilder::field(image, 0, Field::DataOffset));
+    }
+    SECTION("body past the end")
+    {
+        AssetBundleBuilder::setField(image, 2, Field::Length, size);
+    }
+    SECTION("body length wrapping around")
+    {
+        AssetBundleBuilder::setField(image, 0, Field::Length, 0xFFFFFFF0u);
+    }
+    SECTION("hashes out of order")
+    {
+        const uint32_t first = AssetBundleBuilder::field(image, 0, Field::PathHash);
+        AssetBundleBuilder::setField(image, 0, Field::PathHash, AssetBundleBuilder::field(image, 2, Field::PathHash));
+        AssetBundleBuilder::setField(image, 2, Field::PathHash, first);
+    }
+    AssetBundleBuilder::reseal(image);
+    flash(image);
+
+    WebAssetStore store;
+    CHECK(store.mount() == ESP_ERR_INVALID_SIZE);
+    CHECK_FALSE(store.mounted());
+    CHECK(host_partition::openMappings() == 0);
+}
+
+TEST_CASE("A bundle with a bad CRC is rejected", "[web]")
+{
+    std::vector<uint8_t> image = bundle("v1");
+    image.back() ^= 0x01;
+    flash(image);
+
+    WebAssetStore store;
+    CHECK(store.mount() == ESP_ERR_INVALID_CRC);
+}
+
+TEST_CASE("An upload goes to the other slot and retires the old one", "[web]")
+{
+    flash(bundle("v1"));
+    {
+        WebAssetStore store;
+        REQUIRE(store.mount() == ESP_OK);
+        REQUIRE(upload(store, bundle("v2")) == ESP_OK);
+        CHECK(store.mountedSlot() == 1);
+        CHECK(body(store, "/index.html") == "<html>v2</html>");
+    }
+    CHECK(host_partition::openMappings() == 0);
+
+    // After a reboot slot 0 is gone, so slot 1 mounts
+    WebAssetStore store;
+    REQUIRE(store.mount() == ESP_OK);
+    CHECK(store.mountedSlot() == 1);
+    CHECK(body(store, "/index.html") == "<html>v2</html>");
+
+    // And the next upload goes back to slot 0
+    REQUIRE(upload(store, bundle("v3")) == ESP_OK);
+    CHECK(store.mountedSlot() == 0);
+    CHECK(body(store, "/index.html") == "<html>v3</html>");
+}
+
+TEST_CASE("A failed upload keeps the old bundle mounted and bootable", "[web]")
+{
+    flash(bundle("v1"));
+    WebAssetStore store;
+    REQUIRE(store.mount() == ESP_OK);
+
+    SECTION("interrupted part-way")
+    {
+        const std::vector<uint8_t> image = bundle("v2");
+        REQUIRE(store.beginUpdate(image.size() * 4) == ESP_OK);
+        REQUIRE(store.writeUpdate(image.data(), image.size()) == ESP_OK);
+        CHECK(store.finishUpdate() == ESP_ERR_INVALID_SIZE);
+    }
+    SECTION("flash write failure")
+    {
+        host_partition::failWritesAfter(64);
+        CHECK(upload(store, bundle("v2")) == ESP_FAIL);
+    }
+    SECTION("damaged in transit")
+    {
+        std::vector<uint8_t> image = bundle("v2");
+        image[image.size() / 2] ^= 0xFF;
+        CHECK(upload(store, image) == ESP_ERR_INVALID_CRC);
+    }
+    SECTION("larger than a slot")
+    {
+        CHECK(store.beginUpdate(kPartitionSize / 2 + 1) == ESP_ERR_INVALID_SIZE);
+    }
+
+    CHECK(store.mountedSlot() == 0);
+    CHECK(body(store, "/index.html") == "<html>v1</html>");
+
+    store.unmount();
+    WebAssetStore rebooted;
+    REQUIRE(rebooted.mount() == ESP_OK);
+    CHECK(rebooted.mountedSlot() == 0);
+    CHECK(body(rebooted, "/index.html") == "<html>v1</html>");
+}
+
+TEST_CASE("A fresh flash wins over an uploaded bundle", "[web]")
+{
+    flash(bundle("v1"));
+    std::vector<uint8_t> slot1;
+    {
+        WebAssetStore store;
+        REQUIRE(store.mount() == ESP_OK);
+        REQUIRE(upload(store, bundle("v2")) == ESP_OK);
+        const auto& contents = host_partition::contents(kLabel);
+        slot1.assign(contents.begin() + kPartitionSize / 2, contents.end());
+    }
+
+    // Reflash slot 0; slot 1 still holds the upload
+    flash(bundle("v3"));
+    std::copy(slot1.begin(), slot1.end(), host_partition::contents(kLabel).begin() + kPartitionSize / 2);
+
+    WebAssetStore store;
+    REQUIRE(store.mount() == ESP_OK);
+    CHECK(store.mountedSlot() == 0);
+    CHECK(body(store, "/index.html") == "<html>v3</html>");
+}
@@ -0,0 +1,139 @@
+#include <catch2/catch.hpp>
+
+#include <vector>
+
+#include "bms_frames.hh"
+#include "telemetry/bms/bms_controller.h"
+
+namespace
+{
+std::array<uint8_t, BmsController::kFrameLength> sixteenCellFrame()
+{
+    BmsFrameBuilder frame;
+    frame.packDeciVolts(532).currentDeciAmps(-125).soc(87).powerW(-665).cellCount(16);
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+        frame.cell(i, static_cast<uint16_t>(3320 + i));
+    }
+    frame.cell(5, 3301).cell(11, 3355);
+    frame.temperature(0, 31).temperature(1, 29).temperature(2, -4);
+    return frame.finish();
+}
+} // namespace
+
+TEST_CASE("A whole frame is decoded from the notification buffer", "[bms]")
+{
+    BmsController bms;
+    const auto    frame = sixteenCellFrame();
+    bms.handleNotification(frame.data(), frame.size());
+
+    const BmsState& state = bms.telemetry();
+    CHECK(state.framesDecoded == 1);
+    CHECK(state.framesRejected == 0);
+    CHECK(state.data.packVoltage == Approx(53.2f));
+    CHECK(state.data.currentAmps == Approx(-12.5f));
+    CHECK(state.data.powerW == Approx(-665.0f));
+    CHECK(state.data.socPercent == 87);
+    CHECK(state.data.cellCount == 16);
+    CHECK(state.data.temperaturesC[0] == 31);
+    CHECK(state.data.temperaturesC[2] == -4);
+    CHECK(state.data.cellMv[5] == 3301);
+    CHECK(state.data.cellMv[16] == 0);
+
+    const BmsCellStats& cells = state.data.cells;
+    CHECK(cells.minMv == 3301);
+    CHECK(cells.maxMv == 3355);
+    CHECK(cells.deltaMv == 54);
+    CHECK(cells.weakestCell == 5);
+}
+
+TEST_CASE("Frames split across small-MTU notifications are reassembled", "[bms]")
+{
+    BmsController bms;
+    const auto    frame = sixteenCellFrame();
+    for (std::size_t offset = 0; offset < frame.size(); offset += 20)
+    {
+        bms.handleNotification(frame.data() + offset, 20);
+    }
+    CHECK(bms.telemetry().framesDecoded == 1);
+    CHECK(bms.telemetry().data.cells.minMv == 3301);
+
+    // A header part way through a frame restarts reassembly
+    bms.handleNotification(frame.data(), 20);
+    for (std::size_t offset = 0; offset < frame.size(); offset += 20)
+    {
+        bms.handleNotification(frame.data() + offset, 20);
+    }
+    CHECK(bms.telemetry().framesDecoded == 2);
+    CHECK(bms.telemetry().framesRejected == 0);
+}
+
+TEST_CASE("Corrupt and headerless input is rejected", "[bms]")
+{
+    BmsController bms;
+    auto          frame = sixteenCellFrame();
+
+    // Continuation bytes with no frame started
+    bms.handleNotification(frame.data() + 20, 20);
+    CHECK(bms.telemetry().framesRejected == 1);
+
+    frame[80] ^= 0x01;
+    bms.handleNotification(frame.data(), frame.size());
+    CHECK(bms.telemetry().framesRejected == 2);
+    CHECK(bms.telemetry().framesDecoded == 0);
+
+    bms.handleNotification(nullptr, 20);
+    bms.handleNotification(frame.data(), 0);
+    CHECK(bms.telemetry().framesRejected == 2);
+}
+
+TEST_CASE("Cell count beyond the array is clamped", "[bms]")
+{
+    BmsFrameBuilder frame;
+    frame.cellCount(40);
+    for (std::size_t i = 0; i < BmsData::kMaxCells; ++i)
+    {
+        frame.cell(i, 3400);
+    }
+    frame.cell(31, 3100);
+    const auto& bytes = frame.finish();
+
+    BmsController bms;
+    bms.handleNotification(bytes.data(), bytes.size());
+    CHECK(bms.telemetry().data.cellCount == BmsData::kMaxCells);
+    CHECK(bms.telemetry().data.cells.weakestCell == 31);
+}
+
+TEST_CASE("Cell statistics come from one pass over the big-endian array", "[bms]")
+{
+    const std::vector<uint8_t> cells = {0x0C, 0xE4, 0x0C, 0xD0, 0x0D, 0x02, 0x0C, 0xD0};
+    uint16_t                   mv[4] = {};
+
+    const BmsCellStats stats = BmsController::computeCellStats(cells.data(), 4, mv);
+    CHECK(mv[0] == 3300);
+    CHECK(mv[2] == 3330);
+    CHECK(stats.minMv == 3280);
+    CHECK(stats.maxMv == 3330);
+    CHECK(stats.deltaMv == 50);
+    CHECK(stats.meanMv == (3300 + 3280 + 3330 + 3280) / 4);
+    CHECK(stats.weakestCell == 1); // first of the equal minima
+
+    CHECK(BmsController::computeCellStats(cells.data(), 0, mv).maxMv == 0);
+}
+
+TEST_CASE("Each decoded frame reaches the telemetry callback", "[bms]")
+{
+    BmsController bms;
+    int           calls = 0;
+    uint8_t       soc   = 0;
+    bms.setTelemetryCallback([&](const BmsState& state) {
+        ++calls;
+        soc = state.data.socPercent;
+    });
+
+    const auto frame = sixteenCellFrame();
+    bms.handleNotification(frame.data(), frame.size());
+    bms.handleNotification(frame.data(), frame.size());
+    CHECK(calls == 2);
+    CHECK(soc == 87);
+}
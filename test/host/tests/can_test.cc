@@ -0,0 +1,207 @@
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "host_wait.hh"
+#include "services/can_bus/can.hh"
+
+namespace
+{
+CanFrame frame(uint32_t id, uint8_t first = 0, bool extended = false)
+{
+    CanFrame frame{};
+    frame.id       = id;
+    frame.dlc      = 8;
+    frame.extended = extended;
+    frame.data[0]  = first;
+    return frame;
+}
+
+/** Decoder that records what it is handed, from the dispatch task. */
+struct Recorder
+{
+    std::mutex            mutex;
+    std::vector<uint32_t> ids;
+    std::vector<uint8_t>  payloads;
+    std::atomic<int>      calls{0};
+    std::atomic<int>      frames{0};
+
+    CanService::DecoderCallback callback()
+    {
+        return [this](const CanFrame* batch, std::size_t count) {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                ids.push_back(batch[i].id);
+                payloads.push_back(batch[i].data[0]);
+            }
+            ++calls;
+            frames += static_cast<int>(count);
+        };
+    }
+};
+} // namespace
+
+TEST_CASE("The acceptance filter passes every registered range", "[can]")
+{
+    LoopbackCanTransport bus;
+    CanService           can(bus);
+    Recorder             recorder;
+    REQUIRE(can.registerDecoder(0x100, 0x10F, recorder.callback()) == ESP_OK);
+    REQUIRE(can.registerDecoder(0x120, 0x121, recorder.callback()) == ESP_OK);
+
+    const CanAcceptanceFilter filter = can.acceptanceFilter();
+    CHECK_FALSE(filter.extended);
+    for (uint32_t id = 0x100; id <= 0x10F; ++id)
+    {
+        CHECK(filter.accepts(frame(id)));
+    }
+    CHECK(filter.accepts(frame(0x120)));
+    CHECK(filter.accepts(frame(0x121)));
+    CHECK_FALSE(filter.accepts(frame(0x200)));
+    CHECK_FALSE(filter.accepts(frame(0x000)));
+    CHECK_FALSE(filter.accepts(frame(0x100, 0, true)));
+}
+
+TEST_CASE("Extended ranges get an extended filter", "[can]")
+{
+    LoopbackCanTransport bus;
+    CanService           can(bus);
+    Recorder             recorder;
+    REQUIRE(can.registerDecoder(0x18FF5000, 0x18FF50FF, recorder.callback(), true) == ESP_OK);
+
+    const CanAcceptanceFilter filter = can.acceptanceFilter();
+    CHECK(filter.extended);
+    CHECK(filter.accepts(frame(0x18FF5042, 0, true)));
+    CHECK_FALSE(filter.accepts(frame(0x18FF5142, 0, true)));
+    CHECK_FALSE(filter.accepts(frame(0x042)));
+}
+
+TEST_CASE("Registrations the filter cannot honour are refused", "[can]")
+{
+    LoopbackCanTransport bus;
+    CanService           can(bus);
+    Recorder             recorder;
+    REQUIRE(can.registerDecoder(0x100, 0x10F, recorder.callback()) == ESP_OK);
+
+    SECTION("mixed frame formats")
+    {
+        CHECK(can.registerDecoder(0x18FF5000, 0x18FF50FF, recorder.callback(), true) == ESP_ERR_NOT_SUPPORTED);
+        CHECK_FALSE(can.acceptanceFilter().extended);
+    }
+    SECTION("overlapping ranges")
+    {
+        CHECK(can.registerDecoder(0x10F, 0x110, recorder.callback()) == ESP_ERR_INVALID_ARG);
+    }
+    SECTION("bad arguments")
+    {
+        CHECK(can.registerDecoder(0x200, 0x1FF, recorder.callback()) == ESP_ERR_INVALID_ARG);
+        CHECK(can.registerDecoder(0x700, 0x800, recorder.callback()) == ESP_ERR_INVALID_ARG);
+        CHECK(can.registerDecoder(0x200, 0x201, nullptr) == ESP_ERR_INVALID_ARG);
+    }
+    SECTION("after start")
+    {
+        REQUIRE(can.start() == ESP_OK);
+        CHECK(can.registerDecoder(0x200, 0x201, recorder.callback()) == ESP_ERR_INVALID_STATE);
+        CHECK(can.stop() == ESP_OK);
+    }
+}
+
+TEST_CASE("Frames flow from the bus to their decoders in runs", "[can]")
+{
+    LoopbackCanTransport bus;
+    CanService           can(bus);
+    Recorder             low;
+    Recorder             high;
+    REQUIRE(can.registerDecoder(0x100, 0x10F, low.callback()) == ESP_OK);
+    REQUIRE(can.registerDecoder(0x120, 0x121, high.callback()) == ESP_OK);
+
+    REQUIRE(can.start() == ESP_OK);
+
+    // 0x200 is outside the filter; 0x12E passes it but has no decoder
+    CHECK(bus.inject(frame(0x101, 1)));
+    CHECK(bus.inject(frame(0x102, 2)));
+    CHECK(bus.inject(frame(0x120, 3)));
+    CHECK_FALSE(bus.inject(frame(0x200, 4)));
+    CHECK(bus.inject(frame(0x12E, 5)));
+    CHECK(can.transmit(frame(0x103, 6)) == ESP_OK);
+
+    REQUIRE(waitUntil([&] { return low.frames + high.frames == 4; }));
+    REQUIRE(waitUntil([&] { return can.stats().unmatched == 1; }));
+    {
+        std::lock_guard<std::mutex> lock(low.mutex);
+        CHECK(low.ids == std::vector<uint32_t>{0x101, 0x102, 0x103});
+        CHECK(low.payloads == std::vector<uint8_t>{1, 2, 6});
+    }
+    CHECK(high.frames == 1);
+
+    const CanService::Stats stats = can.stats();
+    CHECK(stats.received == 5);
+    CHECK(stats.dropped == 0);
+    CHECK(can.stop() == ESP_OK);
+    CHECK_FALSE(bus.inject(frame(0x101)));
+}
+
+TEST_CASE("Consecutive frames for one decoder arrive as one batch", "[can]")
+{
+    LoopbackCanTransport bus;
+    CanService           can(bus);
+    Recorder             recorder;
+    std::atomic<bool>    release{false};
+    std::atomic<bool>    blocked{false};
+    REQUIRE(can.registerDecoder(0x100, 0x10F, [&](const CanFrame* batch, std::size_t count) {
+        if (batch[0].data[0] == 0xFF)
+        {
+            // Hold the dispatch task so the next frames queue up
+            blocked = true;
+            waitUntil([&] { return release.load(); });
+            return;
+        }
+        recorder.callback()(batch, count);
+    }) == ESP_OK);
+    REQUIRE(can.start() == ESP_OK);
+
+    bus.inject(frame(0x100, 0xFF));
+    REQUIRE(waitUntil([&] { return blocked.load(); }));
+    for (uint8_t i = 0; i < 20; ++i)
+    {
+        bus.inject(frame(0x100 + i % 4, i));
+    }
+    release = true;
+
+    REQUIRE(waitUntil([&] { return recorder.frames == 20; }));
+    CHECK(recorder.calls == 1);
+    CHECK(can.stop() == ESP_OK);
+}
+
+TEST_CASE("A full ring drops and counts instead of blocking the bus", "[can]")
+{
+    LoopbackCanTransport bus;
+    CanService           can(bus);
+    std::atomic<bool>    release{false};
+    std::atomic<bool>    blocked{false};
+    std::atomic<int>     decoded{0};
+    REQUIRE(can.registerDecoder(0x100, 0x10F, [&](const CanFrame*, std::size_t count) {
+        blocked = true;
+        waitUntil([&] { return release.load(); }, 5000);
+        decoded += static_cast<int>(count);
+    }) == ESP_OK);
+    REQUIRE(can.start() == ESP_OK);
+
+    bus.inject(frame(0x100));
+    REQUIRE(waitUntil([&] { return blocked.load(); }));
+
+    const int burst = static_cast<int>(CanService::kRingCapacity) + 44;
+    for (int i = 0; i < burst; ++i)
+    {
+        bus.inject(frame(0x101));
+    }
+    release = true;
+
+    CHECK(can.stats().dropped == 44);
+    REQUIRE(waitUntil([&] { return decoded == 1 + static_cast<int>(CanService::kRingCapacity); }));
+    CHECK(can.stats().received == 1 + CanService::kRingCapacity);
+    CHECK(can.stop() == ESP_OK);
+}
@@ -0,0 +1,201 @@
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "services/gps/gps.hh"
+#include "services/gps/gps_parser.hh"
+#include "services/gps/track_simplifier.hh"
+
+namespace
+{
+void feed(GpsStreamParser& parser, const std::string& text)
+{
+    parser.feed(reinterpret_cast<const uint8_t*>(text.data()), text.size());
+}
+
+/** Frames @p body with '$', checksum and CRLF. */
+std::string sentence(const std::string& body)
+{
+    uint8_t checksum = 0;
+    for (const char c : body)
+    {
+        checksum ^= static_cast<uint8_t>(c);
+    }
+    char trailer[8];
+    std::snprintf(trailer, sizeof(trailer), "*%02X\r\n", checksum);
+    return "$" + body + trailer;
+}
+
+void putLe(std::vector<uint8_t>& payload, std::size_t offset, uint32_t value, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        payload[offset + i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+std::vector<uint8_t> navPvt(uint16_t pdopCenti)
+{
+    std::vector<uint8_t> payload(92, 0);
+    putLe(payload, 4, 2026, 2);
+    payload[6]  = 3;
+    payload[7]  = 14;
+    payload[8]  = 7;
+    payload[9]  = 42;
+    payload[10] = 5;
+    payload[20] = 3;    // 3D fix
+    payload[21] = 0x01; // gnssFixOK
+    payload[23] = 12;
+    putLe(payload, 24, static_cast<uint32_t>(115761240), 4);
+    putLe(payload, 28, static_cast<uint32_t>(481371540), 4);
+    putLe(payload, 60, 6500, 4);
+    putLe(payload, 76, pdopCenti, 2);
+
+    std::vector<uint8_t> frame = {0xB5, 0x62, 0x01, 0x07, 92, 0};
+    frame.insert(frame.end(), payload.begin(), payload.end());
+    uint8_t a = 0;
+    uint8_t b = 0;
+    for (std::size_t i = 2; i < frame.size(); ++i)
+    {
+        a = static_cast<uint8_t>(a + frame[i]);
+        b = static_cast<uint8_t>(b + a);
+    }
+    frame.push_back(a);
+    frame.push_back(b);
+    return frame;
+}
+
+/** Link whose every read fails at once, like a UART that was never opened. */
+class FailingLink : public SerialLink
+{
+public:
+    std::atomic<int> reads{0};
+
+    esp_err_t open() override { return ESP_OK; }
+    void      close() override {}
+    int       write(const uint8_t*, std::size_t) override { return -1; }
+    int       read(uint8_t*, std::size_t, uint32_t) override
+    {
+        ++reads;
+        return -1;
+    }
+};
+} // namespace
+
+TEST_CASE("RMC and GGA fill the fix in fixed point", "[gps]")
+{
+    GpsStreamParser parser;
+    int             published = 0;
+    parser.setFixCallback([](void* context, const GpsFix&) { ++*static_cast<int*>(context); }, &published);
+
+    feed(parser, "$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*6A\r\n");
+    feed(parser, sentence("GPGGA,123519,4807.038,S,01131.000,W,1,08,0.9,545.4,M,46.9,M,,"));
+
+    const GpsFix& fix = parser.currentFix();
+    CHECK(published == 1); // GGA refines, it does not publish
+    CHECK(fix.valid);
+    CHECK(fix.latE7 == -481173000);
+    CHECK(fix.lonE7 == -115166666);
+    CHECK(fix.speedMmps == Approx(11523).margin(1));
+    CHECK(fix.courseE5 == 8440000);
+    CHECK(fix.timeOfDayMs == (12 * 3600 + 35 * 60 + 19) * 1000);
+    CHECK(fix.dateYmd == 19940323);
+    CHECK(fix.satellites == 8);
+    CHECK(fix.hdopCenti == 90);
+    CHECK(fix.pdopCenti == 0);
+    CHECK(fix.altitudeMm == 545400);
+    CHECK(parser.stats().sentences == 2);
+}
+
+TEST_CASE("A bad checksum discards the sentence", "[gps]")
+{
+    GpsStreamParser parser;
+    feed(parser, "$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*6B\r\n");
+    CHECK_FALSE(parser.currentFix().valid);
+    CHECK(parser.stats().checksumErrors == 1);
+    CHECK(parser.stats().fixes == 0);
+}
+
+TEST_CASE("NAV-PVT reports PDOP, not HDOP", "[gps]")
+{
+    GpsStreamParser parser;
+    feed(parser, "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47\r\n");
+    const std::vector<uint8_t> frame = navPvt(250);
+    parser.feed(frame.data(), frame.size());
+
+    const GpsFix& fix = parser.currentFix();
+    CHECK(parser.stats().ubxMessages == 1);
+    CHECK(fix.valid);
+    CHECK(fix.pdopCenti == 250);
+    CHECK(fix.hdopCenti == 90); // Still the last GGA value
+    CHECK(fix.latE7 == 481371540);
+    CHECK(fix.lonE7 == 115761240);
+    CHECK(fix.speedMmps == 6500);
+    CHECK(fix.satellites == 12);
+    CHECK(fix.dateYmd == 20260314);
+}
+
+TEST_CASE("The recorded ride parses cleanly and simplifies tenfold", "[gps]")
+{
+    std::ifstream              in(JARVIS_HOST_DATA_DIR "/commute_1hz.nmea", std::ios::binary);
+    const std::vector<uint8_t> log{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    REQUIRE_FALSE(log.empty());
+
+    struct Replay
+    {
+        TrackSimplifier simplifier;
+        uint32_t        invalid = 0;
+    } replay;
+    GpsStreamParser parser;
+    parser.setFixCallback(
+        [](void* context, const GpsFix& fix) {
+            auto* replay = static_cast<Replay*>(context);
+            if (!fix.valid)
+            {
+                ++replay->invalid;
+                return;
+            }
+            if (fix.speedMmps >= 500)
+            {
+                replay->simplifier.add(TrackPoint{fix.latE7, fix.lonE7, fix.timeOfDayMs, fix.speedMmps});
+            }
+        },
+        &replay);
+
+    // Odd chunk sizes, as the UART hands them over
+    for (std::size_t offset = 0; offset < log.size(); offset += 37)
+    {
+        parser.feed(log.data() + offset, std::min<std::size_t>(37, log.size() - offset));
+    }
+    replay.simplifier.flush();
+
+    CHECK(parser.stats().sentences == 2400);
+    CHECK(parser.stats().checksumErrors == 0);
+    CHECK(parser.stats().fixes == 1200);
+    CHECK(replay.invalid == 40); // The tunnel
+    const TrackSimplifier::Stats track = replay.simplifier.stats();
+    CHECK(track.input > 1000);
+    CHECK(track.output * 10 <= track.input);
+}
+
+TEST_CASE("Read errors back off instead of spinning", "[gps]")
+{
+    FailingLink link;
+    GpsService  gps(link);
+    REQUIRE(gps.start() == ESP_OK);
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    gps.stop();
+
+    // 10, 20, 40, 80, 160 ms: about five reads, not millions
+    CHECK(link.reads.load() >= 3);
+    CHECK(link.reads.load() <= 8);
+    CHECK(gps.stats().readErrors == static_cast<uint32_t>(link.reads.load()));
+}
@@ -0,0 +1,211 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include "host_clock.hh"
+#include "services/history/history.hh"
+#include "telemetry/motor/motor_controller.h"
+
+// Built with a one-minute ring of one-second periods, so 60 samples
+static_assert(TelemetryHistory::kPeriodMs == 1000, "history_test expects one-second periods");
+static_assert(TelemetryHistory::kCapacity == 60, "history_test expects a 60-sample ring");
+
+namespace
+{
+constexpr float kGap = -1.0f;
+
+using Points = std::vector<TelemetryHistory::Point>;
+
+bool collect(void* context, const TelemetryHistory::Point& point)
+{
+    static_cast<Points*>(context)->push_back(point);
+    return true;
+}
+
+/**
+ * One frame per period from @p firstTick, speed from @p speeds (kGap skips
+ * the period), then a frame in the next period so the last one commits.
+ */
+void fill(TelemetryHistory& history, uint32_t firstTick, const std::vector<float>& speeds)
+{
+    TelemetryState state;
+    for (std::size_t i = 0; i <= speeds.size(); ++i)
+    {
+        if (i < speeds.size() && speeds[i] == kGap)
+        {
+            continue;
+        }
+        host_clock::set((int64_t{firstTick} + static_cast<int64_t>(i)) * 1'000'000 + 500'000);
+        state.data.speedKph = i < speeds.size() ? speeds[i] : 0.0f;
+        history.record(state);
+    }
+}
+
+Points run(const TelemetryHistory& history, Downsample mode, std::size_t points, uint32_t fromMs = 0,
+           uint32_t toMs = UINT32_MAX, esp_err_t expected = ESP_OK)
+{
+    TelemetryHistory::Query query;
+    query.mode   = mode;
+    query.points = points;
+    query.fromMs = fromMs;
+    query.toMs   = toMs;
+    Points out;
+    REQUIRE(history.query(query, &collect, &out) == expected);
+    return out;
+}
+
+void requireTimeOrder(const Points& points)
+{
+    for (std::size_t i = 1; i < points.size(); ++i)
+    {
+        REQUIRE(points[i - 1].uptimeMs < points[i].uptimeMs);
+    }
+}
+} // namespace
+
+TEST_CASE("LTTB keeps both endpoints and the peak", "[history]")
+{
+    TelemetryHistory   history;
+    std::vector<float> speeds(50, 10.0f);
+    speeds[23] = 40.0f;
+    speeds[0]  = 12.0f;
+    speeds[49] = 8.0f;
+    fill(history, 100, speeds);
+
+    const Points points = run(history, Downsample::Lttb, 10);
+    REQUIRE(points.size() <= 10);
+    REQUIRE(points.size() >= 3);
+    requireTimeOrder(points);
+    CHECK(points.front().uptimeMs == 100'000);
+    CHECK(points.front().value == 12.0f);
+    CHECK(points.back().uptimeMs == 149'000);
+    CHECK(points.back().value == 8.0f);
+    const auto peak = std::find_if(points.begin(), points.end(), [](const auto& p) { return p.uptimeMs == 123'000; });
+    REQUIRE(peak != points.end());
+    CHECK(peak->value == 40.0f);
+}
+
+TEST_CASE("MinMax gives the exact envelope of each bucket in time order", "[history]")
+{
+    // Distinct whole values, so each bucket has one min and one max
+    TelemetryHistory   history;
+    std::vector<float> speeds;
+    for (int i = 0; i < 50; ++i)
+    {
+        speeds.push_back(static_cast<float>(i * 7 % 50));
+    }
+    fill(history, 0, speeds);
+
+    Points expected;
+    for (std::size_t b = 0; b < 5; ++b)
+    {
+        const auto first = speeds.begin() + static_cast<long>(b * 10);
+        const auto low   = std::min_element(first, first + 10);
+        const auto high  = std::max_element(first, first + 10);
+        for (const auto it : {std::min(low, high), std::max(low, high)})
+        {
+            expected.push_back({static_cast<uint32_t>(it - speeds.begin()) * 1000, *it});
+        }
+    }
+
+    const Points points = run(history, Downsample::MinMax, 10);
+    requireTimeOrder(points);
+    REQUIRE(points.size() == expected.size());
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        CHECK(points[i].uptimeMs == expected[i].uptimeMs);
+        CHECK(points[i].value == expected[i].value);
+    }
+}
+
+TEST_CASE("Periods without telemetry read as missing", "[history]")
+{
+    TelemetryHistory   history;
+    std::vector<float> speeds(20, 15.0f);
+    std::fill(speeds.begin() + 10, speeds.begin() + 15, kGap);
+    fill(history, 0, speeds);
+
+    const Points raw = run(history, Downsample::Raw, 0);
+    REQUIRE(raw.size() == 15);
+    for (const auto& point : raw)
+    {
+        CHECK((point.uptimeMs < 10'000 || point.uptimeMs >= 15'000));
+    }
+
+    run(history, Downsample::Raw, 0, 10'000, 14'000, ESP_ERR_NOT_FOUND);
+    run(history, Downsample::MinMax, 2, 10'000, 14'000, ESP_ERR_NOT_FOUND);
+    run(history, Downsample::Lttb, 3, 10'000, 14'000, ESP_ERR_NOT_FOUND);
+
+    // LTTB anchors on stored samples, not on the edges of the range
+    const Points lttb = run(history, Downsample::Lttb, 3, 5'000, 19'000);
+    REQUIRE(lttb.size() == 3);
+    CHECK(lttb.front().uptimeMs == 5'000);
+    CHECK(lttb.back().uptimeMs == 19'000);
+    for (const auto& point : lttb)
+    {
+        CHECK((point.uptimeMs < 10'000 || point.uptimeMs >= 15'000));
+    }
+}
+
+TEST_CASE("Query ranges are clamped to what is stored", "[history]")
+{
+    TelemetryHistory history;
+    fill(history, 100, std::vector<float>(50, 20.0f));
+
+    TelemetryHistory::Query      query;
+    TelemetryHistory::QueryStats stats;
+    Points                       out;
+    query.mode = Downsample::Raw;
+    REQUIRE(history.query(query, &collect, &out, &stats) == ESP_OK);
+    CHECK(stats.fromMs == 100'000);
+    CHECK(stats.toMs == 149'000);
+    CHECK(out.size() == 50);
+
+    // Partial periods round down to the period they fall in
+    out.clear();
+    query.fromMs = 120'500;
+    query.toMs   = 130'999;
+    REQUIRE(history.query(query, &collect, &out, &stats) == ESP_OK);
+    CHECK(stats.fromMs == 120'000);
+    CHECK(stats.toMs == 130'000);
+    CHECK(out.size() == 11);
+    CHECK(stats.points == 11);
+
+    query.fromMs = 150'000;
+    query.toMs   = UINT32_MAX;
+    CHECK(history.query(query, &collect, &out, &stats) == ESP_ERR_NOT_FOUND);
+    query.fromMs = 0;
+    query.toMs   = 99'999;
+    CHECK(history.query(query, &collect, &out, &stats) == ESP_ERR_NOT_FOUND);
+    query.fromMs = 140'000;
+    query.toMs   = 130'000;
+    CHECK(history.query(query, &collect, &out, &stats) == ESP_ERR_NOT_FOUND);
+}
+
+TEST_CASE("The ring keeps only the newest periods once it wraps", "[history]")
+{
+    TelemetryHistory   history;
+    std::vector<float> speeds;
+    for (int i = 0; i < 150; ++i)
+    {
+        speeds.push_back(static_cast<float>(i) * 0.5f);
+    }
+    fill(history, 0, speeds);
+
+    const Points raw = run(history, Downsample::Raw, 0);
+    REQUIRE(raw.size() == TelemetryHistory::kCapacity);
+    for (std::size_t i = 0; i < raw.size(); ++i)
+    {
+        CHECK(raw[i].uptimeMs == (90 + i) * 1000);
+        CHECK(raw[i].value == speeds[90 + i]);
+    }
+
+    // Overwritten periods are out of range, not stale data
+    run(history, Downsample::Raw, 0, 0, 89'999, ESP_ERR_NOT_FOUND);
+
+    const Points lttb = run(history, Downsample::Lttb, 12);
+    CHECK(lttb.front().uptimeMs == 90'000);
+    CHECK(lttb.back().uptimeMs == 149'000);
+    requireTimeOrder(lttb);
+}
@@ -0,0 +1,77 @@
+#include <catch2/catch.hpp>
+
+#include "host_clock.hh"
+#include "motor_replay.hh"
+#include "services/gps/track_simplifier.hh"
+#include "services/history/history.hh"
+#include "services/lte/lte.hh"
+#include "services/mem/mem.hh"
+#include "sim_modem.hh"
+#include "telemetry/motor/motor_controller.h"
+
+// Built with CONFIG_JARVIS_MEM_ACCOUNTING, so operator new counts every
+// allocation made inside a JARVIS_NO_ALLOC site once startup is sealed.
+static_assert(CONFIG_JARVIS_MEM_ACCOUNTING, "hot_path_alloc_test needs memory accounting");
+
+namespace
+{
+LteService::Config busyUplink()
+{
+    // Every frame is recorded and bundles seal every few samples, so the
+    // run crosses many seals and wraps the store
+    LteService::Config config;
+    config.sampleIntervalMs = 0;
+    config.bundleBytes      = 128;
+    config.storeBytes       = 4 * 1024;
+    return config;
+}
+} // namespace
+
+TEST_CASE("The telemetry path does not allocate once startup is sealed", "[mem]")
+{
+    const auto frames = recordRides(20'000, 6.5f);
+
+    // What app_main builds before the first frame
+    HttpStandIn      server;
+    SimulatedModem   link{server};
+    AtModemTransport modem{link, "http://stand-in/api/telemetry"};
+    LteService       uplink{modem, busyUplink()};
+    TelemetryHistory history;
+
+    MotorControllerConfig config;
+    config.logSnapshots = true;
+    MotorController motor(config);
+    motor.setTelemetryCallback([&](const TelemetryState& state, const char*) {
+        history.record(state);
+        uplink.record(state);
+    });
+
+    host_clock::set(1'000'000);
+    MemAccounting::sealStartup();
+    REQUIRE(MemAccounting::sealed());
+    const uint32_t before = MemAccounting::hotPath().allocations;
+
+    TrackPoint point;
+    for (std::size_t i = 0; i < frames.size(); ++i)
+    {
+        host_clock::advance(MotorSimulator::kFramePeriodUs);
+        motor.handleNotification(frames[i].bytes, frames[i].length);
+        if (i % 50 == 0)
+        {
+            point.timeMs = static_cast<uint32_t>(host_clock::now() / 1000);
+            point.latE7 += 120;
+            point.lonE7 -= 80;
+            uplink.record(point);
+        }
+    }
+
+    const LteService::Stats stats = uplink.stats();
+    CHECK(stats.samplesRecorded > 5'000);
+    CHECK(stats.trackPoints > 200);
+    CHECK(stats.bundlesQueued > 1'000);
+    CHECK(stats.bundlesEvicted > 0);
+
+    const MemAccounting::HotPathStats hot = MemAccounting::hotPath();
+    INFO("last hot-path allocation in " << (hot.lastSite != nullptr ? hot.lastSite : "-"));
+    CHECK(hot.allocations - before == 0);
+}
@@ -0,0 +1,275 @@
+#include <catch2/catch.hpp>
+
+#include <vector>
+
+#include "esp_rom_crc.h"
+#include "host_clock.hh"
+#include "services/gps/track_simplifier.hh"
+#include "services/lte/lte.hh"
+#include "sim_modem.hh"
+
+namespace
+{
+constexpr const char* kUrl = "http://stand-in/api/telemetry";
+
+uint32_t u32At(const std::vector<uint8_t>& bytes, std::size_t offset)
+{
+    return static_cast<uint32_t>(bytes[offset]) | (static_cast<uint32_t>(bytes[offset + 1]) << 8) |
+           (static_cast<uint32_t>(bytes[offset + 2]) << 16) | (static_cast<uint32_t>(bytes[offset + 3]) << 24);
+}
+
+struct BundleHeader
+{
+    bool     valid    = false;
+    uint8_t  fields   = 0;
+    uint32_t bootId   = 0;
+    uint32_t sequence = 0;
+    uint32_t baseMs   = 0;
+    uint16_t count    = 0;
+};
+
+BundleHeader parse(const std::vector<uint8_t>& bundle)
+{
+    BundleHeader header;
+    if (bundle.size() < TelemetryBundler::kHeaderSize + TelemetryBundler::kTrailerSize)
+    {
+        return header;
+    }
+    const std::size_t body = bundle.size() - TelemetryBundler::kTrailerSize;
+    header.valid    = bundle[0] == 'J' && bundle[1] == 'B' && esp_rom_crc32_le(0, bundle.data(), body) == u32At(bundle, body);
+    header.fields   = bundle[3];
+    header.bootId   = u32At(bundle, 4);
+    header.sequence = u32At(bundle, 8);
+    header.baseMs   = u32At(bundle, 12);
+    header.count    = static_cast<uint16_t>(bundle[16] | (bundle[17] << 8));
+    return header;
+}
+
+TelemetrySample sample(uint32_t uptimeMs)
+{
+    TelemetrySample sample;
+    sample.uptimeMs      = uptimeMs;
+    sample.rpm           = 300 + static_cast<int32_t>(uptimeMs / 1000 % 50);
+    sample.speedCentiKph = 2500;
+    sample.voltageDeciV  = 520;
+    sample.distanceM     = static_cast<int32_t>(uptimeMs / 200);
+    return sample;
+}
+
+/** Modem, stand-in server and service wired as on the device. */
+struct Rig
+{
+    explicit Rig(LteService::Config config = {}) : uplink(modem, config) {}
+
+    HttpStandIn      server;
+    SimulatedModem   link{server};
+    AtModemTransport modem{link, kUrl};
+    LteService       uplink;
+};
+
+LteService::Config manualConfig()
+{
+    // Only explicit ticks and uploads send anything
+    LteService::Config config;
+    config.uploadThresholdBytes = 1 << 20;
+    config.maxLatencyMs         = 60 * 60 * 1000;
+    config.maxBundleAgeMs       = 60 * 60 * 1000;
+    config.connectTimeoutMs     = 1000;
+    config.backoffInitialMs     = 1000;
+    config.backoffMaxMs         = 8000;
+    return config;
+}
+} // namespace
+
+TEST_CASE("Bundles reach the server through the simulated modem", "[lte]")
+{
+    LteService::Config config = manualConfig();
+    config.bundleBytes        = 128;
+    Rig rig(config);
+
+    for (uint32_t i = 0; i < 60; ++i)
+    {
+        rig.uplink.record(sample(i * 1000));
+    }
+    REQUIRE(rig.uplink.uploadNow() == ESP_OK);
+
+    CHECK(rig.server.url == kUrl);
+    REQUIRE(rig.server.bodies.size() > 1);
+    uint32_t samples = 0;
+    for (std::size_t i = 0; i < rig.server.bodies.size(); ++i)
+    {
+        const BundleHeader header = parse(rig.server.bodies[i]);
+        CHECK(header.valid);
+        CHECK(header.sequence == i);
+        samples += header.count;
+    }
+    CHECK(samples == 60);
+    CHECK(parse(rig.server.bodies.front()).baseMs == 0);
+
+    const LteService::Stats stats = rig.uplink.stats();
+    CHECK(stats.sessions == 1);
+    CHECK(stats.bundlesUploaded == rig.server.bodies.size());
+    CHECK(stats.queuedBytes == 0);
+    CHECK(stats.radioOnMs >= rig.link.radioOnMs()); // The session also counts the AT handshake
+    CHECK_FALSE(rig.link.radioOn());
+    CHECK(rig.link.attaches() == 1);
+}
+
+TEST_CASE("Track points go out in bundles of their own", "[lte]")
+{
+    Rig rig(manualConfig());
+    for (uint32_t i = 0; i < 5; ++i)
+    {
+        rig.uplink.record(sample(i * 1000));
+        TrackPoint point;
+        point.latE7     = 481371540 + static_cast<int32_t>(i) * 90;
+        point.lonE7     = 115761240 - static_cast<int32_t>(i) * 40;
+        point.timeMs    = i * 1000 + 500;
+        point.speedMmps = 6500;
+        rig.uplink.record(point);
+    }
+    REQUIRE(rig.uplink.uploadNow() == ESP_OK);
+    REQUIRE(rig.server.bodies.size() == 2);
+
+    const BundleHeader telemetry = parse(rig.server.bodies[0]);
+    const BundleHeader track     = parse(rig.server.bodies[1]);
+    CHECK(telemetry.valid);
+    CHECK(telemetry.fields == TelemetrySample::kFieldCount);
+    CHECK(telemetry.count == 5);
+    CHECK(track.valid);
+    CHECK(track.fields == TrackSample::kFieldCount);
+    CHECK(track.count == 5);
+    CHECK(track.baseMs == 500);
+    // Same boot, numbered per kind
+    CHECK(track.bootId == telemetry.bootId);
+    CHECK(track.sequence == 0);
+    // Small deltas: a point costs a few bytes, not 16
+    CHECK(rig.server.bodies[1].size() < TelemetryBundler::kHeaderSize + TelemetryBundler::kTrailerSize + 5 * 16 / 2);
+    CHECK(rig.uplink.stats().trackPoints == 5);
+}
+
+TEST_CASE("Samples closer than the interval are dropped", "[lte]")
+{
+    Rig rig(manualConfig());
+    rig.uplink.record(sample(0));
+    rig.uplink.record(sample(400));
+    rig.uplink.record(sample(999));
+    rig.uplink.record(sample(1000));
+    CHECK(rig.uplink.stats().samplesRecorded == 2);
+}
+
+TEST_CASE("The latency trigger runs from when the oldest bundle was opened", "[lte]")
+{
+    LteService::Config config = manualConfig();
+    config.maxLatencyMs       = 60 * 1000;
+    Rig rig(config);
+
+    rig.uplink.record(sample(0));
+    rig.uplink.flush();
+    rig.uplink.record(sample(5000));
+    rig.uplink.flush();
+
+    rig.uplink.tick(59000);
+    CHECK(rig.uplink.stats().sessions == 0);
+
+    // The first bundle goes out, the second is refused and stays at the head
+    rig.server.statuses = {200, 503};
+    rig.uplink.tick(60000);
+    REQUIRE(rig.uplink.stats().sessions == 1);
+    REQUIRE(rig.server.bodies.size() == 1);
+
+    // Backoff has passed, but the remaining bundle is 57 s old: nothing due
+    // until it turns 60 s, however late in the session it was left behind
+    rig.uplink.tick(62000);
+    CHECK(rig.uplink.stats().sessions == 1);
+    rig.uplink.tick(65000);
+    CHECK(rig.uplink.stats().sessions == 2);
+    REQUIRE(rig.server.bodies.size() == 2);
+    CHECK(parse(rig.server.bodies[1]).baseMs == 5000);
+}
+
+TEST_CASE("The size threshold starts a session", "[lte]")
+{
+    LteService::Config config   = manualConfig();
+    config.bundleBytes          = 128;
+    config.uploadThresholdBytes = 512;
+    Rig rig(config);
+
+    uint32_t nowMs = 0;
+    while (rig.uplink.stats().sessions == 0 && nowMs < 600 * 1000)
+    {
+        rig.uplink.record(sample(nowMs));
+        rig.uplink.tick(nowMs);
+        nowMs += 1000;
+    }
+    const LteService::Stats stats = rig.uplink.stats();
+    CHECK(stats.sessions == 1);
+    CHECK(stats.bytesUploaded >= 512);
+    CHECK(stats.queuedBytes == 0);
+}
+
+TEST_CASE("Failed sessions back off until coverage returns", "[lte]")
+{
+    LteService::Config config = manualConfig();
+    config.maxLatencyMs       = 0;
+    Rig rig(config);
+    rig.link.coverage = false;
+
+    rig.uplink.record(sample(0));
+    rig.uplink.flush();
+
+    rig.uplink.tick(1000);
+    CHECK(rig.uplink.stats().failedSessions == 1);
+    CHECK_FALSE(rig.link.radioOn());
+
+    // First retry is 1 s +/-25 %
+    rig.uplink.tick(1700);
+    CHECK(rig.uplink.stats().sessions == 1);
+
+    rig.link.coverage = true;
+    rig.uplink.tick(2300);
+    const LteService::Stats stats = rig.uplink.stats();
+    CHECK(stats.sessions == 2);
+    CHECK(stats.failedSessions == 1);
+    CHECK(stats.bundlesUploaded == 1);
+    CHECK(rig.server.bodies.size() == 1);
+}
+
+TEST_CASE("A full store keeps the newest bundles", "[lte]")
+{
+    LteService::Config config = manualConfig();
+    config.storeBytes         = 1024;
+    config.bundleBytes        = 128;
+    Rig rig(config);
+
+    for (uint32_t i = 0; i < 600; ++i)
+    {
+        rig.uplink.record(sample(i * 1000));
+    }
+    rig.uplink.flush();
+    const LteService::Stats before = rig.uplink.stats();
+    REQUIRE(before.bundlesEvicted > 0);
+    CHECK(before.queuedBytes <= 1024);
+
+    REQUIRE(rig.uplink.uploadNow() == ESP_OK);
+    REQUIRE_FALSE(rig.server.bodies.empty());
+    const uint32_t lastSequence = before.bundlesQueued - 1;
+    CHECK(parse(rig.server.bodies.back()).sequence == lastSequence);
+    for (std::size_t i = 1; i < rig.server.bodies.size(); ++i)
+    {
+        CHECK(parse(rig.server.bodies[i]).sequence == parse(rig.server.bodies[i - 1]).sequence + 1);
+    }
+    CHECK(rig.server.bodies.size() + before.bundlesEvicted == before.bundlesQueued);
+}
+
+TEST_CASE("A silent modem fails the session without hanging", "[lte]")
+{
+    Rig rig(manualConfig());
+    rig.link.responsive = false;
+    rig.uplink.record(sample(0));
+
+    const int64_t startUs = host_clock::now();
+    CHECK(rig.uplink.uploadNow() != ESP_OK);
+    CHECK(host_clock::now() - startUs < 60 * 1000 * 1000);
+    CHECK(rig.uplink.stats().queuedBytes > 0);
+}
@@ -0,0 +1,114 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include "host_clock.hh"
+#include "motor_replay.hh"
+#include "reference_motor.hh"
+#include "telemetry/motor/motor_controller.h"
+
+namespace
+{
+constexpr float kRatio = 6.5f;
+
+MotorControllerConfig rideConfig()
+{
+    MotorControllerConfig config;
+    config.reductionRatio = kRatio;
+    return config;
+}
+
+void requireSame(const TelemetryState& a, const TelemetryState& b)
+{
+    REQUIRE(a.data.rpm == b.data.rpm);
+    REQUIRE(a.data.gear == b.data.gear);
+    REQUIRE(a.data.throttle == b.data.throttle);
+    REQUIRE(a.data.speedKph == b.data.speedKph);
+    REQUIRE(a.data.voltage == b.data.voltage);
+    REQUIRE(a.data.powerKw == b.data.powerKw);
+    REQUIRE(a.data.controllerC == b.data.controllerC);
+    REQUIRE(a.data.motorC == b.data.motorC);
+    REQUIRE(a.iqAmps == b.iqAmps);
+    REQUIRE(a.idAmps == b.idAmps);
+    REQUIRE(a.distanceKm == b.distanceKm);
+}
+
+struct MaxError
+{
+    double value = 0;
+    void   add(double a, double b) { value = std::max(value, std::fabs(a - b)); }
+};
+} // namespace
+
+TEMPLATE_TEST_CASE("The protocol policy decodes exactly like the hand-written decoder", "[motor]", FloatNumeric,
+                   FixedNumeric<16>)
+{
+    const auto frames = recordRides(20'000, kRatio);
+
+    BasicMotorController<FarDriverProtocol, TestType> policy(rideConfig());
+    HandWrittenDecoder<TestType>                      hand(rideConfig());
+    for (const auto& frame : frames)
+    {
+        host_clock::advance(MotorSimulator::kFramePeriodUs);
+        policy.handleNotification(frame.bytes, frame.length);
+        hand.handleNotification(frame.bytes, frame.length);
+        requireSame(policy.telemetry(), hand.telemetry());
+    }
+    CHECK(policy.telemetry().distanceKm > 0.5f);
+}
+
+TEST_CASE("Fixed point tracks float on replayed rides", "[motor]")
+{
+    const auto frames = recordRides(100'000, kRatio);
+
+    BasicMotorController<FarDriverProtocol, FloatNumeric>     floating(rideConfig());
+    BasicMotorController<FarDriverProtocol, FixedNumeric<16>> fixed(rideConfig());
+    MaxError                                                  speed, voltage, power, current, distance;
+    for (const auto& frame : frames)
+    {
+        host_clock::advance(MotorSimulator::kFramePeriodUs);
+        floating.handleNotification(frame.bytes, frame.length);
+        fixed.handleNotification(frame.bytes, frame.length);
+
+        const TelemetryState& f = floating.telemetry();
+        const TelemetryState& x = fixed.telemetry();
+        speed.add(f.data.speedKph, x.data.speedKph);
+        voltage.add(f.data.voltage, x.data.voltage);
+        power.add(f.data.powerKw, x.data.powerKw);
+        current.add(f.iqAmps, x.iqAmps);
+        current.add(f.idAmps, x.idAmps);
+        distance.add(f.distanceKm, x.distanceKm);
+    }
+
+    INFO("ride " << floating.telemetry().distanceKm << " km");
+    CHECK(floating.telemetry().distanceKm > 5.0f);
+    CHECK(speed.value < 0.001);    // km/h
+    CHECK(voltage.value < 0.001);  // V
+    CHECK(power.value < 0.001);    // kW, i.e. 1 W
+    CHECK(current.value < 0.0001); // A
+    CHECK(distance.value < 0.0001); // km, i.e. 10 cm
+}
+
+TEST_CASE("The float policy agrees with the original float decoder", "[motor]")
+{
+    const auto frames = recordRides(100'000, kRatio);
+
+    BasicMotorController<FarDriverProtocol, FloatNumeric> policy(rideConfig());
+    LegacyFloatDecoder                                    legacy(rideConfig());
+    MaxError                                              speed, power, distance;
+    for (const auto& frame : frames)
+    {
+        host_clock::advance(MotorSimulator::kFramePeriodUs);
+        policy.handleNotification(frame.bytes, frame.length);
+        legacy.handleNotification(frame.bytes, frame.length);
+        speed.add(policy.telemetry().data.speedKph, legacy.telemetry().data.speedKph);
+        power.add(policy.telemetry().data.powerKw, legacy.telemetry().data.powerKw);
+        distance.add(policy.telemetry().distanceKm, legacy.telemetry().distanceKm);
+    }
+
+    // Same quantities, different rounding order
+    CHECK(speed.value < 0.001);
+    CHECK(power.value < 0.001);
+    CHECK(distance.value < 0.001);
+}
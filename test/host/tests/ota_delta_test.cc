@@ -0,0 +1,185 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "host_ota.hh"
+#include "host_partition.hh"
+#include "rom/miniz.h"
+#include "services/ota/ota_delta.hh"
+
+// old.bin, new.bin and update.jdelta come from data/make_ota_images.py and
+// tools/ota_delta.py at build time
+
+namespace
+{
+constexpr std::size_t kSlotSize        = 256 * 1024;
+constexpr std::size_t kElfDigestOffset = 24 + 8 + 144; ///< app_elf_sha256 in an app image
+constexpr std::size_t kNewDigestOffset = 48;           ///< SHA-256 of the new image in the patch header
+
+std::vector<uint8_t> load(const char* name)
+{
+    std::ifstream in(std::string(JARVIS_HOST_OTA_DIR "/") + name, std::ios::binary);
+    return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+}
+
+struct Images
+{
+    std::vector<uint8_t> base  = load("old.bin");
+    std::vector<uint8_t> next  = load("new.bin");
+    std::vector<uint8_t> patch = load("update.jdelta");
+};
+
+const Images& images()
+{
+    static const Images loaded;
+    return loaded;
+}
+
+/** Flashes the base image into the running slot and empties the other one. */
+void install(const std::vector<uint8_t>& base)
+{
+    host_partition::create("ota_0", kSlotSize);
+    host_partition::create("ota_1", kSlotSize);
+    std::copy(base.begin(), base.end(), host_partition::contents("ota_0").begin());
+    host_ota::setAppElfSha256(base.data() + kElfDigestOffset);
+    host_ota::reset();
+}
+
+/** Streams @p patch in @p chunk sized writes; the first error ends it. */
+esp_err_t feed(OtaDeltaPatcher& patcher, const std::vector<uint8_t>& patch, std::size_t chunk)
+{
+    esp_err_t err = patcher.begin(patch.size());
+    for (std::size_t offset = 0; err == ESP_OK && offset < patch.size(); offset += chunk)
+    {
+        err = patcher.write(patch.data() + offset, std::min(chunk, patch.size() - offset));
+    }
+    return err;
+}
+} // namespace
+
+TEST_CASE("A patch from tools/ota_delta.py rebuilds the new image byte for byte", "[ota]")
+{
+    const Images& data = images();
+    REQUIRE(data.base.size() > OtaDeltaPatcher::kHeaderBytes);
+    REQUIRE(data.next.size() > TINFL_LZ_DICT_SIZE); // the inflate window wraps
+    REQUIRE(data.patch.size() < data.next.size() / 10);
+
+    const std::size_t chunk = GENERATE(std::size_t{1}, std::size_t{13}, std::size_t{1460}, std::size_t{65536});
+    CAPTURE(chunk);
+    install(data.base);
+
+    OtaUpdater      updater;
+    OtaDeltaPatcher patcher(updater);
+    REQUIRE(feed(patcher, data.patch, chunk) == ESP_OK);
+    OtaUpdater::Result result;
+    REQUIRE(patcher.finish(result) == ESP_OK);
+
+    CHECK(result.bytes == data.next.size());
+    CHECK(std::equal(result.sha256.begin(), result.sha256.end(), data.patch.begin() + kNewDigestOffset));
+    const std::vector<uint8_t>& slot = host_partition::contents("ota_1");
+    CHECK(std::equal(data.next.begin(), data.next.end(), slot.begin()));
+    CHECK(host_ota::bootLabel() == "ota_1");
+    CHECK_FALSE(updater.active());
+}
+
+TEST_CASE("Patch headers are checked before the update starts", "[ota]")
+{
+    const Images& data = images();
+    install(data.base);
+    OtaUpdater      updater;
+    OtaDeltaPatcher patcher(updater);
+
+    SECTION("A patch no longer than its header is refused")
+    {
+        CHECK(patcher.begin(OtaDeltaPatcher::kHeaderBytes) == ESP_ERR_INVALID_SIZE);
+    }
+
+    SECTION("Wrong magic")
+    {
+        std::vector<uint8_t> patch = data.patch;
+        patch[0] ^= 0xFF;
+        CHECK(feed(patcher, patch, 4096) == ESP_ERR_INVALID_ARG);
+    }
+
+    SECTION("Unknown version")
+    {
+        std::vector<uint8_t> patch = data.patch;
+        patch[4]                   = OtaDeltaPatcher::kVersion + 1;
+        CHECK(feed(patcher, patch, 4096) == ESP_ERR_INVALID_ARG);
+    }
+
+    SECTION("A header split across writes still parses")
+    {
+        REQUIRE(patcher.begin(data.patch.size()) == ESP_OK);
+        REQUIRE(patcher.write(data.patch.data(), 10) == ESP_OK);
+        CHECK_FALSE(updater.active());
+        REQUIRE(patcher.write(data.patch.data() + 10, OtaDeltaPatcher::kHeaderBytes - 10) == ESP_OK);
+        CHECK(updater.active());
+        patcher.abort();
+    }
+
+    CHECK_FALSE(updater.active());
+    CHECK(host_ota::bootLabel().empty());
+}
+
+TEST_CASE("A patch made for another base image is refused", "[ota]")
+{
+    const Images& data = images();
+    install(data.base);
+
+    SECTION("Different ELF digest")
+    {
+        uint8_t other[32]{};
+        host_ota::setAppElfSha256(other);
+    }
+
+    SECTION("Base larger than the running slot")
+    {
+        host_partition::create("ota_0", data.base.size() / 2);
+    }
+
+    OtaUpdater      updater;
+    OtaDeltaPatcher patcher(updater);
+    CHECK(feed(patcher, data.patch, 4096) == ESP_ERR_INVALID_VERSION);
+    CHECK_FALSE(updater.active());
+    CHECK(host_ota::bootLabel().empty());
+}
+
+TEST_CASE("Corrupt or truncated patches never reach the boot slot", "[ota]")
+{
+    const Images& data = images();
+    install(data.base);
+    OtaUpdater           updater;
+    OtaDeltaPatcher      patcher(updater);
+    std::vector<uint8_t> patch = data.patch;
+
+    SECTION("A broken deflate stream is caught while inflating")
+    {
+        // Block type 3 is reserved
+        patch[OtaDeltaPatcher::kHeaderBytes] |= 0x06;
+        CHECK(feed(patcher, patch, 1460) == ESP_ERR_INVALID_CRC);
+        patcher.abort();
+    }
+
+    SECTION("An image that does not match its digest is discarded")
+    {
+        patch[kNewDigestOffset] ^= 0x01;
+        REQUIRE(feed(patcher, patch, 1460) == ESP_OK);
+        OtaUpdater::Result result;
+        CHECK(patcher.finish(result) == ESP_ERR_INVALID_CRC);
+    }
+
+    SECTION("A truncated patch is incomplete")
+    {
+        REQUIRE(patcher.begin(patch.size()) == ESP_OK);
+        REQUIRE(patcher.write(patch.data(), patch.size() - 16) == ESP_OK);
+        OtaUpdater::Result result;
+        CHECK(patcher.finish(result) == ESP_ERR_INVALID_SIZE);
+    }
+
+    CHECK_FALSE(updater.active());
+    CHECK(host_ota::bootLabel().empty());
+}
@@ -0,0 +1,125 @@
+#include <catch2/catch.hpp>
+
+#include "host_clock.hh"
+#include "host_nvs.hh"
+#include "services/ride/ride.hh"
+#include "telemetry/motor/motor_controller.h"
+
+namespace
+{
+RideService::Config shortStops()
+{
+    RideService::Config config;
+    config.stopAfterMs = 5000;
+    return config;
+}
+
+/** Half a minute at 20 km/h, then standing past the stop timeout. */
+void ride(RideService& rides)
+{
+    TelemetryState state;
+    state.data.speedKph = 20.0f;
+    state.data.powerKw  = 0.25f;
+    for (int second = 0; second < 30; ++second)
+    {
+        host_clock::advance(1'000'000);
+        state.distanceKm += 0.0055f;
+        rides.update(state);
+    }
+    state.data.speedKph = 0.0f;
+    state.data.powerKw  = 0.0f;
+    for (int second = 0; second < 7; ++second)
+    {
+        host_clock::advance(1'000'000);
+        rides.update(state);
+    }
+}
+} // namespace
+
+TEST_CASE("Finished rides are offered for upload oldest first, once", "[ride]")
+{
+    host_nvs::erase();
+    host_clock::set(1'000'000);
+    RideService rides(shortStops());
+    REQUIRE(rides.start() == ESP_OK);
+    ride(rides);
+    ride(rides);
+    ride(rides);
+
+    RideSummary next;
+    REQUIRE(rides.nextToUpload(next));
+    CHECK(next.seq == 1);
+    CHECK(next.end == RideSummary::End::Stopped);
+    CHECK(next.distanceM > 100);
+
+    rides.markUploaded(next.seq);
+    REQUIRE(rides.nextToUpload(next));
+    CHECK(next.seq == 2);
+
+    rides.markUploaded(3);
+    CHECK_FALSE(rides.nextToUpload(next));
+
+    // A ride finished after the sync is the only one left
+    ride(rides);
+    REQUIRE(rides.nextToUpload(next));
+    CHECK(next.seq == 4);
+    rides.stop();
+}
+
+TEST_CASE("The upload mark is kept across a restart", "[ride]")
+{
+    host_nvs::erase();
+    host_clock::set(1'000'000);
+    {
+        RideService rides(shortStops());
+        REQUIRE(rides.start() == ESP_OK);
+        ride(rides);
+        ride(rides);
+        rides.markUploaded(1);
+        rides.stop();
+    }
+    host_nvs::reboot();
+
+    RideService rides(shortStops());
+    REQUIRE(rides.start() == ESP_OK);
+    RideSummary history[RideService::kHistory];
+    CHECK(rides.history(history, RideService::kHistory) == 2);
+
+    RideSummary next;
+    REQUIRE(rides.nextToUpload(next));
+    CHECK(next.seq == 2);
+    rides.markUploaded(next.seq);
+    CHECK_FALSE(rides.nextToUpload(next));
+    rides.stop();
+}
+
+TEST_CASE("A wrapped history reloads newest first", "[ride]")
+{
+    host_nvs::erase();
+    host_clock::set(1'000'000);
+    {
+        RideService rides(shortStops());
+        REQUIRE(rides.start() == ESP_OK);
+        for (std::size_t i = 0; i < RideService::kHistory + 2; ++i)
+        {
+            ride(rides);
+        }
+        rides.stop();
+    }
+    host_nvs::reboot();
+
+    RideService rides(shortStops());
+    REQUIRE(rides.start() == ESP_OK);
+    RideSummary history[RideService::kHistory];
+    REQUIRE(rides.history(history, RideService::kHistory) == RideService::kHistory);
+    for (std::size_t i = 0; i < RideService::kHistory; ++i)
+    {
+        CHECK(history[i].seq == RideService::kHistory + 2 - i);
+    }
+
+    // Numbering continues after the newest stored ride
+    ride(rides);
+    REQUIRE(rides.history(history, 1) == 1);
+    CHECK(history[0].seq == RideService::kHistory + 3);
+    rides.stop();
+}
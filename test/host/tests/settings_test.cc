@@ -0,0 +1,204 @@
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include "host_clock.hh"
+#include "host_nvs.hh"
+#include "services/config/config_store.hh"
+#include "telemetry/motor/motor_controller.h"
+
+namespace
+{
+ConfigStore::Config quickCommits()
+{
+    ConfigStore::Config config;
+    config.debounceMs = 2000;
+    config.maxDelayMs = 10000;
+    return config;
+}
+
+esp_err_t post(ConfigStore& store, const char* json, const char** invalid = nullptr)
+{
+    return store.updateFromJson(json, std::strlen(json), invalid);
+}
+
+/** An index 0 frame: motion at @p rpm. */
+void motionFrame(uint8_t (&frame)[FarDriverProtocol::kFrameLength], uint16_t rpm)
+{
+    std::memset(frame, 0, sizeof(frame));
+    frame[0] = FarDriverProtocol::kHeader;
+    frame[1] = 0;
+    frame[6] = static_cast<uint8_t>(rpm & 0xFF);
+    frame[7] = static_cast<uint8_t>(rpm >> 8);
+}
+
+void onMotorSettings(void* context, const Settings& settings, uint32_t)
+{
+    static_cast<MotorController*>(context)->setConfig(settings.motorConfig());
+}
+
+struct Fresh
+{
+    Fresh()
+    {
+        host_nvs::erase();
+        host_nvs::reboot();
+        host_nvs::resetCounters();
+    }
+};
+} // namespace
+
+TEST_CASE("Settings persist to NVS once updates go quiet", "[settings]")
+{
+    Fresh          fresh;
+    NvsConfigBackend backend;
+    {
+        ConfigStore store(backend, quickCommits());
+        REQUIRE(store.load() == ESP_OK);
+        CHECK(store.snapshot().wheelCircumferenceM == Approx(2.1f));
+
+        // A slider dragged for a second: many updates, one commit
+        for (int step = 0; step < 20; ++step)
+        {
+            const std::string json = "{\"wheelCircumferenceM\": " + std::to_string(2.0 + step * 0.01) + "}";
+            REQUIRE(post(store, json.c_str()) == ESP_OK);
+            host_clock::advance(50'000);
+        }
+        CHECK(host_nvs::commits() == 0);
+        host_clock::advance(2'000'000);
+        CHECK(host_nvs::commits() == 1);
+        CHECK(host_nvs::writes() == 1);
+        CHECK(store.stats().updates == 20);
+    }
+
+    host_nvs::reboot();
+    NvsConfigBackend rebooted;
+    ConfigStore      store(rebooted, quickCommits());
+    REQUIRE(store.load() == ESP_OK);
+    CHECK(store.snapshot().wheelCircumferenceM == Approx(2.19f));
+}
+
+TEST_CASE("Continuous changes still commit by the latest deadline", "[settings]")
+{
+    Fresh            fresh;
+    NvsConfigBackend backend;
+    ConfigStore      store(backend, quickCommits());
+    REQUIRE(store.load() == ESP_OK);
+
+    for (int step = 0; step < 30 && host_nvs::commits() == 0; ++step)
+    {
+        const std::string json = "{\"apChannel\": " + std::to_string(1 + step % 13) + "}";
+        REQUIRE(post(store, json.c_str()) == ESP_OK);
+        host_clock::advance(1'000'000);
+    }
+    CHECK(host_nvs::commits() == 1);
+}
+
+TEST_CASE("An invalid update changes nothing", "[settings]")
+{
+    Fresh            fresh;
+    NvsConfigBackend backend;
+    ConfigStore      store(backend, quickCommits());
+    REQUIRE(store.load() == ESP_OK);
+
+    const char* invalid = nullptr;
+    CHECK(post(store, R"({"wheelCircumferenceM": 3.0, "apChannel": 20})", &invalid) == ESP_ERR_INVALID_ARG);
+    CHECK(std::string(invalid) == "apChannel");
+    CHECK(post(store, R"({"apPassword": "short"})", &invalid) == ESP_ERR_INVALID_ARG);
+    CHECK(post(store, R"({"nope": 1})", &invalid) == ESP_ERR_INVALID_ARG);
+    CHECK(store.snapshot().wheelCircumferenceM == Approx(2.1f));
+    CHECK(store.stats().updates == 0);
+
+    // Secrets are accepted but never reported back
+    REQUIRE(post(store, R"({"apPassword": "longenough"})") == ESP_OK);
+    CHECK(store.toJson().find("longenough") == std::string::npos);
+}
+
+TEST_CASE("A failed commit keeps the changes and retries", "[settings]")
+{
+    Fresh            fresh;
+    NvsConfigBackend backend;
+    ConfigStore      store(backend, quickCommits());
+    REQUIRE(store.load() == ESP_OK);
+
+    host_nvs::failCommits(1);
+    REQUIRE(post(store, R"({"reductionRatio": 6.5})") == ESP_OK);
+    host_clock::advance(2'000'000);
+    CHECK(store.stats().commitErrors == 1);
+    host_clock::advance(2'000'000);
+    CHECK(store.stats().commits == 1);
+
+    host_nvs::reboot();
+    NvsConfigBackend rebooted;
+    ConfigStore      reloaded(rebooted, quickCommits());
+    REQUIRE(reloaded.load() == ESP_OK);
+    CHECK(reloaded.snapshot().reductionRatio == Approx(6.5f));
+}
+
+TEST_CASE("Motor settings reach the controller without a reboot", "[settings]")
+{
+    Fresh            fresh;
+    NvsConfigBackend backend;
+    ConfigStore      store(backend, quickCommits());
+    REQUIRE(store.load() == ESP_OK);
+
+    MotorController motor(store.snapshot().motorConfig());
+    REQUIRE(store.subscribe(kConfigGroupMotor, &onMotorSettings, &motor) == ESP_OK);
+
+    uint8_t frame[FarDriverProtocol::kFrameLength];
+    motionFrame(frame, 600);
+    motor.handleNotification(frame, sizeof(frame));
+    CHECK(motor.telemetry().data.speedKph == Approx(600 * 2.1 * 3.6 / 60).epsilon(0.01));
+
+    REQUIRE(post(store, R"({"wheelCircumferenceM": 2.5, "reductionRatio": 2.0})") == ESP_OK);
+    motor.handleNotification(frame, sizeof(frame));
+    CHECK(motor.config().wheelCircumferenceMeters == Approx(2.5f));
+    CHECK(motor.telemetry().data.speedKph == Approx(600 * 2.5 * 3.6 / 60 / 2).epsilon(0.01));
+
+    // A SoftAP change is not the motor's business
+    REQUIRE(post(store, R"({"apChannel": 6})") == ESP_OK);
+    CHECK(motor.config().reductionRatio == Approx(2.0f));
+}
+
+TEST_CASE("Settings changes while frames decode never mix two configurations", "[settings]")
+{
+    MotorController motor;
+    uint8_t         frame[FarDriverProtocol::kFrameLength];
+    motionFrame(frame, 300);
+
+    // Either wheel at ratio 1, or both doubled: the speed is the same
+    // unless a frame sees one value of one and one of the other. Build with
+    // -fsanitize=thread to have the race itself reported.
+    MotorController::Config small;
+    small.wheelCircumferenceMeters = 2.0f;
+    small.reductionRatio           = 1.0f;
+    MotorController::Config large;
+    large.wheelCircumferenceMeters = 4.0f;
+    large.reductionRatio           = 2.0f;
+    const double expected          = 300 * 2.0 * 3.6 / 60;
+    motor.setConfig(small);
+
+    std::atomic<bool> done{false};
+    std::thread       writer([&] {
+        for (int i = 0; !done; ++i)
+        {
+            motor.setConfig(i % 2 == 0 ? large : small);
+        }
+    });
+
+    int mixed = 0;
+    for (int i = 0; i < 200'000; ++i)
+    {
+        motor.handleNotification(frame, sizeof(frame));
+        if (std::abs(motor.telemetry().data.speedKph - expected) > expected * 0.01)
+        {
+            ++mixed;
+        }
+    }
+    done = true;
+    writer.join();
+    CHECK(mixed == 0);
+}
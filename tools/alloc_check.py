@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""Fails when a hot path allocated after boot or a static pool overflowed.
+
+Plays a simulator run (firmware built with CONFIG_JARVIS_SIMULATOR and
+CONFIG_JARVIS_MEM_ACCOUNTING) while polling /api/status, so telemetry
+decode, publishing and the HTTP server all run, then reads /api/mem and
+prints heap use per subsystem. Exits 1 if any allocation happened inside a
+JARVIS_NO_ALLOC scope since boot finished or any subsystem outgrew its
+static pool, 2 if the firmware has no accounting. Without a device,
+test/host's hot_path_alloc_test runs the same check on decode, publish and
+the LTE uplink.
+
+Usage:
+    tools/alloc_check.py [--host 192.168.4.1] [--profile sprint] [--rate 10]
+                         [--seconds 20]
+"""
+
+import argparse
+import http.client
+import json
+import sys
+import threading
+import time
+import urllib.parse
+
+
+def request(host, method, path):
+    conn = http.client.HTTPConnection(host, timeout=10)
+    conn.request(method, path)
+    response = conn.getresponse()
+    body = response.read()
+    if response.status != 200:
+        raise RuntimeError(f"{method} {path}: HTTP {response.status} {body.decode(errors='replace')}")
+    return json.loads(body)
+
+
+def poll_status(host, stop):
+    conn = http.client.HTTPConnection(host, timeout=10)
+    while not stop.is_set():
+        try:
+            conn.request("GET", "/api/status")
+            conn.getresponse().read()
+        except (OSError, http.client.HTTPException):
+            conn.close()
+            conn = http.client.HTTPConnection(host, timeout=10)
+
+
+def print_tags(tags):
+    print(f"{'subsystem':<10} {'live B':>8} {'peak B':>8} {'blocks':>6} {'allocs':>8} {'pool B':>7} {'min free':>8} {'over':>5}")
+    for tag in tags:
+        pool = f"{tag['poolBytes']:7d}" if tag["poolBytes"] else f"{'-':>7}"
+        low = f"{tag['poolMinFree']:8d}" if tag["poolBytes"] else f"{'-':>8}"
+        print(
+            f"{tag['tag']:<10} {tag['liveBytes']:8d} {tag['peakBytes']:8d} {tag['liveBlocks']:6d} "
+            f"{tag['allocations']:8d} {pool} {low} {tag['overflows']:5d}"
+        )
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--host", default="192.168.4.1")
+    parser.add_argument("--profile", default="sprint", choices=["idle", "commute", "hill", "sprint"])
+    parser.add_argument("--rate", type=float, default=10.0, help="playback speed, 1-10x the controller's frame rate")
+    parser.add_argument("--seconds", type=float, default=20.0)
+    parser.add_argument("--status-clients", type=int, default=2)
+    args = parser.parse_args()
+
+    query = urllib.parse.urlencode({"profile": args.profile, "rate": args.rate, "seconds": args.seconds})
+    stop = threading.Event()
+    clients = [
+        threading.Thread(target=poll_status, args=(args.host, stop), daemon=True) for _ in range(args.status_clients)
+    ]
+
+    try:
+        mem = request(args.host, "GET", "/api/mem")
+        if not mem["accounting"]:
+            print("firmware built without CONFIG_JARVIS_MEM_ACCOUNTING", file=sys.stderr)
+            return 2
+
+        # A run started at boot would refuse ours
+        request(args.host, "DELETE", "/api/sim")
+        stats = request(args.host, "POST", f"/api/sim?{query}")
+        for client in clients:
+            client.start()
+        while stats["running"]:
+            time.sleep(1.0)
+            stats = request(args.host, "GET", "/api/sim")
+        stop.set()
+        mem = request(args.host, "GET", "/api/mem")
+    except (OSError, RuntimeError) as err:
+        print(f"check failed: {err}", file=sys.stderr)
+        return 1
+    finally:
+        stop.set()
+
+    print(f"{stats['frames']['delivered']} frames at {stats['rate']:.1f}x, profile {stats['profile']}")
+    print(f"heap free {mem['heapFree']} B, lowest {mem['heapMinFree']} B")
+    print_tags(mem["tags"])
+
+    failed = False
+    if not mem["sealed"]:
+        print("FAIL: boot has not finished, hot paths are not checked yet")
+        failed = True
+    hot = mem["hotPath"]
+    if hot["allocations"]:
+        print(f"FAIL: {hot['allocations']} hot-path allocation(s), last in {hot['lastSite']} ({hot['lastTag']})")
+        failed = True
+    overflowed = [tag["tag"] for tag in mem["tags"] if tag["overflows"]]
+    if overflowed:
+        print(f"FAIL: pool overflow in {', '.join(overflowed)}")
+        failed = True
+    if not failed:
+        print("OK: no hot-path allocations" + (", all pools within budget" if mem["staticBudget"] else ""))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+"""Fetches /api/boot and draws the boot timeline as a text chart.
+
+One row per boot stage, placed on a shared time axis (milliseconds since
+boot), followed by the moment deferred stages were released and the first
+telemetry frame against its target. Overlapping bars are stages that ran in
+parallel.
+
+Usage:
+    tools/boot_timeline.py [--host 192.168.4.1] [--width 60]
+"""
+
+import argparse
+import http.client
+import json
+import sys
+
+
+def fetch(host):
+    conn = http.client.HTTPConnection(host, timeout=10)
+    conn.request("GET", "/api/boot")
+    response = conn.getresponse()
+    body = response.read()
+    if response.status != 200:
+        raise RuntimeError(f"GET /api/boot: HTTP {response.status} {body.decode(errors='replace')}")
+    return json.loads(body)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--host", default="192.168.4.1")
+    parser.add_argument("--width", type=int, default=60, help="chart width in characters")
+    args = parser.parse_args()
+
+    try:
+        boot = fetch(args.host)
+    except (OSError, RuntimeError) as err:
+        print(err, file=sys.stderr)
+        return 1
+
+    stages = boot["stages"]
+    end_us = max([boot["finishUs"], boot["telemetryUs"]] + [s["endUs"] for s in stages]) or 1
+    scale = args.width / end_us
+    name_width = max([len(s["name"]) for s in stages] + [9])
+
+    for stage in stages:
+        if stage["state"] in ("done", "failed"):
+            first = int(stage["startUs"] * scale)
+            last = max(int(stage["endUs"] * scale), first + 1)
+            bar = " " * first + ("#" if stage["state"] == "done" else "x") * (last - first)
+            timing = f"{stage['startUs'] / 1000:8.1f} +{(stage['endUs'] - stage['startUs']) / 1000:.1f} ms"
+        else:
+            bar = ""
+            timing = stage["state"]
+        print(f"{stage['name']:<{name_width}} |{bar:<{args.width}}| {timing} ({stage['kind']})")
+
+    print(f"{'':<{name_width}}  0{'':<{args.width - 1}}{end_us / 1000:.0f} ms")
+    print(f"run() at {boot['runStartUs'] / 1000:.1f} ms, deferred stages released at {boot['releaseUs'] / 1000:.1f} ms")
+    if boot["telemetryUs"]:
+        verdict = "met" if boot["targetMet"] else "MISSED"
+        print(f"first telemetry at {boot['telemetryUs'] / 1000:.1f} ms, target {boot['targetMs']} ms: {verdict}")
+    else:
+        print("no telemetry yet")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
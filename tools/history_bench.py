@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""Compares downsampled history queries against full-resolution transfer.
+
+Fetches the same series and time range from /api/history in each mode
+(raw, lttb, minmax) and reports what each costs and what it keeps: bytes
+on the wire, time to the last byte, points, the device's own query time,
+and how far the downsampled curve strays from the raw one. Fidelity is the
+worst and mean absolute error of the downsampled points, joined by straight
+lines, at every raw sample, and whether the raw minimum and maximum survive.
+
+Needs some history on the device: ride, or play a simulator run first
+(e.g. tools/sim_load.py --profile commute --seconds 600).
+
+Usage:
+    tools/history_bench.py [--host 192.168.4.1] [--series speed] [--points 300]
+                           [--seconds 3600] [--repeat 5]
+"""
+
+import argparse
+import bisect
+import http.client
+import json
+import statistics
+import sys
+import time
+import urllib.parse
+
+MODES = ("raw", "lttb", "minmax")
+
+
+def fetch(host, query):
+    """Returns (body, bytes received, seconds to the last byte)."""
+    conn = http.client.HTTPConnection(host, timeout=30)
+    try:
+        start = time.perf_counter()
+        conn.request("GET", f"/api/history?{urllib.parse.urlencode(query)}")
+        response = conn.getresponse()
+        raw = response.read()
+        elapsed = time.perf_counter() - start
+    finally:
+        conn.close()
+    if response.status != 200:
+        raise RuntimeError(f"HTTP {response.status} {raw.decode(errors='replace')}")
+    return json.loads(raw), len(raw), elapsed
+
+
+def interpolate(points, t):
+    times = [p[0] for p in points]
+    i = bisect.bisect_left(times, t)
+    if i < len(points) and times[i] == t:
+        return points[i][1]
+    if i == 0:
+        return points[0][1]
+    if i == len(points):
+        return points[-1][1]
+    (t0, v0), (t1, v1) = points[i - 1], points[i]
+    return v0 + (v1 - v0) * (t - t0) / (t1 - t0)
+
+
+def fidelity(raw, sampled):
+    if not raw or not sampled:
+        return None
+    errors = [abs(interpolate(sampled, t) - v) for t, v in raw]
+    values = [v for _, v in sampled]
+    low = min(v for _, v in raw)
+    high = max(v for _, v in raw)
+    return {
+        "maxError": max(errors),
+        "meanError": statistics.fmean(errors),
+        "keepsMin": low in values,
+        "keepsMax": high in values,
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--host", default="192.168.4.1")
+    parser.add_argument(
+        "--series", default="speed", choices=["speed", "power", "voltage", "motorTemp", "controllerTemp"]
+    )
+    parser.add_argument("--points", type=int, default=300, help="target points, about the chart's width in pixels")
+    parser.add_argument("--seconds", type=int, default=3600, help="range, ending now")
+    parser.add_argument("--repeat", type=int, default=5, help="requests per mode; medians are reported")
+    args = parser.parse_args()
+
+    # Pin the range once so every mode and repeat sees the same samples
+    try:
+        probe, _, _ = fetch(args.host, {"series": args.series, "mode": "lttb", "points": 3, "seconds": args.seconds})
+    except (OSError, RuntimeError, ValueError) as err:
+        print(f"benchmark failed: {err}", file=sys.stderr)
+        return 1
+    if not probe["returned"]:
+        print("no history stored in that range yet", file=sys.stderr)
+        return 2
+
+    results = {}
+    for mode in MODES:
+        query = {
+            "series": args.series,
+            "mode": mode,
+            "points": args.points,
+            "from": probe["fromMs"],
+            "to": probe["toMs"],
+        }
+        runs = []
+        try:
+            for _ in range(args.repeat):
+                runs.append(fetch(args.host, query))
+        except (OSError, RuntimeError, ValueError) as err:
+            print(f"{mode}: {err}", file=sys.stderr)
+            return 1
+        body = runs[-1][0]
+        results[mode] = {
+            "points": body["points"],
+            "bytes": statistics.median(r[1] for r in runs),
+            "ms": statistics.median(r[2] for r in runs) * 1000.0,
+            "deviceUs": statistics.median(r[0]["elapsedUs"] for r in runs),
+            "scanned": body["scanned"],
+        }
+
+    raw = results["raw"]
+    span = (probe["toMs"] - probe["fromMs"]) / 1000.0
+    print(f"{args.series} over {span:.0f} s ({probe['unit']}), target {args.points} points, {args.repeat} run(s) each")
+    print(
+        f"{'mode':<7} {'points':>7} {'bytes':>9} {'x raw':>6} {'ms':>8} {'x raw':>6} {'device ms':>9} "
+        f"{'scanned':>8} {'max err':>8} {'mean err':>8} {'min/max kept':>12}"
+    )
+    for mode in MODES:
+        result = results[mode]
+        fit = fidelity(raw["points"], result["points"]) if mode != "raw" else None
+        kept = "-" if fit is None else f"{'yes' if fit['keepsMin'] else 'NO'}/{'yes' if fit['keepsMax'] else 'NO'}"
+        max_err = "-" if fit is None else f"{fit['maxError']:8.2f}"
+        mean_err = "-" if fit is None else f"{fit['meanError']:8.3f}"
+        print(
+            f"{mode:<7} {len(result['points']):7d} {result['bytes']:9.0f} {result['bytes'] / raw['bytes']:6.3f} "
+            f"{result['ms']:8.1f} {result['ms'] / raw['ms']:6.3f} {result['deviceUs'] / 1000.0:9.2f} "
+            f"{result['scanned']:8d} {max_err:>8} {mean_err:>8} {kept:>12}"
+        )
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
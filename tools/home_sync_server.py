@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+"""Stands in for the home sync endpoint and reports upload throughput.
+
+Accepts telemetry bundles POSTed by HomeSyncTransport (set
+CONFIG_JARVIS_HOME_SYNC_URL to http://<this host>:<port>/api/telemetry),
+checks each bundle's magic and CRC, and acknowledges it with 204. Sequence
+numbers are tracked per boot and bundle kind (telemetry or GPS track) so
+duplicates and gaps are visible.
+
+Ride summaries POSTed to /api/rides (CONFIG_JARVIS_HOME_SYNC_RIDES_URL) are
+decoded and printed, one line per ride; a ride seen twice is reported.
+
+Each keep-alive connection is one device session; when it closes, the
+server prints the bundles and bytes received, the time from the first to
+the last request and the resulting throughput. Join time is on the device
+side: GET /api/wifi reports "station.lastConnectMs".
+
+Usage:
+    tools/home_sync_server.py [--bind 0.0.0.0] [--port 8080] [--delay-ms 0]
+"""
+
+import argparse
+import http.server
+import struct
+import sys
+import time
+import zlib
+
+BUNDLE_MAGIC = 0x424A  # "JB"
+HEADER = struct.Struct("<HBBIIIH")
+TRACK_FIELDS = 4  # TrackSample (main/services/lte/bundle.hh); telemetry has 11
+# RideSummary (main/services/ride/ride.hh), 56 bytes
+RIDE = struct.Struct("<6IHhhBB4H8H")
+RIDE_ENDS = {0: "open", 1: "stopped", 2: "power_loss"}
+
+
+def parse_bundle(body):
+    """Returns (bootId, fields, sequence, samples), or None for a malformed bundle."""
+    if len(body) < HEADER.size + 4:
+        return None
+    magic, _version, fields, boot_id, sequence, _base_ms, count = HEADER.unpack_from(body)
+    (crc,) = struct.unpack_from("<I", body, len(body) - 4)
+    if magic != BUNDLE_MAGIC or zlib.crc32(body[:-4]) != crc:
+        return None
+    return boot_id, fields, sequence, count
+
+
+def parse_ride(body):
+    """Returns a one-line description of a ride record, or None if malformed."""
+    if len(body) != RIDE.size:
+        return None
+    fields = RIDE.unpack(body)
+    seq, duration_ms, moving_ms, distance_m, used_deci_wh, _regen, max_deci_kph = fields[:7]
+    version, end = fields[9], fields[10]
+    if version != 1 or seq == 0:
+        return None
+    return seq, (
+        f"ride #{seq}: {distance_m} m in {duration_ms // 1000} s ({moving_ms // 1000} s moving), "
+        f"{used_deci_wh / 10:.1f} Wh, max {max_deci_kph / 10:.1f} km/h, {RIDE_ENDS.get(end, end)}"
+    )
+
+
+class SyncHandler(http.server.BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"  # keep-alive, as the device expects
+
+    # Shared across connections
+    last_sequence = {}
+    rides_seen = set()
+    delay = 0.0
+
+    def setup(self):
+        super().setup()
+        self.bundles = 0
+        self.duplicates = 0
+        self.samples = 0
+        self.track_points = 0
+        self.bytes = 0
+        self.first = None
+        self.last = None
+
+    def finish(self):
+        super().finish()
+        if self.bundles == 0:
+            return
+        elapsed = max(self.last - self.first, 1e-6)
+        print(
+            f"{self.client_address[0]}: {self.bundles} bundle(s), {self.samples} sample(s), "
+            f"{self.track_points} track point(s), "
+            f"{self.bytes} B in {elapsed * 1000:.0f} ms = {self.bytes / elapsed / 1024:.1f} KiB/s"
+            + (f", {self.duplicates} duplicate(s)" if self.duplicates else "")
+        )
+
+    def do_POST(self):
+        now = time.perf_counter()
+        if self.first is None:
+            self.first = now
+
+        length = int(self.headers.get("Content-Length", 0))
+        body = self.rfile.read(length)
+        if self.path.startswith("/api/rides"):
+            self.handle_ride(body)
+            return
+        bundle = parse_bundle(body)
+        if bundle is None:
+            self.reply(400)
+            return
+
+        boot_id, fields, sequence, count = bundle
+        track = fields == TRACK_FIELDS
+        previous = SyncHandler.last_sequence.get((boot_id, track))
+        if previous is not None and sequence <= previous:
+            self.duplicates += 1
+        else:
+            if previous is not None and sequence != previous + 1:
+                kind = "track" if track else "telemetry"
+                print(f"boot {boot_id:08x} {kind}: gap {previous + 1}..{sequence - 1}", file=sys.stderr)
+            SyncHandler.last_sequence[(boot_id, track)] = sequence
+            if track:
+                self.track_points += count
+            else:
+                self.samples += count
+
+        if SyncHandler.delay:
+            time.sleep(SyncHandler.delay)
+        self.bundles += 1
+        self.bytes += length
+        self.last = time.perf_counter()
+        self.reply(204)
+
+    def handle_ride(self, body):
+        ride = parse_ride(body)
+        if ride is None:
+            self.reply(400)
+            return
+        seq, text = ride
+        duplicate = seq in SyncHandler.rides_seen
+        SyncHandler.rides_seen.add(seq)
+        print(f"{self.client_address[0]}: {text}" + (" (duplicate)" if duplicate else ""))
+        self.bytes += len(body)
+        self.last = time.perf_counter()
+        self.reply(204)
+
+    def reply(self, status):
+        self.send_response(status)
+        self.send_header("Content-Length", "0")
+        self.end_headers()
+
+    def log_message(self, *args):
+        pass
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--bind", default="0.0.0.0")
+    parser.add_argument("--port", type=int, default=8080)
+    parser.add_argument("--delay-ms", type=float, default=0.0, help="added per request, to model a slow server")
+    args = parser.parse_args()
+
+    SyncHandler.delay = args.delay_ms / 1000
+    server = http.server.ThreadingHTTPServer((args.bind, args.port), SyncHandler)
+    print(f"Listening on {args.bind}:{args.port}")
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
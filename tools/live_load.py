@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+"""Measures the live broadcast's CPU per tick as dashboard clients are added.
+
+For each client count, opens that many /api/live event streams, optionally
+plus one slow client that never reads, and samples /api/live/stats over the
+window. Reports the device's CPU time per tick (encode plus fan-out), the
+share spent per client, events each reader received and the frames the
+slow client skipped. With encode-once the per-tick cost should grow by the
+socket write per client only, not by a JSON encode per client.
+
+--sim plays a simulator run (CONFIG_JARVIS_SIMULATOR) across all steps so
+every tick has news; otherwise ride or feed telemetry some other way.
+Counts above CONFIG_JARVIS_LIVE_CLIENTS are refused by the device.
+
+Usage:
+    tools/live_load.py [--host 192.168.4.1] [--clients 1,4,10] [--seconds 20]
+                       [--slow] [--sim]
+"""
+
+import argparse
+import http.client
+import json
+import socket
+import sys
+import threading
+import time
+import urllib.parse
+
+
+def request(host, method, path):
+    conn = http.client.HTTPConnection(host, timeout=10)
+    conn.request(method, path)
+    response = conn.getresponse()
+    body = response.read()
+    if response.status != 200:
+        raise RuntimeError(f"{method} {path}: HTTP {response.status} {body.decode(errors='replace')}")
+    return json.loads(body)
+
+
+def open_stream(host, receive_buffer=None):
+    name, _, port = host.partition(":")
+    sock = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    if receive_buffer:
+        sock.setsockopt(socket.SOL_SOCKET, socket.SO_RCVBUF, receive_buffer)
+    sock.settimeout(10)
+    sock.connect((name, int(port or 80)))
+    sock.sendall(f"GET /api/live HTTP/1.1\r\nHost: {name}\r\nAccept: text/event-stream\r\n\r\n".encode())
+    return sock
+
+
+def read_stream(sock, stop, counts, index):
+    pending = b""
+    while not stop.is_set():
+        try:
+            data = sock.recv(4096)
+        except OSError:
+            break
+        if not data:
+            break
+        pending += data
+        # Each event starts a line with "data:", after its chunk header's
+        # CRLF; the kept tail is one byte short of a whole match
+        counts[index] += pending.count(b"\ndata:")
+        pending = pending[-5:]
+
+
+def measure(host, clients, seconds, slow):
+    stop = threading.Event()
+    counts = [0] * clients
+    sockets = []
+    threads = []
+    for i in range(clients):
+        sock = open_stream(host)
+        sockets.append(sock)
+        threads.append(threading.Thread(target=read_stream, args=(sock, stop, counts, i), daemon=True))
+    if slow:
+        # Connected but never read: the device must skip frames, not queue them
+        sockets.append(open_stream(host, receive_buffer=1024))
+    for thread in threads:
+        thread.start()
+
+    time.sleep(1.0)
+    before = request(host, "GET", "/api/live/stats")
+    counts_before = list(counts)
+    time.sleep(seconds)
+    after = request(host, "GET", "/api/live/stats")
+    counts_after = list(counts)
+
+    stop.set()
+    for sock in sockets:
+        sock.close()
+    for thread in threads:
+        thread.join(timeout=2)
+    time.sleep(1.0)  # let the device notice the closed streams
+
+    delta = {key: after[key] - before[key] for key in ("ticks", "encoded", "sent", "dropped", "evicted", "busyUs")}
+    delta["clients"] = after["clients"]
+    delta["eventsPerS"] = [(a - b) / seconds for a, b in zip(counts_after, counts_before)]
+    return delta
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--host", default="192.168.4.1")
+    parser.add_argument("--clients", default="1,4,10", help="comma-separated reader counts to measure")
+    parser.add_argument("--seconds", type=float, default=20.0, help="measurement window per count")
+    parser.add_argument("--slow", action="store_true", help="add one client that never reads")
+    parser.add_argument("--sim", action="store_true", help="play a simulator run for the whole measurement")
+    args = parser.parse_args()
+    steps = [int(count) for count in args.clients.split(",")]
+
+    try:
+        if args.sim:
+            total = len(steps) * (args.seconds + 3)
+            request(args.host, "DELETE", "/api/sim")
+            query = urllib.parse.urlencode({"profile": "commute", "rate": 1, "seconds": total})
+            request(args.host, "POST", f"/api/sim?{query}")
+
+        limit = request(args.host, "GET", "/api/live/stats")
+        print(f"device allows {limit['maxClients']} client(s) at {limit['hz']} Hz")
+        print(
+            f"{'readers':>7} {'slow':>4} {'ticks':>6} {'encoded':>7} {'sent':>7} {'dropped':>7} "
+            f"{'us/tick':>8} {'us/client':>9} {'cpu %':>6} {'events/s':>15}"
+        )
+        for clients in steps:
+            if clients + (1 if args.slow else 0) > limit["maxClients"]:
+                print(f"{clients:7d}: skipped, above the device's limit")
+                continue
+            result = measure(args.host, clients, args.seconds, args.slow)
+            ticks = max(result["ticks"], 1)
+            per_tick = result["busyUs"] / ticks
+            per_client = per_tick / max(result["clients"], 1)
+            rates = result["eventsPerS"]
+            events = f"{min(rates):.1f}-{max(rates):.1f}" if rates else "-"
+            print(
+                f"{clients:7d} {'yes' if args.slow else 'no':>4} {result['ticks']:6d} {result['encoded']:7d} "
+                f"{result['sent']:7d} {result['dropped']:7d} {per_tick:8.1f} {per_client:9.1f} "
+                f"{result['busyUs'] / (args.seconds * 1e4):6.2f} {events:>15}"
+            )
+    except (OSError, RuntimeError) as err:
+        print(f"measurement failed: {err}", file=sys.stderr)
+        return 1
+    finally:
+        if args.sim:
+            try:
+                request(args.host, "DELETE", "/api/sim")
+            except (OSError, RuntimeError):
+                pass
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
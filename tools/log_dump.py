@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+"""Fetches the device's deferred log from /api/log and prints it as text.
+
+Used when the firmware is built without CONFIG_JARVIS_DLOG_CONSOLE: the
+telemetry path then only records format IDs and raw arguments, and the
+strings are rendered here from the format table sent with the dump.
+Fetching consumes the records, so each line is printed once.
+
+Usage:
+    tools/log_dump.py [--host 192.168.4.1] [--follow]
+    tools/log_dump.py --file dump.bin
+"""
+
+import argparse
+import http.client
+import re
+import struct
+import sys
+import time
+
+MAGIC = 0x474F4C4A  # "JLOG"
+VERSION = 1
+HEADER = struct.Struct("<IHHIIII")
+FORMAT_ENTRY = struct.Struct("<HH")
+RECORD = struct.Struct("<IHBB")
+
+# Same conversions as DeferredLog::format(); floats travel as 32-bit floats.
+SPEC = re.compile(r"%%|%[-+ #0]*\d*(?:\.\d+)?([diuxXcfeEgG])")
+
+
+def render(fmt, words):
+    args = iter(words)
+
+    def convert(match):
+        if match.group(0) == "%%":
+            return "%"
+        word = next(args, 0)
+        conversion = match.group(1)
+        if conversion in "di":
+            value = struct.unpack("<i", struct.pack("<I", word))[0]
+        elif conversion in "feEgG":
+            value = struct.unpack("<f", struct.pack("<I", word))[0]
+        else:
+            value = word
+        return match.group(0) % value
+
+    return SPEC.sub(convert, fmt)
+
+
+def parse(data):
+    magic, version, format_count, now_us, written, dropped, suppressed = HEADER.unpack_from(data, 0)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError(f"not a version {VERSION} log dump")
+    offset = HEADER.size
+
+    formats = []
+    for _ in range(format_count):
+        _, length = FORMAT_ENTRY.unpack_from(data, offset)
+        offset += FORMAT_ENTRY.size
+        formats.append(data[offset : offset + length].decode())
+        offset += length
+
+    records = []
+    while offset + RECORD.size <= len(data):
+        timestamp_us, fmt, arg_count, skipped = RECORD.unpack_from(data, offset)
+        offset += RECORD.size
+        words = struct.unpack_from(f"<{arg_count}I", data, offset)
+        offset += 4 * arg_count
+        records.append((timestamp_us, fmt, words, skipped))
+
+    stats = {"now_us": now_us, "written": written, "dropped": dropped, "suppressed": suppressed}
+    return formats, records, stats
+
+
+def fetch(host, timeout):
+    conn = http.client.HTTPConnection(host, timeout=timeout)
+    conn.request("GET", "/api/log")
+    response = conn.getresponse()
+    body = response.read()
+    if response.status != 200:
+        raise RuntimeError(f"HTTP {response.status} {body.decode(errors='replace')}")
+    return body
+
+
+def print_dump(data):
+    formats, records, stats = parse(data)
+    for timestamp_us, fmt, words, skipped in records:
+        text = render(formats[fmt], words) if fmt < len(formats) else f"<unknown log format {fmt}>"
+        suffix = f" (+{skipped} suppressed)" if skipped else ""
+        print(f"{timestamp_us / 1e6:12.6f} {text}{suffix}")
+    return stats
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--host", default="192.168.4.1")
+    parser.add_argument("--file", help="read a saved dump instead of fetching one")
+    parser.add_argument("--follow", action="store_true", help="keep polling the device")
+    parser.add_argument("--interval", type=float, default=1.0, help="seconds between polls with --follow")
+    parser.add_argument("--timeout", type=float, default=10.0)
+    args = parser.parse_args()
+
+    if args.file:
+        with open(args.file, "rb") as f:
+            stats = print_dump(f.read())
+        print(f"# written {stats['written']}, dropped {stats['dropped']}, suppressed {stats['suppressed']}", file=sys.stderr)
+        return 0
+
+    dropped = None
+    while True:
+        try:
+            stats = print_dump(fetch(args.host, args.timeout))
+        except (OSError, RuntimeError, ValueError) as err:
+            print(f"log fetch failed: {err}", file=sys.stderr)
+            return 1
+        if dropped is not None and stats["dropped"] != dropped:
+            print(f"# ring overflowed: {stats['dropped'] - dropped} records lost", file=sys.stderr)
+        dropped = stats["dropped"]
+        if not args.follow:
+            return 0
+        time.sleep(args.interval)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
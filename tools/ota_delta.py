@@ -0,0 +1,286 @@
+#!/usr/bin/env python3
+"""Builds and applies binary delta patches between two app images.
+
+A patch turns the image running on the device (OLD) into a new one (NEW).
+It is a bsdiff-style command stream: each control record says "add the
+next N patch bytes to N bytes of OLD, then copy M literal bytes, then move
+the OLD cursor by S". Recompiled firmware mostly differs by shifted
+addresses, so the added bytes are mostly zero and the raw-deflated stream
+is a small fraction of a full image. The device inflates and applies it
+on the fly (see main/services/ota/ota_delta.hh for the format).
+
+Usage:
+    tools/ota_delta.py diff old.bin new.bin --out update.jdelta
+    tools/ota_delta.py apply old.bin update.jdelta --out check.bin
+
+`diff` prints the patch size and the time a host takes to apply it; push
+the patch with `tools/ota_upload.py --base old.bin new.bin`.
+"""
+
+import argparse
+import hashlib
+import struct
+import sys
+import time
+import zlib
+
+PATCH_MAGIC = 0x544C444A  # 'JDLT'
+PATCH_VERSION = 1
+PATCH_HEADER = struct.Struct("<IHHII32s32s")
+CONTROL = struct.Struct("<IIi")
+
+# esp_app_desc_t follows the 24-byte image header and the first 8-byte
+# segment header; app_elf_sha256 sits 144 bytes into it.
+APP_ELF_SHA256_OFFSET = 24 + 8 + 144
+
+SEED_BYTES = 16  # Length of the exact match that starts a copy
+SEED_STEP = 4  # OLD is indexed at every SEED_STEP-th offset
+MIN_MATCH = 32  # Shorter exact matches are cheaper as literals
+MAX_BRIDGE = 64  # Longest run of changed bytes kept inside one record
+
+
+def app_elf_sha256(image):
+    if len(image) < APP_ELF_SHA256_OFFSET + 32 or image[0] != 0xE9:
+        raise ValueError("not an ESP app image")
+    return image[APP_ELF_SHA256_OFFSET : APP_ELF_SHA256_OFFSET + 32]
+
+
+def common_prefix(a, a_pos, b, b_pos, limit):
+    """Length of the common prefix of a[a_pos:] and b[b_pos:], up to limit."""
+    length = 0
+    block = 64
+    while length + block <= limit and a[a_pos + length : a_pos + length + block] == b[b_pos + length : b_pos + length + block]:
+        length += block
+    while length < limit and a[a_pos + length] == b[b_pos + length]:
+        length += 1
+    return length
+
+
+def approximate_forward(old, old_pos, new, new_pos, limit):
+    """Longest extension whose bytes mostly match (bsdiff's 2*matches - length)."""
+    best = score = matches = 0
+    for i in range(limit):
+        if old[old_pos + i] == new[new_pos + i]:
+            matches += 1
+        if 2 * matches - (i + 1) > score:
+            score = 2 * matches - (i + 1)
+            best = i + 1
+    return best
+
+
+def approximate_backward(old, old_pos, new, new_pos, limit):
+    best = score = matches = 0
+    for i in range(1, limit + 1):
+        if old[old_pos - i] == new[new_pos - i]:
+            matches += 1
+        if 2 * matches - i > score:
+            score = 2 * matches - i
+            best = i
+    return best
+
+
+def find_matches(old, new):
+    """Exact matches (new_start, old_start, length) in NEW order, non-overlapping in NEW."""
+    index = {}
+    for j in range(0, len(old) - SEED_BYTES + 1, SEED_STEP):
+        index.setdefault(old[j : j + SEED_BYTES], j)
+
+    matches = []
+    new_end = 0
+    expected_old = 0
+    i = 0
+    while i <= len(new) - SEED_BYTES:
+        # Code that only moved keeps matching where the previous copy left
+        # off; try that before the index.
+        candidates = []
+        if expected_old + SEED_BYTES <= len(old) and old[expected_old : expected_old + SEED_BYTES] == new[i : i + SEED_BYTES]:
+            candidates.append(expected_old)
+        seeded = index.get(new[i : i + SEED_BYTES])
+        if seeded is not None:
+            candidates.append(seeded)
+        if not candidates:
+            i += 1
+            expected_old += 1
+            continue
+
+        best = None
+        for j in candidates:
+            back = 0
+            while i - back > new_end and j - back > 0 and new[i - back - 1] == old[j - back - 1]:
+                back += 1
+            length = back + common_prefix(new, i, old, j, min(len(new) - i, len(old) - j))
+            if best is None or length > best[2]:
+                best = (i - back, j - back, length)
+
+        if best[2] < MIN_MATCH:
+            i += 1
+            expected_old += 1
+            continue
+
+        matches.append(best)
+        new_end = best[0] + best[2]
+        expected_old = best[1] + best[2]
+        i = new_end
+    return matches
+
+
+def build_controls(old, new, matches):
+    """Widens exact matches into approximate ones and emits control records."""
+    spans = []
+    for k, (new_start, old_start, length) in enumerate(matches):
+        gap_start = spans[-1][0] + spans[-1][2] if spans else 0
+        # Reach back into the literal gap left before this match.
+        back = approximate_backward(old, old_start, new, new_start, min(new_start - gap_start, old_start))
+        new_start -= back
+        old_start -= back
+        length += back
+        # And forward towards the next one.
+        next_start = matches[k + 1][0] if k + 1 < len(matches) else len(new)
+        limit = min(next_start - (new_start + length), len(old) - (old_start + length))
+        length += approximate_forward(old, old_start + length, new, new_start + length, limit)
+        gap = new_start - gap_start
+        if spans and gap <= MAX_BRIDGE and old_start - (spans[-1][1] + spans[-1][2]) == gap:
+            # Same displacement as the previous span with only a few changed
+            # bytes in between (typically a relocated address): one record
+            # covers both, the changed bytes going in as differences.
+            spans[-1] = (spans[-1][0], spans[-1][1], spans[-1][2] + gap + length)
+        else:
+            spans.append((new_start, old_start, length))
+
+    controls = []
+    new_pos = old_pos = 0
+    for new_start, old_start, length in spans:
+        # The literal gap before this span and the seek to its start in OLD
+        # finish the previous record.
+        extra = new_start - new_pos
+        seek = old_start - old_pos
+        if controls:
+            controls[-1] = (controls[-1][0], extra, seek)
+        elif extra or seek:
+            controls.append((0, extra, seek))
+        controls.append((length, 0, 0))
+        new_pos = new_start + length
+        old_pos = old_start + length
+
+    tail = len(new) - new_pos
+    if controls:
+        controls[-1] = (controls[-1][0], tail, 0)
+    else:
+        controls.append((0, tail, 0))
+    return controls
+
+
+def make_patch(old, new):
+    matches = find_matches(old, new)
+    controls = build_controls(old, new, matches)
+
+    stream = bytearray()
+    new_pos = old_pos = 0
+    for diff_length, extra_length, seek in controls:
+        stream += CONTROL.pack(diff_length, extra_length, seek)
+        stream += bytes((new[new_pos + i] - old[old_pos + i]) & 0xFF for i in range(diff_length))
+        new_pos += diff_length
+        old_pos += diff_length
+        stream += new[new_pos : new_pos + extra_length]
+        new_pos += extra_length
+        old_pos += seek
+
+    compressor = zlib.compressobj(9, zlib.DEFLATED, -15)
+    body = compressor.compress(bytes(stream)) + compressor.flush()
+    header = PATCH_HEADER.pack(
+        PATCH_MAGIC,
+        PATCH_VERSION,
+        0,
+        len(old),
+        len(new),
+        app_elf_sha256(old),
+        hashlib.sha256(new).digest(),
+    )
+    return header + body, len(controls)
+
+
+def apply_patch(old, patch):
+    magic, version, _, old_size, new_size, base_sha, new_sha = PATCH_HEADER.unpack_from(patch)
+    if magic != PATCH_MAGIC or version != PATCH_VERSION:
+        raise ValueError("not a delta patch")
+    if old_size != len(old) or base_sha != app_elf_sha256(old):
+        raise ValueError("patch was made against a different base image")
+
+    stream = zlib.decompress(patch[PATCH_HEADER.size :], -15)
+    new = bytearray()
+    pos = old_pos = 0
+    while pos < len(stream):
+        diff_length, extra_length, seek = CONTROL.unpack_from(stream, pos)
+        pos += CONTROL.size
+        if old_pos < 0 or old_pos + diff_length > len(old) or len(new) + diff_length + extra_length > new_size:
+            raise ValueError("corrupt patch")
+        new += bytes((stream[pos + i] + old[old_pos + i]) & 0xFF for i in range(diff_length))
+        pos += diff_length
+        old_pos += diff_length
+        new += stream[pos : pos + extra_length]
+        pos += extra_length
+        old_pos += seek
+
+    if len(new) != new_size or hashlib.sha256(new).digest() != new_sha:
+        raise ValueError("patched image does not match")
+    return bytes(new)
+
+
+def cmd_diff(args):
+    old = open(args.old, "rb").read()
+    new = open(args.new, "rb").read()
+
+    start = time.perf_counter()
+    patch, records = make_patch(old, new)
+    diff_seconds = time.perf_counter() - start
+
+    start = time.perf_counter()
+    apply_patch(old, patch)
+    apply_seconds = time.perf_counter() - start
+
+    with open(args.out, "wb") as f:
+        f.write(patch)
+
+    print(f"old        {len(old)} bytes")
+    print(f"new        {len(new)} bytes, sha256 {hashlib.sha256(new).hexdigest()}")
+    print(f"patch      {len(patch)} bytes ({100.0 * len(patch) / len(new):.1f}% of new), {records} records")
+    print(f"diff       {diff_seconds:.1f} s, host apply {apply_seconds:.2f} s")
+    return 0
+
+
+def cmd_apply(args):
+    old = open(args.old, "rb").read()
+    patch = open(args.patch, "rb").read()
+    new = apply_patch(old, patch)
+    with open(args.out, "wb") as f:
+        f.write(new)
+    print(f"wrote {len(new)} bytes to {args.out}")
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    diff = commands.add_parser("diff", help="create a patch from OLD to NEW")
+    diff.add_argument("old")
+    diff.add_argument("new")
+    diff.add_argument("--out", required=True)
+    diff.set_defaults(run=cmd_diff)
+
+    apply = commands.add_parser("apply", help="rebuild NEW from OLD and a patch")
+    apply.add_argument("old")
+    apply.add_argument("patch")
+    apply.add_argument("--out", required=True)
+    apply.set_defaults(run=cmd_apply)
+
+    args = parser.parse_args()
+    try:
+        return args.run(args)
+    except ValueError as exc:
+        print(f"error: {exc}", file=sys.stderr)
+        return 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+"""Uploads a firmware image to /api/ota and reports how long it took.
+
+Sends the app image (build/jarvis_main.bin) with its SHA-256 in the
+X-Image-SHA256 header, then prints the client-side wall time next to the
+device's own figures (bytes, total and flash-write time, KiB/s).
+
+With --base, the image the device is currently running, only a delta
+patch (see tools/ota_delta.py) is sent to /api/ota/delta and the device
+rebuilds the new image from its running one.
+
+Usage:
+    tools/ota_upload.py [--host 192.168.4.1] [--base old.bin] [build/jarvis_main.bin]
+"""
+
+import argparse
+import hashlib
+import http.client
+import json
+import sys
+import time
+
+import ota_delta
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("image", nargs="?", default="build/jarvis_main.bin")
+    parser.add_argument("--host", default="192.168.4.1")
+    parser.add_argument("--base", help="image running on the device; sends a delta patch against it")
+    parser.add_argument("--timeout", type=float, default=120.0)
+    args = parser.parse_args()
+
+    with open(args.image, "rb") as f:
+        image = f.read()
+    digest = hashlib.sha256(image).hexdigest()
+
+    path = "/api/ota"
+    payload = image
+    if args.base:
+        with open(args.base, "rb") as f:
+            payload, _ = ota_delta.make_patch(f.read(), image)
+        path = "/api/ota/delta"
+
+    conn = http.client.HTTPConnection(args.host, timeout=args.timeout)
+    start = time.perf_counter()
+    conn.request(
+        "POST",
+        path,
+        body=payload,
+        headers={"Content-Type": "application/octet-stream", "X-Image-SHA256": digest},
+    )
+    response = conn.getresponse()
+    body = response.read()
+    elapsed = time.perf_counter() - start
+
+    if response.status != 200:
+        print(f"upload failed: HTTP {response.status} {body.decode(errors='replace')}", file=sys.stderr)
+        return 1
+
+    result = json.loads(body)
+    print(f"image      {len(image)} bytes, sha256 {digest}")
+    if args.base:
+        print(f"patch      {len(payload)} bytes ({100.0 * len(payload) / len(image):.1f}% of image)")
+    print(f"client     {elapsed * 1000:.0f} ms ({len(payload) / 1024 / elapsed:.1f} KiB/s sent)")
+    print(
+        f"device     {result['elapsedMs']} ms ({result['kibPerSecond']:.1f} KiB/s), "
+        f"{result['writeMs']} ms in flash writes"
+    )
+    if result["sha256"] != digest:
+        print("warning: device digest differs from the local image", file=sys.stderr)
+        return 1
+    print("device reboots into the new image; it is kept once the HTTP server comes back up")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
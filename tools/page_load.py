@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+"""Measures what loading the web UI costs over the SoftAP.
+
+Fetches the index page and every script, stylesheet and icon it references,
+first cold and then again the way a browser would on a reload: sending
+If-None-Match for revalidated files and skipping immutable ones entirely.
+
+Usage:
+    tools/page_load.py [--host 192.168.4.1] [--runs 5]
+"""
+
+import argparse
+import gzip
+import http.client
+import re
+import statistics
+import sys
+import time
+
+LINK_RE = re.compile(r'(?:src|href)="\.?(/?[^"]+\.(?:js|css|svg|png|ico))"')
+
+
+def fetch(conn, path, etag=None):
+    headers = {"Accept-Encoding": "gzip"}
+    if etag:
+        headers["If-None-Match"] = etag
+    conn.request("GET", path, headers=headers)
+    response = conn.getresponse()
+    body = response.read()
+    return response.status, response.getheaders(), body
+
+
+def header(headers, name):
+    for key, value in headers:
+        if key.lower() == name:
+            return value
+    return None
+
+
+def links(headers, body):
+    if header(headers, "content-encoding") == "gzip":
+        body = gzip.decompress(body)
+    return ["/" + link.lstrip("/") for link in LINK_RE.findall(body.decode("utf-8", "replace"))]
+
+
+def load(host, cache):
+    """One page load; `cache` maps path -> (etag, immutable) and is updated."""
+    conn = http.client.HTTPConnection(host, timeout=10)
+    total_bytes = 0
+    requests = 0
+    start = time.perf_counter()
+
+    queue = ["/"]
+    seen = set()
+    while queue:
+        path = queue.pop(0)
+        if path in seen:
+            continue
+        seen.add(path)
+
+        etag, immutable = cache.get(path, (None, False))
+        if immutable:
+            continue
+
+        status, headers, body = fetch(conn, path, etag)
+        requests += 1
+        total_bytes += len(body)
+        if status == 200:
+            control = header(headers, "cache-control") or ""
+            cache[path] = (header(headers, "etag"), "immutable" in control)
+        elif status != 304:
+            print("warning: %s -> %d" % (path, status), file=sys.stderr)
+
+        if path == "/" and status == 200:
+            queue.extend(links(headers, body))
+        elif path == "/" and status == 304:
+            # Unchanged page, so it references the same files as last time.
+            queue.extend(p for p in cache if p != "/")
+
+    conn.close()
+    return requests, total_bytes, (time.perf_counter() - start) * 1000.0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--host", default="192.168.4.1")
+    parser.add_argument("--runs", type=int, default=5)
+    args = parser.parse_args()
+
+    for label, warm in (("cold", False), ("warm", True)):
+        timings = []
+        for _ in range(args.runs):
+            cache = {}
+            if warm:
+                load(args.host, cache)
+            requests, total_bytes, elapsed = load(args.host, cache)
+            timings.append(elapsed)
+        print(
+            "%s: %d request(s), %d body bytes, median %.0f ms (min %.0f, max %.0f)"
+            % (label, requests, total_bytes, statistics.median(timings), min(timings), max(timings))
+        )
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+"""Runs the on-device motor controller simulator and reports throughput.
+
+Starts a run on /api/sim (firmware built with CONFIG_JARVIS_SIMULATOR),
+polls it until it finishes and prints sustained frames/s with handler and
+end-to-end latency percentiles. `--status-clients` adds threads polling
+/api/status during the run so decode and the HTTP server are loaded
+together; their response times are reported as well.
+
+Usage:
+    tools/sim_load.py [--host 192.168.4.1] [--profile sprint] [--rate 10]
+                      [--drop 0.01] [--corrupt 0.005] [--seconds 30]
+"""
+
+import argparse
+import http.client
+import json
+import sys
+import threading
+import time
+import urllib.parse
+
+
+def request(host, method, path):
+    conn = http.client.HTTPConnection(host, timeout=10)
+    conn.request(method, path)
+    response = conn.getresponse()
+    body = response.read()
+    if response.status != 200:
+        raise RuntimeError(f"{method} {path}: HTTP {response.status} {body.decode(errors='replace')}")
+    return json.loads(body)
+
+
+def poll_status(host, stop, latencies):
+    conn = http.client.HTTPConnection(host, timeout=10)
+    while not stop.is_set():
+        start = time.perf_counter()
+        try:
+            conn.request("GET", "/api/status")
+            conn.getresponse().read()
+            latencies.append((time.perf_counter() - start) * 1000.0)
+        except (OSError, http.client.HTTPException):
+            conn.close()
+            conn = http.client.HTTPConnection(host, timeout=10)
+
+
+def percentile(values, fraction):
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(round(fraction * (len(ordered) - 1))))]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--host", default="192.168.4.1")
+    parser.add_argument("--profile", default="commute", choices=["idle", "commute", "hill", "sprint"])
+    parser.add_argument("--rate", type=float, default=1.0, help="playback speed, 1-10x the controller's frame rate")
+    parser.add_argument("--noise", type=float, default=0.01)
+    parser.add_argument("--drop", type=float, default=0.0)
+    parser.add_argument("--corrupt", type=float, default=0.0)
+    parser.add_argument("--seconds", type=float, default=30.0)
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--status-clients", type=int, default=0)
+    args = parser.parse_args()
+
+    query = urllib.parse.urlencode(
+        {
+            "profile": args.profile,
+            "rate": args.rate,
+            "noise": args.noise,
+            "drop": args.drop,
+            "corrupt": args.corrupt,
+            "seconds": args.seconds,
+            "seed": args.seed,
+        }
+    )
+
+    stop = threading.Event()
+    latencies = []
+    clients = [
+        threading.Thread(target=poll_status, args=(args.host, stop, latencies), daemon=True)
+        for _ in range(args.status_clients)
+    ]
+
+    try:
+        stats = request(args.host, "POST", f"/api/sim?{query}")
+        for client in clients:
+            client.start()
+        while stats["running"]:
+            time.sleep(1.0)
+            stats = request(args.host, "GET", "/api/sim")
+            frames = stats["frames"]
+            print(
+                f"\r{stats['elapsedMs'] / 1000:6.1f} s  {frames['delivered']:8d} frames  "
+                f"{frames['perSecond']:7.1f} frames/s  {stats['ride']['speedKph']:5.1f} km/h",
+                end="",
+                flush=True,
+            )
+        print()
+    except KeyboardInterrupt:
+        stats = request(args.host, "DELETE", "/api/sim")
+    except (OSError, RuntimeError) as err:
+        print(f"simulation failed: {err}", file=sys.stderr)
+        return 1
+    finally:
+        stop.set()
+
+    frames = stats["frames"]
+    # The simulator plays 100 frames/s at 1x; dropped frames are never delivered.
+    target = 100.0 * stats["rate"] * (1.0 - args.drop)
+    print(f"profile    {stats['profile']} at {stats['rate']:.1f}x for {stats['elapsedMs'] / 1000:.1f} s")
+    print(
+        f"frames     {frames['delivered']} delivered, {frames['dropped']} dropped, "
+        f"{frames['corrupted']} corrupted (of {frames['generated']})"
+    )
+    print(f"throughput {frames['perSecond']:.1f} frames/s sustained (target {target:.0f}), max backlog {frames['maxBacklog']}")
+    for name, key in (("handler", "handlerUs"), ("end-to-end", "endToEndUs")):
+        latency = stats[key]
+        print(f"{name:<10} p50 {latency['p50']} us  p99 {latency['p99']} us  max {latency['max']} us")
+    if latencies:
+        print(
+            f"/api/status {len(latencies)} requests  p50 {percentile(latencies, 0.5):.1f} ms  "
+            f"p99 {percentile(latencies, 0.99):.1f} ms"
+        )
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+"""Measures /api/status latency while other clients pull bulk data.
+
+Polls /api/status on its own connection, first on an idle server and then
+while `--bulk` client threads repeatedly download `--bulk-path` (ignoring
+caches), and prints latency percentiles for both runs.
+
+Usage:
+    tools/status_latency.py [--host 192.168.4.1] [--bulk-path /assets/index-XXXX.css]
+"""
+
+import argparse
+import http.client
+import statistics
+import sys
+import threading
+import time
+
+
+def percentile(values, fraction):
+    ordered = sorted(values)
+    index = min(len(ordered) - 1, int(round(fraction * (len(ordered) - 1))))
+    return ordered[index]
+
+
+def poll_status(host, samples, interval):
+    latencies = []
+    failures = 0
+    conn = http.client.HTTPConnection(host, timeout=10)
+    for _ in range(samples):
+        start = time.perf_counter()
+        try:
+            conn.request("GET", "/api/status")
+            response = conn.getresponse()
+            response.read()
+            if response.status != 200:
+                failures += 1
+            latencies.append((time.perf_counter() - start) * 1000.0)
+        except (OSError, http.client.HTTPException):
+            failures += 1
+            conn.close()
+            conn = http.client.HTTPConnection(host, timeout=10)
+        time.sleep(interval)
+    conn.close()
+    return latencies, failures
+
+
+def bulk_loop(host, path, stop, counters):
+    while not stop.is_set():
+        conn = http.client.HTTPConnection(host, timeout=30)
+        try:
+            conn.request("GET", path, headers={"Cache-Control": "no-cache"})
+            response = conn.getresponse()
+            body = response.read()
+            counters["bytes"] += len(body)
+            counters["busy" if response.status == 503 else "ok"] += 1
+        except (OSError, http.client.HTTPException):
+            counters["errors"] += 1
+        finally:
+            conn.close()
+
+
+def report(label, latencies, failures):
+    if not latencies:
+        print("%s: no successful samples (%d failures)" % (label, failures))
+        return
+    print(
+        "%s: n=%d p50=%.1f ms p90=%.1f ms p99=%.1f ms max=%.1f ms failures=%d"
+        % (
+            label,
+            len(latencies),
+            statistics.median(latencies),
+            percentile(latencies, 0.90),
+            percentile(latencies, 0.99),
+            max(latencies),
+            failures,
+        )
+    )
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--host", default="192.168.4.1")
+    parser.add_argument("--bulk-path", default="/", help="large resource to download repeatedly")
+    parser.add_argument("--bulk", type=int, default=2, help="concurrent bulk download clients")
+    parser.add_argument("--samples", type=int, default=200)
+    parser.add_argument("--interval", type=float, default=0.05, help="seconds between status polls")
+    args = parser.parse_args()
+
+    report("idle", *poll_status(args.host, args.samples, args.interval))
+
+    stop = threading.Event()
+    counters = {"bytes": 0, "ok": 0, "busy": 0, "errors": 0}
+    threads = [
+        threading.Thread(target=bulk_loop, args=(args.host, args.bulk_path, stop, counters), daemon=True)
+        for _ in range(args.bulk)
+    ]
+    for thread in threads:
+        thread.start()
+    started = time.perf_counter()
+    try:
+        report("under load", *poll_status(args.host, args.samples, args.interval))
+    finally:
+        stop.set()
+        for thread in threads:
+            thread.join()
+
+    elapsed = time.perf_counter() - started
+    print(
+        "bulk: %d ok, %d busy (503), %d errors, %.1f KiB/s"
+        % (counters["ok"], counters["busy"], counters["errors"], counters["bytes"] / 1024.0 / elapsed)
+    )
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
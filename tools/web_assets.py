@@ -0,0 +1,212 @@
+#!/usr/bin/env python3
+"""Packs the built web UI (web/dist) for the firmware.
+
+Every file is gzip-compressed when that makes it smaller and given a
+content ETag. The result is written either as
+
+  bundle  a binary image for the `webui` flash partition, which the
+          firmware memory-maps and serves from (see
+          main/services/web/asset_store.hh for the format), or
+  header  a C++ table sorted by URL path, compiled into the app when
+          CONFIG_JARVIS_WEBUI_EMBEDDED is enabled.
+
+Usage:
+    tools/web_assets.py bundle --dist web/dist --out build/webui.bin
+    tools/web_assets.py header --dist web/dist --out main/include/web_assets.h
+
+Flash a new bundle without rebuilding the app:
+    parttool.py write_partition --partition-name webui --input build/webui.bin
+"""
+
+import argparse
+import gzip
+import hashlib
+import mimetypes
+import struct
+import sys
+import zlib
+from pathlib import Path
+
+MIME_TYPES = {
+    ".html": "text/html",
+    ".js": "text/javascript",
+    ".mjs": "text/javascript",
+    ".css": "text/css",
+    ".svg": "image/svg+xml",
+    ".png": "image/png",
+    ".ico": "image/x-icon",
+    ".json": "application/json",
+    ".woff2": "font/woff2",
+    ".txt": "text/plain",
+}
+
+# Only keep the gzip variant when it saves at least this fraction.
+MIN_GZIP_SAVING = 0.1
+
+# Vite emits content-hashed file names under /assets/; they never change
+# for a given URL and may be cached forever.
+IMMUTABLE_PREFIX = "/assets/"
+
+BUNDLE_MAGIC = 0x4955574A  # 'JWUI'
+BUNDLE_VERSION = 1
+BUNDLE_HEADER = struct.Struct("<IHHII")
+BUNDLE_ENTRY = struct.Struct("<IIIIIII")
+FLAG_GZIP = 1 << 0
+FLAG_IMMUTABLE = 1 << 1
+
+
+class Asset:
+    def __init__(self, path, mime, data, gzipped):
+        self.path = path
+        self.mime = mime
+        self.data = data
+        self.gzipped = gzipped
+        self.etag = '"%s"' % hashlib.sha256(data).hexdigest()[:16]
+        self.immutable = path.startswith(IMMUTABLE_PREFIX)
+
+
+def collect(dist):
+    assets = []
+    for file in sorted(dist.rglob("*")):
+        if not file.is_file() or file.suffix == ".gz":
+            continue
+        raw = file.read_bytes()
+        packed = gzip.compress(raw, compresslevel=9, mtime=0)
+        gzipped = len(packed) <= len(raw) * (1.0 - MIN_GZIP_SAVING)
+        path = "/" + file.relative_to(dist).as_posix()
+        mime = MIME_TYPES.get(file.suffix) or mimetypes.guess_type(file.name)[0] or "application/octet-stream"
+        assets.append(Asset(path, mime, packed if gzipped else raw, gzipped))
+    # The firmware binary-searches with strcmp, i.e. byte order.
+    assets.sort(key=lambda a: a.path.encode())
+    return assets
+
+
+def write_header(assets, out):
+    lines = [
+        "// Generated by tools/web_assets.py from web/dist. Do not edit.",
+        "#pragma once",
+        "",
+        "#include <cstddef>",
+        "#include <cstdint>",
+        "",
+        '#include "services/web/asset_store.hh"',
+        "",
+    ]
+    for index, asset in enumerate(assets):
+        lines.append("// %s (%d bytes%s)" % (asset.path, len(asset.data), ", gzip" if asset.gzipped else ""))
+        lines.append("static const uint8_t kWebAssetData%d[] = {" % index)
+        for offset in range(0, len(asset.data), 24):
+            chunk = asset.data[offset : offset + 24]
+            lines.append("    " + ",".join("0x%02x" % b for b in chunk) + ",")
+        lines.append("};")
+        lines.append("")
+
+    lines.append("/// Sorted by path for binary search.")
+    lines.append("static const WebAsset kWebAssets[] = {")
+    for index, asset in enumerate(assets):
+        lines.append(
+            '    {"%s", "%s", "%s", kWebAssetData%d, sizeof(kWebAssetData%d), %s, %s},'
+            % (
+                asset.path,
+                asset.mime,
+                asset.etag.replace('"', '\\"'),
+                index,
+                index,
+                "true" if asset.gzipped else "false",
+                "true" if asset.immutable else "false",
+            )
+        )
+    lines.append("};")
+    lines.append("")
+    lines.append("static constexpr std::size_t kWebAssetCount = sizeof(kWebAssets) / sizeof(kWebAssets[0]);")
+    lines.append("")
+    out.write_text("\n".join(lines))
+
+
+def fnv1a(data):
+    value = 2166136261
+    for byte in data:
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def write_bundle(assets, out):
+    # The server looks paths up by hash, the index is sorted accordingly.
+    ordered = sorted(assets, key=lambda a: (fnv1a(a.path.encode()), a.path))
+
+    strings = bytearray()
+    string_offsets = {}
+
+    def intern(text):
+        if text not in string_offsets:
+            string_offsets[text] = len(strings)
+            strings.extend(text.encode() + b"\0")
+        return string_offsets[text]
+
+    refs = [(intern(a.path), intern(a.mime), intern(a.etag)) for a in ordered]
+
+    strings_start = BUNDLE_HEADER.size + BUNDLE_ENTRY.size * len(ordered)
+    data_start = (strings_start + len(strings) + 3) & ~3
+
+    entries = bytearray()
+    data = bytearray()
+    for asset, (path, mime, etag) in zip(ordered, refs):
+        flags = (FLAG_GZIP if asset.gzipped else 0) | (FLAG_IMMUTABLE if asset.immutable else 0)
+        entries += BUNDLE_ENTRY.pack(
+            fnv1a(asset.path.encode()),
+            strings_start + path,
+            strings_start + mime,
+            strings_start + etag,
+            data_start + len(data),
+            len(asset.data),
+            flags,
+        )
+        data += asset.data
+        data += b"\0" * (-len(data) % 4)
+
+    body = bytes(entries) + bytes(strings) + b"\0" * (data_start - strings_start - len(strings)) + bytes(data)
+    image_size = BUNDLE_HEADER.size + len(body)
+    header = BUNDLE_HEADER.pack(BUNDLE_MAGIC, BUNDLE_VERSION, len(ordered), image_size, zlib.crc32(body))
+    out.parent.mkdir(parents=True, exist_ok=True)
+    out.write_bytes(header + body)
+
+
+def summary(assets):
+    total = sum(len(a.data) for a in assets)
+    for asset in assets:
+        print("  %-40s %8d B %s%s" % (asset.path, len(asset.data), asset.mime, " (gzip)" if asset.gzipped else ""))
+    print("%d assets, %d bytes" % (len(assets), total))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    for name, help_text in (
+        ("bundle", "emit a partition image"),
+        ("header", "emit a C++ header with the asset table"),
+    ):
+        command = sub.add_parser(name, help=help_text)
+        command.add_argument("--dist", type=Path, required=True)
+        command.add_argument("--out", type=Path, required=True)
+
+    args = parser.parse_args()
+    if not args.dist.is_dir():
+        print("error: %s is not a directory" % args.dist, file=sys.stderr)
+        return 1
+
+    assets = collect(args.dist)
+    if not any(a.path == "/index.html" for a in assets):
+        print("error: %s has no index.html" % args.dist, file=sys.stderr)
+        return 1
+
+    if args.command == "bundle":
+        write_bundle(assets, args.out)
+    else:
+        write_header(assets, args.out)
+    summary(assets)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())